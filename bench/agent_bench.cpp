@@ -0,0 +1,206 @@
+/**
+ * ══════════════════════════════════════════════════════════════════════════
+ *                    🖤🛣️ AGENT STATUS BENCHMARK 🛣️🖤
+ * ══════════════════════════════════════════════════════════════════════════
+ *
+ * Applies snapshots and diffs to the 2-bit agent status table for 16k
+ * agents and times aggregation, checking counts against a byte-per-agent
+ * reference model.
+ *
+ *   make -C bench run
+ */
+
+#include "agent_status.h"
+#include "histogram.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#define AGENTS      15892
+#define ITERATIONS  2000
+#define GROUPS      8
+
+static uint32_t rng = 0x9E3779B9;
+
+static uint32_t nextRandom() {
+  rng ^= rng << 13;
+  rng ^= rng >> 17;
+  rng ^= rng << 5;
+  return rng;
+}
+
+static uint64_t nowNs() {
+  using namespace std::chrono;
+  return duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count();
+}
+
+static void putVarint(std::vector<uint8_t>& out, uint32_t v) {
+  do {
+    uint8_t byte = v & 0x7F;
+    v >>= 7;
+    out.push_back(v ? (byte | 0x80) : byte);
+  } while (v);
+}
+
+static std::vector<uint8_t> header(uint8_t encoding, uint32_t seq) {
+  std::vector<uint8_t> msg = { AGENT_MSG_STATUS, encoding };
+  putVarint(msg, seq);
+  putVarint(msg, AGENTS);
+  return msg;
+}
+
+// Run-length encodes the whole reference model
+static std::vector<uint8_t> encodeSnapshot(const std::vector<uint8_t>& model, uint32_t seq) {
+  std::vector<uint8_t> msg = header(2, seq);
+  for (uint32_t i = 0; i < model.size(); ) {
+    uint32_t run = 1;
+    while (i + run < model.size() && model[i + run] == model[i]) run++;
+    putVarint(msg, 0);
+    putVarint(msg, run);
+    msg.push_back(model[i]);
+    i += run;
+  }
+  return msg;
+}
+
+// Flips `changes` random agents and encodes them as a bitmap diff
+static std::vector<uint8_t> encodeBitmap(std::vector<uint8_t>& model, uint32_t seq, uint32_t changes) {
+  std::vector<uint8_t> flagged(model.size(), 0);
+  for (uint32_t c = 0; c < changes; c++) {
+    uint32_t i = nextRandom() % model.size();
+    model[i] = 1 + nextRandom() % 3;
+    flagged[i] = 1;
+  }
+
+  std::vector<uint8_t> msg = header(1, seq);
+  putVarint(msg, 0);
+  putVarint(msg, model.size());
+  std::vector<uint8_t> map((model.size() + 7) / 8, 0);
+  std::vector<uint8_t> states;
+  uint32_t k = 0;
+  for (uint32_t i = 0; i < model.size(); i++) {
+    if (!flagged[i]) continue;
+    map[i / 8] |= 1 << (i % 8);
+    if (k % 4 == 0) states.push_back(0);
+    states.back() |= model[i] << ((k % 4) * 2);
+    k++;
+  }
+  msg.insert(msg.end(), map.begin(), map.end());
+  msg.insert(msg.end(), states.begin(), states.end());
+  return msg;
+}
+
+// A whole range going down or coming back, the typical RLE diff
+static std::vector<uint8_t> encodeOutage(std::vector<uint8_t>& model, uint32_t seq) {
+  uint32_t start = nextRandom() % (model.size() - 1000);
+  uint32_t run = 200 + nextRandom() % 800;
+  uint8_t state = 1 + nextRandom() % 3;
+  for (uint32_t i = start; i < start + run; i++) model[i] = state;
+
+  std::vector<uint8_t> msg = header(0, seq);
+  putVarint(msg, start);
+  putVarint(msg, run);
+  msg.push_back(state);
+  return msg;
+}
+
+static bool check(const AgentStatusTable& table, const std::vector<uint8_t>& model) {
+  uint32_t counts[4] = { 0, 0, 0, 0 };
+  for (uint8_t s : model) counts[s]++;
+  const AgentCounts& t = table.totals();
+  bool ok = t.unknown == counts[0] && t.online == counts[1] && t.degraded == counts[2] && t.offline == counts[3];
+
+  uint32_t groupSize = AGENTS / GROUPS;
+  for (uint8_t g = 0; g < table.groupCount(); g++) {
+    uint32_t online = 0;
+    for (uint32_t i = g * groupSize; i < (g + 1) * groupSize; i++) online += model[i] == 1;
+    ok = ok && table.group(g).counts.online == online;
+  }
+  for (uint32_t i = 0; i < model.size(); i++) ok = ok && table.get(i) == model[i];
+  return ok;
+}
+
+static void report(const char* label, const LogHistogramT<HISTOGRAM_BUCKETS_FULL>& h, size_t bytes) {
+  printf("  %-26s %6u B  p50 %7u ns  p99 %7u ns  max %7u ns\n", label, (unsigned)bytes,
+    (unsigned)h.percentile(500), (unsigned)h.percentile(990), (unsigned)h.maxValue);
+}
+
+int main() {
+  int failures = 0;
+  static AgentStatusTable table;
+  table.clear();
+  for (int g = 0; g < GROUPS; g++) {
+    char name[AGENT_GROUP_NAME];
+    snprintf(name, sizeof(name), "group%d", g);
+    table.addGroup(name, g * (AGENTS / GROUPS), AGENTS / GROUPS);
+  }
+
+  std::vector<uint8_t> model(AGENTS);
+  for (uint8_t& s : model) {
+    uint32_t r = nextRandom() % 100;
+    s = r < 80 ? AGENT_ONLINE : r < 90 ? AGENT_DEGRADED : AGENT_OFFLINE;
+  }
+
+  LogHistogramT<HISTOGRAM_BUCKETS_FULL> snapshot, bitmap, outage, aggregate;
+  snapshot.reset();
+  bitmap.reset();
+  outage.reset();
+  aggregate.reset();
+  size_t snapshotBytes = 0, bitmapBytes = 0, outageBytes = 0;
+  uint32_t seq = 1;
+
+  for (int it = 0; it < ITERATIONS; it++) {
+    std::vector<uint8_t> msg;
+    uint64_t start;
+
+    if (it % 100 == 0) {
+      msg = encodeSnapshot(model, seq);
+      start = nowNs();
+      failures += table.apply(msg.data(), msg.size()) != AGENT_DIFF_OK;
+      snapshot.record(nowNs() - start);
+      snapshotBytes = msg.size();
+    }
+
+    msg = encodeBitmap(model, ++seq, AGENTS / 100);
+    start = nowNs();
+    failures += table.apply(msg.data(), msg.size()) != AGENT_DIFF_OK;
+    bitmap.record(nowNs() - start);
+    bitmapBytes = msg.size();
+
+    msg = encodeOutage(model, ++seq);
+    start = nowNs();
+    failures += table.apply(msg.data(), msg.size()) != AGENT_DIFF_OK;
+    outage.record(nowNs() - start);
+    outageBytes = msg.size();
+
+    start = nowNs();
+    table.aggregate();
+    aggregate.record(nowNs() - start);
+
+    if (it % 250 == 0 && !check(table, model)) {
+      printf("FAIL: table and reference model disagree at iteration %d\n", it);
+      failures++;
+    }
+  }
+
+  // A skipped sequence number must be refused
+  std::vector<uint8_t> gap = encodeBitmap(model, seq + 2, 10);
+  if (table.apply(gap.data(), gap.size()) != AGENT_DIFF_GAP) {
+    printf("FAIL: sequence gap accepted\n");
+    failures++;
+  }
+
+  const AgentCounts& t = table.totals();
+  printf("Agent status, %u agents in %u bytes\n", (unsigned)AGENTS, (unsigned)(AGENT_WORDS * 4));
+  printf("  online %u, degraded %u, offline %u, unknown %u\n",
+    (unsigned)t.online, (unsigned)t.degraded, (unsigned)t.offline, (unsigned)t.unknown);
+  report("snapshot (RLE)", snapshot, snapshotBytes);
+  report("diff, 1% bitmap", bitmap, bitmapBytes);
+  report("diff, outage run (RLE)", outage, outageBytes);
+  report("aggregate + 8 groups", aggregate, 0);
+
+  printf(failures ? "%d checks FAILED\n" : "All checks passed\n", failures);
+  return failures ? 1 : 0;
+}
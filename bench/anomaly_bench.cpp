@@ -0,0 +1,209 @@
+/**
+ * ══════════════════════════════════════════════════════════════════════════
+ *                    🖤🛣️ ANOMALY DETECTOR BENCHMARK 🛣️🖤
+ * ══════════════════════════════════════════════════════════════════════════
+ *
+ * Known-answer checks for each rule with the firmware's configurations:
+ * every rule fires on the first sample past its limit, once per
+ * excursion, not again inside the cooldown, and DEVIATION not before
+ * the warm-up. Then times update() over a day of 1 s CPU samples.
+ *
+ *   make -C bench run
+ */
+
+#include "anomaly.h"
+#include "fmt.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+
+#define DAY_SECONDS 86400
+
+static int failures = 0;
+
+#define CHECK(cond, ...) do {   \
+    if (!(cond)) {              \
+      printf("FAIL: " __VA_ARGS__); \
+      printf("\n");             \
+      failures++;               \
+    }                           \
+  } while (0)
+
+static size_t fmtPercentValue(char* out, size_t size, float value) {
+  size_t n = fmtUint(out, size - 1, value > 0 ? (uint32_t)(value + 0.5f) : 0);
+  out[n++] = '%';
+  out[n] = '\0';
+  return n;
+}
+
+static size_t fmtPlainValue(char* out, size_t size, float value) {
+  return fmtFloat(out, size, value, 0);
+}
+
+// As in main.cpp: name, format, alpha, warmup, zLimit, minSigma, hasHigh,
+// hasLow, high, low, riseLimit, fallLimit, relative, rateWindowMs, cooldownMs
+static const AnomalyConfig CPU = {
+  "CPU", fmtPercentValue, 0.10f, 20, 4.0f, 3.0f, true, false, 95, 0, 0, 0, false, 0, 300000
+};
+static const AnomalyConfig PRICE = {
+  "RoadCoin", fmtPlainValue, 0.05f, 30, 6.0f, 100.0f, false, false, 0, 0, 10.0f, 5.0f, true, 60000, 600000
+};
+static const AnomalyConfig HEAP = {
+  "Free heap", fmtPlainValue, 0.05f, 10, 0, 0, false, true, 0, 24576, 0, 16384, false, 60000, 600000
+};
+
+static uint32_t rng = 0x9E3779B9;
+
+static uint32_t nextRandom() {
+  rng ^= rng << 13;
+  rng ^= rng >> 17;
+  rng ^= rng << 5;
+  return rng;
+}
+
+static uint64_t nowNs() {
+  using namespace std::chrono;
+  return duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count();
+}
+
+// The event of `rule` in that direction among `n`, or null
+static const AnomalyEvent* find(const AnomalyEvent* events, uint8_t n, AnomalyRule rule, int8_t direction) {
+  for (uint8_t i = 0; i < n; i++) {
+    if (events[i].rule == rule && events[i].direction == direction) return &events[i];
+  }
+  return nullptr;
+}
+
+// Feeds `count` samples of `value`, one a second from `ms`; returns how
+// many events `rule` raised among them
+static uint32_t feed(AnomalyDetector& d, float value, uint32_t count, uint32_t& ms, AnomalyRule rule) {
+  AnomalyEvent events[ANOMALY_RULES];
+  uint32_t raised = 0;
+  for (uint32_t i = 0; i < count; i++, ms += 1000) {
+    uint8_t n = d.update(value, ms, events);
+    for (uint8_t k = 0; k < n; k++) raised += events[k].rule == rule;
+  }
+  return raised;
+}
+
+static void checkThreshold() {
+  AnomalyDetector d;
+  d.begin(&CPU);
+  AnomalyEvent events[ANOMALY_RULES];
+  uint32_t ms = 0;
+  CHECK(feed(d, 50, 30, ms, ANOMALY_THRESHOLD) == 0, "threshold fired below the limit");
+
+  // On the first sample over, critical, and only once while it stays over
+  uint8_t n = d.update(97, ms, events);
+  const AnomalyEvent* e = find(events, n, ANOMALY_THRESHOLD, 1);
+  CHECK(e && e->severity == ANOMALY_CRITICAL && e->score == 95, "threshold did not fire on the first sample");
+  char text[64];
+  if (e) anomalyDescribe(text, sizeof(text), CPU, *e);
+  CHECK(e && !strcmp(text, "CPU 97% above 95%"), "described as \"%s\"", e ? text : "");
+  ms += 1000;
+  CHECK(feed(d, 98, 10, ms, ANOMALY_THRESHOLD) == 0, "threshold fired again while still over");
+
+  // Cleared and back inside the cooldown: quiet. After it: fires again
+  feed(d, 50, 1, ms, ANOMALY_THRESHOLD);
+  uint32_t cleared = ms - 1000;
+  ms = cleared + 60000;
+  CHECK(feed(d, 97, 1, ms, ANOMALY_THRESHOLD) == 0, "threshold fired inside the cooldown");
+  feed(d, 50, 1, ms, ANOMALY_THRESHOLD);
+  cleared = ms - 1000;
+  ms = cleared + CPU.cooldownMs - 1;
+  feed(d, 50, 1, ms, ANOMALY_THRESHOLD);
+  ms = cleared + CPU.cooldownMs;
+  CHECK(feed(d, 97, 1, ms, ANOMALY_THRESHOLD) == 1, "threshold quiet after the cooldown");
+  CHECK(d.stats().fired >= 2, "fired count %u", (unsigned)d.stats().fired);
+}
+
+static void checkDeviation() {
+  AnomalyEvent events[ANOMALY_RULES];
+
+  // Inside the warm-up nothing is judged, however far off
+  AnomalyDetector early;
+  early.begin(&CPU);
+  uint32_t ms = 0;
+  feed(early, 50, CPU.warmup - 1, ms, ANOMALY_DEVIATION);
+  CHECK(feed(early, 90, 1, ms, ANOMALY_DEVIATION) == 0, "deviation judged during the warm-up");
+
+  // Flat at 50, so sigma is minSigma (3): 62 is z 4.0, just not over.
+  // Then 66 is past z 4, a warning, on the sample itself
+  AnomalyDetector d;
+  d.begin(&CPU);
+  ms = 0;
+  feed(d, 50, CPU.warmup, ms, ANOMALY_DEVIATION);
+  CHECK(feed(d, 62, 1, ms, ANOMALY_DEVIATION) == 0, "z 4.0 is not over the limit");
+  feed(d, 50, 1, ms, ANOMALY_DEVIATION);
+  uint8_t n = d.update(66, ms, events);
+  const AnomalyEvent* e = find(events, n, ANOMALY_DEVIATION, 1);
+  CHECK(e && e->severity == ANOMALY_WARN && e->score > CPU.zLimit, "spike did not warn on the first sample");
+  ms += 1000;
+
+  // A dip past 2 * zLimit is critical; its direction has its own edge
+  n = d.update(0, ms, events);
+  e = find(events, n, ANOMALY_DEVIATION, -1);
+  CHECK(e && e->severity == ANOMALY_CRITICAL, "deep dip not critical");
+  ms += 1000;
+  CHECK(feed(d, 0, 1, ms, ANOMALY_DEVIATION) == 0, "dip fired twice");
+}
+
+static void checkRate() {
+  AnomalyEvent events[ANOMALY_RULES];
+
+  // RoadCoin, relative: 6% down fires on that sample, as a warning
+  AnomalyDetector price;
+  price.begin(&PRICE);
+  uint32_t ms = 0;
+  CHECK(feed(price, 1000000, 150, ms, ANOMALY_RATE) == 0, "flat price raised a rate alert");
+  CHECK(feed(price, 970000, 1, ms, ANOMALY_RATE) == 0, "a 3 percent fall is under the limit");
+  uint8_t n = price.update(940000, ms, events);
+  const AnomalyEvent* e = find(events, n, ANOMALY_RATE, -1);
+  CHECK(e && e->severity == ANOMALY_WARN && e->score < -5.9f && e->score > -6.1f &&
+        e->spanMs >= PRICE.rateWindowMs && e->spanMs < 2 * PRICE.rateWindowMs,
+        "price fall not caught on the first sample");
+  ms += 1000;
+  CHECK(feed(price, 940000, 20, ms, ANOMALY_RATE) == 0, "price fall fired twice");
+
+  // Free heap, absolute: 20 KB gone is a fall, still above the floor
+  AnomalyDetector heap;
+  heap.begin(&HEAP);
+  ms = 0;
+  feed(heap, 100000, 90, ms, ANOMALY_RATE);
+  n = heap.update(80000, ms, events);
+  CHECK(find(events, n, ANOMALY_RATE, -1) && !find(events, n, ANOMALY_THRESHOLD, -1), "heap loss not caught");
+  ms += 1000;
+  n = heap.update(20000, ms, events);
+  CHECK(find(events, n, ANOMALY_THRESHOLD, -1) && !find(events, n, ANOMALY_RATE, -1),
+    "heap floor not caught, or the ongoing fall fired twice");
+}
+
+int main() {
+  checkThreshold();
+  checkDeviation();
+  checkRate();
+
+  // A day of CPU wandering between 5 and 100%
+  AnomalyDetector d;
+  d.begin(&CPU);
+  AnomalyEvent events[ANOMALY_RULES];
+  float cpu = 40;
+  uint32_t raised = 0;
+  uint64_t t0 = nowNs();
+  for (uint32_t s = 0; s < DAY_SECONDS; s++) {
+    cpu += ((int)(nextRandom() % 21) - 10) * 0.5f;
+    if (cpu < 5) cpu = 5;
+    if (cpu > 100) cpu = 100;
+    raised += d.update(cpu, s * 1000, events);
+  }
+  uint64_t elapsed = nowNs() - t0;
+  CHECK(raised == d.stats().fired, "%u events, %u counted", (unsigned)raised, (unsigned)d.stats().fired);
+
+  printf("Anomaly detector, %u bytes per metric\n", (unsigned)sizeof(AnomalyDetector));
+  printf("  a day of 1 s CPU samples: %u alerts\n", (unsigned)raised);
+  printf("  update()           %7.1f ns/sample\n", (double)elapsed / DAY_SECONDS);
+
+  printf(failures ? "%d checks FAILED\n" : "All checks passed\n", failures);
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,153 @@
+/**
+ * ══════════════════════════════════════════════════════════════════════════
+ *                    🖤🛣️ BENCHMARK HARNESS 🛣️🖤
+ * ══════════════════════════════════════════════════════════════════════════
+ *
+ * Repeatable timing for tiny functions on a noisy host.
+ *
+ *   1. Calibrate: double the batch until one batch takes BENCH_BATCH_NS,
+ *      so clock overhead and resolution vanish into the batch.
+ *   2. Warm up for BENCH_WARMUP_NS (caches, branch predictors, frequency).
+ *   3. Take `reps` samples of one batch each and report the per-call
+ *      median and the median absolute deviation (MAD).
+ *
+ * Median and MAD are used instead of mean and standard deviation because
+ * a single preemption or page fault would drag those along. Results can
+ * be written as JSON (--json) and compared between commits with
+ * tools/bench_compare.py.
+ *
+ *   ./hotpath_bench [--reps N] [--filter text] [--json out.json] [--label rev]
+ */
+
+#ifndef BENCH_H
+#define BENCH_H
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#define BENCH_BATCH_NS   200000ull     // one sample
+#define BENCH_WARMUP_NS  20000000ull   // per benchmark
+#define BENCH_REPS       31
+
+#ifndef BENCH_FLAGS
+#define BENCH_FLAGS ""
+#endif
+
+// Keeps a result alive without storing it anywhere
+template <typename T>
+static inline void benchKeep(const T& value) {
+  asm volatile("" : : "r,m"(value) : "memory");
+}
+
+struct BenchResult {
+  std::string name;
+  double medianNs;
+  double madNs;
+  double minNs;
+  uint64_t batch;
+  uint32_t samples;
+};
+
+class BenchSuite {
+ public:
+  BenchSuite(const char* suite, int argc, char** argv) : suite(suite) {
+    for (int i = 1; i < argc; i++) {
+      bool more = i + 1 < argc;
+      if (!strcmp(argv[i], "--reps") && more) reps = std::max(3, atoi(argv[++i]));
+      else if (!strcmp(argv[i], "--filter") && more) filter = argv[++i];
+      else if (!strcmp(argv[i], "--json") && more) jsonPath = argv[++i];
+      else if (!strcmp(argv[i], "--label") && more) label = argv[++i];
+      else {
+        fprintf(stderr, "usage: %s [--reps N] [--filter text] [--json out.json] [--label rev]\n", argv[0]);
+        exit(2);
+      }
+    }
+    printf("%s, %d samples per benchmark, median ± MAD per call\n", suite, reps);
+  }
+
+  // body(i) performs call number i; the harness picks how many per sample
+  template <typename F>
+  void run(const char* name, F&& body) {
+    if (filter && !strstr(name, filter)) return;
+
+    uint64_t batch = 1;
+    while (timeBatch(body, batch) < BENCH_BATCH_NS && batch < (1ull << 30)) batch *= 2;
+
+    uint64_t warm = 0;
+    while (warm < BENCH_WARMUP_NS) warm += timeBatch(body, batch);
+
+    std::vector<double> perCall(reps);
+    for (int r = 0; r < reps; r++) perCall[r] = (double)timeBatch(body, batch) / batch;
+
+    BenchResult res;
+    res.name = name;
+    res.batch = batch;
+    res.samples = reps;
+    res.minNs = *std::min_element(perCall.begin(), perCall.end());
+    res.medianNs = median(perCall);
+    for (double& v : perCall) v = std::fabs(v - res.medianNs);
+    res.madNs = median(perCall);
+    results.push_back(res);
+
+    printf("  %-32s %10.1f ns ± %6.1f (%4.1f%%)  min %10.1f\n", name, res.medianNs, res.madNs,
+      res.medianNs > 0 ? 100 * res.madNs / res.medianNs : 0.0, res.minNs);
+  }
+
+  // Writes the JSON file if asked; returns false when that failed
+  bool finish() const {
+    if (!jsonPath) return true;
+    FILE* f = fopen(jsonPath, "w");
+    if (!f) {
+      perror(jsonPath);
+      return false;
+    }
+    fprintf(f, "{\n  \"suite\": \"%s\",\n  \"label\": \"%s\",\n  \"compiler\": \"%s\",\n"
+               "  \"flags\": \"%s\",\n  \"results\": [\n", suite, label, __VERSION__, BENCH_FLAGS);
+    for (size_t i = 0; i < results.size(); i++) {
+      const BenchResult& r = results[i];
+      fprintf(f, "    {\"name\": \"%s\", \"median_ns\": %.3f, \"mad_ns\": %.3f, \"min_ns\": %.3f, "
+                 "\"batch\": %llu, \"samples\": %u}%s\n", r.name.c_str(), r.medianNs, r.madNs, r.minNs,
+        (unsigned long long)r.batch, r.samples, i + 1 < results.size() ? "," : "");
+    }
+    fprintf(f, "  ]\n}\n");
+    fclose(f);
+    printf("Results written to %s\n", jsonPath);
+    return true;
+  }
+
+ private:
+  const char* suite;
+  const char* filter = nullptr;
+  const char* jsonPath = nullptr;
+  const char* label = "";
+  int reps = BENCH_REPS;
+  std::vector<BenchResult> results;
+
+  static uint64_t nowNs() {
+    using namespace std::chrono;
+    return duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count();
+  }
+
+  template <typename F>
+  static uint64_t timeBatch(F& body, uint64_t batch) {
+    uint64_t start = nowNs();
+    for (uint64_t i = 0; i < batch; i++) body(i);
+    return nowNs() - start;
+  }
+
+  static double median(std::vector<double> v) {
+    size_t mid = v.size() / 2;
+    std::nth_element(v.begin(), v.begin() + mid, v.end());
+    double m = v[mid];
+    if (v.size() % 2 == 0) m = (m + *std::max_element(v.begin(), v.begin() + mid)) / 2;
+    return m;
+  }
+};
+
+#endif // BENCH_H
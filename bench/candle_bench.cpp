@@ -0,0 +1,215 @@
+/**
+ * ══════════════════════════════════════════════════════════════════════════
+ *                    🖤🛣️ CANDLE AGGREGATION BENCHMARK 🛣️🖤
+ * ══════════════════════════════════════════════════════════════════════════
+ *
+ * Streams a day of bursty RoadCoin ticks through the 'T' frame decoder
+ * into 1m/5m/1h candles, times each frame and checks every candle held
+ * against a straightforward reference aggregation.
+ *
+ *   make -C bench run
+ */
+
+#include "candles.h"
+#include "fmt.h"
+#include "histogram.h"
+
+#include <chrono>
+#include <cstdio>
+#include <map>
+#include <string>
+#include <vector>
+
+#define SECONDS      86400
+#define FRAME_TICKS  256
+
+struct Tick {
+  uint32_t time;
+  Price price;
+  uint32_t volume;
+};
+
+static uint32_t rng = 0x2545F491;
+
+static uint32_t nextRandom() {
+  rng ^= rng << 13;
+  rng ^= rng >> 17;
+  rng ^= rng << 5;
+  return rng;
+}
+
+static uint64_t nowNs() {
+  using namespace std::chrono;
+  return duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count();
+}
+
+static void putVarint(std::vector<uint8_t>& out, uint32_t v) {
+  do {
+    uint8_t byte = v & 0x7F;
+    v >>= 7;
+    out.push_back(v ? (byte | 0x80) : byte);
+  } while (v);
+}
+
+static void putSvarint(std::vector<uint8_t>& out, int32_t v) {
+  putVarint(out, ((uint32_t)v << 1) ^ (uint32_t)(v >> 31));
+}
+
+static std::vector<uint8_t> encode(const std::vector<Tick>& ticks, size_t first, size_t count) {
+  std::vector<uint8_t> msg = { CANDLE_MSG_TICKS };
+  putVarint(msg, count);
+  for (size_t i = first; i < first + count; i++) {
+    if (i == first) {
+      putVarint(msg, ticks[i].time);
+      putSvarint(msg, ticks[i].price);
+    } else {
+      putVarint(msg, ticks[i].time - ticks[i - 1].time);
+      putSvarint(msg, ticks[i].price - ticks[i - 1].price);
+    }
+    putVarint(msg, ticks[i].volume);
+  }
+  return msg;
+}
+
+// Quiet stretches, busy stretches and the odd burst of several hundred
+// ticks in one second; a few ticks arrive a little out of order
+static std::vector<Tick> generate() {
+  std::vector<Tick> ticks;
+  Price price = 420000;
+  uint32_t base = 1700000000;
+  for (uint32_t s = 0; s < SECONDS; s++) {
+    uint32_t r = nextRandom() % 1000;
+    uint32_t n = r < 600 ? 0 : r < 990 ? 1 + nextRandom() % 8 : 200 + nextRandom() % 400;
+    if ((s / 3600) % 7 == 3) n = 0;  // dead hours leave flat candles
+    for (uint32_t k = 0; k < n; k++) {
+      price += (int32_t)(nextRandom() % 401) - 200;
+      if (price < 1000) price = 1000;
+      uint32_t jitter = nextRandom() % 50 == 0 ? nextRandom() % 90 : 0;
+      uint32_t t = base + s - (jitter < s ? jitter : 0);
+      ticks.push_back({ t, price, 1 + nextRandom() % 5000 });
+    }
+  }
+  return ticks;
+}
+
+// Reference: same acceptance rule, one std::map of candles per frame
+static bool check(const CandleAggregator& agg, const std::vector<Tick>& ticks) {
+  static const uint32_t periods[CANDLE_FRAMES] = { 60, 300, 3600 };
+  bool ok = true;
+
+  for (uint8_t f = 0; f < CANDLE_FRAMES; f++) {
+    uint32_t period = periods[f];
+    std::map<uint32_t, Candle> ref;
+    uint32_t newest = 0, minuteStart = 0;
+    bool any = false;
+
+    for (const Tick& t : ticks) {
+      if (any && t.time < minuteStart) continue;
+      bool latest = !any || t.time >= newest;
+      uint32_t start = t.time - t.time % period;
+      auto it = ref.find(start);
+      if (it == ref.end()) it = ref.insert({ start, { start, t.price, t.price, t.price, t.price, 0, 0 } }).first;
+      Candle& c = it->second;
+      if (t.price > c.high) c.high = t.price;
+      if (t.price < c.low) c.low = t.price;
+      if (latest) {
+        c.close = t.price;
+        newest = t.time;
+        minuteStart = t.time - t.time % 60;
+      }
+      c.volume += t.volume;
+      c.ticks++;
+      any = true;
+    }
+
+    // Fill empty buckets with flat candles at the previous close
+    std::vector<Candle> filled;
+    for (auto& kv : ref) {
+      while (!filled.empty() && filled.back().start + period < kv.first) {
+        Price c = filled.back().close;
+        filled.push_back({ filled.back().start + period, c, c, c, c, 0, 0 });
+      }
+      filled.push_back(kv.second);
+    }
+
+    const CandleSeries& s = agg.series((CandleFrame)f);
+    size_t held = s.count();
+    if (held != (filled.size() < CANDLE_HISTORY ? filled.size() : CANDLE_HISTORY)) {
+      printf("FAIL: frame %u holds %u candles\n", f, (unsigned)held);
+      return false;
+    }
+    for (size_t i = 0; i < held; i++) {
+      const Candle& a = s.at(i);
+      const Candle& b = filled[filled.size() - held + i];
+      if (a.start != b.start || a.open != b.open || a.high != b.high || a.low != b.low ||
+          a.close != b.close || a.volume != b.volume || a.ticks != b.ticks) {
+        printf("FAIL: frame %u candle %u differs\n", f, (unsigned)i);
+        ok = false;
+        break;
+      }
+    }
+  }
+  return ok;
+}
+
+int main() {
+  int failures = 0;
+  std::vector<Tick> ticks = generate();
+
+  static CandleAggregator agg;
+  agg.begin();
+
+  LogHistogramT<HISTOGRAM_BUCKETS_FULL> frameNs;
+  frameNs.reset();
+  uint64_t totalNs = 0;
+  size_t bytes = 0;
+
+  for (size_t i = 0; i < ticks.size(); i += FRAME_TICKS) {
+    size_t n = ticks.size() - i < FRAME_TICKS ? ticks.size() - i : FRAME_TICKS;
+    std::vector<uint8_t> msg = encode(ticks, i, n);
+    bytes += msg.size();
+
+    uint8_t opened;
+    uint64_t start = nowNs();
+    int32_t applied = agg.apply(msg.data(), msg.size(), opened);
+    uint64_t elapsed = nowNs() - start;
+    frameNs.record(elapsed);
+    totalNs += elapsed;
+    if (applied != (int32_t)n) {
+      printf("FAIL: frame at tick %u rejected\n", (unsigned)i);
+      failures++;
+    }
+  }
+
+  if (!check(agg, ticks)) failures++;
+
+  // Fixed-point parsing and formatting must round-trip exactly
+  Price p;
+  char buf[FMT_BUF_SIZE];
+  if (!priceParse("0.4213", p) || p != 421300) failures++, printf("FAIL: priceParse\n");
+  if (priceParse("0.1234567", p) || priceParse("1.2.3", p) || priceParse("", p)) failures++, printf("FAIL: priceParse accepted junk\n");
+  fmtPrice(buf, sizeof(buf), 421350, 4);
+  if (std::string(buf) != "0.4214") failures++, printf("FAIL: fmtPrice gave %s\n", buf);
+
+  uint8_t truncated[] = { CANDLE_MSG_TICKS, 3, 0x80 };
+  uint8_t opened;
+  if (agg.apply(truncated, sizeof(truncated), opened) != -1) failures++, printf("FAIL: truncated frame accepted\n");
+
+  char low[FMT_BUF_SIZE], high[FMT_BUF_SIZE], change[FMT_BUF_SIZE];
+  Price lo, hi;
+  agg.range24h(lo, hi);
+  fmtPrice(low, sizeof(low), lo, 4);
+  fmtPrice(high, sizeof(high), hi, 4);
+  fmtFixed(change, sizeof(change), agg.changeBasisPoints(), 2);
+
+  printf("Candles, %u ticks over 24h (%u late, dropped), %.1f bytes/tick\n",
+    (unsigned)agg.tickCount(), (unsigned)agg.lateCount(), (double)bytes / ticks.size());
+  printf("  24h change %s%%, low %s, high %s\n", change, low, high);
+  printf("  per %d-tick frame  p50 %7u ns  p99 %7u ns  max %7u ns\n", FRAME_TICKS,
+    (unsigned)frameNs.percentile(500), (unsigned)frameNs.percentile(990), (unsigned)frameNs.maxValue);
+  printf("  per tick           %7.1f ns  (%.1fM ticks/s)\n",
+    (double)totalNs / ticks.size(), ticks.size() * 1000.0 / totalNs);
+
+  printf(failures ? "%d checks FAILED\n" : "All checks passed\n", failures);
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,131 @@
+/**
+ * ══════════════════════════════════════════════════════════════════════════
+ *                    🖤🛣️ TEXT CLASSIFIER BENCHMARK 🛣️🖤
+ * ══════════════════════════════════════════════════════════════════════════
+ *
+ * Runs the int8 event classifier over its training data and a few
+ * messages it has never seen, checks the labels, and times one
+ * classification. The accuracy on the training data must match what
+ * tools/train_classifier.py printed, since both run the same integer
+ * arithmetic.
+ *
+ *   make -C bench run
+ */
+
+#include "text_classifier.h"
+#include "histogram.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#define DATA "../assets/classifier/events.tsv"
+#define MIN_ACCURACY 0.95
+
+struct Example {
+  TextClass label;
+  std::string text;
+};
+
+// Not in the training data; wording the hub may well see
+static const Example UNSEEN[] = {
+  { TEXT_CRITICAL, "Production database is down" },
+  { TEXT_CRITICAL, "payments service crashed, customers affected" },
+  { TEXT_WARN,     "api latency p99 at 1800 ms" },
+  { TEXT_WARN,     "disk usage 91% on storage-2" },
+  { TEXT_INFO,     "Deploy of roadview succeeded in 42s" },
+  { TEXT_INFO,     "alexa merged pull request #88" },
+};
+
+static uint64_t nowNs() {
+  using namespace std::chrono;
+  return duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count();
+}
+
+static bool parseLabel(const char* name, TextClass& out) {
+  for (uint8_t c = 0; c < TEXT_CLASSES; c++) {
+    if (strcmp(name, textClassName((TextClass)c)) == 0) {
+      out = (TextClass)c;
+      return true;
+    }
+  }
+  return false;
+}
+
+static std::vector<Example> load() {
+  std::vector<Example> rows;
+  FILE* f = fopen(DATA, "r");
+  if (!f) return rows;
+  char line[512];
+  while (fgets(line, sizeof(line), f)) {
+    if (line[0] == '#' || line[0] == '\n') continue;
+    line[strcspn(line, "\r\n")] = '\0';
+    char* tab = strchr(line, '\t');
+    if (!tab) continue;
+    *tab = '\0';
+    Example e;
+    if (parseLabel(line, e.label)) {
+      e.text = tab + 1;
+      rows.push_back(e);
+    }
+  }
+  fclose(f);
+  return rows;
+}
+
+int main() {
+  int failures = 0;
+  std::vector<Example> rows = load();
+  if (rows.empty()) {
+    printf("FAIL: no examples in %s\n", DATA);
+    return 1;
+  }
+
+  LogHistogramT<HISTOGRAM_BUCKETS_FULL> classifyNs;
+  classifyNs.reset();
+  uint32_t correct = 0, confident = 0, features = 0;
+  uint32_t confusion[TEXT_CLASSES][TEXT_CLASSES] = {};
+  for (int pass = 0; pass < 20; pass++) {
+    for (const Example& e : rows) {
+      uint64_t t0 = nowNs();
+      TextVerdict v = classifyText(e.text.c_str());
+      classifyNs.record(nowNs() - t0);
+      if (pass) continue;
+      correct += v.label == e.label;
+      confident += v.confidence >= 70;
+      features += v.features;
+      confusion[e.label][v.label]++;
+    }
+  }
+  double accuracy = (double)correct / rows.size();
+  if (accuracy < MIN_ACCURACY) failures++, printf("FAIL: accuracy %.1f%%\n", accuracy * 100);
+
+  for (const Example& e : UNSEEN) {
+    TextVerdict v = classifyText(e.text.c_str());
+    bool ok = v.label == e.label;
+    printf("  %-9s %3u%%  %s%s\n", textClassName(v.label), v.confidence, e.text.c_str(), ok ? "" : "  (expected other)");
+    if (!ok) failures++;
+  }
+
+  TextVerdict empty = classifyText("!!! ---");
+  if (empty.features || empty.label != TEXT_INFO) failures++, printf("FAIL: text without words\n");
+  std::string longText(1000, 'a');
+  if (classifyText(longText.c_str()).features > CLASSIFIER_TEXT_MAX + 2) failures++, printf("FAIL: long text\n");
+
+  printf("Text classifier, %u examples: %.1f%% correct, %u%% at 70%%+ confidence, %.0f features each\n",
+    (unsigned)rows.size(), accuracy * 100, (unsigned)(confident * 100 / rows.size()), (double)features / rows.size());
+  printf("  confusion (rows true, columns predicted info/warn/critical):\n");
+  for (uint8_t t = 0; t < TEXT_CLASSES; t++) {
+    printf("    %-9s %4u %4u %4u\n", textClassName((TextClass)t),
+      (unsigned)confusion[t][0], (unsigned)confusion[t][1], (unsigned)confusion[t][2]);
+  }
+  printf("  model %u bytes\n", (unsigned)(CLASSIFIER_BUCKETS * CLASSIFIER_EMBED +
+    CLASSIFIER_HIDDEN * (CLASSIFIER_EMBED + 4) + TEXT_CLASSES * (CLASSIFIER_HIDDEN + 4)));
+  printf("  classify           p50 %7u ns  p99 %7u ns  max %7u ns\n",
+    (unsigned)classifyNs.percentile(500), (unsigned)classifyNs.percentile(990), (unsigned)classifyNs.maxValue);
+
+  printf(failures ? "%d checks FAILED\n" : "All checks passed\n", failures);
+  return failures ? 1 : 0;
+}
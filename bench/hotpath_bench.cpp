@@ -0,0 +1,582 @@
+/**
+ * ══════════════════════════════════════════════════════════════════════════
+ *                    🖤🛣️ UPDATE HOT PATH BENCHMARK 🛣️🖤
+ * ══════════════════════════════════════════════════════════════════════════
+ *
+ * Times the platform-independent work done on every metrics update and
+ * redraw: parsing the metrics message, number formatting, mini chart
+ * scaling, decimating a day of 1 s samples to the chart width, the
+ * notification queue, the boot snapshot restored before the first
+ * frame, and rendering the /metrics body for a scrape. Checks each
+ * against known answers first, so a fast wrong result fails the run.
+ * The same calls then run under ALLOC_GUARD_SCOPE, and any heap
+ * allocation inside one fails the run too.
+ *
+ * The parse benchmark needs ArduinoJson, which `pio pkg install` puts in
+ * .pio/libdeps; without it that benchmark is skipped.
+ *
+ *   make -C bench run
+ *   make -C bench json         # hotpath-<git rev>.json
+ *   tools/bench_compare.py bench/hotpath-<old>.json bench/hotpath-<new>.json
+ */
+
+#include "alloc_guard.h"
+#include "bench.h"
+#include "boot_snapshot.h"
+#include "chart.h"
+#include "fmt.h"
+#include "notifications.h"
+#include "prom_export.h"
+
+#ifdef BENCH_ARDUINOJSON
+#include "json_arena.h"
+#include "metrics.h"
+#endif
+
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+static int failures = 0;
+
+#define CHECK(cond, ...) do {   \
+    if (!(cond)) {              \
+      printf("FAIL: " __VA_ARGS__); \
+      printf("\n");             \
+      failures++;               \
+    }                           \
+  } while (0)
+
+static uint32_t rng = 0x2545F491;
+
+static uint32_t nextRandom() {
+  rng ^= rng << 13;
+  rng ^= rng >> 17;
+  rng ^= rng << 5;
+  return rng;
+}
+
+// Values spread over every unit fmtSI / fmtBytes can pick
+static uint32_t values[256];
+
+static void checkFormatting() {
+  char buf[FMT_BUF_SIZE];
+  fmtSI(buf, sizeof(buf), 30247);
+  CHECK(!strcmp(buf, "30.2K"), "fmtSI(30247) gave \"%s\"", buf);
+  fmtSI(buf, sizeof(buf), 1500000);
+  CHECK(!strcmp(buf, "1.5M"), "fmtSI(1500000) gave \"%s\"", buf);
+  fmtBytes(buf, sizeof(buf), 2048);
+  CHECK(!strcmp(buf, "2.0KB"), "fmtBytes(2048) gave \"%s\"", buf);
+  fmtBytes(buf, sizeof(buf), 512);
+  CHECK(!strcmp(buf, "512B"), "fmtBytes(512) gave \"%s\"", buf);
+}
+
+static void checkChart() {
+  const uint8_t data[] = { 20, 60, 100, 20 };
+  int16_t heights[CHART_MAX_BARS];
+  int16_t barWidth;
+  uint16_t bars = chartScale(data, 4, 220, 28, heights, barWidth);
+  CHECK(bars == 4 && barWidth == 55, "chartScale gave %u bars of %d px", bars, barWidth);
+  CHECK(heights[0] == 0 && heights[1] == 12 && heights[2] == 24 && heights[3] == 0,
+    "chartScale heights %d %d %d %d", heights[0], heights[1], heights[2], heights[3]);
+
+  // Flat series and more samples than pixels
+  uint8_t flat[CHART_MAX_BARS + 10];
+  memset(flat, 50, sizeof(flat));
+  bars = chartScale(flat, sizeof(flat), 100, 28, heights, barWidth);
+  CHECK(bars == 100 && barWidth == 1 && heights[99] == 0, "flat chart gave %u bars", bars);
+}
+
+#define DAY_SECONDS 86400
+#define CHART_W     220
+
+// A day of 1 s samples: slow wave plus noise, one spike up and one down
+static int32_t daySample(uint32_t i) {
+  if (i == 50000) return 90000;
+  if (i == 70001) return -90000;
+  return (int32_t)((i % 7200) < 3600 ? (i % 3600) : 3600 - (i % 3600)) + (int32_t)(nextRandom() % 200);
+}
+
+static ChartSeries day;
+
+static void checkDecimation() {
+  // Short series: one bucket per sample, nothing decimated
+  ChartSeries s;
+  s.clear();
+  for (int32_t v : { 5, 9, 1, 7 }) s.push(v);
+  s.merge(12);  // folds into the last sample
+  int32_t lo[CHART_W], hi[CHART_W];
+  uint16_t cols = s.envelope(CHART_W, lo, hi);
+  CHECK(cols == 4 && lo[3] == 7 && hi[3] == 12 && lo[2] == 1, "short envelope wrong");
+
+  // A day of samples keeps both spikes through every merge
+  day.clear();
+  for (uint32_t i = 0; i < DAY_SECONDS; i++) day.push(daySample(i));
+  CHECK(day.samples() == DAY_SECONDS, "sample count %u", (unsigned)day.samples());
+  cols = day.envelope(CHART_W, lo, hi);
+  int32_t top = INT32_MIN, bottom = INT32_MAX;
+  for (uint16_t c = 0; c < cols; c++) {
+    if (hi[c] > top) top = hi[c];
+    if (lo[c] < bottom) bottom = lo[c];
+  }
+  CHECK(cols == CHART_W && top == 90000 && bottom == -90000, "envelope lost a peak: %u cols, %d..%d",
+    cols, (int)bottom, (int)top);
+
+  ChartPoint pts[CHART_W];
+  uint16_t n = day.lttb(pts, CHART_W);
+  bool ordered = true, up = false, down = false;
+  for (uint16_t i = 0; i < n; i++) {
+    if (i && pts[i].x <= pts[i - 1].x) ordered = false;
+    if (pts[i].x == 50000 && pts[i].y == 90000) up = true;
+    if (pts[i].x == 70001 && pts[i].y == -90000) down = true;
+  }
+  // Ends are the extremes of the first and last bucket
+  uint32_t span = day.samplesPerBucket();
+  CHECK(n == CHART_W && ordered && pts[0].x < span && pts[n - 1].x >= DAY_SECONDS - span,
+    "lttb gave %u points, ordered %d, ends %u..%u", n, ordered, (unsigned)pts[0].x, (unsigned)pts[n - 1].x);
+  CHECK(up && down, "lttb lost a spike (up %d, down %d)", up, down);
+
+  // Plain LTTB over an array agrees on a series short enough to check by eye
+  ChartPoint raw[8] = { {0, 0}, {1, 5}, {2, 0}, {3, 0}, {4, -6}, {5, 0}, {6, 1}, {7, 0} };
+  ChartPoint out[4];
+  n = chartLttb([&](uint32_t i) { return raw[i]; }, 8, out, 4);
+  CHECK(n == 4 && out[1].x == 1 && out[2].x == 4 && out[3].x == 7, "lttb picked %u %u", out[1].x, out[2].x);
+
+  // Array envelope for long mini charts keeps its peak column
+  static uint8_t bars[DAY_SECONDS];
+  for (uint32_t i = 0; i < DAY_SECONDS; i++) bars[i] = 20 + i % 50;
+  bars[12345] = 255;
+  int16_t low[CHART_MAX_BARS], high[CHART_MAX_BARS];
+  cols = chartScaleEnvelope(bars, DAY_SECONDS, CHART_W, 28, low, high);
+  int16_t peak = 0;
+  for (uint16_t c = 0; c < cols; c++) if (high[c] > peak) peak = high[c];
+  CHECK(cols == CHART_W - 4 && peak == 24, "bar envelope %u cols, peak %d", cols, peak);
+}
+
+static void checkNotifications() {
+  NotificationQueue q;
+  q.clear();
+  char msg[16];
+  for (uint32_t i = 0; i < NOTIFY_SLOTS; i++) {
+    snprintf(msg, sizeof(msg), "n%u", (unsigned)i);
+    q.add(msg, 0, 1000 + i * NOTIFY_RATE_MS);
+  }
+  q.add("newest", 0, 6000);  // replaces n0, the oldest
+  CHECK(q.active() == NOTIFY_SLOTS && !strcmp(q.slot(0).message, "newest"), "oldest not replaced");
+
+  // n1 (posted at 2000) is the next to go
+  uint32_t next = q.expire(2000 + NOTIFY_MS - 1);
+  CHECK(next == 1 && q.active() == NOTIFY_SLOTS, "expire gave %u", (unsigned)next);
+  uint32_t revision = q.revision();
+  next = q.expire(2000 + NOTIFY_MS);
+  CHECK(q.active() == NOTIFY_SLOTS - 1 && next == NOTIFY_RATE_MS, "expire gave %u, %u left", (unsigned)next, q.active());
+  CHECK(q.revision() != revision, "expiry did not change the revision");
+  CHECK(q.expire(6000 + NOTIFY_MS) == 0 && q.active() == 0, "queue not empty");
+
+  std::string longMsg(300, 'x');
+  q.add(longMsg.c_str(), 0, 0);
+  CHECK(strlen(q.slot(0).message) == NOTIFY_MSG_LEN - 1, "long message not truncated");
+
+  // A repeat refreshes its slot; critical ones survive a flood of info
+  q.clear();
+  q.add("CPU 97% above 95%", 1, 3000, NOTIFY_CRITICAL);
+  q.add("CPU 97% above 95%", 1, 3500, NOTIFY_CRITICAL);
+  CHECK(q.active() == 1 && q.slot(0).timestamp == 3500 && q.slot(0).repeats == 2, "repeat not merged");
+  for (uint32_t i = 0; i < 3 * NOTIFY_SLOTS; i++) {
+    snprintf(msg, sizeof(msg), "info%u", (unsigned)i);
+    q.add(msg, 0, 4000 + i);
+  }
+  uint8_t order[NOTIFY_SLOTS];
+  uint8_t shown = q.ranked(order, 3);
+  CHECK(shown == 3 && q.slot(order[0]).priority == NOTIFY_CRITICAL &&
+        q.slot(order[1]).timestamp > q.slot(order[2]).timestamp, "ranking wrong");
+  for (uint32_t i = 0; i < NOTIFY_SLOTS; i++) q.add(msg, 0, 5000, NOTIFY_CRITICAL), msg[0]++;
+  CHECK(!q.add("late info", 0, 5001), "info displaced a critical alert");
+
+  // The info flood above got NOTIFY_BURST through; one more token a
+  // NOTIFY_RATE_MS later
+  q.clear();
+  NotifyStats before = q.stats();
+  uint8_t accepted = 0;
+  for (uint32_t i = 0; i < NOTIFY_SLOTS; i++) {
+    snprintf(msg, sizeof(msg), "burst%u", (unsigned)i);
+    accepted += q.add(msg, 0, 20000);
+  }
+  CHECK(accepted == NOTIFY_BURST, "%u of a burst let through", accepted);
+  CHECK(!q.add("later", 0, 20000 + NOTIFY_RATE_MS - 1) && q.add("later", 0, 20000 + NOTIFY_RATE_MS),
+    "rate limit refill wrong");
+  CHECK(q.add("burst0", 0, 20000 + NOTIFY_RATE_MS) && q.add("down", 0, 20000 + NOTIFY_RATE_MS, NOTIFY_CRITICAL),
+    "repeat or critical alert limited");
+  CHECK(q.stats().limited - before.limited == NOTIFY_SLOTS - NOTIFY_BURST + 1, "limited count wrong");
+
+  // A flapping link is two toasts with counts, not a full queue
+  q.clear();
+  for (uint32_t i = 0; i < 10; i++) {
+    q.add(i & 1 ? "Server connected" : "Server disconnected", 0, 30000 + i * 100);
+  }
+  shown = q.ranked(order, NOTIFY_SLOTS);
+  CHECK(shown == 2 && q.slot(order[0]).repeats == 5 && q.slot(order[1]).repeats == 5, "flapping not coalesced");
+
+  // A late second opinion lifts a toast in place, but not one gone by
+  q.clear();
+  q.add("billing charged twice", 0, 40000);
+  NotifyStats counted = q.stats();
+  CHECK(q.raise("billing charged twice", 2, 40000 + NOTIFY_MS - 1, NOTIFY_WARN) &&
+        q.slot(0).priority == NOTIFY_WARN && q.slot(0).color == 2 &&
+        q.slot(0).repeats == 1 && q.slot(0).timestamp == 40000, "raise changed more than the priority");
+  CHECK(!q.raise("billing charged twice", 2, 40000 + NOTIFY_MS - 1, NOTIFY_WARN), "raised to the same priority");
+  CHECK(!q.raise("billing charged twice", 3, 40000 + NOTIFY_MS, NOTIFY_CRITICAL) &&
+        q.slot(0).priority == NOTIFY_WARN, "expired toast raised");
+  CHECK(!q.raise("never shown", 2, 40000, NOTIFY_WARN) && q.active() == 1, "raise posted a new toast");
+  CHECK(q.stats().merged == counted.merged && q.stats().limited == counted.limited, "raise counted as a post");
+}
+
+static const BootSnapshot BOOT_SAMPLE = {
+  3, 1, 2, 30247, 15892, 47, 420000, -523, 45, 67, 2048
+};
+
+static void checkBootSnapshot() {
+  uint8_t blob[BOOT_SNAPSHOT_MAX];
+  size_t n = bootSnapshotEncode(BOOT_SAMPLE, blob, sizeof(blob));
+  BootSnapshot s = {};
+  CHECK(n > 0 && n <= 32 && bootSnapshotDecode(blob, n, s), "snapshot %u bytes did not decode", (unsigned)n);
+  CHECK(!memcmp(&s.projects, &BOOT_SAMPLE.projects, sizeof(s) - offsetof(BootSnapshot, projects)) &&
+        s.screen == 3 && s.homeWindow == 1 && s.candleView == 2, "snapshot round trip wrong");
+
+  BootSnapshot widest;
+  memset(&widest, 0xFF, sizeof(widest));
+  widest.price = INT32_MIN;
+  widest.changeBp = INT32_MIN;
+  CHECK(bootSnapshotEncode(widest, blob, sizeof(blob)) <= BOOT_SNAPSHOT_MAX, "worst case overflows");
+  CHECK(bootSnapshotDecode(blob, bootSnapshotEncode(widest, blob, sizeof(blob)), s) && s.price == INT32_MIN,
+    "worst case round trip wrong");
+
+  // Any flipped bit or cut byte reads as no snapshot, leaving `s` alone
+  n = bootSnapshotEncode(BOOT_SAMPLE, blob, sizeof(blob));
+  uint32_t accepted = 0;
+  for (size_t bit = 0; bit < n * 8; bit++) {
+    blob[bit / 8] ^= 1 << (bit % 8);
+    accepted += bootSnapshotDecode(blob, n, s);
+    blob[bit / 8] ^= 1 << (bit % 8);
+  }
+  for (size_t cut = 0; cut < n; cut++) accepted += bootSnapshotDecode(blob, cut, s);
+  CHECK(accepted == 0 && s.price == INT32_MIN, "%u damaged snapshots accepted", (unsigned)accepted);
+}
+
+// About what collectHubMetrics() writes: six timing histograms, the
+// rest single counters and gauges
+static LogHistogram promTimes[6];
+static char promBody[PROM_BODY_MAX];
+
+static void renderScrape(PromWriter& w) {
+  static const char* const spans[] = { "span=\"a\"", "span=\"b\"", "span=\"c\"", "span=\"d\"" };
+  char name[48];
+  for (uint32_t i = 0; i < 30; i++) {
+    snprintf(name, sizeof(name), "blackroad_hub_counter_%02u_total", (unsigned)i);
+    w.counter(name, "A counter of things the hub did.", values[i]);
+  }
+  w.family("blackroad_hub_frame_seconds", "Time to draw the current screen.", PROM_HISTOGRAM);
+  w.histogram("blackroad_hub_frame_seconds", nullptr, promTimes[0]);
+  w.family("blackroad_hub_parse_seconds", "Time to deserialize one JSON message.", PROM_HISTOGRAM);
+  w.histogram("blackroad_hub_parse_seconds", nullptr, promTimes[1]);
+  w.family("blackroad_hub_touch_latency_seconds", "Touch-to-photon latency per stage.", PROM_HISTOGRAM);
+  for (int i = 0; i < 4; i++) w.histogram("blackroad_hub_touch_latency_seconds", spans[i], promTimes[2 + i]);
+}
+
+static void checkPromWriter() {
+  LogHistogram h;
+  h.reset();
+  for (uint32_t v : { 10u, 100u, 1000u, 5000000u }) h.record(v);
+  PromWriter w;
+  w.begin(promBody, sizeof(promBody));
+  w.family("t_seconds", "Test.", PROM_HISTOGRAM);
+  w.histogram("t_seconds", "k=\"v\"", h);
+  CHECK(strstr(promBody, "# TYPE t_seconds histogram\n") &&
+        strstr(promBody, "t_seconds_bucket{k=\"v\",le=\"0.000064\"} 1\n") &&
+        strstr(promBody, "t_seconds_bucket{k=\"v\",le=\"0.001024\"} 3\n") &&
+        strstr(promBody, "t_seconds_bucket{k=\"v\",le=\"4.194304\"} 3\n") &&
+        strstr(promBody, "t_seconds_bucket{k=\"v\",le=\"+Inf\"} 4\n") &&
+        strstr(promBody, "t_seconds_sum{k=\"v\"} 5.001110\n") &&
+        strstr(promBody, "t_seconds_count{k=\"v\"} 4\n"), "histogram text wrong:\n%s", promBody);
+
+  w.begin(promBody, sizeof(promBody));
+  w.gauge("g", "Signed.", -67);
+  w.sampleMicros("s", nullptr, 1500000);
+  CHECK(!strcmp(promBody, "# HELP g Signed.\n# TYPE g gauge\ng -67\ns 1.500000\n"), "samples wrong:\n%s", promBody);
+
+  // A body that does not fit is cut at a line end
+  char small[200];
+  w.begin(small, sizeof(small));
+  w.histogram("t_seconds", nullptr, h);
+  size_t n = strlen(small);
+  CHECK(w.overflowed() && n == w.length() && n > 0 && small[n - 1] == '\n', "cut body ends mid-line");
+
+  // The full scrape fits, with every sample line a name and a number
+  for (LogHistogram& t : promTimes) {
+    t.reset();
+    for (int i = 0; i < 500; i++) t.record(nextRandom() % 200000);
+  }
+  w.begin(promBody, sizeof(promBody));
+  renderScrape(w);
+  uint32_t bad = 0;
+  for (char* line = promBody; *line; line = strchr(line, '\n') + 1) {
+    if (*line == '#') continue;
+    const char* end = strchr(line, '\n');
+    const char* space = end;
+    while (space > line && *space != ' ') space--;
+    if (space == line || !strchr("0123456789-", space[1])) bad++;
+  }
+  CHECK(!w.overflowed() && !bad, "scrape body: overflow %d, %u bad lines", w.overflowed(), (unsigned)bad);
+  printf("  /metrics body %u of %u bytes\n", (unsigned)w.length(), (unsigned)PROM_BODY_MAX);
+}
+
+#ifdef BENCH_ARDUINOJSON
+static uint8_t arenaBuffer[JSON_ARENA_SIZE];
+static JsonArena arena(arenaBuffer, sizeof(arenaBuffer));
+
+static const char METRICS_MSG[] =
+  "{\"projects\":30247,\"agents\":15892,\"roadcoin\":0.42,\"change24h\":5.23,"
+  "\"cpu\":45,\"memory\":67,\"network\":2048}";
+static const char METRICS_MSG_DECIMAL[] =
+  "{\"projects\":30247,\"agents\":15892,\"roadcoin\":\"0.4213\",\"change24h\":-1.5,"
+  "\"cpu\":45,\"memory\":67,\"network\":2048}";
+
+// What parseMetricsData() does before it applies the values and repaints
+static bool parseMetrics(const char* json, size_t length, MetricsUpdate& m) {
+  bool ok = false;
+  {
+    JsonDocument doc(&arena);
+    if (!deserializeJson(doc, json, length)) {
+      const char* type = doc["type"] | "";
+      if (!*type) {
+        metricsRead(doc.as<JsonVariantConst>(), m);
+        ok = true;
+      }
+    }
+  }
+  arena.reset();
+  return ok;
+}
+
+static void checkMetrics() {
+  MetricsUpdate m;
+  bool ok = parseMetrics(METRICS_MSG, sizeof(METRICS_MSG) - 1, m);
+  CHECK(ok && m.fields == 0x7F, "metrics fields %02x", m.fields);
+  CHECK(m.projects == 30247 && m.agents == 15892 && m.cpu == 45 && m.memory == 67 && m.network == 2048,
+    "metrics values wrong");
+  CHECK(m.price == 420000 && m.change24hBp == 523, "price %d, change %d", (int)m.price, (int)m.change24hBp);
+
+  ok = parseMetrics(METRICS_MSG_DECIMAL, sizeof(METRICS_MSG_DECIMAL) - 1, m);
+  CHECK(ok && m.price == 421300 && m.change24hBp == -150, "decimal price %d, change %d",
+    (int)m.price, (int)m.change24hBp);
+
+  const char* mistyped = "{\"cpu\":\"high\",\"network\":-1}";
+  ok = parseMetrics(mistyped, strlen(mistyped), m);
+  CHECK(ok && m.fields == 0, "mistyped fields accepted: %02x", m.fields);
+}
+#endif
+
+#if CEO_HUB_ALLOC_GUARD
+// The render path stays off the heap (alloc_guard.h): each of these runs
+// inside a scope, and the run fails if any scope allocated
+static void checkNoAllocation() {
+  // The guard must see both a malloc and an operator new, or the rest
+  // would pass for nothing
+  static void* volatile sink;
+  {
+    ALLOC_GUARD_SCOPE("malloc");
+    sink = malloc(64);
+  }
+  free(sink);
+  {
+    ALLOC_GUARD_SCOPE("new");
+    sink = new char[64];
+  }
+  delete[] (char*)sink;
+  CHECK(allocGuardStats().violations == 2, "guard saw %u of 2 allocations", (unsigned)allocGuardStats().violations);
+  allocGuardReset();
+
+  char buf[FMT_BUF_SIZE];
+  {
+    ALLOC_GUARD_SCOPE("fmt");
+    for (uint32_t v : values) {
+      fmtSI(buf, sizeof(buf), v);
+      fmtBytes(buf, sizeof(buf), v);
+      fmtFloat(buf, sizeof(buf), v / 7.0f, 2);
+      fmtDuration(buf, sizeof(buf), v);
+    }
+  }
+  {
+    ALLOC_GUARD_SCOPE("chart");
+    uint8_t data[CHART_MAX_BARS];
+    for (uint8_t& d : data) d = nextRandom();
+    int16_t heights[CHART_MAX_BARS];
+    int16_t barWidth;
+    chartScale(data, CHART_MAX_BARS, 220, 28, heights, barWidth);
+    ChartPoint points[CHART_W];
+    int32_t lo[CHART_W], hi[CHART_W];
+    day.lttb(points, CHART_W);
+    day.envelope(CHART_W, lo, hi);
+  }
+#ifdef BENCH_ARDUINOJSON
+  {
+    ALLOC_GUARD_SCOPE("parseMetrics");
+    MetricsUpdate m;
+    parseMetrics(METRICS_MSG, sizeof(METRICS_MSG) - 1, m);
+    parseMetrics(METRICS_MSG_DECIMAL, sizeof(METRICS_MSG_DECIMAL) - 1, m);
+  }
+#endif
+  {
+    ALLOC_GUARD_SCOPE("notifications");
+    NotificationQueue q;
+    q.clear();
+    for (uint32_t i = 0; i < 2 * NOTIFY_SLOTS; i++) {
+      snprintf(buf, sizeof(buf), "n%u", (unsigned)i);
+      q.add(buf, 0, i * NOTIFY_RATE_MS, (uint8_t)(i % 3));
+    }
+    uint8_t order[NOTIFY_SLOTS];
+    q.ranked(order, NOTIFY_SLOTS);
+    q.expire(NOTIFY_MS);
+  }
+  {
+    ALLOC_GUARD_SCOPE("scrape");
+    PromWriter w;
+    w.begin(promBody, sizeof(promBody));
+    renderScrape(w);
+  }
+
+  const AllocGuardStats& s = allocGuardStats();
+  CHECK(s.violations == 0, "%u of %u scopes allocated, last \"%s\" %u times", (unsigned)s.violations,
+    (unsigned)s.frames, s.lastScope ? s.lastScope : "", (unsigned)s.lastCount);
+}
+#endif
+
+int main(int argc, char** argv) {
+  for (uint32_t& v : values) v = nextRandom() >> (nextRandom() % 32);
+
+  checkFormatting();
+  checkChart();
+  checkDecimation();
+  checkNotifications();
+  checkBootSnapshot();
+  checkPromWriter();
+#ifdef BENCH_ARDUINOJSON
+  checkMetrics();
+#endif
+#if CEO_HUB_ALLOC_GUARD
+  checkNoAllocation();
+#endif
+
+  BenchSuite suite("Update hot path", argc, argv);
+
+#ifdef BENCH_ARDUINOJSON
+  suite.run("parseMetrics number", [](uint64_t) {
+    MetricsUpdate m;
+    benchKeep(parseMetrics(METRICS_MSG, sizeof(METRICS_MSG) - 1, m));
+    benchKeep(m);
+  });
+  suite.run("parseMetrics decimal string", [](uint64_t) {
+    MetricsUpdate m;
+    benchKeep(parseMetrics(METRICS_MSG_DECIMAL, sizeof(METRICS_MSG_DECIMAL) - 1, m));
+    benchKeep(m);
+  });
+#else
+  printf("  (parseMetrics skipped: ArduinoJson not found, run `pio pkg install` or set ARDUINOJSON)\n");
+#endif
+
+  char buf[FMT_BUF_SIZE];
+  suite.run("fmtSI (formatNumber)", [&](uint64_t i) {
+    benchKeep(fmtSI(buf, sizeof(buf), values[i & 255]));
+    benchKeep(buf);
+  });
+  suite.run("fmtBytes (formatBytes)", [&](uint64_t i) {
+    benchKeep(fmtBytes(buf, sizeof(buf), values[i & 255]));
+    benchKeep(buf);
+  });
+
+  // The Activity chart: 30 days into 220 x 28, and a full-width series
+  uint8_t chartData[CHART_MAX_BARS];
+  for (uint8_t& d : chartData) d = 20 + nextRandom() % 80;
+  int16_t heights[CHART_MAX_BARS];
+  int16_t barWidth;
+  suite.run("chartScale 30 bars", [&](uint64_t i) {
+    chartData[i % 30] ^= 1;  // keep the compiler from hoisting the scan
+    benchKeep(chartScale(chartData, 30, 220, 28, heights, barWidth));
+    benchKeep(heights);
+  });
+  suite.run("chartScale 220 bars", [&](uint64_t i) {
+    chartData[i % 220] ^= 1;
+    benchKeep(chartScale(chartData, 220, 220, 28, heights, barWidth));
+    benchKeep(heights);
+  });
+
+  // Decimation: per-sample append, then each view of the whole day
+  static ChartSeries growing;
+  growing.clear();
+  suite.run("ChartSeries push", [&](uint64_t i) {
+    growing.push((int32_t)(i * 2654435761u));
+    benchKeep(&growing);  // the buckets escape, so every store stays
+  });
+  ChartPoint points[CHART_W];
+  int32_t lo[CHART_W], hi[CHART_W];
+  suite.run("ChartSeries lttb 86400 -> 220", [&](uint64_t) {
+    benchKeep(day.lttb(points, CHART_W));
+    benchKeep(points);
+  });
+  suite.run("ChartSeries envelope 86400 -> 220", [&](uint64_t) {
+    benchKeep(day.envelope(CHART_W, lo, hi));
+    benchKeep(hi);
+  });
+  static uint8_t longBars[DAY_SECONDS];
+  for (uint8_t& b : longBars) b = nextRandom();
+  int16_t lowBars[CHART_MAX_BARS], highBars[CHART_MAX_BARS];
+  suite.run("chartScaleEnvelope 86400 (array)", [&](uint64_t i) {
+    longBars[i % DAY_SECONDS] ^= 1;
+    benchKeep(chartScaleEnvelope(longBars, DAY_SECONDS, CHART_W, 28, lowBars, highBars));
+    benchKeep(highBars);
+  });
+
+  // Queue kept full of distinct messages, so every add checks for a
+  // repeat and then searches for the oldest slot
+  NotificationQueue queue;
+  queue.clear();
+  uint32_t clock = 0;
+  char names[NOTIFY_SLOTS + 1][8];
+  for (uint8_t i = 0; i <= NOTIFY_SLOTS; i++) snprintf(names[i], sizeof(names[i]), "msg %u", i);
+  suite.run("addNotification (full)", [&](uint64_t i) {
+    queue.add(names[i % (NOTIFY_SLOTS + 1)], 0xFFFF, clock += NOTIFY_RATE_MS);  // under the rate limit
+    benchKeep(queue);
+  });
+  suite.run("updateNotifications", [&](uint64_t i) {
+    benchKeep(queue.expire(clock + (i & 1023)));  // none due: a full scan every time
+  });
+
+  // Boot: decode before the first frame, encode on every save check
+  uint8_t snapshot[BOOT_SNAPSHOT_MAX];
+  size_t snapshotLength = bootSnapshotEncode(BOOT_SAMPLE, snapshot, sizeof(snapshot));
+  suite.run("bootSnapshotDecode", [&](uint64_t) {
+    BootSnapshot s;
+    benchKeep(bootSnapshotDecode(snapshot, snapshotLength, s));
+    benchKeep(s);
+  });
+  BootSnapshot changing = BOOT_SAMPLE;
+  suite.run("bootSnapshotEncode", [&](uint64_t i) {
+    changing.network = (uint32_t)i;
+    benchKeep(bootSnapshotEncode(changing, snapshot, sizeof(snapshot)));
+    benchKeep(snapshot);
+  });
+
+  // A 1 Hz scrape costs the loop one of these
+  suite.run("render /metrics body", [&](uint64_t) {
+    PromWriter w;
+    w.begin(promBody, sizeof(promBody));
+    renderScrape(w);
+    benchKeep(w.length());
+    benchKeep(promBody);
+  });
+
+  bool written = suite.finish();
+  printf(failures ? "%d checks FAILED\n" : "All checks passed\n", failures);
+  return failures || !written ? 1 : 0;
+}
@@ -0,0 +1,213 @@
+/**
+ * ══════════════════════════════════════════════════════════════════════════
+ *                    🖤🛣️ INFERENCE CACHE BENCHMARK 🛣️🖤
+ * ══════════════════════════════════════════════════════════════════════════
+ *
+ * Replays a day of cloud inference requests against the cache: a
+ * hundred prompts with Zipf popularity, from three callers, often in
+ * bursts. Upstream calls take 0.3 to 4 s and 3% fail. Reports the hit
+ * rate, coalesced calls, upstream calls and waiting saved against no
+ * cache. Checks that no input is ever in flight twice, that every
+ * caller is told when its call ends, that hits return the newest
+ * answer, and that a saved cache loads back.
+ *
+ *   make -C bench run
+ */
+
+#include "inference_cache.h"
+#include "histogram.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <map>
+#include <string>
+#include <vector>
+
+#define PROMPTS     100
+#define DAY_MS      (24UL * 3600 * 1000)
+#define MEAN_GAP_MS 5000
+#define BURST_PCT   20      // a second caller asks the same right after
+#define FAIL_PCT    3
+
+struct Call {
+  uint64_t key;
+  uint32_t doneMs;
+  uint32_t latencyMs;
+  bool ok;
+};
+
+struct Prompt {
+  InferKind kind;
+  std::string text;
+  std::string context;
+};
+
+static uint32_t rng = 0x68E31DA4;
+
+static uint32_t nextRandom() {
+  rng ^= rng << 13;
+  rng ^= rng >> 17;
+  rng ^= rng << 5;
+  return rng;
+}
+
+static uint64_t nowNs() {
+  using namespace std::chrono;
+  return duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count();
+}
+
+static const uint32_t LATENCY_MS[INFER_KINDS][2] = {
+  { 1200, 2800 }, { 500, 1200 }, { 1500, 4000 }, { 300, 900 }
+};
+
+int main() {
+  int failures = 0;
+
+  std::vector<Prompt> prompts(PROMPTS);
+  std::vector<double> cumulative(PROMPTS);
+  double total = 0;
+  for (int i = 0; i < PROMPTS; i++) {
+    Prompt& p = prompts[i];
+    p.kind = (InferKind)(i % INFER_KINDS);
+    p.text = "Prompt " + std::to_string(i) + ": what changed in project " + std::to_string(i * 7919 % 10007) + "?";
+    if (p.kind == INFER_ANSWER) p.context = "Context for question " + std::to_string(i);
+    total += 1.0 / pow(i + 1, 1.1);
+    cumulative[i] = total;
+  }
+
+  static InferenceCache cache;
+  cache.clear();
+  std::vector<Call> inFlight;
+  std::map<uint64_t, uint8_t> expectWaiters;   // bits owed a reply per key
+  std::map<uint64_t, std::string> newest;       // last answer per key
+  std::map<uint64_t, uint32_t> failedAt;
+  uint32_t answerSeq = 0, noCacheCalls = 0, doubleCalls = 0, wrongWaiters = 0, wrongAnswers = 0;
+  uint32_t earlyRetries = 0;
+  uint64_t noCacheWaitMs = 0;
+  LogHistogramT<HISTOGRAM_BUCKETS_FULL> requestNs;
+  requestNs.reset();
+
+  auto finishUpTo = [&](uint32_t now) {
+    for (size_t i = 0; i < inFlight.size();) {
+      Call c = inFlight[i];
+      if (c.doneMs > now) {
+        i++;
+        continue;
+      }
+      inFlight.erase(inFlight.begin() + i);
+      uint8_t told;
+      if (c.ok) {
+        std::string answer = "Answer " + std::to_string(++answerSeq);
+        told = cache.complete(c.key, answer.c_str(), c.latencyMs * 1000, c.doneMs);
+        newest[c.key] = answer;
+      } else {
+        told = cache.fail(c.key, c.doneMs);
+        failedAt[c.key] = c.doneMs;
+      }
+      if (told != expectWaiters[c.key]) wrongWaiters++;
+      expectWaiters[c.key] = 0;
+    }
+  };
+
+  auto ask = [&](const Prompt& p, uint8_t waiter, uint32_t now) {
+    const char* context = p.context.empty() ? nullptr : p.context.c_str();
+    uint64_t t0 = nowNs();
+    InferLookup r = cache.request(p.kind, p.text.c_str(), context, waiter, now);
+    requestNs.record(nowNs() - t0);
+
+    uint32_t latency = LATENCY_MS[p.kind][0] + nextRandom() % (LATENCY_MS[p.kind][1] - LATENCY_MS[p.kind][0]);
+    noCacheCalls++;
+    noCacheWaitMs += latency;
+
+    if ((r.state == INFER_HIT || r.state == INFER_STALE) && newest[r.key] != r.result) wrongAnswers++;
+    if (r.state == INFER_STALE || r.state == INFER_WAIT || r.fetch) expectWaiters[r.key] |= waiter;
+    if (!r.fetch) return;
+
+    auto f = failedAt.find(r.key);
+    if (f != failedAt.end() && now - f->second < INFER_RETRY_MS) earlyRetries++;
+    for (const Call& c : inFlight) doubleCalls += c.key == r.key;
+    inFlight.push_back({ r.key, now + latency, latency, nextRandom() % 100 >= FAIL_PCT });
+  };
+
+  uint32_t now = 0;
+  while (now < DAY_MS) {
+    now += 1 + (uint32_t)(-log((nextRandom() + 1.0) / 4294967297.0) * MEAN_GAP_MS);
+    finishUpTo(now);
+    double u = (nextRandom() / 4294967296.0) * total;
+    int pick = std::lower_bound(cumulative.begin(), cumulative.end(), u) - cumulative.begin();
+    uint8_t waiter = 1 << (nextRandom() % 3);
+    ask(prompts[pick], waiter, now);
+    if (nextRandom() % 100 < BURST_PCT) {
+      now += 50;
+      finishUpTo(now);
+      ask(prompts[pick], waiter == 1 ? 2 : 1, now);
+    }
+  }
+  finishUpTo(UINT32_MAX);
+
+  InferStats s = cache.stats();
+  if (doubleCalls) failures++, printf("FAIL: %u calls for an input already in flight\n", (unsigned)doubleCalls);
+  if (wrongWaiters) failures++, printf("FAIL: %u replies told the wrong callers\n", (unsigned)wrongWaiters);
+  if (wrongAnswers) failures++, printf("FAIL: %u hits returned an old answer\n", (unsigned)wrongAnswers);
+  if (earlyRetries) failures++, printf("FAIL: %u retries inside the back-off\n", (unsigned)earlyRetries);
+  if (!s.staleHits || !s.coalesced) failures++, printf("FAIL: no stale hits or no coalescing seen\n");
+  if (s.inFlight) failures++, printf("FAIL: %u calls left in flight\n", s.inFlight);
+  if (s.calls != s.answers + s.failures) failures++, printf("FAIL: %u calls, %u ended\n", (unsigned)s.calls,
+    (unsigned)(s.answers + s.failures));
+
+  // LRU: the entry touched last survives a full turnover but one
+  static InferenceCache lru;
+  lru.clear();
+  for (int i = 0; i < INFER_ENTRIES; i++) {
+    InferLookup r = lru.request(INFER_SUMMARY, prompts[i].text.c_str(), nullptr, 1, 0);
+    lru.complete(r.key, "x", 1000, 0);
+  }
+  lru.request(INFER_SUMMARY, prompts[0].text.c_str(), nullptr, 1, 1);
+  InferLookup fresh = lru.request(INFER_SUMMARY, prompts[INFER_ENTRIES].text.c_str(), nullptr, 1, 2);
+  lru.complete(fresh.key, "y", 1000, 2);
+  if (!lru.find(InferenceCache::keyOf(INFER_SUMMARY, prompts[0].text.c_str())) ||
+      lru.find(InferenceCache::keyOf(INFER_SUMMARY, prompts[1].text.c_str()))) {
+    failures++, printf("FAIL: eviction is not least recently used\n");
+  }
+
+  // Save and load: every result comes back, stale, and refreshes once
+  std::vector<uint8_t> blob(cache.saveSize());
+  if (!cache.save(blob.data(), blob.size()) || cache.dirty()) failures++, printf("FAIL: save\n");
+  static InferenceCache loaded;
+  if (!loaded.load(blob.data(), blob.size(), 12345)) failures++, printf("FAIL: load\n");
+  uint32_t restored = 0, notStale = 0;
+  for (const Prompt& p : prompts) {
+    uint64_t key = InferenceCache::keyOf(p.kind, p.text.c_str(), p.context.empty() ? nullptr : p.context.c_str());
+    const char* before = cache.find(key);
+    if (!before) continue;
+    const char* after = loaded.find(key);
+    if (!after || strcmp(before, after) != 0) continue;
+    restored++;
+    InferLookup r = loaded.request(p.kind, p.text.c_str(), p.context.empty() ? nullptr : p.context.c_str(), 1, 12345);
+    notStale += r.state != INFER_STALE || !r.fetch;
+  }
+  if (restored != s.entries || notStale) {
+    failures++, printf("FAIL: %u of %u results loaded, %u not stale\n", (unsigned)restored, s.entries, (unsigned)notStale);
+  }
+  if (loaded.load(blob.data(), 3, 0)) failures++, printf("FAIL: truncated blob accepted\n");
+
+  uint32_t served = s.hits + s.staleHits;
+  printf("Inference cache, %u entries (%u bytes), %u prompts over 24 h\n",
+    (unsigned)INFER_ENTRIES, (unsigned)sizeof(InferenceCache), (unsigned)PROMPTS);
+  printf("  %lu requests: %lu hits, %lu stale, %lu coalesced, %lu misses, %lu busy, %lu evictions\n",
+    (unsigned long)s.requests, (unsigned long)s.hits, (unsigned long)s.staleHits, (unsigned long)s.coalesced,
+    (unsigned long)s.misses, (unsigned long)s.busy, (unsigned long)s.evictions);
+  printf("  hit rate %.1f%%, upstream calls %lu vs %lu uncached (%.1f%% fewer), %lu failed\n",
+    100.0 * served / s.requests, (unsigned long)s.calls, (unsigned long)noCacheCalls,
+    100.0 - 100.0 * s.calls / noCacheCalls, (unsigned long)s.failures);
+  printf("  waiting saved %.0f of %.0f s, saved blob %u bytes\n",
+    s.savedUs / 1e6, noCacheWaitMs / 1e3, (unsigned)blob.size());
+  printf("  request()          p50 %7u ns  p99 %7u ns\n",
+    (unsigned)requestNs.percentile(500), (unsigned)requestNs.percentile(990));
+
+  printf(failures ? "%d checks FAILED\n" : "All checks passed\n", failures);
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,153 @@
+/**
+ * ══════════════════════════════════════════════════════════════════════════
+ *                    🖤🛣️ DEFERRED LOGGER BENCHMARK 🛣️🖤
+ * ══════════════════════════════════════════════════════════════════════════
+ *
+ * Times what a LOG() call costs the hot path (enabled and filtered out)
+ * against formatting the same line with snprintf, then what the drain
+ * side pays per record. Checks the deferred formatter against snprintf
+ * and that a full ring drops and counts records instead of corrupting.
+ *
+ *   make -C bench run
+ */
+
+#include "logger.h"
+
+#include <chrono>
+#include <cstdio>
+#include <string>
+
+#define BATCH   32        // records per fill/drain cycle, well under the ring
+#define ROUNDS  20000
+
+static uint64_t nowNs() {
+  using namespace std::chrono;
+  return duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count();
+}
+
+static int failures = 0;
+
+// Encodes the arguments the way LOG() does and formats them back
+template <typename... Args>
+static std::string deferred(const char* format, Args... args) {
+  LogWriter w(0, 0);
+  int expand[] = { 0, (w.put(args), 0)... };
+  (void)expand;
+  char out[LOG_LINE_MAX];
+  logFormat(out, sizeof(out), format, w.data() + 6, w.size() - 6);
+  return out;
+}
+
+#define CHECK_FORMAT(format, ...) do {                               \
+    char ref[LOG_LINE_MAX];                                          \
+    snprintf(ref, sizeof(ref), format, __VA_ARGS__);                 \
+    std::string got = deferred(format, __VA_ARGS__);                 \
+    if (got != ref) {                                                \
+      printf("FAIL: \"%s\" gave \"%s\", expected \"%s\"\n", format, got.c_str(), ref); \
+      failures++;                                                    \
+    }                                                                \
+  } while (0)
+
+static void drainAll() {
+  uint8_t record[LOG_RECORD_MAX];
+  while (logNext(record)) {}
+}
+
+int main() {
+  // Formatter: every conversion the firmware uses, plus flags and widths
+  CHECK_FORMAT("Touch: x=%d, y=%d", (int16_t)-12, (int16_t)319);
+  CHECK_FORMAT("%u bytes, %lu ms, %llu total", 7u, 123456ul, 1ull << 40);
+  CHECK_FORMAT("%-8s|%8s|%.3s", "left", "right", "truncate");
+  CHECK_FORMAT("%05d %+d %x %#X %o", 42, 7, 0xBEEFu, 0xCAFEu, 8u);
+  CHECK_FORMAT("%.2f %8.3e %g", 3.14159f, -0.00125, 2.5);
+  CHECK_FORMAT("%c%c 100%%", 'o', 'k');
+  CHECK_FORMAT("%lld %hu %hhd", -9000000000ll, (unsigned short)65535, (signed char)-5);
+
+  // Long strings are cut to LOG_STR_MAX; an overlong record loses its tail
+  std::string longName(100, 'x');
+  if (deferred("%s", longName.c_str()) != longName.substr(0, LOG_STR_MAX)) {
+    printf("FAIL: long string not truncated to %d\n", LOG_STR_MAX);
+    failures++;
+  }
+  if (deferred("%s %s %s %u", longName.c_str(), longName.c_str(), longName.c_str(), 1u).back() != '?') {
+    printf("FAIL: missing argument not marked\n");
+    failures++;
+  }
+
+  // Round trip through the ring and the message table
+  drainAll();
+  LOG(PROJECT_OPEN, 4242ul, "Lucidia Core");
+  LOG(WS_CONNECTING, "ws://192.168.4.74:8080/ws");
+  const char* expect[] = { "→ Project #4242 Lucidia Core", "Connecting to WebSocket: ws://192.168.4.74:8080/ws" };
+  for (const char* want : expect) {
+    uint8_t record[LOG_RECORD_MAX];
+    char line[LOG_LINE_MAX];
+    uint8_t length = logNext(record);
+    logFormatRecord(line, sizeof(line), record, length);
+    if (std::string(line) != want) {
+      printf("FAIL: record gave \"%s\"\n", line);
+      failures++;
+    }
+  }
+
+  // Overflow: nothing blocks, every record is either queued or counted
+  LogStats before = logStats();
+  uint32_t attempts = LOG_RING_BYTES;
+  for (uint32_t i = 0; i < attempts; i++) LOG(WS_UNKNOWN_BINARY, (unsigned)i);
+  LogStats after = logStats();
+  uint32_t queued = after.written - before.written;
+  uint32_t dropped = after.dropped - before.dropped;
+  uint32_t drained = 0;
+  uint8_t record[LOG_RECORD_MAX];
+  while (uint8_t length = logNext(record)) {
+    char line[LOG_LINE_MAX];
+    logFormatRecord(line, sizeof(line), record, length);
+    char want[LOG_LINE_MAX];
+    snprintf(want, sizeof(want), "✗ Unknown binary message (%u bytes)", (unsigned)drained);
+    if (std::string(line) != want && failures < 10) {
+      printf("FAIL: drained \"%s\", expected \"%s\"\n", line, want);
+      failures++;
+    }
+    drained++;
+  }
+  if (queued + dropped != attempts || drained != queued || dropped == 0) {
+    printf("FAIL: %u attempts, %u queued, %u dropped, %u drained\n", attempts, queued, dropped, drained);
+    failures++;
+  }
+
+  // Hot-path cost per call: enabled, filtered out, and snprintf for comparison
+  uint64_t enabledNs = 0, filteredNs = 0, snprintfNs = 0, drainNs = 0;
+  char sink[LOG_LINE_MAX];
+  volatile size_t keep = 0;
+  for (int r = 0; r < ROUNDS; r++) {
+    uint64_t start = nowNs();
+    for (int i = 0; i < BATCH; i++) LOG(PROJECT_OPEN, (unsigned long)i, "Lucidia Core");
+    enabledNs += nowNs() - start;
+
+    start = nowNs();
+    for (int i = 0; i < BATCH; i++) LOG(TOUCH, i, i);  // DEBUG, filtered at INFO
+    filteredNs += nowNs() - start;
+
+    start = nowNs();
+    for (int i = 0; i < BATCH; i++) keep += snprintf(sink, sizeof(sink), "→ Project #%lu %s", (unsigned long)i, "Lucidia Core");
+    snprintfNs += nowNs() - start;
+
+    start = nowNs();
+    while (uint8_t length = logNext(record)) keep += logFormatRecord(sink, sizeof(sink), record, length);
+    drainNs += nowNs() - start;
+  }
+  double calls = (double)ROUNDS * BATCH;
+  LogStats st = logStats();
+
+  printf("Logger, %u-byte ring, %u-byte records max, table hash %04x\n",
+    (unsigned)LOG_RING_BYTES, (unsigned)LOG_RECORD_MAX, logTableHash());
+  printf("  LOG() enabled      %7.1f ns/call\n", enabledNs / calls);
+  printf("  LOG() filtered     %7.1f ns/call\n", filteredNs / calls);
+  printf("  snprintf same line %7.1f ns/call\n", snprintfNs / calls);
+  printf("  drain + format     %7.1f ns/record\n", drainNs / calls);
+  printf("  %lu records, %lu dropped, ring peak %lu bytes\n",
+    (unsigned long)st.written, (unsigned long)st.dropped, (unsigned long)st.highWater);
+
+  printf(failures ? "%d checks FAILED\n" : "All checks passed\n", failures);
+  return failures ? 1 : 0;
+}
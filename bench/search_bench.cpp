@@ -0,0 +1,292 @@
+/**
+ * ══════════════════════════════════════════════════════════════════════════
+ *                    🖤🛣️ SEARCH INDEX BENCHMARK 🛣️🖤
+ * ══════════════════════════════════════════════════════════════════════════
+ *
+ * Builds the project search index over 30,000 synthetic names in a RAM
+ * model of the flash partition and measures index size, per-keystroke
+ * lookup latency, delta and compaction cost. Results are cross-checked
+ * against a brute-force scan.
+ *
+ * Host numbers are a lower bound: on the ESP32 every block decode goes
+ * through the flash cache at 240 MHz. Use the `find` serial command for
+ * on-device timings.
+ *
+ *   make -C bench run
+ */
+
+#include "search_index.h"
+#include "histogram.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#define NAME_COUNT   30000
+#define FLASH_BYTES  0x160000  // default "spiffs" partition, 4 MB boards
+#define SCREEN_ROWS  6         // results visible while typing
+
+// NOR flash model: erase sets 0xFF, programming can only clear bits
+class RamStorage : public SearchStorage {
+ public:
+  explicit RamStorage(uint32_t bytes) : flash(bytes, 0xFF) {}
+
+  uint32_t size() const override { return flash.size(); }
+  const uint8_t* data() const override { return flash.data(); }
+
+  bool erase(uint32_t offset, uint32_t length) override {
+    if (offset % SEARCH_SECTOR_SIZE || length % SEARCH_SECTOR_SIZE) return false;
+    if (offset + length > flash.size()) return false;
+    memset(&flash[offset], 0xFF, length);
+    erases += length / SEARCH_SECTOR_SIZE;
+    return true;
+  }
+
+  bool write(uint32_t offset, const void* src, uint32_t length) override {
+    if (offset + length > flash.size()) return false;
+    const uint8_t* in = (const uint8_t*)src;
+    for (uint32_t i = 0; i < length; i++) {
+      if ((flash[offset + i] & in[i]) != in[i]) bitErrors++;
+      flash[offset + i] &= in[i];
+    }
+    written += length;
+    return true;
+  }
+
+  std::vector<uint8_t> flash;
+  uint32_t erases = 0;
+  uint32_t written = 0;
+  uint32_t bitErrors = 0;  // writes to bytes that were not erased
+};
+
+struct Project {
+  uint32_t id;
+  std::string name;
+};
+
+static uint32_t rng = 0x2545F491;
+
+static uint32_t nextRandom() {
+  rng ^= rng << 13;
+  rng ^= rng >> 17;
+  rng ^= rng << 5;
+  return rng;
+}
+
+static std::string lower(const std::string& s) {
+  std::string out = s;
+  for (char& c : out) {
+    if (c >= 'A' && c <= 'Z') c += 'a' - 'A';
+  }
+  return out;
+}
+
+static uint64_t nowNs() {
+  using namespace std::chrono;
+  return duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count();
+}
+
+static std::vector<Project> makeProjects() {
+  static const char* brands[] = {
+    "RoadView", "Lucidia", "Roadie", "Radius", "RoadCoin", "Pack", "BlackRoad",
+    "Cadence", "Atlas", "Aria", "Prism", "Echo", "Nimbus", "Quasar", "Vertex"
+  };
+  static const char* parts[] = {
+    "Core", "Platform", "Exchange", "Studio", "Agent", "Gateway", "Ledger",
+    "Canvas", "Pipeline", "Console", "Runtime", "Bridge", "Vault", "Monitor"
+  };
+  static const char* tails[] = {
+    "API", "Mobile", "Web", "Infra", "Research", "Ops", "Edge", "Labs", "v2", "Beta"
+  };
+
+  std::vector<Project> projects;
+  for (uint32_t i = 0; i < NAME_COUNT; i++) {
+    char name[64];
+    snprintf(name, sizeof(name), "%s %s %s %u",
+      brands[nextRandom() % 15], parts[nextRandom() % 14], tails[nextRandom() % 10],
+      (unsigned)(nextRandom() % 1000));
+    projects.push_back({ i + 1, name });
+  }
+
+  std::sort(projects.begin(), projects.end(), [](const Project& a, const Project& b) {
+    return lower(a.name) < lower(b.name);
+  });
+  return projects;
+}
+
+static uint32_t bruteForce(const std::vector<Project>& projects, const std::string& q, bool prefix) {
+  std::string needle = lower(q);
+  uint32_t count = 0;
+  for (const Project& p : projects) {
+    std::string hay = lower(p.name);
+    size_t at = hay.find(needle);
+    if (prefix ? at == 0 : at != std::string::npos) count++;
+  }
+  return count;
+}
+
+static void report(const char* label, const LogHistogram& h) {
+  printf("  %-34s n=%-6u p50 %6u us  p99 %6u us  max %6u us\n", label,
+    (unsigned)h.count, (unsigned)h.percentile(500), (unsigned)h.percentile(990), (unsigned)h.maxValue);
+}
+
+// Runs a query until the first screenful is ready and then to completion
+static void timeQuery(SearchIndex& index, const std::string& q, SearchMode mode,
+                      LogHistogram& firstScreen, LogHistogram& complete) {
+  uint64_t start = nowNs();
+  index.query(q.c_str(), mode);
+  bool firstDone = false;
+  while (!index.step(500)) {
+    if (!firstDone && index.hitCount() >= SCREEN_ROWS) {
+      firstScreen.record((nowNs() - start) / 1000);
+      firstDone = true;
+    }
+  }
+  uint32_t total = (nowNs() - start) / 1000;
+  if (!firstDone) firstScreen.record(total);
+  complete.record(total);
+}
+
+int main() {
+  int failures = 0;
+  std::vector<Project> projects = makeProjects();
+
+  RamStorage flash(FLASH_BYTES);
+  static SearchIndex index;
+  if (!index.begin(&flash)) {
+    printf("FAIL: mount\n");
+    return 1;
+  }
+
+  // ── Build ────────────────────────────────────────────────────────────
+  uint64_t start = nowNs();
+  bool ok = index.snapshotBegin(1);
+  for (const Project& p : projects) ok = ok && index.snapshotAdd(p.id, p.name.c_str());
+  ok = ok && index.snapshotEnd();
+  double buildMs = (nowNs() - start) / 1e6;
+  if (!ok) {
+    printf("FAIL: snapshot\n");
+    return 1;
+  }
+
+  SearchIndexStats s = index.stats();
+  printf("Search index, %u names\n", (unsigned)s.entries);
+  printf("  blocks %u, index %u bytes (%.1f B/name), raw %u bytes, ratio %.2f\n",
+    (unsigned)s.blocks, (unsigned)s.indexBytes, (double)s.indexBytes / s.entries,
+    (unsigned)s.rawBytes, (double)s.indexBytes / s.rawBytes);
+  printf("  RAM: SearchIndex object %u bytes\n", (unsigned)sizeof(SearchIndex));
+  printf("  build %.1f ms, %u sector erases, %u bytes programmed\n",
+    buildMs, (unsigned)flash.erases, (unsigned)flash.written);
+
+  // ── Prefix search, one query per keystroke ───────────────────────────
+  LogHistogram prefixFirst, prefixAll;
+  prefixFirst.reset();
+  prefixAll.reset();
+  for (int t = 0; t < 500; t++) {
+    const std::string& target = projects[nextRandom() % projects.size()].name;
+    for (size_t len = 1; len <= target.size() && len <= 12; len++) {
+      std::string q = target.substr(0, len);
+      timeQuery(index, q, SEARCH_PREFIX, prefixFirst, prefixAll);
+
+      uint32_t expected = std::min<uint32_t>(bruteForce(projects, q, true), SEARCH_MAX_HITS);
+      if (t < 20 && index.hitCount() != expected) {
+        printf("FAIL: prefix '%s' %u hits, expected %u\n", q.c_str(), index.hitCount(), expected);
+        failures++;
+      }
+    }
+  }
+
+  // ── Substring search ─────────────────────────────────────────────────
+  LogHistogram subFirst, subAll;
+  subFirst.reset();
+  subAll.reset();
+  for (int t = 0; t < 300; t++) {
+    const std::string& source = projects[nextRandom() % projects.size()].name;
+    size_t len = 3 + nextRandom() % 4;
+    size_t at = nextRandom() % (source.size() - len);
+    std::string q = source.substr(at, len);
+    timeQuery(index, q, SEARCH_SUBSTRING, subFirst, subAll);
+
+    uint32_t expected = std::min<uint32_t>(bruteForce(projects, q, false), SEARCH_MAX_HITS);
+    if (index.hitCount() != expected) {
+      printf("FAIL: substring '%s' %u hits, expected %u\n", q.c_str(), index.hitCount(), expected);
+      failures++;
+    }
+  }
+
+  // Rare query: the block masks have to skip almost everything
+  for (int t = 0; t < 50; t++) timeQuery(index, "zq", SEARCH_SUBSTRING, subFirst, subAll);
+
+  printf("Lookup latency (host)\n");
+  report("prefix, first screenful", prefixFirst);
+  report("prefix, complete", prefixAll);
+  report("substring, first screenful", subFirst);
+  report("substring, complete", subAll);
+
+  // ── Deltas and compaction ────────────────────────────────────────────
+  uint32_t erasesBefore = flash.erases;
+  start = nowNs();
+  uint32_t applied = 0;
+  for (uint32_t i = 0; i < SEARCH_DELTA_MAX; i++) {
+    char name[32];
+    snprintf(name, sizeof(name), "Zephyr Delta %u", (unsigned)i);
+    if (i % 4 == 3) applied += index.remove(projects[i].id);
+    else applied += index.put(100000 + i, name);
+  }
+  applied += index.setVersion(2);
+  double deltaUs = (nowNs() - start) / 1e3 / SEARCH_DELTA_MAX;
+
+  index.query("zephyr delta", SEARCH_PREFIX);
+  while (!index.step(1000)) {}
+  uint32_t overlayHits = index.hitCount();
+
+  index.compact();
+  start = nowNs();
+  uint32_t slices = 0;
+  while (index.needsService()) {
+    index.service(2000);
+    slices++;
+  }
+  double compactMs = (nowNs() - start) / 1e6;
+
+  s = index.stats();
+  index.query("zephyr delta", SEARCH_PREFIX);
+  while (!index.step(1000)) {}
+  uint32_t mergedHits = index.hitCount();
+  index.query(projects[3].name.c_str(), SEARCH_PREFIX);
+  while (!index.step(1000)) {}
+  bool removedGone = true;
+  for (uint16_t i = 0; i < index.hitCount(); i++) {
+    if (index.hit(i).id == projects[3].id) removedGone = false;
+  }
+
+  printf("Deltas\n");
+  printf("  %u ops applied, %.1f us/op (incl. log write)\n", (unsigned)applied, deltaUs);
+  printf("  compaction %.1f ms in %u x 2ms slices, %u sector erases, version %u, generation %u\n",
+    compactMs, (unsigned)slices, (unsigned)(flash.erases - erasesBefore),
+    (unsigned)s.version, (unsigned)s.generation);
+
+  if (overlayHits != 32 || mergedHits != 32 || !removedGone || s.deltas != 0 || s.version != 2) {
+    printf("FAIL: deltas (overlay %u, merged %u, removed %s, left %u)\n",
+      (unsigned)overlayHits, (unsigned)mergedHits, removedGone ? "yes" : "no", (unsigned)s.deltas);
+    failures++;
+  }
+
+  // ── Remount: the committed bank and its log survive a reboot ─────────
+  static SearchIndex reboot;
+  if (!reboot.begin(&flash) || reboot.stats().entries != s.entries || reboot.version() != 2) {
+    printf("FAIL: remount\n");
+    failures++;
+  }
+  if (flash.bitErrors) {
+    printf("FAIL: %u writes to unerased flash\n", (unsigned)flash.bitErrors);
+    failures++;
+  }
+
+  printf(failures ? "%d checks FAILED\n" : "All checks passed\n", failures);
+  return failures ? 1 : 0;
+}
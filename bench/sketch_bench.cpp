@@ -0,0 +1,192 @@
+/**
+ * ══════════════════════════════════════════════════════════════════════════
+ *                    🖤🛣️ QUANTILE SKETCH BENCHMARK 🛣️🖤
+ * ══════════════════════════════════════════════════════════════════════════
+ *
+ * Streams a day of CPU and network samples at 2 Hz into the rolling
+ * 1m/1h/24h sketches, times each record and each window query, and
+ * checks p50/p95/p99 against the exact quantiles of the same window.
+ * Also checks that a stream split in two and merged back answers
+ * exactly like the whole.
+ *
+ *   make -C bench run
+ */
+
+#include "quantile_sketch.h"
+#include "histogram.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+#define SECONDS       86400
+#define PER_SECOND    2
+#define CHECK_EVERY   (3 * 3600 + 17)  // off the slot boundaries
+
+struct Sample {
+  uint32_t time;
+  uint32_t cpu;
+  uint32_t network;
+};
+
+static const uint16_t PERMILLE[] = { 500, 950, 990 };
+static const uint32_t WINDOW_SPAN[SKETCH_WINDOWS] = { 10, 600, 7200 };
+static const uint32_t WINDOW_SLOTS[SKETCH_WINDOWS] = { 6, 6, 12 };
+
+static uint32_t rng = 0x1B873593;
+
+static uint32_t nextRandom() {
+  rng ^= rng << 13;
+  rng ^= rng >> 17;
+  rng ^= rng << 5;
+  return rng;
+}
+
+static uint64_t nowNs() {
+  using namespace std::chrono;
+  return duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count();
+}
+
+// CPU wanders between 5 and 100%. Network sits around a few KB/s with
+// bursts a hundred times higher, and now and then drops to zero
+static std::vector<Sample> generate() {
+  std::vector<Sample> samples;
+  double cpu = 40, level = 2000;
+  uint32_t base = 1700000000;
+  for (uint32_t s = 0; s < SECONDS; s++) {
+    for (int k = 0; k < PER_SECOND; k++) {
+      cpu += ((int)(nextRandom() % 21) - 10) * 0.5;
+      cpu = cpu < 5 ? 5 : cpu > 100 ? 100 : cpu;
+      level *= 1.0 + ((int)(nextRandom() % 201) - 100) / 2000.0;
+      level = level < 300 ? 300 : level > 20000 ? 20000 : level;
+      uint32_t r = nextRandom() % 1000;
+      uint32_t net = r < 5 ? 0 : r < 25 ? (uint32_t)(level * (20 + nextRandom() % 80)) : (uint32_t)level;
+      samples.push_back({ base + s, (uint32_t)cpu, net });
+    }
+  }
+  return samples;
+}
+
+static uint32_t exactQuantile(std::vector<uint32_t>& values, uint16_t permille) {
+  uint32_t target = ((uint64_t)values.size() * permille + 999) / 1000;
+  if (target == 0) target = 1;
+  std::nth_element(values.begin(), values.begin() + (target - 1), values.end());
+  return values[target - 1];
+}
+
+// Within the sketch's relative error of the exact answer. A collapsed
+// sketch only vouches for quantiles above its folded bucket
+template <typename Sketch>
+static bool checkWindow(const char* metric, SketchWindow w, const Sketch& sketch,
+                        std::vector<uint32_t> values, uint32_t now) {
+  if (sketch.count != values.size()) {
+    printf("FAIL: %s %s holds %u samples, expected %u\n", metric, sketchWindowName(w),
+      (unsigned)sketch.count, (unsigned)values.size());
+    return false;
+  }
+  bool ok = true;
+  for (uint16_t p : PERMILLE) {
+    uint32_t exact = exactQuantile(values, p);
+    uint32_t got = sketch.quantile(p);
+    if (sketch.collapsed && Sketch::indexFor(exact) <= sketch.base) continue;
+    double err = exact ? fabs((double)got - exact) / exact : got;
+    if (err > 1.0 / 32 + 1e-9) {
+      printf("FAIL: %s %s p%u at %u: %u, exact %u\n", metric, sketchWindowName(w), p / 10,
+        (unsigned)now, (unsigned)got, (unsigned)exact);
+      ok = false;
+    }
+  }
+  return ok;
+}
+
+int main() {
+  int failures = 0;
+  std::vector<Sample> samples = generate();
+  uint32_t start = samples.front().time;
+
+  static MetricWindowsT<SKETCH_BUCKETS_PERCENT> cpu;
+  static MetricWindowsT<SKETCH_BUCKETS_WIDE> network;
+  cpu.begin(start);
+  network.begin(start);
+
+  LogHistogramT<HISTOGRAM_BUCKETS_FULL> queryNs;
+  queryNs.reset();
+  uint64_t recordNs = 0;
+  uint32_t checks = 0, collapsedChecks = 0;
+  uint32_t nextCheck = start + CHECK_EVERY;
+
+  for (size_t i = 0; i < samples.size(); i++) {
+    const Sample& s = samples[i];
+    uint64_t t0 = nowNs();
+    cpu.record(s.cpu, s.time);
+    network.record(s.network, s.time);
+    recordNs += nowNs() - t0;
+
+    if (s.time < nextCheck && i + 1 < samples.size()) continue;
+    nextCheck += CHECK_EVERY;
+
+    for (uint8_t w = 0; w < SKETCH_WINDOWS; w++) {
+      uint32_t oldest = (s.time / WINDOW_SPAN[w] - (WINDOW_SLOTS[w] - 1)) * WINDOW_SPAN[w];
+      std::vector<uint32_t> cpuRef, netRef;
+      for (size_t j = 0; j <= i; j++) {
+        if (samples[j].time < oldest) continue;
+        cpuRef.push_back(samples[j].cpu);
+        netRef.push_back(samples[j].network);
+      }
+
+      MetricWindowsT<SKETCH_BUCKETS_PERCENT>::Sketch cpuSketch;
+      MetricWindowsT<SKETCH_BUCKETS_WIDE>::Sketch netSketch;
+      uint64_t q0 = nowNs();
+      network.query((SketchWindow)w, netSketch, s.time);
+      queryNs.record(nowNs() - q0);
+      cpu.query((SketchWindow)w, cpuSketch, s.time);
+
+      if (!checkWindow("cpu", (SketchWindow)w, cpuSketch, cpuRef, s.time)) failures++;
+      if (!checkWindow("network", (SketchWindow)w, netSketch, netRef, s.time)) failures++;
+      checks += 2;
+      collapsedChecks += cpuSketch.collapsed + netSketch.collapsed;
+      if (cpuSketch.collapsed) failures++, printf("FAIL: percentages collapsed\n");
+    }
+  }
+
+  // Two thirds merged with the rest answer exactly like the whole
+  QuantileSketchT<SKETCH_BUCKETS_WIDE> whole, first, second;
+  whole.reset();
+  first.reset();
+  second.reset();
+  for (size_t i = 0; i < samples.size(); i++) {
+    uint32_t v = samples[i].network;
+    if (v < 300 || v > 20000) continue;  // no bursts: neither side collapses
+    whole.record(v);
+    (i % 3 ? first : second).record(v);
+  }
+  first.merge(second);
+  bool same = first.count == whole.count && first.minValue == whole.minValue &&
+              first.maxValue == whole.maxValue && !first.collapsed && !whole.collapsed;
+  for (uint16_t p = 1; p <= 1000 && same; p++) same = first.quantile(p) == whole.quantile(p);
+  if (!same) failures++, printf("FAIL: merged parts differ from the whole\n");
+
+  // Every index maps back onto itself, across the whole range
+  for (uint16_t idx = 0; idx < SKETCH_INDEX_COUNT; idx++) {
+    uint32_t low = QuantileSketchT<1>::indexLow(idx);
+    if (QuantileSketchT<1>::indexFor(low) != idx || (idx && QuantileSketchT<1>::indexFor(low - 1) != idx - 1)) {
+      failures++, printf("FAIL: index %u\n", idx);
+      break;
+    }
+  }
+  if (QuantileSketchT<1>::indexFor(UINT32_MAX) != SKETCH_INDEX_COUNT - 1) failures++, printf("FAIL: top index\n");
+
+  size_t bytes = sizeof(cpu) + sizeof(network);
+  printf("Quantile sketches, %u samples over 24h, %u window checks (%u collapsed)\n",
+    (unsigned)samples.size() * 2, (unsigned)checks, (unsigned)collapsedChecks);
+  printf("  memory: cpu %u bytes, network %u bytes, %u total\n",
+    (unsigned)sizeof(cpu), (unsigned)sizeof(network), (unsigned)bytes);
+  printf("  record (3 windows) %7.1f ns/sample\n", (double)recordNs / (samples.size() * 2));
+  printf("  window query       p50 %7u ns  p99 %7u ns  max %7u ns\n",
+    (unsigned)queryNs.percentile(500), (unsigned)queryNs.percentile(990), (unsigned)queryNs.maxValue);
+
+  printf(failures ? "%d checks FAILED\n" : "All checks passed\n", failures);
+  return failures ? 1 : 0;
+}
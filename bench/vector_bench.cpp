@@ -0,0 +1,277 @@
+/**
+ * ══════════════════════════════════════════════════════════════════════════
+ *                    🖤🛣️ VECTOR INDEX BENCHMARK 🛣️🖤
+ * ══════════════════════════════════════════════════════════════════════════
+ *
+ * Fills the project vector index with a full cache of synthetic
+ * embeddings (projects around shared topics, some between two) in a RAM
+ * model of flash. Times "related projects" queries, and measures their
+ * recall@8 against a brute-force scan of every vector. Then applies
+ * deltas, remounts, and checks that nothing was lost and that flash was
+ * only ever programmed from 1 to 0.
+ *
+ * Host numbers are a lower bound: on the ESP32 every record read goes
+ * through the flash cache. Use the `related` serial command for
+ * on-device timings.
+ *
+ *   make -C bench run
+ */
+
+#include "vector_index.h"
+#include "histogram.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#define TOPICS        64
+#define QUERIES       1000
+#define MIN_RECALL    0.90
+
+// NOR flash model: erase sets 0xFF, programming can only clear bits
+class RamStorage : public SearchStorage {
+ public:
+  explicit RamStorage(uint32_t bytes) : flash(bytes, 0xFF) {}
+
+  uint32_t size() const override { return flash.size(); }
+  const uint8_t* data() const override { return flash.data(); }
+
+  bool erase(uint32_t offset, uint32_t length) override {
+    if (offset % VECTOR_SECTOR_SIZE || length % VECTOR_SECTOR_SIZE) return false;
+    if (offset + length > flash.size()) return false;
+    memset(&flash[offset], 0xFF, length);
+    erases += length / VECTOR_SECTOR_SIZE;
+    return true;
+  }
+
+  bool write(uint32_t offset, const void* src, uint32_t length) override {
+    if (offset + length > flash.size()) return false;
+    const uint8_t* in = (const uint8_t*)src;
+    for (uint32_t i = 0; i < length; i++) {
+      if ((flash[offset + i] & in[i]) != in[i]) bitErrors++;
+      flash[offset + i] &= in[i];
+    }
+    return true;
+  }
+
+  std::vector<uint8_t> flash;
+  uint32_t erases = 0;
+  uint32_t bitErrors = 0;
+};
+
+struct Project {
+  uint32_t id;
+  std::string name;
+  int8_t v[VECTOR_DIM];
+};
+
+static uint32_t rng = 0x9E3779B9;
+
+static uint32_t nextRandom() {
+  rng ^= rng << 13;
+  rng ^= rng >> 17;
+  rng ^= rng << 5;
+  return rng;
+}
+
+static double gaussian() {
+  double u = (nextRandom() + 1.0) / 4294967297.0, v = (nextRandom() + 1.0) / 4294967297.0;
+  return sqrt(-2 * log(u)) * cos(6.283185307179586 * v);
+}
+
+static uint64_t nowNs() {
+  using namespace std::chrono;
+  return duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count();
+}
+
+// Unit vector scaled so its largest component is ±127, as the backend sends
+static void quantize(const std::vector<double>& f, int8_t* out) {
+  double top = 1e-9;
+  for (double x : f) top = std::max(top, fabs(x));
+  for (int i = 0; i < VECTOR_DIM; i++) out[i] = (int8_t)lround(f[i] * 127 / top);
+}
+
+static std::vector<std::vector<double>> topics;
+
+static void embed(Project& p) {
+  uint32_t a = nextRandom() % TOPICS, b = nextRandom() % TOPICS;
+  double mix = nextRandom() % 4 == 0 ? 0.4 : 0.0;  // a quarter sit between two topics
+  std::vector<double> f(VECTOR_DIM);
+  for (int i = 0; i < VECTOR_DIM; i++) f[i] = (1 - mix) * topics[a][i] + mix * topics[b][i] + 0.55 * gaussian();
+  quantize(f, p.v);
+}
+
+static std::vector<Project> makeProjects(uint32_t count, uint32_t firstId) {
+  std::vector<Project> projects(count);
+  for (uint32_t i = 0; i < count; i++) {
+    projects[i].id = firstId + i;
+    projects[i].name = "Project " + std::to_string(firstId + i);
+    embed(projects[i]);
+  }
+  return projects;
+}
+
+static std::string base64(const int8_t* v) {
+  static const char* table = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+  std::string out;
+  for (int i = 0; i < VECTOR_DIM; i += 3) {
+    uint32_t n = (uint8_t)v[i] << 16;
+    if (i + 1 < VECTOR_DIM) n |= (uint8_t)v[i + 1] << 8;
+    if (i + 2 < VECTOR_DIM) n |= (uint8_t)v[i + 2];
+    out += table[n >> 18];
+    out += table[(n >> 12) & 63];
+    out += i + 1 < VECTOR_DIM ? table[(n >> 6) & 63] : '=';
+    out += i + 2 < VECTOR_DIM ? table[n & 63] : '=';
+  }
+  return out;
+}
+
+static double recall(const VectorHit* got, uint8_t n, const VectorHit* exact, uint8_t m) {
+  if (m == 0) return 1;
+  uint8_t found = 0;
+  for (uint8_t i = 0; i < m; i++) {
+    for (uint8_t j = 0; j < n; j++) {
+      // Equal scores may tie in either order: a hit scoring as well as the
+      // exact one counts
+      if (got[j].id == exact[i].id || (j == i && got[j].score >= exact[i].score)) {
+        found++;
+        break;
+      }
+    }
+  }
+  return (double)found / m;
+}
+
+int main() {
+  int failures = 0;
+  topics.assign(TOPICS, std::vector<double>(VECTOR_DIM));
+  for (auto& t : topics) {
+    for (double& x : t) x = gaussian();
+  }
+
+  RamStorage flash(VECTOR_STORAGE_BYTES);
+  static VectorIndex index;
+  if (!index.begin(&flash)) {
+    printf("FAIL: mount on blank flash\n");
+    return 1;
+  }
+
+  // Full snapshot, one item too many
+  std::vector<Project> projects = makeProjects(VECTOR_CAPACITY + 1, 1);
+  uint64_t t0 = nowNs();
+  index.snapshotBegin(42);
+  uint32_t refused = 0;
+  for (const Project& p : projects) refused += !index.snapshotAdd(p.id, p.name.c_str(), p.v);
+  if (!index.snapshotEnd()) failures++, printf("FAIL: snapshot commit\n");
+  double snapshotMs = (nowNs() - t0) / 1e6;
+  projects.pop_back();
+  VectorIndexStats s = index.stats();
+  if (refused != 1 || s.entries != VECTOR_CAPACITY || s.version != 42) {
+    failures++, printf("FAIL: snapshot holds %u (refused %u), version %u\n", s.entries, (unsigned)refused, (unsigned)s.version);
+  }
+
+  // Related projects against brute force
+  LogHistogramT<HISTOGRAM_BUCKETS_FULL> queryNs, exactNs;
+  queryNs.reset();
+  exactNs.reset();
+  double recallSum = 0;
+  uint32_t scanned = 0;
+  for (int q = 0; q < QUERIES; q++) {
+    const Project& p = projects[nextRandom() % projects.size()];
+    VectorHit got[VECTOR_MAX_RESULTS], exact[VECTOR_MAX_RESULTS];
+    uint64_t q0 = nowNs();
+    uint8_t n = index.related(p.id, got, VECTOR_MAX_RESULTS);
+    queryNs.record(nowNs() - q0);
+    scanned += index.stats().lastScanned;
+    q0 = nowNs();
+    uint8_t m = index.queryExact(p.v, p.id, exact, VECTOR_MAX_RESULTS);
+    exactNs.record(nowNs() - q0);
+    recallSum += recall(got, n, exact, m);
+    for (uint8_t i = 0; i < n; i++) {
+      if (got[i].id == p.id) failures++, printf("FAIL: %u related to itself\n", (unsigned)p.id);
+      if (i && got[i].score > got[i - 1].score) failures++, printf("FAIL: hits out of order\n");
+    }
+  }
+  double meanRecall = recallSum / QUERIES;
+  if (meanRecall < MIN_RECALL) failures++, printf("FAIL: recall@8 %.3f\n", meanRecall);
+
+  // Deltas: updates, removals, then new projects into the freed room
+  uint32_t erasesBefore = flash.erases;
+  for (int i = 0; i < 300; i++) {
+    Project& p = projects[nextRandom() % projects.size()];
+    embed(p);
+    if (!index.put(p.id, p.name.c_str(), p.v)) failures++, printf("FAIL: update %u\n", (unsigned)p.id);
+  }
+  std::vector<uint32_t> removed;
+  for (int i = 0; i < 200; i++) {
+    size_t at = nextRandom() % projects.size();
+    removed.push_back(projects[at].id);
+    if (!index.remove(projects[at].id)) failures++, printf("FAIL: remove\n");
+    projects.erase(projects.begin() + at);
+  }
+  std::vector<Project> added = makeProjects(200, 100000);
+  uint32_t addedOk = 0;
+  for (const Project& p : added) {
+    if (!index.put(p.id, p.name.c_str(), p.v)) break;
+    projects.push_back(p);
+    addedOk++;
+  }
+  if (addedOk != 200) failures++, printf("FAIL: only %u of 200 new projects fit\n", (unsigned)addedOk);
+  if (index.put(999999, "one too many", added[0].v)) failures++, printf("FAIL: put past capacity\n");
+  index.setVersion(43);
+  uint32_t deltaErases = flash.erases - erasesBefore;
+  index.service();
+
+  // Remount: same contents, same version, same answers
+  static VectorIndex again;
+  if (!again.begin(&flash)) failures++, printf("FAIL: remount\n");
+  VectorIndexStats a = again.stats();
+  if (a.entries != index.stats().entries || a.version != 43) {
+    failures++, printf("FAIL: remount has %u entries, version %u\n", a.entries, (unsigned)a.version);
+  }
+  uint32_t wrong = 0;
+  for (const Project& p : projects) {
+    const int8_t* v = again.vector(p.id);
+    if (!v || memcmp(v, p.v, VECTOR_DIM) != 0) wrong++;
+  }
+  for (uint32_t id : removed) wrong += again.contains(id);
+  if (wrong) failures++, printf("FAIL: %u projects wrong after remount\n", (unsigned)wrong);
+
+  // Version log wraps into the header
+  for (uint32_t v = 44; v < 44 + 1500; v++) again.setVersion(v);
+  static VectorIndex third;
+  third.begin(&flash);
+  if (third.version() != 44 + 1499) failures++, printf("FAIL: version %u after log wrap\n", (unsigned)third.version());
+
+  // An aborted snapshot leaves an empty index at version 0
+  third.snapshotBegin(77);
+  for (int i = 0; i < 50; i++) third.snapshotAdd(projects[i].id, projects[i].name.c_str(), projects[i].v);
+  third.snapshotAbort();
+  static VectorIndex fourth;
+  fourth.begin(&flash);
+  if (fourth.stats().entries != 0 || fourth.version() != 0) failures++, printf("FAIL: aborted snapshot visible\n");
+
+  if (flash.bitErrors) failures++, printf("FAIL: %u bytes programmed without an erase\n", (unsigned)flash.bitErrors);
+
+  int8_t decoded[VECTOR_DIM];
+  if (!vectorDecode(base64(projects[0].v).c_str(), decoded) || memcmp(decoded, projects[0].v, VECTOR_DIM) != 0) {
+    failures++, printf("FAIL: base64 round trip\n");
+  }
+  if (vectorDecode("AAAA", decoded) || vectorDecode("!!", decoded)) failures++, printf("FAIL: bad base64 accepted\n");
+
+  printf("Vector index, %u projects × %u dims, %u lists, %u probed\n",
+    (unsigned)VECTOR_CAPACITY, (unsigned)VECTOR_DIM, (unsigned)s.lists, (unsigned)VECTOR_PROBES);
+  printf("  flash %u bytes, RAM %u bytes, snapshot %.1f ms, clustering %u us\n",
+    (unsigned)VECTOR_STORAGE_BYTES, (unsigned)sizeof(VectorIndex), snapshotMs, (unsigned)s.clusterUs);
+  printf("  related            p50 %7u ns  p99 %7u ns  %u codes compared  recall@8 %.3f\n",
+    (unsigned)queryNs.percentile(500), (unsigned)queryNs.percentile(990), (unsigned)(scanned / QUERIES), meanRecall);
+  printf("  brute force        p50 %7u ns  p99 %7u ns\n",
+    (unsigned)exactNs.percentile(500), (unsigned)exactNs.percentile(990));
+  printf("  700 deltas: %u sector erases, %u deleted slots left\n", (unsigned)deltaErases, (unsigned)a.deleted);
+
+  printf(failures ? "%d checks FAILED\n" : "All checks passed\n", failures);
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,627 @@
+/**
+ * ══════════════════════════════════════════════════════════════════════════
+ *                    🖤🛣️ HUB GATEWAY 🛣️🖤
+ * ══════════════════════════════════════════════════════════════════════════
+ */
+
+#include "gateway.h"
+#include "ws_protocol.h"
+
+#include <arpa/inet.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <time.h>
+#include <unistd.h>
+
+#define EPOLL_BATCH 256
+
+uint64_t gatewayNowMs() {
+  timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+}
+
+// ══════════════════════════════════════════════════════════════════════════
+// SHARED FRAMES
+// ══════════════════════════════════════════════════════════════════════════
+
+static SharedFrame* allocFrame(size_t size) {
+  SharedFrame* f = static_cast<SharedFrame*>(::operator new(sizeof(SharedFrame) + size));
+  f->refs = 1;
+  f->size = (uint32_t)size;
+  return f;
+}
+
+SharedFrame* SharedFrame::text(const char* payload, size_t len) {
+  uint8_t header[WS_HEADER_MAX];
+  size_t h = wsFrameHeader(WS_OP_TEXT, len, header);
+  SharedFrame* f = allocFrame(h + len);
+  memcpy(f->data(), header, h);
+  memcpy(f->data() + h, payload, len);
+  return f;
+}
+
+SharedFrame* SharedFrame::control(uint8_t opcode, const uint8_t* payload, size_t len) {
+  if (len > 125) len = 125;
+  SharedFrame* f = allocFrame(2 + len);
+  wsFrameHeader(opcode, len, f->data());
+  if (len) memcpy(f->data() + 2, payload, len);
+  return f;
+}
+
+void SharedFrame::unref() {
+  if (--refs == 0) ::operator delete(this);
+}
+
+// Bytes that are not a WebSocket frame (the handshake reply)
+static SharedFrame* rawFrame(const char* data, size_t len) {
+  SharedFrame* f = allocFrame(len);
+  memcpy(f->data(), data, len);
+  return f;
+}
+
+// ══════════════════════════════════════════════════════════════════════════
+// CONNECTIONS
+// ══════════════════════════════════════════════════════════════════════════
+
+struct Gateway::Conn {
+  struct Out {
+    SharedFrame* frame;
+    uint32_t offset;
+  };
+
+  int fd = -1;
+  uint32_t serial = 0;
+  bool upgraded = false;
+  bool closing = false;       // close once the queue is out
+  bool writeWatched = false;
+  bool dirty = false;         // queued since the last flush
+  uint64_t openedMs = 0;
+  uint64_t lastSeenMs = 0;
+  std::string in;
+  std::string message;        // fragments of one message
+  bool inMessage = false;
+  std::deque<Out> out;
+  size_t queued = 0;
+  int32_t subIndex[GW_MAX_CHANNELS];
+};
+
+// Scratch shared by every message; the loop is single-threaded
+static std::vector<JsonField> fieldScratch;
+
+Gateway::Gateway() {}
+
+Gateway::~Gateway() {
+  for (auto& c : conns) {
+    if (c) close(*c);
+  }
+  for (uint8_t i = 0; i < channelCount; i++) {
+    if (channels[i].snapshot) channels[i].snapshot->unref();
+  }
+  if (listenFd >= 0) ::close(listenFd);
+  if (wakeFd >= 0) ::close(wakeFd);
+  if (epollFd >= 0) ::close(epollFd);
+}
+
+bool Gateway::listen(const char* bindAddr, uint16_t port) {
+  epollFd = epoll_create1(EPOLL_CLOEXEC);
+  wakeFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+  listenFd = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+  if (epollFd < 0 || wakeFd < 0 || listenFd < 0) {
+    perror("gateway: setup");
+    return false;
+  }
+
+  int one = 1;
+  setsockopt(listenFd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+  sockaddr_in addr = {};
+  addr.sin_family = AF_INET;
+  addr.sin_port = htons(port);
+  if (inet_pton(AF_INET, bindAddr, &addr.sin_addr) != 1) {
+    fprintf(stderr, "gateway: bad bind address %s\n", bindAddr);
+    return false;
+  }
+  if (bind(listenFd, (sockaddr*)&addr, sizeof(addr)) < 0 || ::listen(listenFd, SOMAXCONN) < 0) {
+    perror("gateway: bind");
+    return false;
+  }
+  socklen_t len = sizeof(addr);
+  getsockname(listenFd, (sockaddr*)&addr, &len);
+  boundPort = ntohs(addr.sin_port);
+
+  epoll_event ev = {};
+  ev.events = EPOLLIN;
+  ev.data.fd = listenFd;
+  epoll_ctl(epollFd, EPOLL_CTL_ADD, listenFd, &ev);
+  ev.data.fd = wakeFd;
+  epoll_ctl(epollFd, EPOLL_CTL_ADD, wakeFd, &ev);
+  lastSweepMs = gatewayNowMs();
+  return true;
+}
+
+void Gateway::run() {
+  running = true;
+  while (running) pollOnce(GW_SWEEP_MS);
+}
+
+void Gateway::stop() {
+  running = false;
+  uint64_t one = 1;
+  if (write(wakeFd, &one, sizeof(one)) < 0) {}
+}
+
+void Gateway::pollOnce(int timeoutMs) {
+  epoll_event events[EPOLL_BATCH];
+  polling = true;
+
+  int n = epoll_wait(epollFd, events, EPOLL_BATCH, timeoutMs < GW_SWEEP_MS ? timeoutMs : GW_SWEEP_MS);
+  for (int i = 0; i < n; i++) {
+    int fd = events[i].data.fd;
+    if (fd == listenFd) {
+      acceptAll();
+      continue;
+    }
+    if (fd == wakeFd) {
+      uint64_t count;
+      if (read(wakeFd, &count, sizeof(count)) < 0) {}
+      drainPending();
+      continue;
+    }
+    if ((size_t)fd >= conns.size() || !conns[fd]) continue;
+    Conn& c = *conns[fd];
+    uint32_t e = events[i].events;
+    if (e & EPOLLIN) onReadable(c);
+    else if (e & (EPOLLERR | EPOLLHUP)) close(c);
+    if (c.fd >= 0 && (e & EPOLLOUT)) flush(c);
+  }
+
+  // One writev per hub for everything queued in this pass
+  for (Conn* c : dirty) {
+    if (c->fd >= 0 && c->dirty) flush(*c);
+  }
+  dirty.clear();
+  polling = false;
+
+  uint64_t now = gatewayNowMs();
+  if (now - lastSweepMs >= GW_SWEEP_MS) sweep(now);
+  dead.clear();
+}
+
+void Gateway::acceptAll() {
+  for (;;) {
+    int fd = accept4(listenFd, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+    if (fd < 0) {
+      if (errno == EMFILE || errno == ENFILE) perror("gateway: accept");
+      return;  // EAGAIN: all taken
+    }
+    int one = 1;
+    setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+
+    if ((size_t)fd >= conns.size()) conns.resize(fd + 1024);
+    conns[fd].reset(new Conn());
+    Conn& c = *conns[fd];
+    c.fd = fd;
+    c.serial = nextSerial++;
+    c.openedMs = c.lastSeenMs = gatewayNowMs();
+    for (int32_t& s : c.subIndex) s = -1;
+
+    epoll_event ev = {};
+    ev.events = EPOLLIN | EPOLLRDHUP;
+    ev.data.fd = fd;
+    epoll_ctl(epollFd, EPOLL_CTL_ADD, fd, &ev);
+    open++;
+    counters.accepted++;
+  }
+}
+
+void Gateway::onReadable(Conn& c) {
+  char buf[GW_READ_CHUNK];
+  ssize_t n = recv(c.fd, buf, sizeof(buf), 0);
+  if (n <= 0) {
+    if (n < 0 && (errno == EAGAIN || errno == EINTR)) return;
+    close(c);
+    return;
+  }
+  c.lastSeenMs = gatewayNowMs();
+  if (c.closing) return;  // reply queued, nothing more to read
+  c.in.append(buf, n);
+
+  if (!c.upgraded && !handshake(c)) return;
+  if (c.upgraded) readFrames(c);
+}
+
+bool Gateway::handshake(Conn& c) {
+  size_t end = c.in.find("\r\n\r\n");
+  if (end == std::string::npos) {
+    if (c.in.size() <= GW_MAX_MESSAGE) return false;
+    end = 0;  // too long to be a hub: reject below
+  }
+
+  WsUpgradeRequest req;
+  std::string_view head(c.in.data(), end);
+  std::string_view path;
+  if (end && wsParseUpgrade(head, req)) path = req.path.substr(0, req.path.find('?'));
+  if (path != "/ws") {
+    static const char reply[] = "HTTP/1.1 400 Bad Request\r\nConnection: close\r\nContent-Length: 0\r\n\r\n";
+    counters.rejected++;
+    c.closing = true;
+    sendRaw(c, reply, sizeof(reply) - 1);
+    return false;
+  }
+
+  char accept[WS_ACCEPT_LEN + 1];
+  wsAcceptKey(req.key, accept);
+  std::string reply = "HTTP/1.1 101 Switching Protocols\r\nUpgrade: websocket\r\nConnection: Upgrade\r\n"
+                      "Sec-WebSocket-Accept: ";
+  reply += accept;
+  // The hub's client offers "arduino" and expects it back
+  if (!req.protocol.empty()) {
+    reply += "\r\nSec-WebSocket-Protocol: ";
+    reply += req.protocol;
+  }
+  reply += "\r\n\r\n";
+
+  c.in.erase(0, end + 4);
+  c.upgraded = true;
+  counters.upgraded++;
+  sendRaw(c, reply.data(), reply.size());
+  return true;
+}
+
+bool Gateway::readFrames(Conn& c) {
+  size_t at = 0;
+  while (c.fd >= 0 && !c.closing) {
+    WsFrame f;
+    long used = wsParseClientFrame((uint8_t*)&c.in[at], c.in.size() - at, GW_MAX_MESSAGE, f);
+    if (used == 0) break;
+    if (used < 0) {
+      close(c);
+      return false;
+    }
+    const char* payload = c.in.data() + at + f.headerLen;
+    at += used;
+
+    switch (f.opcode) {
+      case WS_OP_TEXT:
+      case WS_OP_BINARY:
+      case WS_OP_CONTINUATION:
+        if (f.opcode != WS_OP_CONTINUATION) {
+          c.message.clear();
+          c.inMessage = f.opcode == WS_OP_TEXT;  // binary from a hub is ignored
+        }
+        if (!c.inMessage) break;
+        if (f.fin && c.message.empty()) {
+          onMessage(c, payload, f.payloadLen);  // the usual case: no copy
+          c.inMessage = false;
+          break;
+        }
+        c.message.append(payload, f.payloadLen);
+        if (c.message.size() > GW_MAX_MESSAGE) {
+          close(c);
+          return false;
+        }
+        if (f.fin) {
+          onMessage(c, c.message.data(), c.message.size());
+          c.message.clear();
+          c.inMessage = false;
+        }
+        break;
+
+      case WS_OP_PING:
+        send(c, SharedFrame::control(WS_OP_PONG, (const uint8_t*)payload, f.payloadLen));
+        break;
+
+      case WS_OP_CLOSE:
+        // Echo the status code, then hang up once it is out
+        send(c, SharedFrame::control(WS_OP_CLOSE, (const uint8_t*)payload, f.payloadLen < 2 ? f.payloadLen : 2));
+        c.closing = true;
+        break;
+
+      default:
+        break;
+    }
+  }
+  if (c.fd >= 0) c.in.erase(0, at);
+  return c.fd >= 0;
+}
+
+void Gateway::onMessage(Conn& c, const char* text, size_t len) {
+  counters.messagesIn++;
+  std::string_view json(text, len);
+  if (!jsonFlatParse(json, fieldScratch)) return;
+  std::string_view type = jsonStringValue(jsonFind(fieldScratch, "type"));
+
+  char reply[96];
+  if (type == "ping") {
+    // Answered here, at once: the hub's RTT is to the gateway
+    int n = snprintf(reply, sizeof(reply), "{\"type\":\"pong\",\"seq\":%llu}",
+      (unsigned long long)jsonUintValue(jsonFind(fieldScratch, "seq"), 0));
+    send(c, SharedFrame::text(reply, n));
+  } else if (type == "subscribe") {
+    int ch = channelFor(std::string(jsonStringValue(jsonFind(fieldScratch, "channel"))), true);
+    if (ch >= 0) subscribe(c, ch);
+  } else if (type == "getMetrics") {
+    int ch = channelFor("metrics", false);
+    SharedFrame* snap = ch >= 0 ? snapshotOf(channels[ch]) : nullptr;
+    if (snap) {
+      snap->ref();
+      send(c, snap);
+    }
+  } else if (type == "command") {
+    counters.commands++;
+    if (commandHandler) {
+      commandHandler((uint64_t)c.fd << 32 | c.serial, std::string(json));
+    } else {
+      int n = snprintf(reply, sizeof(reply), "{\"type\":\"commandAck\",\"id\":%llu,\"ok\":false,\"error\":\"no command backend\"}",
+        (unsigned long long)jsonUintValue(jsonFind(fieldScratch, "id"), 0));
+      send(c, SharedFrame::text(reply, n));
+    }
+  }
+  // getProjects, getIndex and getAgents are not served by the gateway
+}
+
+// ══════════════════════════════════════════════════════════════════════════
+// CHANNELS
+// ══════════════════════════════════════════════════════════════════════════
+
+void Gateway::publish(const std::string& channel, std::string json) {
+  {
+    std::lock_guard<std::mutex> lock(pendingLock);
+    pending.push_back({ false, channel, 0, std::move(json) });
+  }
+  uint64_t one = 1;
+  if (write(wakeFd, &one, sizeof(one)) < 0) {}
+}
+
+void Gateway::commandDone(uint64_t token, std::string ackJson) {
+  {
+    std::lock_guard<std::mutex> lock(pendingLock);
+    pending.push_back({ true, std::string(), token, std::move(ackJson) });
+  }
+  uint64_t one = 1;
+  if (write(wakeFd, &one, sizeof(one)) < 0) {}
+}
+
+void Gateway::drainPending() {
+  {
+    std::lock_guard<std::mutex> lock(pendingLock);
+    taking.swap(pending);
+  }
+  for (Pending& p : taking) {
+    if (!p.command) {
+      applyPublish(p.channel, p.json);
+      continue;
+    }
+    // The hub may have gone, and its fd been reused, since it asked
+    size_t fd = p.token >> 32;
+    if (fd < conns.size() && conns[fd] && conns[fd]->serial == (uint32_t)p.token && conns[fd]->upgraded) {
+      send(*conns[fd], SharedFrame::text(p.json.data(), p.json.size()));
+    }
+  }
+  taking.clear();
+}
+
+int Gateway::channelFor(const std::string& name, bool create) {
+  if (name.empty()) return -1;
+  for (uint8_t i = 0; i < channelCount; i++) {
+    if (channels[i].name == name) return i;
+  }
+  if (!create || channelCount == GW_MAX_CHANNELS) return -1;
+  channels[channelCount].name = name;
+  return channelCount++;
+}
+
+// The whole document as one frame, rebuilt after a change
+SharedFrame* Gateway::snapshotOf(Channel& ch) {
+  if (ch.snapshot || ch.fields.empty()) return ch.snapshot;
+  std::string json = "{";
+  for (auto& f : ch.fields) {
+    if (json.size() > 1) json += ',';
+    json += '"';
+    json += f.first;
+    json += "\":";
+    json += f.second;
+  }
+  json += '}';
+  ch.snapshot = SharedFrame::text(json.data(), json.size());
+  return ch.snapshot;
+}
+
+void Gateway::subscribe(Conn& c, int channel) {
+  Channel& ch = channels[channel];
+  if (c.subIndex[channel] < 0) {
+    c.subIndex[channel] = (int32_t)ch.subscribers.size();
+    ch.subscribers.push_back(&c);
+  }
+  SharedFrame* snap = snapshotOf(ch);
+  if (snap) {
+    snap->ref();
+    send(c, snap);
+  }
+}
+
+void Gateway::applyPublish(const std::string& name, const std::string& json) {
+  counters.publishes++;
+  if (!jsonFlatParse(json, fieldScratch)) {
+    fprintf(stderr, "gateway: %s: not a JSON object, dropped\n", name.c_str());
+    return;
+  }
+  int index = channelFor(name, true);
+  if (index < 0) return;
+  Channel& ch = channels[index];
+
+  // Changed and new fields; "type" always goes along so the hub can route it
+  std::string delta = "{";
+  bool changed = false;
+  for (const JsonField& f : fieldScratch) {
+    bool isType = f.key == "type";
+    auto known = ch.fields.begin();
+    while (known != ch.fields.end() && known->first != f.key) ++known;
+    if (known == ch.fields.end()) {
+      ch.fields.emplace_back(std::string(f.key), std::string(f.value));
+    } else if (known->second != f.value) {
+      known->second.assign(f.value.data(), f.value.size());
+    } else if (!isType) {
+      continue;
+    }
+    changed |= !isType;
+    if (delta.size() > 1) delta += ',';
+    delta += '"';
+    delta.append(f.key.data(), f.key.size());
+    delta += "\":";
+    delta.append(f.value.data(), f.value.size());
+  }
+  if (!changed) return;
+  delta += '}';
+  counters.deltas++;
+
+  if (ch.snapshot) {
+    ch.snapshot->unref();
+    ch.snapshot = nullptr;
+  }
+
+  // Backwards, so a slow hub removed on the way does not shift the rest
+  SharedFrame* frame = SharedFrame::text(delta.data(), delta.size());
+  for (size_t i = ch.subscribers.size(); i-- > 0;) {
+    if (i >= ch.subscribers.size()) continue;
+    frame->ref();
+    send(*ch.subscribers[i], frame);
+  }
+  frame->unref();
+}
+
+// ══════════════════════════════════════════════════════════════════════════
+// OUTPUT
+// ══════════════════════════════════════════════════════════════════════════
+
+// Takes over the caller's reference
+void Gateway::send(Conn& c, SharedFrame* frame) {
+  if (c.fd < 0) {
+    frame->unref();
+    return;
+  }
+  if (c.queued + frame->size > GW_MAX_QUEUED_BYTES) {
+    frame->unref();
+    counters.slowClosed++;
+    close(c);
+    return;
+  }
+  c.out.push_back({ frame, 0 });
+  c.queued += frame->size;
+  counters.framesOut++;
+
+  if (!c.dirty && !c.writeWatched) {
+    c.dirty = true;
+    if (polling) dirty.push_back(&c);
+    else flush(c);
+  }
+}
+
+void Gateway::sendRaw(Conn& c, const char* data, size_t len) {
+  send(c, rawFrame(data, len));
+}
+
+void Gateway::flush(Conn& c) {
+  c.dirty = false;
+  while (!c.out.empty()) {
+    iovec iov[GW_IOV_MAX];
+    int n = 0;
+    size_t asked = 0;
+    for (auto it = c.out.begin(); it != c.out.end() && n < GW_IOV_MAX; ++it, n++) {
+      iov[n].iov_base = it->frame->data() + it->offset;
+      iov[n].iov_len = it->frame->size - it->offset;
+      asked += iov[n].iov_len;
+    }
+
+    ssize_t wrote = writev(c.fd, iov, n);
+    counters.writevCalls++;
+    if (wrote < 0) {
+      if (errno == EINTR) continue;
+      if (errno == EAGAIN) break;
+      close(c);
+      return;
+    }
+    counters.bytesOut += wrote;
+    c.queued -= wrote;
+
+    size_t left = wrote;
+    while (left) {
+      Conn::Out& o = c.out.front();
+      size_t rest = o.frame->size - o.offset;
+      if (left < rest) {
+        o.offset += left;
+        break;
+      }
+      left -= rest;
+      o.frame->unref();
+      c.out.pop_front();
+    }
+    if ((size_t)wrote < asked) break;  // socket buffer full
+  }
+
+  watchWrite(c, !c.out.empty());
+  if (c.out.empty() && c.closing) close(c);
+}
+
+void Gateway::watchWrite(Conn& c, bool on) {
+  if (c.writeWatched == on) return;
+  c.writeWatched = on;
+  epoll_event ev = {};
+  ev.events = EPOLLIN | EPOLLRDHUP | (on ? (uint32_t)EPOLLOUT : 0u);
+  ev.data.fd = c.fd;
+  epoll_ctl(epollFd, EPOLL_CTL_MOD, c.fd, &ev);
+}
+
+void Gateway::close(Conn& c) {
+  if (c.fd < 0) return;
+  for (uint8_t i = 0; i < channelCount; i++) {
+    int32_t at = c.subIndex[i];
+    if (at < 0) continue;
+    std::vector<Conn*>& subs = channels[i].subscribers;
+    subs[at] = subs.back();
+    subs[at]->subIndex[i] = at;
+    subs.pop_back();
+    c.subIndex[i] = -1;
+  }
+  for (Conn::Out& o : c.out) o.frame->unref();
+  c.out.clear();
+  c.queued = 0;
+
+  int fd = c.fd;
+  epoll_ctl(epollFd, EPOLL_CTL_DEL, fd, nullptr);
+  ::close(fd);
+  c.fd = -1;
+  open--;
+  counters.closed++;
+  // Other code in this pass may still hold &c; it goes at the end of it
+  dead.push_back(std::move(conns[fd]));
+}
+
+void Gateway::sweep(uint64_t nowMs) {
+  lastSweepMs = nowMs;
+  for (auto& p : conns) {
+    if (!p || p->fd < 0) continue;
+    Conn& c = *p;
+    if (!c.upgraded && nowMs - c.openedMs > GW_HANDSHAKE_MS) {
+      close(c);
+    } else if (c.upgraded && nowMs - c.lastSeenMs > GW_IDLE_TIMEOUT_MS) {
+      counters.idleClosed++;
+      close(c);
+    }
+  }
+}
+
+size_t Gateway::subscribers(const std::string& channel) const {
+  for (uint8_t i = 0; i < channelCount; i++) {
+    if (channels[i].name == channel) return channels[i].subscribers.size();
+  }
+  return 0;
+}
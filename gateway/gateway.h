@@ -0,0 +1,164 @@
+/**
+ * ══════════════════════════════════════════════════════════════════════════
+ *                    🖤🛣️ HUB GATEWAY 🛣️🖤
+ * ══════════════════════════════════════════════════════════════════════════
+ *
+ * One process between the backends and every hub on the floor. It speaks
+ * the hub's /ws protocol, so a hub only needs it at the top of
+ * WS_ENDPOINTS.
+ *
+ * Backend documents come in through publish(), one per channel (for
+ * example the metrics object). The gateway keeps the latest fields of
+ * each channel and sends subscribers only the fields that changed:
+ *
+ *   publish("metrics", {"projects":30247,"cpu":45,...})
+ *   → subscribers get {"cpu":47}
+ *
+ * A new subscriber, and any getMetrics request, gets the whole document
+ * at once. No hub request ever reaches the backend.
+ *
+ * Single-threaded epoll loop, level-triggered, non-blocking sockets.
+ * Fan-out is zero-copy: a delta is encoded into one SharedFrame, and each
+ * subscriber's queue holds a reference to it. Queues go out with
+ * writev(), so the payload is never copied per hub. A hub whose queue
+ * grows past GW_MAX_QUEUED_BYTES is disconnected. The hub reconnects and
+ * starts over from a full snapshot.
+ *
+ * publish(), commandDone() and stop() are thread-safe: they hand work to
+ * the loop through an eventfd. Everything else runs on the loop thread.
+ */
+
+#ifndef GATEWAY_H
+#define GATEWAY_H
+
+#include <stdint.h>
+#include <atomic>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#define GW_MAX_CHANNELS      8
+#define GW_MAX_MESSAGE       4096        // largest hub message, fragments joined
+#define GW_MAX_QUEUED_BYTES  (256 * 1024)
+#define GW_READ_CHUNK        4096
+#define GW_IOV_MAX           64          // frames per writev()
+#define GW_IDLE_TIMEOUT_MS   30000       // hubs ping every 2 s
+#define GW_HANDSHAKE_MS      5000
+#define GW_SWEEP_MS          1000
+
+// One encoded server frame shared by every queue it sits in. Only the
+// loop thread touches the count, so it is a plain integer.
+struct SharedFrame {
+  uint32_t refs;
+  uint32_t size;
+  uint8_t* data() { return reinterpret_cast<uint8_t*>(this + 1); }
+
+  static SharedFrame* text(const char* payload, size_t len);
+  static SharedFrame* control(uint8_t opcode, const uint8_t* payload, size_t len);
+  void ref() { refs++; }
+  void unref();
+};
+
+struct GatewayStats {
+  uint64_t accepted;
+  uint64_t upgraded;
+  uint64_t rejected;       // bad handshakes
+  uint64_t closed;
+  uint64_t slowClosed;     // queue over GW_MAX_QUEUED_BYTES
+  uint64_t idleClosed;
+  uint64_t messagesIn;
+  uint64_t publishes;
+  uint64_t deltas;         // publishes that changed something
+  uint64_t framesOut;      // frames queued, per hub
+  uint64_t bytesOut;
+  uint64_t writevCalls;
+  uint64_t commands;
+};
+
+// Called on the loop thread with a hub's command message; the answer
+// goes back through commandDone(token, ...)
+typedef std::function<void(uint64_t token, const std::string& json)> CommandHandler;
+
+class Gateway {
+ public:
+  Gateway();
+  ~Gateway();
+
+  // port 0 picks a free one; see port()
+  bool listen(const char* bindAddr, uint16_t port);
+  uint16_t port() const { return boundPort; }
+
+  void run();                    // until stop()
+  void pollOnce(int timeoutMs);  // one loop iteration
+  void stop();
+
+  void publish(const std::string& channel, std::string json);
+  void commandDone(uint64_t token, std::string ackJson);
+  void setCommandHandler(CommandHandler handler) { commandHandler = std::move(handler); }
+
+  const GatewayStats& stats() const { return counters; }
+  size_t connections() const { return open; }
+  size_t subscribers(const std::string& channel) const;
+
+ private:
+  struct Conn;
+  struct Channel {
+    std::string name;
+    std::vector<std::pair<std::string, std::string>> fields;  // key, raw value
+    SharedFrame* snapshot = nullptr;                           // built on demand
+    std::vector<Conn*> subscribers;
+  };
+  struct Pending {
+    bool command;
+    std::string channel;   // publish
+    uint64_t token;        // command answer
+    std::string json;
+  };
+
+  int epollFd = -1;
+  int listenFd = -1;
+  int wakeFd = -1;
+  uint16_t boundPort = 0;
+  std::atomic<bool> running{ false };
+  std::vector<std::unique_ptr<Conn>> conns;  // by fd
+  std::vector<std::unique_ptr<Conn>> dead;   // closed during this pass
+  std::vector<Conn*> dirty;                  // to flush at the end of it
+  bool polling = false;
+  size_t open = 0;
+  uint32_t nextSerial = 1;
+  Channel channels[GW_MAX_CHANNELS];
+  uint8_t channelCount = 0;
+  uint64_t lastSweepMs = 0;
+  CommandHandler commandHandler;
+  GatewayStats counters = {};
+
+  std::mutex pendingLock;
+  std::vector<Pending> pending;
+  std::vector<Pending> taking;
+
+  void acceptAll();
+  void onReadable(Conn& c);
+  bool handshake(Conn& c);
+  bool readFrames(Conn& c);
+  void onMessage(Conn& c, const char* text, size_t len);
+  void drainPending();
+  void applyPublish(const std::string& name, const std::string& json);
+
+  int channelFor(const std::string& name, bool create);
+  SharedFrame* snapshotOf(Channel& ch);
+  void subscribe(Conn& c, int channel);
+
+  void send(Conn& c, SharedFrame* frame);
+  void sendRaw(Conn& c, const char* data, size_t len);
+  void flush(Conn& c);
+  void watchWrite(Conn& c, bool on);
+  void close(Conn& c);
+  void sweep(uint64_t nowMs);
+};
+
+uint64_t gatewayNowMs();
+
+#endif // GATEWAY_H
@@ -0,0 +1,298 @@
+/**
+ * ══════════════════════════════════════════════════════════════════════════
+ *                    🖤🛣️ GATEWAY BENCHMARK 🛣️🖤
+ * ══════════════════════════════════════════════════════════════════════════
+ *
+ * Runs the gateway loop on one thread, pinned to CPU 0, and a load
+ * generator for N hubs over loopback on another thread (CPU 1 when there
+ * is one). Three phases:
+ *
+ *   connect   N TCP connects + WebSocket upgrades, then subscribe
+ *   fan-out   M metrics changes, each delivered to all N hubs before the
+ *             next is published; reports the time to reach the last hub
+ *   ping      every hub sends K pings back to back, each after its pong
+ *
+ * Rates are given per wall second and per second of gateway CPU time
+ * (the thread's own clock), so a busy load generator on the same core
+ * does not count against the gateway. Checks that every hub got every
+ * delta, in order, with the expected payload.
+ *
+ *   make -C gateway bench
+ *   ./gateway/gateway_bench [--connections N] [--rounds M] [--pings K]
+ */
+
+#include "gateway.h"
+
+#include <arpa/inet.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <pthread.h>
+#include <sched.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/epoll.h>
+#include <sys/resource.h>
+#include <sys/socket.h>
+#include <time.h>
+#include <unistd.h>
+#include <algorithm>
+#include <string>
+#include <thread>
+#include <vector>
+
+#define DEFAULT_CONNECTIONS 2000
+#define DEFAULT_ROUNDS      200
+#define DEFAULT_PINGS       20
+#define PHASE_TIMEOUT_NS    30000000000ull
+
+struct Hub {
+  int fd;
+  bool upgraded;
+  std::string in;
+  uint32_t frames;        // text frames this phase
+  uint32_t lastCpu;       // from the latest delta
+  bool outOfOrder;
+};
+
+static std::vector<Hub> hubs;
+static int epollFd = -1;
+static int failures = 0;
+static uint32_t upgradedCount = 0;
+static uint32_t reached = 0;       // hubs that got this phase's frame
+
+static uint64_t nowNs() {
+  timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
+static uint64_t threadCpuNs(pthread_t thread) {
+  clockid_t id;
+  timespec ts;
+  if (pthread_getcpuclockid(thread, &id) != 0 || clock_gettime(id, &ts) != 0) return 0;
+  return (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
+static void pin(pthread_t thread, int cpu) {
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  CPU_SET(cpu, &set);
+  pthread_setaffinity_np(thread, sizeof(set), &set);
+}
+
+// A masked client text frame
+static void sendText(Hub& h, const char* text) {
+  uint8_t frame[256];
+  size_t len = strlen(text);
+  frame[0] = 0x81;
+  frame[1] = 0x80 | (uint8_t)len;
+  const uint8_t mask[4] = { 0x12, 0x34, 0x56, 0x78 };
+  memcpy(frame + 2, mask, 4);
+  for (size_t i = 0; i < len; i++) frame[6 + i] = text[i] ^ mask[i & 3];
+  if (send(h.fd, frame, 6 + len, MSG_NOSIGNAL) != (ssize_t)(6 + len)) failures++;
+}
+
+// Reads what is there and counts whole server frames; onFrame(hub, payload)
+template <typename F>
+static void readHub(Hub& h, F&& onFrame) {
+  char buf[16384];
+  for (;;) {
+    ssize_t n = recv(h.fd, buf, sizeof(buf), 0);
+    if (n <= 0) break;
+    h.in.append(buf, n);
+  }
+  size_t at = 0;
+  if (!h.upgraded) {
+    size_t end = h.in.find("\r\n\r\n");
+    if (end == std::string::npos) return;
+    if (h.in.compare(0, 12, "HTTP/1.1 101") != 0) failures++;
+    h.upgraded = true;
+    upgradedCount++;
+    at = end + 4;
+  }
+  while (h.in.size() - at >= 2) {
+    size_t len = (uint8_t)h.in[at + 1] & 0x7F, header = 2;
+    if (len == 126) {
+      if (h.in.size() - at < 4) break;
+      len = (uint8_t)h.in[at + 2] << 8 | (uint8_t)h.in[at + 3];
+      header = 4;
+    }
+    if (h.in.size() - at < header + len) break;
+    onFrame(h, std::string_view(h.in.data() + at + header, len));
+    at += header + len;
+  }
+  h.in.erase(0, at);
+}
+
+// Runs the client side until done() or the timeout; false on timeout
+template <typename F, typename D>
+static bool pump(F&& onFrame, D&& done) {
+  epoll_event events[256];
+  uint64_t start = nowNs();
+  while (!done()) {
+    if (nowNs() - start > PHASE_TIMEOUT_NS) return false;
+    int n = epoll_wait(epollFd, events, 256, 100);
+    for (int i = 0; i < n; i++) readHub(hubs[events[i].data.u32], onFrame);
+  }
+  return true;
+}
+
+static void report(const char* label, uint64_t count, const char* unit, uint64_t wallNs, uint64_t cpuNs) {
+  printf("  %-10s %8llu %-11s %9.0f /s wall  %9.0f /s gateway CPU (%3.0f%% busy)\n", label,
+    (unsigned long long)count, unit, count * 1e9 / wallNs, cpuNs ? count * 1e9 / cpuNs : 0.0,
+    100.0 * cpuNs / wallNs);
+}
+
+int main(int argc, char** argv) {
+  uint32_t connections = DEFAULT_CONNECTIONS, rounds = DEFAULT_ROUNDS, pings = DEFAULT_PINGS;
+  for (int i = 1; i < argc; i++) {
+    bool more = i + 1 < argc;
+    if (!strcmp(argv[i], "--connections") && more) connections = atoi(argv[++i]);
+    else if (!strcmp(argv[i], "--rounds") && more) rounds = atoi(argv[++i]);
+    else if (!strcmp(argv[i], "--pings") && more) pings = atoi(argv[++i]);
+    else {
+      fprintf(stderr, "usage: %s [--connections N] [--rounds M] [--pings K]\n", argv[0]);
+      return 2;
+    }
+  }
+
+  // Both ends of every connection live in this process
+  signal(SIGPIPE, SIG_IGN);
+  rlimit lim;
+  getrlimit(RLIMIT_NOFILE, &lim);
+  lim.rlim_cur = lim.rlim_max;
+  setrlimit(RLIMIT_NOFILE, &lim);
+  if (lim.rlim_cur < 2 * connections + 64) {
+    connections = lim.rlim_cur > 128 ? (uint32_t)(lim.rlim_cur - 64) / 2 : 32;
+    printf("Open file limit %llu: using %u connections\n", (unsigned long long)lim.rlim_cur, connections);
+  }
+
+  Gateway gw;
+  if (!gw.listen("127.0.0.1", 0)) return 1;
+  std::thread loop([&gw] { gw.run(); });
+  unsigned cpus = std::thread::hardware_concurrency();
+  pin(loop.native_handle(), 0);
+  if (cpus > 1) pin(pthread_self(), 1);
+  printf("Gateway benchmark, %u hubs over loopback, gateway on CPU 0%s\n", connections,
+    cpus > 1 ? ", load on CPU 1" : " shared with the load (1 CPU)");
+
+  epollFd = epoll_create1(0);
+  sockaddr_in addr = {};
+  addr.sin_family = AF_INET;
+  addr.sin_port = htons(gw.port());
+  addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+  gw.publish("metrics", "{\"projects\":30247,\"agents\":15892,\"roadcoin\":\"0.4200\",\"cpu\":0,\"memory\":50}");
+
+  // ── Connect ──
+  static const char upgrade[] =
+    "GET /ws HTTP/1.1\r\nHost: bench\r\nUpgrade: websocket\r\nConnection: Upgrade\r\n"
+    "Sec-WebSocket-Key: dGhlIHNhbXBsZSBub25jZQ==\r\nSec-WebSocket-Version: 13\r\n"
+    "Sec-WebSocket-Protocol: arduino\r\n\r\n";
+  auto countFrame = [](Hub& h, std::string_view) { reached += ++h.frames == 1; };
+
+  uint64_t cpu0 = threadCpuNs(loop.native_handle()), t0 = nowNs();
+  hubs.resize(connections);
+  for (uint32_t i = 0; i < connections; i++) {
+    Hub& h = hubs[i];
+    h.fd = socket(AF_INET, SOCK_STREAM, 0);
+    if (h.fd < 0 || connect(h.fd, (sockaddr*)&addr, sizeof(addr)) < 0) {
+      perror("connect");
+      return 1;
+    }
+    int one = 1;
+    setsockopt(h.fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+    send(h.fd, upgrade, sizeof(upgrade) - 1, MSG_NOSIGNAL);
+    fcntl(h.fd, F_SETFL, O_NONBLOCK);
+    epoll_event ev = {};
+    ev.events = EPOLLIN;
+    ev.data.u32 = i;
+    epoll_ctl(epollFd, EPOLL_CTL_ADD, h.fd, &ev);
+  }
+  bool ok = pump(countFrame, [&] { return upgradedCount == connections; });
+  uint64_t connectNs = nowNs() - t0, connectCpu = threadCpuNs(loop.native_handle()) - cpu0;
+  if (!ok) {
+    printf("FAIL: only %u of %u hubs upgraded\n", upgradedCount, connections);
+    failures++;
+  }
+
+  for (Hub& h : hubs) sendText(h, "{\"type\":\"subscribe\",\"channel\":\"metrics\"}");
+  ok = pump(countFrame, [&] { return reached == connections; });
+  if (!ok) {
+    printf("FAIL: not every hub got the snapshot\n");
+    failures++;
+  }
+
+  // ── Fan-out ──
+  auto onDelta = [](Hub& h, std::string_view payload) {
+    h.frames++;
+    reached++;
+    uint32_t cpu = 0;
+    if (sscanf(std::string(payload).c_str(), "{\"cpu\":%u}", &cpu) != 1 || cpu != h.lastCpu + 1) h.outOfOrder = true;
+    h.lastCpu = cpu;
+  };
+  for (Hub& h : hubs) h.frames = 0;
+  std::vector<uint64_t> spread;
+  cpu0 = threadCpuNs(loop.native_handle());
+  t0 = nowNs();
+  for (uint32_t r = 1; r <= rounds && ok; r++) {
+    char doc[160];
+    snprintf(doc, sizeof(doc), "{\"projects\":30247,\"agents\":15892,\"roadcoin\":\"0.4200\",\"cpu\":%u,\"memory\":50}", r);
+    uint64_t sent = nowNs();
+    reached = 0;
+    gw.publish("metrics", doc);
+    ok = pump(onDelta, [&] { return reached == connections; });
+    spread.push_back(nowNs() - sent);
+  }
+  uint64_t fanNs = nowNs() - t0, fanCpu = threadCpuNs(loop.native_handle()) - cpu0;
+  uint32_t wrong = 0;
+  for (Hub& h : hubs) wrong += h.outOfOrder || h.frames != rounds;
+  if (!ok || wrong) {
+    printf("FAIL: %u hubs missed or reordered deltas\n", wrong);
+    failures++;
+  }
+  std::sort(spread.begin(), spread.end());
+  uint64_t p50 = spread.empty() ? 0 : spread[spread.size() / 2];
+  uint64_t p99 = spread.empty() ? 0 : spread[spread.size() * 99 / 100];
+
+  // ── Ping ──
+  uint32_t answered = 0;
+  auto onPong = [&](Hub& h, std::string_view) {
+    h.frames++;
+    answered++;
+    if (h.frames < pings) {
+      char ping[48];
+      snprintf(ping, sizeof(ping), "{\"type\":\"ping\",\"seq\":%u}", h.frames);
+      sendText(h, ping);
+    }
+  };
+  for (Hub& h : hubs) h.frames = 0;
+  cpu0 = threadCpuNs(loop.native_handle());
+  t0 = nowNs();
+  for (Hub& h : hubs) sendText(h, "{\"type\":\"ping\",\"seq\":0}");
+  ok = pump(onPong, [&] { return answered == connections * pings; });
+  uint64_t pingNs = nowNs() - t0, pingCpu = threadCpuNs(loop.native_handle()) - cpu0;
+  if (!ok) {
+    printf("FAIL: %u of %u pongs\n", answered, connections * pings);
+    failures++;
+  }
+
+  for (Hub& h : hubs) close(h.fd);
+  gw.stop();
+  loop.join();
+
+  const GatewayStats& s = gw.stats();
+  report("connect", connections, "upgrades", connectNs, connectCpu);
+  report("fan-out", (uint64_t)connections * rounds, "deltas", fanNs, fanCpu);
+  printf("             publish to last hub p50 %llu us, p99 %llu us, %.1f frames per writev\n",
+    (unsigned long long)(p50 / 1000), (unsigned long long)(p99 / 1000),
+    s.writevCalls ? (double)s.framesOut / s.writevCalls : 0.0);
+  report("ping", (uint64_t)connections * pings, "round trips", pingNs, pingCpu);
+
+  printf(failures ? "%d checks FAILED\n" : "All checks passed\n", failures);
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,117 @@
+/**
+ * ══════════════════════════════════════════════════════════════════════════
+ *                    🖤🛣️ BLACKROAD HUB GATEWAY 🛣️🖤
+ * ══════════════════════════════════════════════════════════════════════════
+ *
+ * Fetches backend data once and fans it out to every hub as deltas.
+ *
+ *   ./hub_gateway --simulate                       # no backend needed
+ *   ./hub_gateway --metrics http://159.65.43.12:8080/api/metrics \
+ *                 --commands http://159.65.43.12:8080/api/commands
+ *
+ * Then put ws://<this machine>:8080/ws first in the hub's WS_ENDPOINTS.
+ */
+
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/resource.h>
+#include <unistd.h>
+
+#include "gateway.h"
+#include "upstream.h"
+
+#define STATS_EVERY_MS 10000
+
+static volatile sig_atomic_t stopRequested = 0;
+static Gateway* running = nullptr;
+
+static void onSignal(int) {
+  stopRequested = 1;
+  if (running) running->stop();  // wakes the loop
+}
+
+static void usage(const char* argv0) {
+  fprintf(stderr,
+    "usage: %s [options]\n"
+    "  --bind ADDR          listen address (default 0.0.0.0)\n"
+    "  --port N             listen port (default 8080)\n"
+    "  --metrics URL        poll the metrics channel from this http:// URL\n"
+    "  --channel NAME=URL   poll another channel (repeatable)\n"
+    "  --commands URL       forward hub commands to this http:// URL\n"
+    "  --interval MS        poll period (default 1000)\n"
+    "  --simulate           invent metrics and acknowledge commands\n"
+    "API key for the backends: DO_API_KEY in the environment\n", argv0);
+  exit(2);
+}
+
+static void printStats(const Gateway& gw, const Upstream& up) {
+  const GatewayStats& s = gw.stats();
+  UpstreamStats u = up.stats();
+  fprintf(stderr, "gateway: %zu hubs (%zu on metrics), %llu accepted, %llu rejected, %llu slow, %llu idle | "
+                  "%llu deltas of %llu fetches (%llu failed) | %llu frames, %llu writev, %llu KiB out | "
+                  "%llu commands (%llu unanswered)\n",
+    gw.connections(), gw.subscribers("metrics"), (unsigned long long)s.accepted,
+    (unsigned long long)s.rejected, (unsigned long long)s.slowClosed, (unsigned long long)s.idleClosed,
+    (unsigned long long)s.deltas, (unsigned long long)u.fetches, (unsigned long long)u.fetchFailures,
+    (unsigned long long)s.framesOut, (unsigned long long)s.writevCalls, (unsigned long long)(s.bytesOut / 1024),
+    (unsigned long long)u.commands, (unsigned long long)u.commandFailures);
+}
+
+int main(int argc, char** argv) {
+  const char* bindAddr = "0.0.0.0";
+  int port = 8080;
+  Gateway gw;
+  Upstream up(gw);
+
+  for (int i = 1; i < argc; i++) {
+    bool more = i + 1 < argc;
+    if (!strcmp(argv[i], "--bind") && more) bindAddr = argv[++i];
+    else if (!strcmp(argv[i], "--port") && more) port = atoi(argv[++i]);
+    else if (!strcmp(argv[i], "--metrics") && more) up.addChannel("metrics", argv[++i]);
+    else if (!strcmp(argv[i], "--commands") && more) up.setCommandsUrl(argv[++i]);
+    else if (!strcmp(argv[i], "--interval") && more) up.setIntervalMs(atoi(argv[++i]));
+    else if (!strcmp(argv[i], "--simulate")) up.setSimulated(true);
+    else if (!strcmp(argv[i], "--channel") && more) {
+      const char* spec = argv[++i];
+      const char* eq = strchr(spec, '=');
+      if (!eq) usage(argv[0]);
+      up.addChannel(std::string(spec, eq - spec), eq + 1);
+    } else {
+      usage(argv[0]);
+    }
+  }
+  if (const char* key = getenv("DO_API_KEY")) up.setApiKey(key);
+
+  // One descriptor per hub
+  rlimit lim;
+  if (getrlimit(RLIMIT_NOFILE, &lim) == 0 && lim.rlim_cur < lim.rlim_max) {
+    lim.rlim_cur = lim.rlim_max;
+    setrlimit(RLIMIT_NOFILE, &lim);
+  }
+  signal(SIGPIPE, SIG_IGN);
+  signal(SIGINT, onSignal);
+  signal(SIGTERM, onSignal);
+
+  if (!gw.listen(bindAddr, (uint16_t)port)) return 1;
+  gw.setCommandHandler([&up](uint64_t token, const std::string& json) { up.forwardCommand(token, json); });
+  up.start();
+  fprintf(stderr, "gateway: listening on ws://%s:%u/ws\n", bindAddr, gw.port());
+
+  running = &gw;
+  uint64_t lastStats = gatewayNowMs();
+  while (!stopRequested) {
+    gw.pollOnce(GW_SWEEP_MS);
+    uint64_t now = gatewayNowMs();
+    if (now - lastStats >= STATS_EVERY_MS) {
+      lastStats = now;
+      printStats(gw, up);
+    }
+  }
+  running = nullptr;
+
+  up.stop();
+  printStats(gw, up);
+  return 0;
+}
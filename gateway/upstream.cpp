@@ -0,0 +1,232 @@
+/**
+ * ══════════════════════════════════════════════════════════════════════════
+ *                    🖤🛣️ GATEWAY UPSTREAM 🛣️🖤
+ * ══════════════════════════════════════════════════════════════════════════
+ */
+
+#include "upstream.h"
+#include "ws_protocol.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <netdb.h>
+#include <poll.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <unistd.h>
+#include <chrono>
+#include <random>
+
+// ══════════════════════════════════════════════════════════════════════════
+// HTTP CLIENT
+// ══════════════════════════════════════════════════════════════════════════
+
+static bool splitUrl(const std::string& url, std::string& host, std::string& port, std::string& path) {
+  if (url.compare(0, 7, "http://") != 0) return false;
+  size_t hostStart = 7;
+  size_t pathStart = url.find('/', hostStart);
+  std::string authority = url.substr(hostStart, pathStart == std::string::npos ? std::string::npos : pathStart - hostStart);
+  path = pathStart == std::string::npos ? "/" : url.substr(pathStart);
+  size_t colon = authority.rfind(':');
+  host = authority.substr(0, colon);
+  port = colon == std::string::npos ? "80" : authority.substr(colon + 1);
+  return !host.empty();
+}
+
+static int connectTimeout(const std::string& host, const std::string& port, int timeoutMs) {
+  addrinfo hints = {}, *res = nullptr;
+  hints.ai_family = AF_UNSPEC;
+  hints.ai_socktype = SOCK_STREAM;
+  if (getaddrinfo(host.c_str(), port.c_str(), &hints, &res) != 0) return -1;
+
+  int fd = -1;
+  for (addrinfo* a = res; a && fd < 0; a = a->ai_next) {
+    fd = socket(a->ai_family, a->ai_socktype | SOCK_NONBLOCK | SOCK_CLOEXEC, a->ai_protocol);
+    if (fd < 0) continue;
+    int rc = connect(fd, a->ai_addr, a->ai_addrlen);
+    if (rc < 0 && errno == EINPROGRESS) {
+      pollfd p = { fd, POLLOUT, 0 };
+      int err = 0;
+      socklen_t len = sizeof(err);
+      if (poll(&p, 1, timeoutMs) == 1 && getsockopt(fd, SOL_SOCKET, SO_ERROR, &err, &len) == 0 && err == 0) rc = 0;
+    }
+    if (rc < 0) {
+      ::close(fd);
+      fd = -1;
+    }
+  }
+  freeaddrinfo(res);
+  if (fd < 0) return -1;
+
+  // Blocking from here on, bounded by the same timeout
+  fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) & ~O_NONBLOCK);
+  timeval tv = { timeoutMs / 1000, (timeoutMs % 1000) * 1000 };
+  setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+  setsockopt(fd, SOL_SOCKET, SO_SNDTIMEO, &tv, sizeof(tv));
+  return fd;
+}
+
+int httpRequest(const std::string& url, const char* method, const std::string& body,
+                const std::string& apiKey, int timeoutMs, std::string& response) {
+  std::string host, port, path;
+  if (!splitUrl(url, host, port, path)) return -1;
+  int fd = connectTimeout(host, port, timeoutMs);
+  if (fd < 0) return -1;
+
+  // HTTP/1.0: the server closes after the body and never chunks it
+  std::string req = std::string(method) + " " + path + " HTTP/1.0\r\nHost: " + host + "\r\n";
+  if (!apiKey.empty()) req += "Authorization: Bearer " + apiKey + "\r\n";
+  if (!body.empty()) {
+    req += "Content-Type: application/json\r\nContent-Length: " + std::to_string(body.size()) + "\r\n";
+  }
+  req += "\r\n";
+  req += body;
+
+  int status = -1;
+  std::string raw;
+  if (::send(fd, req.data(), req.size(), MSG_NOSIGNAL) == (ssize_t)req.size()) {
+    char buf[4096];
+    ssize_t n;
+    while ((n = recv(fd, buf, sizeof(buf), 0)) > 0) raw.append(buf, n);
+    size_t headEnd = raw.find("\r\n\r\n");
+    if (n == 0 && headEnd != std::string::npos && raw.compare(0, 5, "HTTP/") == 0) {
+      size_t space = raw.find(' ');
+      status = space < headEnd ? atoi(raw.c_str() + space + 1) : -1;
+      response = raw.substr(headEnd + 4);
+    }
+  }
+  ::close(fd);
+  return status;
+}
+
+// ══════════════════════════════════════════════════════════════════════════
+// THREADS
+// ══════════════════════════════════════════════════════════════════════════
+
+void Upstream::start() {
+  stopping = false;
+  pollThread = std::thread(&Upstream::pollLoop, this);
+  commandThread = std::thread(&Upstream::commandLoop, this);
+}
+
+void Upstream::stop() {
+  {
+    std::lock_guard<std::mutex> guard(lock);
+    stopping = true;
+  }
+  wake.notify_all();
+  if (pollThread.joinable()) pollThread.join();
+  if (commandThread.joinable()) commandThread.join();
+}
+
+void Upstream::pollLoop() {
+  auto next = std::chrono::steady_clock::now();
+  for (;;) {
+    if (simulated) {
+      gateway.publish("metrics", simulateMetrics());
+      fetches++;
+    }
+    for (const Channel& ch : channels) {
+      std::string body;
+      int status = httpRequest(ch.url, "GET", std::string(), apiKey, UPSTREAM_TIMEOUT_MS, body);
+      if (status >= 200 && status < 300) {
+        gateway.publish(ch.name, std::move(body));
+        fetches++;
+      } else {
+        fetchFailures++;
+        fprintf(stderr, "upstream: %s: %s %d\n", ch.name.c_str(), ch.url.c_str(), status);
+      }
+    }
+
+    // Fixed rate, not fixed gap: a slow backend does not stretch the period
+    next += std::chrono::milliseconds(intervalMs);
+    auto now = std::chrono::steady_clock::now();
+    if (next < now) next = now;
+    std::unique_lock<std::mutex> guard(lock);
+    if (wake.wait_until(guard, next, [this] { return stopping; })) return;
+  }
+}
+
+void Upstream::forwardCommand(uint64_t token, const std::string& json) {
+  {
+    std::lock_guard<std::mutex> guard(lock);
+    commandQueue.emplace_back(token, json);
+  }
+  wake.notify_all();
+}
+
+void Upstream::commandLoop() {
+  for (;;) {
+    std::pair<uint64_t, std::string> cmd;
+    {
+      std::unique_lock<std::mutex> guard(lock);
+      wake.wait(guard, [this] { return stopping || !commandQueue.empty(); });
+      if (stopping) return;
+      cmd = std::move(commandQueue.front());
+      commandQueue.pop_front();
+    }
+    runCommand(cmd.first, cmd.second);
+  }
+}
+
+void Upstream::runCommand(uint64_t token, const std::string& json) {
+  commands++;
+  std::vector<JsonField> fields;
+  unsigned long long id = jsonFlatParse(json, fields) ? jsonUintValue(jsonFind(fields, "id"), 0) : 0;
+
+  char ack[128];
+  if (simulated || commandsUrl.empty()) {
+    snprintf(ack, sizeof(ack), "{\"type\":\"commandAck\",\"id\":%llu,\"ok\":%s}", id,
+      simulated ? "true" : "false,\"error\":\"no command backend\"");
+    gateway.commandDone(token, ack);
+    return;
+  }
+
+  std::string body;
+  int status = httpRequest(commandsUrl, "POST", json, apiKey, UPSTREAM_TIMEOUT_MS, body);
+  if (status >= 200 && status < 300) {
+    gateway.commandDone(token, std::move(body));
+  } else if (status >= 400 && status < 500) {
+    // The backend looked at it and said no; retrying will not help
+    snprintf(ack, sizeof(ack), "{\"type\":\"commandAck\",\"id\":%llu,\"ok\":false,\"error\":\"HTTP %d\"}", id, status);
+    gateway.commandDone(token, ack);
+  } else {
+    commandFailures++;
+    fprintf(stderr, "upstream: command %llu: %s %d, left to the hub's retry\n", id, commandsUrl.c_str(), status);
+  }
+}
+
+UpstreamStats Upstream::stats() const {
+  return { fetches.load(), fetchFailures.load(), commands.load(), commandFailures.load() };
+}
+
+// ══════════════════════════════════════════════════════════════════════════
+// SIMULATION
+// ══════════════════════════════════════════════════════════════════════════
+
+// Same walk as the hub's offline simulation; most fields stay put, so
+// each publish makes a small delta
+std::string Upstream::simulateMetrics() {
+  static std::mt19937 rng(std::random_device{}());
+  static long projects = 30247, agents = 15892, price = 4200;  // price in 1/10000
+  static long changeBp = 523;
+  auto between = [](long lo, long hi) { return std::uniform_int_distribution<long>(lo, hi)(rng); };
+
+  if (between(0, 3) == 0) projects += between(-10, 50);
+  if (between(0, 9) == 0) agents += between(-5, 5);
+  if (between(0, 1) == 0) {
+    price += between(-20, 20);
+    changeBp += between(-5, 5);
+  }
+
+  char json[256];
+  snprintf(json, sizeof(json),
+    "{\"projects\":%ld,\"agents\":%ld,\"roadcoin\":\"%ld.%04ld\",\"change24h\":%.2f,"
+    "\"cpu\":%ld,\"memory\":%ld,\"network\":%ld}",
+    projects, agents, price / 10000, price % 10000, changeBp / 100.0,
+    between(20, 90), between(30, 85), between(100, 5000));
+  return json;
+}
@@ -0,0 +1,98 @@
+/**
+ * ══════════════════════════════════════════════════════════════════════════
+ *                    🖤🛣️ GATEWAY UPSTREAM 🛣️🖤
+ * ══════════════════════════════════════════════════════════════════════════
+ *
+ * Talks to the backends on behalf of every hub, off the event loop:
+ *
+ *   - a poll thread GETs each channel's URL every interval and publishes
+ *     the body to the gateway, which turns it into deltas;
+ *   - a command thread POSTs hub commands to the commands endpoint and
+ *     hands the answer back. Like the hub's own HTTP fallback, a 4xx
+ *     becomes a failed commandAck. A transport error or 5xx gets no
+ *     answer, so the hub times out and retries.
+ *
+ * Plain http:// only (the DigitalOcean endpoints in cloud_config.h);
+ * HTTPS backends need a TLS-terminating proxy in front. With simulate on,
+ * the poll thread invents metrics the way the hub does offline and
+ * commands are acknowledged at once, so the gateway runs with no backend.
+ */
+
+#ifndef GATEWAY_UPSTREAM_H
+#define GATEWAY_UPSTREAM_H
+
+#include <stdint.h>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "gateway.h"
+
+#define UPSTREAM_TIMEOUT_MS 5000
+
+struct UpstreamStats {
+  uint64_t fetches;
+  uint64_t fetchFailures;
+  uint64_t commands;
+  uint64_t commandFailures;  // no answer passed on
+};
+
+// Blocking HTTP/1.0 request; returns the status code, -1 on a transport error
+int httpRequest(const std::string& url, const char* method, const std::string& body,
+                const std::string& apiKey, int timeoutMs, std::string& response);
+
+class Upstream {
+ public:
+  explicit Upstream(Gateway& gateway) : gateway(gateway) {}
+  ~Upstream() { stop(); }
+
+  void addChannel(const std::string& name, const std::string& url) { channels.push_back({ name, url }); }
+  void setCommandsUrl(const std::string& url) { commandsUrl = url; }
+  void setApiKey(const std::string& key) { apiKey = key; }
+  void setIntervalMs(uint32_t ms) { intervalMs = ms; }
+  void setSimulated(bool on) { simulated = on; }
+
+  void start();
+  void stop();
+
+  // From the gateway's CommandHandler; returns at once
+  void forwardCommand(uint64_t token, const std::string& json);
+
+  UpstreamStats stats() const;
+
+ private:
+  struct Channel {
+    std::string name;
+    std::string url;
+  };
+
+  Gateway& gateway;
+  std::vector<Channel> channels;
+  std::string commandsUrl;
+  std::string apiKey;
+  uint32_t intervalMs = 1000;
+  bool simulated = false;
+
+  std::thread pollThread;
+  std::thread commandThread;
+  std::mutex lock;
+  std::condition_variable wake;
+  std::deque<std::pair<uint64_t, std::string>> commandQueue;
+  bool stopping = false;
+
+  std::atomic<uint64_t> fetches{ 0 };
+  std::atomic<uint64_t> fetchFailures{ 0 };
+  std::atomic<uint64_t> commands{ 0 };
+  std::atomic<uint64_t> commandFailures{ 0 };
+
+  void pollLoop();
+  void commandLoop();
+  void runCommand(uint64_t token, const std::string& json);
+  std::string simulateMetrics();
+};
+
+#endif // GATEWAY_UPSTREAM_H
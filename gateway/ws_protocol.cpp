@@ -0,0 +1,290 @@
+/**
+ * ══════════════════════════════════════════════════════════════════════════
+ *                    🖤🛣️ GATEWAY WEBSOCKET PROTOCOL 🛣️🖤
+ * ══════════════════════════════════════════════════════════════════════════
+ */
+
+#include "ws_protocol.h"
+
+#include <string.h>
+#include <strings.h>
+
+// ══════════════════════════════════════════════════════════════════════════
+// SHA-1 + BASE64 (handshake only)
+// ══════════════════════════════════════════════════════════════════════════
+
+static inline uint32_t rol(uint32_t v, int n) {
+  return (v << n) | (v >> (32 - n));
+}
+
+static void sha1Block(uint32_t h[5], const uint8_t* p) {
+  uint32_t w[80];
+  for (int i = 0; i < 16; i++) {
+    w[i] = (uint32_t)p[4 * i] << 24 | (uint32_t)p[4 * i + 1] << 16 | (uint32_t)p[4 * i + 2] << 8 | p[4 * i + 3];
+  }
+  for (int i = 16; i < 80; i++) w[i] = rol(w[i - 3] ^ w[i - 8] ^ w[i - 14] ^ w[i - 16], 1);
+
+  uint32_t a = h[0], b = h[1], c = h[2], d = h[3], e = h[4];
+  for (int i = 0; i < 80; i++) {
+    uint32_t f, k;
+    if (i < 20) {
+      f = (b & c) | (~b & d);
+      k = 0x5A827999;
+    } else if (i < 40) {
+      f = b ^ c ^ d;
+      k = 0x6ED9EBA1;
+    } else if (i < 60) {
+      f = (b & c) | (b & d) | (c & d);
+      k = 0x8F1BBCDC;
+    } else {
+      f = b ^ c ^ d;
+      k = 0xCA62C1D6;
+    }
+    uint32_t t = rol(a, 5) + f + e + k + w[i];
+    e = d;
+    d = c;
+    c = rol(b, 30);
+    b = a;
+    a = t;
+  }
+  h[0] += a;
+  h[1] += b;
+  h[2] += c;
+  h[3] += d;
+  h[4] += e;
+}
+
+void sha1(const uint8_t* data, size_t len, uint8_t out[20]) {
+  uint32_t h[5] = { 0x67452301, 0xEFCDAB89, 0x98BADCFE, 0x10325476, 0xC3D2E1F0 };
+  size_t full = len / 64 * 64;
+  for (size_t i = 0; i < full; i += 64) sha1Block(h, data + i);
+
+  // Tail, the 0x80 marker and the bit length, in one or two blocks
+  uint8_t tail[128] = {};
+  size_t rest = len - full;
+  memcpy(tail, data + full, rest);
+  tail[rest] = 0x80;
+  size_t blocks = rest + 9 > 64 ? 2 : 1;
+  uint64_t bits = (uint64_t)len * 8;
+  for (int i = 0; i < 8; i++) tail[blocks * 64 - 1 - i] = (uint8_t)(bits >> (8 * i));
+  for (size_t b = 0; b < blocks; b++) sha1Block(h, tail + 64 * b);
+
+  for (int i = 0; i < 5; i++) {
+    out[4 * i] = h[i] >> 24;
+    out[4 * i + 1] = h[i] >> 16;
+    out[4 * i + 2] = h[i] >> 8;
+    out[4 * i + 3] = h[i];
+  }
+}
+
+size_t base64Encode(const uint8_t* in, size_t len, char* out) {
+  static const char digits[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+  size_t o = 0;
+  for (size_t i = 0; i < len; i += 3) {
+    uint32_t v = (uint32_t)in[i] << 16;
+    if (i + 1 < len) v |= (uint32_t)in[i + 1] << 8;
+    if (i + 2 < len) v |= in[i + 2];
+    out[o++] = digits[v >> 18 & 63];
+    out[o++] = digits[v >> 12 & 63];
+    out[o++] = i + 1 < len ? digits[v >> 6 & 63] : '=';
+    out[o++] = i + 2 < len ? digits[v & 63] : '=';
+  }
+  return o;
+}
+
+void wsAcceptKey(std::string_view clientKey, char out[WS_ACCEPT_LEN + 1]) {
+  static const char guid[] = "258EAFA5-E914-47DA-95CA-C5AB0DC85B11";
+  std::string joined(clientKey);
+  joined += guid;
+  uint8_t digest[20];
+  sha1((const uint8_t*)joined.data(), joined.size(), digest);
+  out[base64Encode(digest, sizeof(digest), out)] = '\0';
+}
+
+// ══════════════════════════════════════════════════════════════════════════
+// FRAMES
+// ══════════════════════════════════════════════════════════════════════════
+
+size_t wsFrameHeader(uint8_t opcode, size_t payloadLen, uint8_t* out) {
+  out[0] = 0x80 | opcode;
+  if (payloadLen < 126) {
+    out[1] = (uint8_t)payloadLen;
+    return 2;
+  }
+  if (payloadLen <= 0xFFFF) {
+    out[1] = 126;
+    out[2] = payloadLen >> 8;
+    out[3] = payloadLen;
+    return 4;
+  }
+  out[1] = 127;
+  for (int i = 0; i < 8; i++) out[2 + i] = (uint8_t)((uint64_t)payloadLen >> (56 - 8 * i));
+  return 10;
+}
+
+long wsParseClientFrame(uint8_t* buf, size_t len, size_t maxPayload, WsFrame& out) {
+  if (len < 2) return 0;
+  if (buf[0] & 0x70) return -1;         // no extensions negotiated
+  if (!(buf[1] & 0x80)) return -1;      // clients must mask
+
+  size_t header = 2;
+  uint64_t payload = buf[1] & 0x7F;
+  if (payload == 126) {
+    if (len < 4) return 0;
+    payload = (uint64_t)buf[2] << 8 | buf[3];
+    header = 4;
+  } else if (payload == 127) {
+    if (len < 10) return 0;
+    payload = 0;
+    for (int i = 0; i < 8; i++) payload = payload << 8 | buf[2 + i];
+    header = 10;
+  }
+  if (payload > maxPayload) return -1;
+  if (len < header + 4 + payload) return 0;
+
+  const uint8_t* mask = buf + header;
+  uint8_t* data = buf + header + 4;
+  for (size_t i = 0; i < payload; i++) data[i] ^= mask[i & 3];
+
+  out.opcode = buf[0] & 0x0F;
+  out.fin = buf[0] & 0x80;
+  out.headerLen = header + 4;
+  out.payloadLen = payload;
+  return (long)(header + 4 + payload);
+}
+
+static std::string_view trim(std::string_view s) {
+  while (!s.empty() && (s.front() == ' ' || s.front() == '\t')) s.remove_prefix(1);
+  while (!s.empty() && (s.back() == ' ' || s.back() == '\t' || s.back() == '\r')) s.remove_suffix(1);
+  return s;
+}
+
+static bool headerIs(std::string_view name, const char* want) {
+  return name.size() == strlen(want) && strncasecmp(name.data(), want, name.size()) == 0;
+}
+
+bool wsParseUpgrade(std::string_view head, WsUpgradeRequest& out) {
+  out = WsUpgradeRequest();
+  size_t eol = head.find("\r\n");
+  if (eol == std::string_view::npos) return false;
+
+  std::string_view line = head.substr(0, eol);
+  if (line.substr(0, 4) != "GET ") return false;
+  size_t pathEnd = line.find(' ', 4);
+  if (pathEnd == std::string_view::npos) return false;
+  out.path = line.substr(4, pathEnd - 4);
+
+  bool upgrade = false;
+  for (size_t at = eol + 2; at < head.size();) {
+    size_t end = head.find("\r\n", at);
+    if (end == std::string_view::npos) end = head.size();
+    line = head.substr(at, end - at);
+    at = end + 2;
+
+    size_t colon = line.find(':');
+    if (colon == std::string_view::npos) continue;
+    std::string_view name = trim(line.substr(0, colon)), value = trim(line.substr(colon + 1));
+    if (headerIs(name, "Upgrade")) {
+      upgrade = value.size() == 9 && strncasecmp(value.data(), "websocket", 9) == 0;
+    } else if (headerIs(name, "Sec-WebSocket-Key")) {
+      out.key = value;
+    } else if (headerIs(name, "Sec-WebSocket-Protocol")) {
+      out.protocol = trim(value.substr(0, value.find(',')));
+    }
+  }
+  return upgrade && !out.key.empty();
+}
+
+// ══════════════════════════════════════════════════════════════════════════
+// FLAT JSON
+// ══════════════════════════════════════════════════════════════════════════
+
+static size_t skipSpace(std::string_view s, size_t i) {
+  while (i < s.size() && (s[i] == ' ' || s[i] == '\t' || s[i] == '\n' || s[i] == '\r')) i++;
+  return i;
+}
+
+// Index just past the string starting at s[i] == '"', npos if unterminated
+static size_t skipString(std::string_view s, size_t i) {
+  for (i++; i < s.size(); i++) {
+    if (s[i] == '\\') i++;
+    else if (s[i] == '"') return i + 1;
+  }
+  return std::string_view::npos;
+}
+
+// Index just past the value starting at s[i]
+static size_t skipValue(std::string_view s, size_t i) {
+  if (i >= s.size()) return std::string_view::npos;
+  if (s[i] == '"') return skipString(s, i);
+  if (s[i] == '{' || s[i] == '[') {
+    int depth = 0;
+    while (i < s.size()) {
+      char c = s[i];
+      if (c == '"') {
+        i = skipString(s, i);
+        if (i == std::string_view::npos) return i;
+        continue;
+      }
+      if (c == '{' || c == '[') depth++;
+      if (c == '}' || c == ']') {
+        if (--depth == 0) return i + 1;
+      }
+      i++;
+    }
+    return std::string_view::npos;
+  }
+  while (i < s.size() && s[i] != ',' && s[i] != '}' && s[i] != ' ' && s[i] != '\n' && s[i] != '\r' && s[i] != '\t') i++;
+  return i;
+}
+
+bool jsonFlatParse(std::string_view text, std::vector<JsonField>& out) {
+  out.clear();
+  size_t i = skipSpace(text, 0);
+  if (i >= text.size() || text[i] != '{') return false;
+  i = skipSpace(text, i + 1);
+  if (i < text.size() && text[i] == '}') return true;
+
+  while (i < text.size()) {
+    if (text[i] != '"') return false;
+    size_t keyEnd = skipString(text, i);
+    if (keyEnd == std::string_view::npos) return false;
+    std::string_view key = text.substr(i + 1, keyEnd - i - 2);
+
+    i = skipSpace(text, keyEnd);
+    if (i >= text.size() || text[i] != ':') return false;
+    i = skipSpace(text, i + 1);
+    size_t valueEnd = skipValue(text, i);
+    if (valueEnd == std::string_view::npos || valueEnd == i) return false;
+    out.push_back({ key, text.substr(i, valueEnd - i) });
+
+    i = skipSpace(text, valueEnd);
+    if (i >= text.size()) return false;
+    if (text[i] == '}') return true;
+    if (text[i] != ',') return false;
+    i = skipSpace(text, i + 1);
+  }
+  return false;
+}
+
+std::string_view jsonFind(const std::vector<JsonField>& fields, std::string_view key) {
+  for (const JsonField& f : fields) {
+    if (f.key == key) return f.value;
+  }
+  return std::string_view();
+}
+
+std::string_view jsonStringValue(std::string_view raw) {
+  if (raw.size() < 2 || raw.front() != '"' || raw.back() != '"') return std::string_view();
+  return raw.substr(1, raw.size() - 2);
+}
+
+uint64_t jsonUintValue(std::string_view raw, uint64_t fallback) {
+  if (raw.empty() || raw[0] < '0' || raw[0] > '9') return fallback;
+  uint64_t v = 0;
+  for (char c : raw) {
+    if (c < '0' || c > '9') break;
+    v = v * 10 + (c - '0');
+  }
+  return v;
+}
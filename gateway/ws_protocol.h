@@ -0,0 +1,82 @@
+/**
+ * ══════════════════════════════════════════════════════════════════════════
+ *                    🖤🛣️ GATEWAY WEBSOCKET PROTOCOL 🛣️🖤
+ * ══════════════════════════════════════════════════════════════════════════
+ *
+ * The server side of RFC 6455, as much as hubs use: the upgrade
+ * handshake, unmasked server frames and masked client frames. No
+ * extensions (no compression), so one encoded frame can go to every
+ * hub byte for byte.
+ *
+ * Plus a flat JSON scanner. Hub messages and backend documents are
+ * single objects with scalar fields; nested values are kept as raw text.
+ */
+
+#ifndef GATEWAY_WS_PROTOCOL_H
+#define GATEWAY_WS_PROTOCOL_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#define WS_OP_CONTINUATION 0x0
+#define WS_OP_TEXT         0x1
+#define WS_OP_BINARY       0x2
+#define WS_OP_CLOSE        0x8
+#define WS_OP_PING         0x9
+#define WS_OP_PONG         0xA
+
+#define WS_HEADER_MAX      10   // server frames are never masked
+#define WS_ACCEPT_LEN      28
+
+void sha1(const uint8_t* data, size_t len, uint8_t out[20]);
+size_t base64Encode(const uint8_t* in, size_t len, char* out);  // returns chars written, no NUL
+
+// Sec-WebSocket-Accept for a Sec-WebSocket-Key; out gets WS_ACCEPT_LEN chars + NUL
+void wsAcceptKey(std::string_view clientKey, char out[WS_ACCEPT_LEN + 1]);
+
+// Header of a final, unmasked frame; returns its length
+size_t wsFrameHeader(uint8_t opcode, size_t payloadLen, uint8_t* out);
+
+struct WsFrame {
+  uint8_t opcode;
+  bool fin;
+  size_t headerLen;
+  size_t payloadLen;
+};
+
+// Parses a client frame at the start of buf and unmasks its payload in
+// place. Returns bytes consumed, 0 while incomplete, -1 on a protocol
+// error (unmasked frame, reserved bits, payload over maxPayload)
+long wsParseClientFrame(uint8_t* buf, size_t len, size_t maxPayload, WsFrame& out);
+
+// Request head of an upgrade: the path and the headers the reply needs
+struct WsUpgradeRequest {
+  std::string_view path;
+  std::string_view key;
+  std::string_view protocol;  // first offered subprotocol, may be empty
+};
+
+// Parses "GET <path> HTTP/1.1" and its headers up to the blank line
+bool wsParseUpgrade(std::string_view head, WsUpgradeRequest& out);
+
+// ══════════════════════════════════════════════════════════════════════════
+// FLAT JSON
+// ══════════════════════════════════════════════════════════════════════════
+
+struct JsonField {
+  std::string_view key;    // without quotes, escapes left as is
+  std::string_view value;  // raw: strings keep their quotes
+};
+
+// Top-level fields of one JSON object; false when it is not one
+bool jsonFlatParse(std::string_view text, std::vector<JsonField>& out);
+std::string_view jsonFind(const std::vector<JsonField>& fields, std::string_view key);
+
+// A raw string value without its quotes (escapes left as is); empty otherwise
+std::string_view jsonStringValue(std::string_view raw);
+uint64_t jsonUintValue(std::string_view raw, uint64_t fallback);
+
+#endif // GATEWAY_WS_PROTOCOL_H
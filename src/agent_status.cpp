@@ -0,0 +1,209 @@
+/**
+ * ══════════════════════════════════════════════════════════════════════════
+ *                    🖤🛣️ AGENT STATUS BITSET 🛣️🖤
+ * ══════════════════════════════════════════════════════════════════════════
+ */
+
+#include "agent_status.h"
+#include <string.h>
+
+#define ENCODING_RLE      0
+#define ENCODING_BITMAP   1
+#define ENCODING_SNAPSHOT 2
+
+#define LOW_PLANE 0x55555555u
+
+// Bits of agent slots [from, to) inside one word
+static inline uint32_t slotMask(uint32_t from, uint32_t to) {
+  uint32_t width = (to - from) * 2;
+  uint32_t mask = width >= 32 ? 0xFFFFFFFFu : ((1u << width) - 1);
+  return mask << (from * 2);
+}
+
+static bool readVarint(const uint8_t*& p, const uint8_t* end, uint32_t& value) {
+  value = 0;
+  for (uint8_t shift = 0; shift < 35; shift += 7) {
+    if (p >= end) return false;
+    uint8_t byte = *p++;
+    value |= (uint32_t)(byte & 0x7F) << shift;
+    if (!(byte & 0x80)) return true;
+  }
+  return false;
+}
+
+// ══════════════════════════════════════════════════════════════════════════
+// STATE
+// ══════════════════════════════════════════════════════════════════════════
+
+void AgentStatusTable::clear() {
+  memset(bits, 0, sizeof(bits));
+  agents = 0;
+  seq = 0;
+  haveSnapshot = false;
+  total = {};
+  markDirty(0, AGENT_MAX - 1);
+}
+
+void AgentStatusTable::markDirty(uint32_t first, uint32_t last) {
+  if (first < dirtyFirst) dirtyFirst = first;
+  if (last > dirtyLast) dirtyLast = last;
+}
+
+bool AgentStatusTable::takeDirty(uint32_t& first, uint32_t& last) {
+  if (dirtyFirst == UINT32_MAX) return false;
+  first = dirtyFirst;
+  last = dirtyLast;
+  dirtyFirst = UINT32_MAX;
+  dirtyLast = 0;
+  return true;
+}
+
+void AgentStatusTable::set(uint32_t index, AgentState state) {
+  if (index >= AGENT_MAX) return;
+  uint32_t shift = (index & 15) * 2;
+  uint32_t& word = bits[index >> 4];
+  word = (word & ~(3u << shift)) | ((uint32_t)(state & 3) << shift);
+  markDirty(index, index);
+}
+
+void AgentStatusTable::fill(uint32_t first, uint32_t count, AgentState state) {
+  if (first >= AGENT_MAX || count == 0) return;
+  if (count > AGENT_MAX - first) count = AGENT_MAX - first;
+
+  uint32_t pattern = (uint32_t)(state & 3) * LOW_PLANE;
+  uint32_t end = first + count;
+  for (uint32_t i = first; i < end; ) {
+    uint32_t w = i >> 4;
+    uint32_t from = i & 15;
+    uint32_t to = end - (w << 4) < 16 ? end - (w << 4) : 16;
+    if (from == 0 && to == 16) {
+      bits[w] = pattern;
+    } else {
+      uint32_t mask = slotMask(from, to);
+      bits[w] = (bits[w] & ~mask) | (pattern & mask);
+    }
+    i = (w + 1) << 4;
+  }
+  markDirty(first, end - 1);
+}
+
+// ══════════════════════════════════════════════════════════════════════════
+// DIFFS
+// ══════════════════════════════════════════════════════════════════════════
+
+AgentDiffResult AgentStatusTable::apply(const uint8_t* data, size_t length) {
+  const uint8_t* p = data + 2;
+  const uint8_t* end = data + length;
+  if (length < 2 || data[0] != AGENT_MSG_STATUS) return AGENT_DIFF_MALFORMED;
+
+  uint8_t encoding = data[1];
+  uint32_t newSeq, newTotal;
+  if (!readVarint(p, end, newSeq) || !readVarint(p, end, newTotal)) return AGENT_DIFF_MALFORMED;
+
+  if (encoding == ENCODING_SNAPSHOT) {
+    memset(bits, 0, sizeof(bits));
+    markDirty(0, AGENT_MAX - 1);
+    haveSnapshot = true;
+  } else if (!haveSnapshot || newSeq != seq + 1) {
+    return AGENT_DIFF_GAP;
+  }
+  agents = newTotal < AGENT_MAX ? newTotal : AGENT_MAX;
+
+  // From here on a bad message leaves the table half-updated, so any
+  // error also drops sync and forces a fresh snapshot
+  bool ok = true;
+  if (encoding == ENCODING_RLE || encoding == ENCODING_SNAPSHOT) {
+    uint32_t pos = 0;
+    while (ok && p < end) {
+      uint32_t skip, run;
+      ok = readVarint(p, end, skip) && readVarint(p, end, run) && p < end;
+      if (!ok) break;
+      AgentState state = (AgentState)(*p++ & 3);
+      pos += skip;
+      fill(pos, run, state);
+      pos += run;
+    }
+  } else if (encoding == ENCODING_BITMAP) {
+    uint32_t first, n;
+    ok = readVarint(p, end, first) && readVarint(p, end, n);
+    const uint8_t* changed = p;
+    uint32_t mapBytes = (n + 7) / 8;
+    ok = ok && (uint32_t)(end - p) >= mapBytes;
+
+    uint32_t flagged = 0;
+    for (uint32_t i = 0; ok && i < mapBytes; i++) flagged += __builtin_popcount(changed[i]);
+    const uint8_t* states = changed + mapBytes;
+    ok = ok && (uint32_t)(end - states) >= (flagged + 3) / 4;
+
+    uint32_t k = 0;
+    for (uint32_t byte = 0; ok && byte < mapBytes; byte++) {
+      uint8_t mask = changed[byte];
+      while (mask) {
+        uint32_t bit = __builtin_ctz(mask);
+        mask &= mask - 1;
+        uint32_t i = byte * 8 + bit;
+        if (i < n) set(first + i, (AgentState)((states[k >> 2] >> ((k & 3) * 2)) & 3));
+        k++;
+      }
+    }
+  } else {
+    ok = false;
+  }
+
+  if (!ok) {
+    haveSnapshot = false;
+    return AGENT_DIFF_MALFORMED;
+  }
+  seq = newSeq;
+  return AGENT_DIFF_OK;
+}
+
+// ══════════════════════════════════════════════════════════════════════════
+// AGGREGATION
+// ══════════════════════════════════════════════════════════════════════════
+
+bool AgentStatusTable::addGroup(const char* name, uint32_t start, uint32_t count) {
+  if (groups >= AGENT_GROUP_MAX) return false;
+  AgentGroup& g = groupList[groups++];
+  strncpy(g.name, name, AGENT_GROUP_NAME - 1);
+  g.name[AGENT_GROUP_NAME - 1] = '\0';
+  g.start = start;
+  g.count = count;
+  g.counts = {};
+  return true;
+}
+
+void AgentStatusTable::countRange(uint32_t first, uint32_t count, AgentCounts& out) const {
+  uint32_t end = first + count;
+  if (end > agents) end = agents;
+  out = {};
+  if (first >= end) return;
+
+  uint32_t online = 0, degraded = 0, offline = 0;
+  for (uint32_t i = first; i < end; ) {
+    uint32_t w = i >> 4;
+    uint32_t from = i & 15;
+    uint32_t to = end - (w << 4) < 16 ? end - (w << 4) : 16;
+    uint32_t valid = slotMask(from, to) & LOW_PLANE;
+
+    uint32_t word = bits[w];
+    uint32_t lo = word & valid;
+    uint32_t hi = (word >> 1) & valid;
+    online += __builtin_popcount(lo & ~hi);
+    degraded += __builtin_popcount(hi & ~lo);
+    offline += __builtin_popcount(lo & hi);
+    i = (w + 1) << 4;
+  }
+
+  out.online = online;
+  out.degraded = degraded;
+  out.offline = offline;
+  out.unknown = (end - first) - online - degraded - offline;
+}
+
+void AgentStatusTable::aggregate() {
+  countRange(0, agents, total);
+  for (uint8_t i = 0; i < groups; i++) {
+    countRange(groupList[i].start, groupList[i].count, groupList[i].counts);
+  }
+}
@@ -0,0 +1,118 @@
+/**
+ * ══════════════════════════════════════════════════════════════════════════
+ *                    🖤🛣️ AGENT STATUS BITSET 🛣️🖤
+ * ══════════════════════════════════════════════════════════════════════════
+ *
+ * Live state of every agent packed 2 bits per agent, 16 agents per 32-bit
+ * word: 16k agents in 4 KB. The server keeps it current with binary diffs
+ * (WebSocket BIN frames):
+ *
+ *   'S' encoding varint(seq) varint(total) body
+ *
+ *   encoding 0  RLE       body = { varint(skip) varint(run) u8(state) }*
+ *                         skip agents are left alone, the next run are set
+ *   encoding 1  BITMAP    body = varint(first) varint(n)
+ *                         ceil(n/8) bytes change bitmap, then the new
+ *                         state of each flagged agent, 4 per byte
+ *   encoding 2  SNAPSHOT  RLE over a cleared table (everything unlisted
+ *                         becomes unknown); resets the sequence
+ *
+ * Diffs must arrive with consecutive sequence numbers; after a gap the
+ * table refuses diffs until the next snapshot.
+ *
+ * Aggregation works a word at a time: the low and high bit planes are
+ * split with 0x5555... masks and each state is one popcount, for the
+ * fleet and for each contiguous agent group.
+ */
+
+#ifndef AGENT_STATUS_H
+#define AGENT_STATUS_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifndef AGENT_MAX
+#define AGENT_MAX 16384
+#endif
+
+#define AGENT_WORDS        (AGENT_MAX / 16)
+#define AGENT_GROUP_MAX    8
+#define AGENT_GROUP_NAME   12
+#define AGENT_MSG_STATUS   'S'
+
+enum AgentState : uint8_t {
+  AGENT_UNKNOWN = 0,  // never reported
+  AGENT_ONLINE,
+  AGENT_DEGRADED,
+  AGENT_OFFLINE
+};
+
+enum AgentDiffResult : uint8_t {
+  AGENT_DIFF_OK = 0,
+  AGENT_DIFF_GAP,        // missed a diff; ask for a snapshot
+  AGENT_DIFF_MALFORMED
+};
+
+struct AgentCounts {
+  uint32_t online;
+  uint32_t degraded;
+  uint32_t offline;
+  uint32_t unknown;
+};
+
+struct AgentGroup {
+  char name[AGENT_GROUP_NAME];
+  uint32_t start;
+  uint32_t count;
+  AgentCounts counts;
+};
+
+class AgentStatusTable {
+ public:
+  void clear();
+
+  uint32_t size() const { return agents; }
+  uint32_t sequence() const { return seq; }
+  bool synced() const { return haveSnapshot; }
+
+  AgentState get(uint32_t index) const {
+    return (AgentState)((bits[index >> 4] >> ((index & 15) * 2)) & 3);
+  }
+  void set(uint32_t index, AgentState state);
+  void fill(uint32_t first, uint32_t count, AgentState state);
+
+  AgentDiffResult apply(const uint8_t* data, size_t length);
+
+  // Groups are contiguous index ranges; without any, the fleet is one group
+  void clearGroups() { groups = 0; }
+  bool addGroup(const char* name, uint32_t start, uint32_t count);
+  uint8_t groupCount() const { return groups; }
+  const AgentGroup& group(uint8_t i) const { return groupList[i]; }
+
+  // Recounts totals and every group
+  void aggregate();
+  const AgentCounts& totals() const { return total; }
+
+  // Index range changed since the last call, for partial repaints
+  bool takeDirty(uint32_t& first, uint32_t& last);
+
+  const uint32_t* words() const { return bits; }
+
+ private:
+  uint32_t bits[AGENT_WORDS];
+  uint32_t agents = 0;
+  uint32_t seq = 0;
+  bool haveSnapshot = false;
+
+  AgentGroup groupList[AGENT_GROUP_MAX];
+  uint8_t groups = 0;
+  AgentCounts total = {};
+
+  uint32_t dirtyFirst = UINT32_MAX;
+  uint32_t dirtyLast = 0;
+
+  void markDirty(uint32_t first, uint32_t last);
+  void countRange(uint32_t first, uint32_t count, AgentCounts& out) const;
+};
+
+#endif // AGENT_STATUS_H
@@ -0,0 +1,122 @@
+/**
+ * ══════════════════════════════════════════════════════════════════════════
+ *                    🖤🛣️ HEAP ALLOCATION GUARD 🛣️🖤
+ * ══════════════════════════════════════════════════════════════════════════
+ */
+
+#include "alloc_guard.h"
+
+#if CEO_HUB_ALLOC_GUARD
+
+#include <stdlib.h>
+#include <new>
+
+#ifdef ARDUINO
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#endif
+
+extern "C" {
+void* __real_malloc(size_t size);
+void* __real_calloc(size_t count, size_t size);
+void* __real_realloc(void* ptr, size_t size);
+}
+
+static volatile uint32_t allocCount = 0;
+static uint32_t scopeStart = 0;
+static uint8_t scopeDepth = 0;
+static const char* scopeName = nullptr;
+static AllocGuardStats stats = { 0, 0, 0, nullptr, 0 };
+
+#ifdef ARDUINO
+// WiFi/lwIP tasks allocate all the time; only the UI task is policed
+static TaskHandle_t guardedTask = nullptr;
+
+static inline bool onGuardedTask() {
+  return guardedTask && xTaskGetCurrentTaskHandle() == guardedTask;
+}
+#else
+static inline bool onGuardedTask() {
+  return true;
+}
+#endif
+
+// ══════════════════════════════════════════════════════════════════════════
+// ALLOCATOR WRAPPERS (-Wl,--wrap=...)
+// ══════════════════════════════════════════════════════════════════════════
+
+extern "C" void* __wrap_malloc(size_t size) {
+  if (onGuardedTask()) allocCount++;
+  return __real_malloc(size);
+}
+
+extern "C" void* __wrap_calloc(size_t count, size_t size) {
+  if (onGuardedTask()) allocCount++;
+  return __real_calloc(count, size);
+}
+
+extern "C" void* __wrap_realloc(void* ptr, size_t size) {
+  if (onGuardedTask()) allocCount++;
+  return __real_realloc(ptr, size);
+}
+
+#ifndef ARDUINO
+// Host libstdc++ is a shared library, so its operator new never sees the
+// wrapped malloc. Route it through ours explicitly.
+void* operator new(size_t size) {
+  void* p = __wrap_malloc(size ? size : 1);
+  if (!p) throw std::bad_alloc();
+  return p;
+}
+void* operator new[](size_t size) {
+  return operator new(size);
+}
+void operator delete(void* p) noexcept { free(p); }
+void operator delete[](void* p) noexcept { free(p); }
+void operator delete(void* p, size_t) noexcept { free(p); }
+void operator delete[](void* p, size_t) noexcept { free(p); }
+#endif
+
+// ══════════════════════════════════════════════════════════════════════════
+// SCOPES
+// ══════════════════════════════════════════════════════════════════════════
+
+void allocGuardBegin(const char* scope) {
+#ifdef ARDUINO
+  if (!guardedTask) guardedTask = xTaskGetCurrentTaskHandle();
+#endif
+  // Nested scopes are folded into the outermost one
+  if (scopeDepth++ == 0) {
+    scopeName = scope;
+    scopeStart = allocCount;
+  }
+}
+
+uint32_t allocGuardEnd() {
+  if (scopeDepth == 0) return 0;
+  uint32_t count = allocCount - scopeStart;
+  if (--scopeDepth > 0) return count;
+
+  stats.frames++;
+  if (count) {
+    stats.violations++;
+    stats.allocations += count;
+    stats.lastScope = scopeName;
+    stats.lastCount = count;
+  }
+  return count;
+}
+
+uint32_t allocGuardTotal() {
+  return allocCount;
+}
+
+const AllocGuardStats& allocGuardStats() {
+  return stats;
+}
+
+void allocGuardReset() {
+  stats = { 0, 0, 0, nullptr, 0 };
+}
+
+#endif // CEO_HUB_ALLOC_GUARD
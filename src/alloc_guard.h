@@ -0,0 +1,60 @@
+/**
+ * ══════════════════════════════════════════════════════════════════════════
+ *                    🖤🛣️ HEAP ALLOCATION GUARD 🛣️🖤
+ * ══════════════════════════════════════════════════════════════════════════
+ *
+ * Debug counter for heap allocations made on the UI task. The render path
+ * must not allocate: wrap a frame in ALLOC_GUARD_SCOPE("frame") and any
+ * malloc/calloc/realloc (including operator new and Arduino String) made
+ * while the scope is open is counted as a violation.
+ *
+ * Counting works by wrapping the allocator at link time, so the build
+ * needs both -DCEO_HUB_ALLOC_GUARD=1 and
+ *   -Wl,--wrap=malloc -Wl,--wrap=calloc -Wl,--wrap=realloc
+ * (set up in env:esp32dev-profile). bench/hotpath_bench is built with the
+ * same flags and fails when a guarded scope allocates.
+ * Without the define, ALLOC_GUARD_SCOPE compiles to nothing.
+ */
+
+#ifndef ALLOC_GUARD_H
+#define ALLOC_GUARD_H
+
+#include <stdint.h>
+
+#ifndef CEO_HUB_ALLOC_GUARD
+#define CEO_HUB_ALLOC_GUARD 0
+#endif
+
+#if CEO_HUB_ALLOC_GUARD
+
+struct AllocGuardStats {
+  uint32_t frames;          // guarded scopes closed
+  uint32_t violations;      // scopes that allocated
+  uint32_t allocations;     // total allocations inside guarded scopes
+  const char* lastScope;    // name of the last offending scope
+  uint32_t lastCount;       // allocations in that scope
+};
+
+void allocGuardBegin(const char* scope);
+uint32_t allocGuardEnd();  // allocations since allocGuardBegin()
+uint32_t allocGuardTotal();  // every allocation seen on the guarded task
+const AllocGuardStats& allocGuardStats();
+void allocGuardReset();
+
+class AllocGuardScope {
+ public:
+  explicit AllocGuardScope(const char* scope) { allocGuardBegin(scope); }
+  ~AllocGuardScope() { allocGuardEnd(); }
+};
+
+#define ALLOC_GUARD_CONCAT_(a, b) a##b
+#define ALLOC_GUARD_CONCAT(a, b) ALLOC_GUARD_CONCAT_(a, b)
+#define ALLOC_GUARD_SCOPE(name) AllocGuardScope ALLOC_GUARD_CONCAT(allocGuard_, __LINE__)(name)
+
+#else
+
+#define ALLOC_GUARD_SCOPE(name) do {} while (0)
+
+#endif // CEO_HUB_ALLOC_GUARD
+
+#endif // ALLOC_GUARD_H
@@ -0,0 +1,158 @@
+/**
+ * ══════════════════════════════════════════════════════════════════════════
+ *                    🖤🛣️ ANOMALY DETECTOR 🛣️🖤
+ * ══════════════════════════════════════════════════════════════════════════
+ */
+
+#include "anomaly.h"
+#include "fmt.h"
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+void AnomalyDetector::begin(const AnomalyConfig* config) {
+  cfg = config;
+  mean = 0;
+  var = 0;
+  samples = 0;
+  fired = 0;
+  active = 0;
+  seen = 0;
+}
+
+// Edge-triggered with a cooldown: true only when the condition starts
+// and the same rule and direction has not fired recently
+bool AnomalyDetector::raise(AnomalyRule rule, int8_t direction, bool on, uint32_t nowMs) {
+  uint8_t i = rule * 2 + (direction > 0);
+  uint8_t bit = 1 << i;
+  if (!on) {
+    if (active & bit) {
+      active &= ~bit;
+      clearedMs[i] = nowMs;
+    }
+    return false;
+  }
+  if (active & bit) return false;
+  active |= bit;
+  if ((seen & bit) && nowMs - clearedMs[i] < cfg->cooldownMs) return false;
+  seen |= bit;
+  fired++;
+  return true;
+}
+
+uint8_t AnomalyDetector::update(float value, uint32_t nowMs, AnomalyEvent* out) {
+  const AnomalyConfig& c = *cfg;
+  uint8_t n = 0;
+
+  if (samples == 0) {
+    mean = value;
+    var = 0;
+    anchorOld = anchorNew = value;
+    anchorOldMs = anchorNewMs = nowMs;
+  }
+
+  // Threshold
+  bool above = c.hasHigh && value > c.high;
+  bool below = c.hasLow && value < c.low;
+  if (raise(ANOMALY_THRESHOLD, 1, above, nowMs)) {
+    out[n++] = { ANOMALY_THRESHOLD, ANOMALY_CRITICAL, 1, value, c.high, 0 };
+  }
+  if (raise(ANOMALY_THRESHOLD, -1, below, nowMs)) {
+    out[n++] = { ANOMALY_THRESHOLD, ANOMALY_CRITICAL, -1, value, c.low, 0 };
+  }
+
+  // Deviation from the history so far
+  float sigma = sqrtf(var);
+  if (sigma < c.minSigma) sigma = c.minSigma;
+  bool judged = c.zLimit > 0 && samples >= c.warmup && sigma > 0;
+  float z = judged ? (value - mean) / sigma : 0;
+  bool up = raise(ANOMALY_DEVIATION, 1, judged && z > c.zLimit, nowMs);
+  bool down = raise(ANOMALY_DEVIATION, -1, judged && z < -c.zLimit, nowMs);
+  if (up || down) {
+    AnomalySeverity severity = fabsf(z) >= 2 * c.zLimit ? ANOMALY_CRITICAL : ANOMALY_WARN;
+    out[n++] = { ANOMALY_DEVIATION, severity, (int8_t)(up ? 1 : -1), value, z, 0 };
+  }
+
+  // Rate of change against the older anchor; after a long gap there is
+  // nothing recent to compare with
+  uint32_t sinceNew = nowMs - anchorNewMs;
+  if (sinceNew >= 2 * c.rateWindowMs) {
+    anchorOld = anchorNew = value;
+    anchorOldMs = anchorNewMs = nowMs;
+  } else if (sinceNew >= c.rateWindowMs) {
+    anchorOld = anchorNew;
+    anchorOldMs = anchorNewMs;
+    anchorNew = value;
+    anchorNewMs = nowMs;
+  }
+  float change = value - anchorOld;
+  if (c.relative) change = anchorOld != 0 ? change * 100 / fabsf(anchorOld) : 0;
+  bool rising = raise(ANOMALY_RATE, 1, c.riseLimit > 0 && change >= c.riseLimit, nowMs);
+  bool falling = raise(ANOMALY_RATE, -1, c.fallLimit > 0 && change <= -c.fallLimit, nowMs);
+  if (rising || falling) {
+    float limit = rising ? c.riseLimit : c.fallLimit;
+    AnomalySeverity severity = fabsf(change) >= 2 * limit ? ANOMALY_CRITICAL : ANOMALY_WARN;
+    out[n++] = { ANOMALY_RATE, severity, (int8_t)(rising ? 1 : -1), value, change, nowMs - anchorOldMs };
+  }
+
+  // Fold in, clamped so an outlier moves the baseline only as far as the limit
+  if (samples > 0) {
+    float x = value;
+    if (judged) {
+      float limit = c.zLimit * sigma;
+      if (x > mean + limit) x = mean + limit;
+      if (x < mean - limit) x = mean - limit;
+    }
+    float diff = x - mean;
+    float incr = c.alpha * diff;
+    mean += incr;
+    var = (1 - c.alpha) * (var + diff * incr);
+  }
+  samples++;
+  return n;
+}
+
+AnomalyStats AnomalyDetector::stats() const {
+  return { mean, sqrtf(var), samples, fired, active };
+}
+
+const char* anomalyRuleName(AnomalyRule rule) {
+  switch (rule) {
+    case ANOMALY_THRESHOLD: return "threshold";
+    case ANOMALY_DEVIATION: return "deviation";
+    case ANOMALY_RATE:      return "rate";
+    default:                return "?";
+  }
+}
+
+size_t anomalyDescribe(char* out, size_t size, const AnomalyConfig& config, const AnomalyEvent& e) {
+  char value[FMT_BUF_SIZE], detail[FMT_BUF_SIZE], span[FMT_BUF_SIZE];
+  config.format(value, sizeof(value), e.value);
+  int len = 0;
+  if (size) out[0] = '\0';
+
+  switch (e.rule) {
+    case ANOMALY_THRESHOLD:
+      config.format(detail, sizeof(detail), e.score);
+      len = snprintf(out, size, "%s %s %s %s", config.name, value, e.direction > 0 ? "above" : "below", detail);
+      break;
+    case ANOMALY_DEVIATION:
+      fmtFloat(detail, sizeof(detail), fabsf(e.score), 1);
+      len = snprintf(out, size, "%s %s %s, z %s", config.name, e.direction > 0 ? "spike" : "dip", value, detail);
+      break;
+    case ANOMALY_RATE:
+      if (config.relative) {
+        fmtFloat(detail, sizeof(detail), fabsf(e.score), 1);
+        strcat(detail, "%");
+      } else {
+        config.format(detail, sizeof(detail), fabsf(e.score));
+      }
+      fmtDuration(span, sizeof(span), e.spanMs / 1000);
+      len = snprintf(out, size, "%s %c%s in %s", config.name, e.direction > 0 ? '+' : '-', detail, span);
+      break;
+    default:
+      break;
+  }
+  if (len < 0) len = 0;
+  return (size_t)len < size ? (size_t)len : size ? size - 1 : 0;
+}
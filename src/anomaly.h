@@ -0,0 +1,115 @@
+/**
+ * ══════════════════════════════════════════════════════════════════════════
+ *                    🖤🛣️ ANOMALY DETECTOR 🛣️🖤
+ * ══════════════════════════════════════════════════════════════════════════
+ *
+ * Watches one metric stream and reports when a sample looks wrong, on
+ * the sample itself, with no server involved. Three rules, each optional
+ * in the metric's AnomalyConfig:
+ *
+ *   THRESHOLD  above `high` or below `low`
+ *   DEVIATION  more than `zLimit` standard deviations from the EWMA mean
+ *              (after `warmup` samples; the deviation never drops below
+ *              `minSigma`, so a flat line does not turn noise into alarms)
+ *   RATE       risen by `riseLimit` or fallen by `fallLimit` against a
+ *              value one to two `rateWindowMs` old (percent of that value
+ *              when `relative`, else metric units)
+ *
+ * A sample is judged against the history before it, then folded into
+ * the mean and variance. A sample beyond zLimit is folded in clamped to
+ * the limit, so one spike cannot inflate the variance and mask the next,
+ * while a lasting level shift is still learned within a few 1/alpha.
+ *
+ * Each rule and direction fires once when it starts and again only
+ * after it has cleared and `cooldownMs` has passed. State is a few
+ * floats per metric. Times are passed in.
+ */
+
+#ifndef ANOMALY_H
+#define ANOMALY_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+enum AnomalyRule : uint8_t {
+  ANOMALY_THRESHOLD = 0,
+  ANOMALY_DEVIATION,
+  ANOMALY_RATE,
+  ANOMALY_RULES
+};
+
+enum AnomalySeverity : uint8_t {
+  ANOMALY_WARN = 1,
+  ANOMALY_CRITICAL
+};
+
+struct AnomalyConfig {
+  const char* name;
+  // Formats a value in the metric's unit ("95%", "2.0KB", "0.4213")
+  size_t (*format)(char* out, size_t size, float value);
+  float alpha;              // EWMA weight of a new sample
+  uint16_t warmup;          // samples before DEVIATION is judged
+  float zLimit;             // 0 = no DEVIATION rule
+  float minSigma;
+  bool hasHigh, hasLow;
+  float high, low;
+  float riseLimit;          // 0 = not watched
+  float fallLimit;          // 0 = not watched
+  bool relative;
+  uint32_t rateWindowMs;
+  uint32_t cooldownMs;
+};
+
+struct AnomalyEvent {
+  AnomalyRule rule;
+  AnomalySeverity severity;
+  int8_t direction;   // +1 up, -1 down
+  float value;        // the sample
+  float score;        // z, change, or the crossed limit
+  uint32_t spanMs;    // RATE: how far back the change was measured
+};
+
+struct AnomalyStats {
+  float mean;
+  float sigma;
+  uint32_t samples;
+  uint32_t fired;
+  uint8_t active;     // bit per rule and direction: 1 << (rule * 2 + up)
+};
+
+class AnomalyDetector {
+ public:
+  void begin(const AnomalyConfig* config);
+
+  // Judges value; returns the number of events written to out (at most
+  // ANOMALY_RULES, one per rule)
+  uint8_t update(float value, uint32_t nowMs, AnomalyEvent* out);
+
+  const AnomalyConfig& config() const { return *cfg; }
+  AnomalyStats stats() const;
+
+ private:
+  const AnomalyConfig* cfg = nullptr;
+  float mean = 0;
+  float var = 0;
+  uint32_t samples = 0;
+  uint32_t fired = 0;
+
+  // Rate lookback: the value at the start of the previous window and of
+  // the current one, so the comparison always spans at least one window
+  float anchorOld = 0, anchorNew = 0;
+  uint32_t anchorOldMs = 0, anchorNewMs = 0;
+
+  uint8_t active = 0;
+  uint8_t seen = 0;   // fired at least once, so the cooldown applies
+  uint32_t clearedMs[ANOMALY_RULES * 2] = {};
+
+  bool raise(AnomalyRule rule, int8_t direction, bool on, uint32_t nowMs);
+};
+
+const char* anomalyRuleName(AnomalyRule rule);
+
+// "CPU 97% above 95%", "CPU spike 88%, z 5.2", "RoadCoin -6.1% in 1m 5s"
+size_t anomalyDescribe(char* out, size_t size, const AnomalyConfig& config, const AnomalyEvent& e);
+
+#endif // ANOMALY_H
@@ -0,0 +1,92 @@
+/**
+ * ══════════════════════════════════════════════════════════════════════════
+ *                    🖤🛣️ BOOT SNAPSHOT 🛣️🖤
+ * ══════════════════════════════════════════════════════════════════════════
+ */
+
+#include "boot_snapshot.h"
+
+#define SNAPSHOT_MAGIC  0xB5
+#define SNAPSHOT_FORMAT 1
+
+// CRC-16/CCITT-FALSE
+static uint16_t crc16(const uint8_t* data, size_t n) {
+  uint16_t crc = 0xFFFF;
+  while (n--) {
+    crc ^= (uint16_t)*data++ << 8;
+    for (int i = 0; i < 8; i++) crc = (crc & 0x8000) ? (uint16_t)((crc << 1) ^ 0x1021) : (uint16_t)(crc << 1);
+  }
+  return crc;
+}
+
+static void writeVarint(uint8_t*& p, uint32_t value) {
+  do {
+    uint8_t byte = value & 0x7F;
+    value >>= 7;
+    *p++ = value ? (byte | 0x80) : byte;
+  } while (value);
+}
+
+static void writeSvarint(uint8_t*& p, int32_t value) {
+  writeVarint(p, ((uint32_t)value << 1) ^ (uint32_t)(value >> 31));
+}
+
+static bool readVarint(const uint8_t*& p, const uint8_t* end, uint32_t& value) {
+  value = 0;
+  for (uint8_t shift = 0; shift < 35; shift += 7) {
+    if (p >= end) return false;
+    uint8_t byte = *p++;
+    value |= (uint32_t)(byte & 0x7F) << shift;
+    if (!(byte & 0x80)) return true;
+  }
+  return false;
+}
+
+static bool readSvarint(const uint8_t*& p, const uint8_t* end, int32_t& value) {
+  uint32_t raw;
+  if (!readVarint(p, end, raw)) return false;
+  value = (int32_t)(raw >> 1) ^ -(int32_t)(raw & 1);
+  return true;
+}
+
+size_t bootSnapshotEncode(const BootSnapshot& s, uint8_t* out, size_t size) {
+  if (size < BOOT_SNAPSHOT_MAX) return 0;
+  uint8_t* p = out;
+  *p++ = SNAPSHOT_MAGIC;
+  *p++ = SNAPSHOT_FORMAT;
+  *p++ = s.screen;
+  *p++ = s.homeWindow;
+  *p++ = s.candleView;
+  writeVarint(p, s.projects);
+  writeVarint(p, s.agents);
+  writeVarint(p, s.activeAgents);
+  writeSvarint(p, s.price);
+  writeSvarint(p, s.changeBp);
+  writeVarint(p, s.cpu);
+  writeVarint(p, s.memory);
+  writeVarint(p, s.network);
+  uint16_t crc = crc16(out, p - out);
+  *p++ = crc >> 8;
+  *p++ = crc & 0xFF;
+  return p - out;
+}
+
+bool bootSnapshotDecode(const uint8_t* data, size_t length, BootSnapshot& s) {
+  if (length < 7 || length > BOOT_SNAPSHOT_MAX) return false;
+  if (data[0] != SNAPSHOT_MAGIC || data[1] != SNAPSHOT_FORMAT) return false;
+  const uint8_t* end = data + length - 2;
+  if (crc16(data, end - data) != (uint16_t)(end[0] << 8 | end[1])) return false;
+
+  BootSnapshot d;
+  const uint8_t* p = data + 2;
+  d.screen = *p++;
+  d.homeWindow = *p++;
+  d.candleView = *p++;
+  bool ok = readVarint(p, end, d.projects) && readVarint(p, end, d.agents) &&
+            readVarint(p, end, d.activeAgents) && readSvarint(p, end, d.price) &&
+            readSvarint(p, end, d.changeBp) && readVarint(p, end, d.cpu) &&
+            readVarint(p, end, d.memory) && readVarint(p, end, d.network);
+  if (!ok || p != end) return false;
+  s = d;
+  return true;
+}
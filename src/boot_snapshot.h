@@ -0,0 +1,46 @@
+/**
+ * ══════════════════════════════════════════════════════════════════════════
+ *                    🖤🛣️ BOOT SNAPSHOT 🛣️🖤
+ * ══════════════════════════════════════════════════════════════════════════
+ *
+ * The dashboard as it last looked: the screen and view choices plus the
+ * last values the server sent. Kept in flash so boot can paint a usable
+ * (stale-marked) dashboard before WiFi is even associated.
+ *
+ * Encoding: magic, format, then varints (zigzag for signed fields) and a
+ * CRC-16 over everything before it. Typical snapshots are 20-30 bytes;
+ * a truncated or corrupted one decodes as absent.
+ *
+ * Pure logic; where the bytes are stored is up to the caller.
+ */
+
+#ifndef BOOT_SNAPSHOT_H
+#define BOOT_SNAPSHOT_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define BOOT_SNAPSHOT_MAX 48  // worst case is 47 bytes
+
+struct BootSnapshot {
+  // View
+  uint8_t screen;
+  uint8_t homeWindow;     // SketchWindow
+  uint8_t candleView;     // CandleFrame, or CANDLE_FRAMES for the price line
+  // Data, as last received
+  uint32_t projects;
+  uint32_t agents;
+  uint32_t activeAgents;
+  int32_t price;          // Price, fixed point
+  int32_t changeBp;
+  uint32_t cpu;
+  uint32_t memory;
+  uint32_t network;
+};
+
+// Bytes written, 0 when `size` is too small
+size_t bootSnapshotEncode(const BootSnapshot& s, uint8_t* out, size_t size);
+// false on a bad magic, format, length or CRC; `s` is left untouched then
+bool bootSnapshotDecode(const uint8_t* data, size_t length, BootSnapshot& s);
+
+#endif // BOOT_SNAPSHOT_H
@@ -0,0 +1,210 @@
+/**
+ * ══════════════════════════════════════════════════════════════════════════
+ *                    🖤🛣️ OHLC CANDLES 🛣️🖤
+ * ══════════════════════════════════════════════════════════════════════════
+ */
+
+#include "candles.h"
+#include "fmt.h"
+
+static const uint32_t frameSeconds[CANDLE_FRAMES] = { 60, 300, 3600 };
+
+static bool readVarint(const uint8_t*& p, const uint8_t* end, uint32_t& value) {
+  value = 0;
+  for (uint8_t shift = 0; shift < 35; shift += 7) {
+    if (p >= end) return false;
+    uint8_t byte = *p++;
+    value |= (uint32_t)(byte & 0x7F) << shift;
+    if (!(byte & 0x80)) return true;
+  }
+  return false;
+}
+
+static bool readSvarint(const uint8_t*& p, const uint8_t* end, int32_t& value) {
+  uint32_t raw;
+  if (!readVarint(p, end, raw)) return false;
+  value = (int32_t)(raw >> 1) ^ -(int32_t)(raw & 1);
+  return true;
+}
+
+// ══════════════════════════════════════════════════════════════════════════
+// FIXED-POINT PRICES
+// ══════════════════════════════════════════════════════════════════════════
+
+bool priceParse(const char* text, Price& out) {
+  if (!text || !*text) return false;
+  int64_t value = 0;
+  uint8_t fraction = 0;
+  bool dot = false, digits = false;
+
+  for (const char* c = text; *c; c++) {
+    if (*c == '.' && !dot) {
+      dot = true;
+    } else if (*c >= '0' && *c <= '9') {
+      if (dot && ++fraction > PRICE_DECIMALS) return false;
+      value = value * 10 + (*c - '0');
+      if (value > INT32_MAX) return false;
+      digits = true;
+    } else {
+      return false;
+    }
+  }
+  if (!digits) return false;
+
+  for (; fraction < PRICE_DECIMALS; fraction++) {
+    value *= 10;
+    if (value > INT32_MAX) return false;
+  }
+  out = (Price)value;
+  return true;
+}
+
+Price priceFromDouble(double value) {
+  double scaled = value * PRICE_SCALE;
+  scaled += scaled < 0 ? -0.5 : 0.5;
+  if (scaled >= (double)INT32_MAX) return INT32_MAX;
+  if (scaled <= (double)INT32_MIN) return INT32_MIN;
+  return (Price)scaled;
+}
+
+size_t fmtPrice(char* out, size_t size, Price price, uint8_t decimals) {
+  if (decimals > PRICE_DECIMALS) decimals = PRICE_DECIMALS;
+  int32_t divisor = 1;
+  for (uint8_t i = decimals; i < PRICE_DECIMALS; i++) divisor *= 10;
+  int64_t half = price < 0 ? -(divisor / 2) : divisor / 2;
+  return fmtFixed(out, size, (int32_t)(((int64_t)price + half) / divisor), decimals);
+}
+
+// ══════════════════════════════════════════════════════════════════════════
+// SERIES
+// ══════════════════════════════════════════════════════════════════════════
+
+void CandleSeries::begin(uint32_t periodSeconds) {
+  seconds = periodSeconds;
+  head = 0;
+  used = 0;
+}
+
+void CandleSeries::open(uint32_t start, Price price) {
+  if (used > 0) head = (head + 1) % CANDLE_HISTORY;
+  if (used < CANDLE_HISTORY) used++;
+  ring[head] = { start, price, price, price, price, 0, 0 };
+}
+
+bool CandleSeries::add(uint32_t time, Price price, uint32_t volume, bool latest) {
+  uint32_t start = time - time % seconds;
+  bool opened = false;
+
+  if (used == 0) {
+    open(start, price);
+    opened = true;
+  } else if (start < ring[head].start) {
+    return false;
+  } else if (start > ring[head].start) {
+    // Empty buckets become flat candles; older than a full ring is pointless
+    Price prev = ring[head].close;
+    uint32_t gap = (start - ring[head].start) / seconds - 1;
+    if (gap > CANDLE_HISTORY) gap = CANDLE_HISTORY;
+    for (uint32_t g = gap; g > 0; g--) open(start - g * seconds, prev);
+    open(start, price);
+    opened = true;
+  }
+
+  Candle& c = ring[head];
+  if (price > c.high) c.high = price;
+  if (price < c.low) c.low = price;
+  if (latest) c.close = price;
+  c.volume += volume;
+  c.ticks++;
+  return opened;
+}
+
+// ══════════════════════════════════════════════════════════════════════════
+// AGGREGATOR
+// ══════════════════════════════════════════════════════════════════════════
+
+void CandleAggregator::begin() {
+  for (uint8_t f = 0; f < CANDLE_FRAMES; f++) frames[f].begin(frameSeconds[f]);
+  price = 0;
+  time = 0;
+  ticks = 0;
+  late = 0;
+}
+
+uint8_t CandleAggregator::addTick(uint32_t tickTime, Price tickPrice, uint32_t volume) {
+  // The 1m series is the finest, so anything before its newest candle is
+  // late for every frame
+  const CandleSeries& minute = frames[CANDLE_1M];
+  if (minute.count() > 0 && tickTime < minute.last().start) {
+    late++;
+    return 0;
+  }
+
+  bool latest = ticks == 0 || tickTime >= time;
+  uint8_t opened = 0;
+  for (uint8_t f = 0; f < CANDLE_FRAMES; f++) {
+    if (frames[f].add(tickTime, tickPrice, volume, latest)) opened |= 1 << f;
+  }
+  if (latest) {
+    price = tickPrice;
+    time = tickTime;
+  }
+  ticks++;
+  return opened;
+}
+
+int32_t CandleAggregator::apply(const uint8_t* data, size_t length, uint8_t& opened) {
+  const uint8_t* p = data + 1;
+  const uint8_t* end = data + length;
+  opened = 0;
+  if (length < 1 || data[0] != CANDLE_MSG_TICKS) return -1;
+
+  uint32_t count;
+  if (!readVarint(p, end, count)) return -1;
+
+  uint32_t tickTime = 0;
+  int64_t tickPrice = 0;
+  for (uint32_t i = 0; i < count; i++) {
+    uint32_t t, volume;
+    int32_t dp;
+    if (!readVarint(p, end, t) || !readSvarint(p, end, dp) || !readVarint(p, end, volume)) return -1;
+
+    tickTime = i == 0 ? t : tickTime + t;
+    tickPrice = i == 0 ? dp : tickPrice + dp;
+    if (tickPrice < 0 || tickPrice > INT32_MAX) return -1;
+    opened |= addTick(tickTime, (Price)tickPrice, volume);
+  }
+  return (int32_t)count;
+}
+
+uint16_t CandleAggregator::firstHour24h() const {
+  const CandleSeries& hours = frames[CANDLE_1H];
+  uint32_t since = time > 86400 ? time - 86400 : 0;
+  uint16_t i = 0;
+  while (i + 1 < hours.count() && hours.at(i).start + 3600 <= since) i++;
+  return i;
+}
+
+int32_t CandleAggregator::changeBasisPoints() const {
+  const CandleSeries& hours = frames[CANDLE_1H];
+  if (hours.count() == 0) return 0;
+  Price open = hours.at(firstHour24h()).open;
+  if (open == 0) return 0;
+  return (int32_t)(((int64_t)price - open) * 10000 / open);
+}
+
+void CandleAggregator::range24h(Price& low, Price& high) const {
+  const CandleSeries& hours = frames[CANDLE_1H];
+  low = high = price;
+  for (uint16_t i = firstHour24h(); i < hours.count(); i++) {
+    if (hours.at(i).low < low) low = hours.at(i).low;
+    if (hours.at(i).high > high) high = hours.at(i).high;
+  }
+}
+
+uint32_t CandleAggregator::volume24h() const {
+  const CandleSeries& hours = frames[CANDLE_1H];
+  uint32_t total = 0;
+  for (uint16_t i = firstHour24h(); i < hours.count(); i++) total += hours.at(i).volume;
+  return total;
+}
@@ -0,0 +1,115 @@
+/**
+ * ══════════════════════════════════════════════════════════════════════════
+ *                    🖤🛣️ OHLC CANDLES 🛣️🖤
+ * ══════════════════════════════════════════════════════════════════════════
+ *
+ * Aggregates raw RoadCoin price ticks into 1m, 5m and 1h candles on the
+ * device. Prices are fixed-point (PRICE_DECIMALS places in an int32), so
+ * aggregation never drifts and formatting goes through fmtFixed().
+ *
+ * Ticks arrive as binary WebSocket frames, delta-coded so a burst of
+ * hundreds of ticks stays a few bytes each:
+ *
+ *   'T' varint(count) varint(time) svarint(price) varint(volume)
+ *                     { varint(dt) svarint(dprice) varint(volume) }*
+ *
+ * time is server epoch seconds, price is fixed-point, svarint is zigzag.
+ * Every tick after the first is relative to the one before it.
+ *
+ * Each frame keeps a ring of CANDLE_HISTORY candles. Buckets without a
+ * tick become flat candles at the previous close, so the time axis never
+ * has holes. Ticks older than the newest candle are counted and dropped.
+ */
+
+#ifndef CANDLES_H
+#define CANDLES_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Fixed-point price: 420000 = 0.42 at 6 decimals
+typedef int32_t Price;
+#define PRICE_DECIMALS 6
+#define PRICE_SCALE    1000000
+
+#define CANDLE_HISTORY 64
+#define CANDLE_MSG_TICKS 'T'
+
+enum CandleFrame : uint8_t {
+  CANDLE_1M = 0,
+  CANDLE_5M,
+  CANDLE_1H,
+  CANDLE_FRAMES
+};
+
+struct Candle {
+  uint32_t start;   // bucket start, seconds
+  Price open;
+  Price high;
+  Price low;
+  Price close;
+  uint32_t volume;
+  uint16_t ticks;
+};
+
+// "0.4213" -> 421300 exactly; at most PRICE_DECIMALS fraction digits
+bool priceParse(const char* text, Price& out);
+Price priceFromDouble(double value);
+// Rounds to `decimals` (<= PRICE_DECIMALS) and formats
+size_t fmtPrice(char* out, size_t size, Price price, uint8_t decimals);
+
+class CandleSeries {
+ public:
+  void begin(uint32_t periodSeconds);
+
+  // true when the tick opened a new candle (the chart has to shift)
+  bool add(uint32_t time, Price price, uint32_t volume, bool latest);
+
+  uint32_t period() const { return seconds; }
+  uint16_t count() const { return used; }
+  // 0 is the oldest candle held, count() - 1 the newest
+  const Candle& at(uint16_t i) const { return ring[(head + CANDLE_HISTORY - used + 1 + i) % CANDLE_HISTORY]; }
+  const Candle& last() const { return ring[head]; }
+
+ private:
+  Candle ring[CANDLE_HISTORY];
+  uint16_t head = 0;  // newest
+  uint16_t used = 0;
+  uint32_t seconds = 60;
+
+  void open(uint32_t start, Price price);
+};
+
+class CandleAggregator {
+ public:
+  void begin();
+
+  // Bitmask of frames that opened a new candle, 0 if the tick was dropped
+  // or only moved the newest candles
+  uint8_t addTick(uint32_t time, Price price, uint32_t volume);
+  // Decodes a 'T' frame; returns the tick count, or -1 if malformed
+  int32_t apply(const uint8_t* data, size_t length, uint8_t& opened);
+
+  const CandleSeries& series(CandleFrame frame) const { return frames[frame]; }
+  bool hasPrice() const { return ticks > 0; }
+  Price lastPrice() const { return price; }
+  uint32_t lastTime() const { return time; }
+  uint32_t tickCount() const { return ticks; }
+  uint32_t lateCount() const { return late; }
+
+  // Over the hourly candles covering the last 24h
+  int32_t changeBasisPoints() const;  // 523 = +5.23%
+  void range24h(Price& low, Price& high) const;
+  uint32_t volume24h() const;
+
+ private:
+  CandleSeries frames[CANDLE_FRAMES];
+  Price price = 0;
+  uint32_t time = 0;
+  uint32_t ticks = 0;
+  uint32_t late = 0;
+
+  uint16_t firstHour24h() const;
+};
+
+#endif // CANDLES_H
@@ -0,0 +1,60 @@
+/**
+ * ══════════════════════════════════════════════════════════════════════════
+ *                    🖤🛣️ CHART SCALING & DECIMATION 🛣️🖤
+ * ══════════════════════════════════════════════════════════════════════════
+ */
+
+#include "chart.h"
+
+uint16_t chartScale(const uint8_t* data, uint16_t count, int16_t w, int16_t h,
+                    int16_t* heights, int16_t& barWidth) {
+  barWidth = 1;
+  if (count == 0 || w <= 0) return 0;
+  if (count > CHART_MAX_BARS) count = CHART_MAX_BARS;
+
+  // Find min/max for scaling
+  uint8_t minVal = 255, maxVal = 0;
+  for (uint16_t i = 0; i < count; i++) {
+    if (data[i] < minVal) minVal = data[i];
+    if (data[i] > maxVal) maxVal = data[i];
+  }
+  if (maxVal == minVal) maxVal = minVal + 1;  // Avoid division by zero
+
+  barWidth = w / count;
+  if (barWidth < 1) barWidth = 1;
+
+  uint16_t bars = 0;
+  for (; bars < count && bars * barWidth < w; bars++) {
+    heights[bars] = (int16_t)(((data[bars] - minVal) * (h - 4)) / (maxVal - minVal));
+  }
+  return bars;
+}
+
+uint16_t chartScaleEnvelope(const uint8_t* data, uint32_t count, int16_t w, int16_t h,
+                            int16_t* low, int16_t* high) {
+  if (count == 0 || w <= 4) return 0;
+  uint16_t columns = w - 4 < CHART_MAX_BARS ? w - 4 : CHART_MAX_BARS;
+  if (count < columns) columns = count;
+
+  uint8_t minVal = 255, maxVal = 0;
+  for (uint32_t i = 0; i < count; i++) {
+    if (data[i] < minVal) minVal = data[i];
+    if (data[i] > maxVal) maxVal = data[i];
+  }
+  if (maxVal == minVal) maxVal = minVal + 1;
+
+  // Column c covers samples [c * count / columns, (c + 1) * count / columns)
+  uint32_t from = 0;
+  for (uint16_t c = 0; c < columns; c++) {
+    uint32_t to = (uint64_t)(c + 1) * count / columns;
+    uint8_t lo = data[from], hi = data[from];
+    for (uint32_t i = from + 1; i < to; i++) {
+      if (data[i] < lo) lo = data[i];
+      if (data[i] > hi) hi = data[i];
+    }
+    low[c] = (int16_t)(((lo - minVal) * (h - 4)) / (maxVal - minVal));
+    high[c] = (int16_t)(((hi - minVal) * (h - 4)) / (maxVal - minVal));
+    from = to;
+  }
+  return columns;
+}
@@ -0,0 +1,209 @@
+/**
+ * ══════════════════════════════════════════════════════════════════════════
+ *                    🖤🛣️ CHART SCALING & DECIMATION 🛣️🖤
+ * ══════════════════════════════════════════════════════════════════════════
+ *
+ * Turns runs of samples into what a 220 px canvas can show.
+ *
+ * Bars: chartScale() maps up to one sample per column to bar heights,
+ * smallest sample empty and largest full, inside a 2px margin. Longer
+ * runs go through chartScaleEnvelope(): each pixel column gets the min
+ * and max of the samples it covers, so no peak disappears between
+ * pixels.
+ *
+ * Long series: ChartSeriesT keeps any number of samples in a fixed set of
+ * min/max buckets, built incrementally. When the buckets run out,
+ * neighbours merge pairwise and each bucket covers twice the span.
+ * Appending costs O(1) amortised. The output stays the same size
+ * however long the series grows (24 h of 1 s samples is 86,400 points):
+ *
+ *   envelope()  min/max per column, for bars
+ *   lttb()      Largest-Triangle-Three-Buckets over the bucket extremes
+ *               (MinMaxLTTB), for lines. It keeps the visual shape with
+ *               one point per column.
+ *
+ * Integer-only, no heap, no drawing, so everything can be timed on the
+ * host.
+ */
+
+#ifndef CHART_H
+#define CHART_H
+
+#include <stdint.h>
+
+#define CHART_MAX_BARS 240        // one per pixel column of the display
+#define CHART_SERIES_BUCKETS 448  // >= 2x the 224 columns a chart can use
+
+struct ChartPoint {
+  uint32_t x;  // sample index
+  int32_t y;
+};
+
+// Fills heights[] and barWidth; returns how many bars to draw
+uint16_t chartScale(const uint8_t* data, uint16_t count, int16_t w, int16_t h,
+                    int16_t* heights, int16_t& barWidth);
+
+// Any number of samples as 1px columns; low/high are bar heights of each
+// column's min and max. Returns the column count (w - 4, or count if less)
+uint16_t chartScaleEnvelope(const uint8_t* data, uint32_t count, int16_t w, int16_t h,
+                            int16_t* low, int16_t* high);
+
+// Largest-Triangle-Three-Buckets: picks `count` (>= 3) of the n points
+// from at(i), first and last always included. Returns points written
+template <typename Points>
+uint16_t chartLttb(const Points& at, uint32_t n, ChartPoint* out, uint16_t count) {
+  if (n <= count || count < 3) {
+    uint16_t k = n < count ? n : count;
+    for (uint16_t i = 0; i < k; i++) out[i] = at(i);
+    return k;
+  }
+
+  // Bucket b (1..count-2) holds points [edge(b), edge(b + 1))
+  uint32_t inner = n - 2, buckets = count - 2;
+  auto edge = [&](uint32_t b) { return 1 + (uint32_t)((uint64_t)(b - 1) * inner / buckets); };
+
+  out[0] = at(0);
+  ChartPoint a = out[0];
+  for (uint32_t b = 1; b <= buckets; b++) {
+    // Average of the next bucket (the last point after the final one)
+    uint32_t from = edge(b + 1), to = b + 1 <= buckets ? edge(b + 2) : n;
+    int64_t sumX = 0, sumY = 0;
+    for (uint32_t i = from; i < to; i++) {
+      ChartPoint p = at(i);
+      sumX += p.x;
+      sumY += p.y;
+    }
+    int64_t cx = sumX / (int64_t)(to - from), cy = sumY / (int64_t)(to - from);
+
+    // The point of this bucket spanning the largest triangle with a and c
+    int64_t best = -1;
+    ChartPoint pick = a;
+    for (uint32_t i = edge(b); i < edge(b + 1); i++) {
+      ChartPoint p = at(i);
+      int64_t area = ((int64_t)a.x - cx) * ((int64_t)p.y - a.y) - ((int64_t)a.x - p.x) * (cy - a.y);
+      if (area < 0) area = -area;
+      if (area > best) {
+        best = area;
+        pick = p;
+      }
+    }
+    out[b] = a = pick;
+  }
+  out[count - 1] = at(n - 1);
+  return count;
+}
+
+template <uint16_t BUCKETS>
+class ChartSeriesT {
+  static_assert(BUCKETS % 2 == 0, "buckets merge in pairs");
+
+ public:
+  void clear() {
+    used = 0;
+    span = 1;
+    fill = 0;
+    total = 0;
+  }
+
+  // Appends the next sample
+  void push(int32_t value) {
+    if (used == 0 || fill == span) {
+      if (used == BUCKETS) halve();
+      buckets[used++] = { value, value, total, total };
+      fill = 0;
+    } else {
+      fold(buckets[used - 1], value, total);
+    }
+    fill++;
+    total++;
+  }
+
+  // Folds another reading into the latest sample without advancing
+  void merge(int32_t value) {
+    if (used) fold(buckets[used - 1], value, total - 1);
+  }
+
+  uint32_t samples() const { return total; }
+  uint32_t samplesPerBucket() const { return span; }
+
+  bool range(int32_t& lo, int32_t& hi) const {
+    if (!used) return false;
+    lo = buckets[0].min;
+    hi = buckets[0].max;
+    for (uint16_t i = 1; i < used; i++) {
+      if (buckets[i].min < lo) lo = buckets[i].min;
+      if (buckets[i].max > hi) hi = buckets[i].max;
+    }
+    return true;
+  }
+
+  // Min/max per column over the whole series; returns columns filled
+  // (fewer than `columns` while the series is shorter than that)
+  uint16_t envelope(uint16_t columns, int32_t* lo, int32_t* hi) const {
+    uint16_t shown = used < columns ? used : columns;
+    for (uint16_t c = 0; c < shown; c++) {
+      uint16_t from = (uint32_t)c * used / shown, to = (uint32_t)(c + 1) * used / shown;
+      lo[c] = buckets[from].min;
+      hi[c] = buckets[from].max;
+      for (uint16_t i = from + 1; i < to; i++) {
+        if (buckets[i].min < lo[c]) lo[c] = buckets[i].min;
+        if (buckets[i].max > hi[c]) hi[c] = buckets[i].max;
+      }
+    }
+    return shown;
+  }
+
+  // LTTB down to `count` points over each bucket's min and max, in order
+  uint16_t lttb(ChartPoint* out, uint16_t count) const {
+    return chartLttb(*this, (uint32_t)used * 2, out, count);
+  }
+
+  // Candidate i for lttb(): the earlier, then the later extreme of bucket i/2
+  ChartPoint operator()(uint32_t i) const {
+    const Bucket& b = buckets[i / 2];
+    bool minFirst = b.minAt <= b.maxAt;
+    if ((i & 1) == minFirst) return { b.maxAt, b.max };
+    return { b.minAt, b.min };
+  }
+
+ private:
+  struct Bucket {
+    int32_t min;
+    int32_t max;
+    uint32_t minAt;
+    uint32_t maxAt;
+  };
+
+  Bucket buckets[BUCKETS];
+  uint16_t used = 0;
+  uint32_t span = 1;   // samples per bucket
+  uint32_t fill = 0;   // samples in the newest bucket
+  uint32_t total = 0;
+
+  static void fold(Bucket& b, int32_t value, uint32_t at) {
+    if (value < b.min) {
+      b.min = value;
+      b.minAt = at;
+    }
+    if (value > b.max) {
+      b.max = value;
+      b.maxAt = at;
+    }
+  }
+
+  void halve() {
+    for (uint16_t i = 0; i < BUCKETS / 2; i++) {
+      Bucket merged = buckets[2 * i];
+      const Bucket& next = buckets[2 * i + 1];
+      fold(merged, next.min, next.minAt);
+      fold(merged, next.max, next.maxAt);
+      buckets[i] = merged;
+    }
+    used = BUCKETS / 2;
+    span *= 2;
+  }
+};
+
+typedef ChartSeriesT<CHART_SERIES_BUCKETS> ChartSeries;
+
+#endif // CHART_H
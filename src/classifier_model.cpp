@@ -0,0 +1,1070 @@
+// Generated by tools/train_classifier.py from assets/classifier/events.tsv - do not edit
+// 475 examples, int8 accuracy 100.0% on them, 16764 bytes
+
+#include "text_classifier.h"
+
+#ifndef PROGMEM
+#define PROGMEM
+#endif
+
+static const int8_t EMBED[] PROGMEM = {
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  12, 13, -15, -14, 11, -7, -1, -20, 0, 9, -7, -15, -11, 18, -3, 20,
+  -25, -24, -22, -24, -22, 31, 27, 0, 24, -23, -25, 23, 29, 1, 29, -15,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  -11, -11, 6, 5, -10, 8, 4, 12, 3, -9, 1, 12, 11, -11, 6, -14,
+  0, 0, -4, -4, 0, 1, 2, -3, 2, 0, -3, -1, 0, 3, 2, 2,
+  6, 4, 42, 42, 5, -19, -24, 29, -23, 8, 33, 0, -11, -26, -23, -14,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  -5, -5, -24, -24, -5, 13, 15, -15, 14, -6, -19, 3, 9, 13, 15, 5,
+  -20, -20, -8, -10, -18, 22, 17, 8, 15, -18, -13, 20, 22, -6, 19, -17,
+  -4, -5, 17, 17, -4, -1, -5, 17, -6, -2, 11, 7, 3, -15, -4, -13,
+  -5, -6, 28, 27, -5, -5, -10, 25, -11, -2, 19, 9, 2, -22, -9, -18,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  -2, -2, 10, 9, -2, -2, -3, 9, -4, -1, 6, 3, 1, -8, -3, -6,
+  8, 11, -73, -73, 8, 17, 30, -64, 31, 1, -51, -18, 1, 56, 27, 43,
+  0, 0, -3, -3, 0, 1, 1, -2, 1, 0, -2, -1, 0, 2, 1, 2,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  7, 8, -9, -8, 7, -4, -1, -12, 0, 5, -4, -9, -7, 11, -2, 12,
+  -14, -14, -16, -17, -13, 19, 17, -3, 16, -14, -17, 13, 17, 2, 18, -8,
+  1, 1, 4, 4, 1, -2, -3, 2, -3, 2, 3, -1, -2, -2, -3, 0,
+  -15, -15, 13, 12, -13, 9, 4, 20, 2, -12, 4, 17, 14, -18, 6, -22,
+  3, 2, 27, 27, 3, -12, -15, 19, -15, 5, 21, 0, -7, -17, -15, -9,
+  -8, -8, -15, -16, -7, 13, 13, -6, 12, -8, -14, 7, 11, 6, 13, -1,
+  -13, -12, -23, -24, -11, 20, 20, -9, 18, -13, -21, 10, 17, 8, 20, -3,
+  -17, -19, 41, 40, -16, 2, -8, 45, -11, -11, 25, 24, 13, -39, -5, -37,
+  40, 38, 37, 40, 36, -50, -45, 2, -40, 37, 41, -37, -47, -2, -48, 25,
+  -10, -12, 54, 53, -10, -9, -19, 49, -21, -4, 36, 18, 4, -43, -16, -36,
+  2, 1, 21, 21, 1, -9, -11, 16, -11, 3, 16, 1, -5, -14, -11, -8,
+  -21, -21, -2, -3, -19, 21, 15, 14, 13, -18, -9, 22, 23, -11, 18, -22,
+  15, 14, 32, 33, 13, -25, -26, 15, -24, 15, 29, -12, -20, -13, -26, 1,
+  -15, -16, 20, 19, -14, 7, 1, 26, -1, -11, 9, 19, 13, -23, 3, -25,
+  19, 20, -25, -24, 18, -10, -1, -33, 2, 14, -12, -24, -17, 29, -4, 32,
+  12, 13, -27, -26, 11, -2, 5, -30, 6, 8, -16, -17, -10, 26, 3, 26,
+  1, 1, 8, 8, 1, -4, -5, 6, -5, 2, 6, 0, -2, -5, -5, -3,
+  6, 3, 58, 58, 5, -25, -32, 42, -31, 10, 45, 2, -14, -37, -30, -21,
+  24, 25, -10, -8, 22, -20, -12, -25, -8, 20, 1, -27, -25, 21, -14, 30,
+  14, 16, -30, -29, 13, -3, 5, -34, 7, 10, -17, -19, -12, 30, 2, 30,
+  24, 25, -25, -23, 23, -15, -5, -37, -1, 19, -10, -29, -23, 32, -8, 37,
+  7, 8, -33, -32, 6, 5, 11, -31, 12, 3, -22, -12, -3, 27, 10, 23,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  -14, -13, -18, -19, -12, 19, 18, -5, 16, -13, -18, 12, 17, 4, 19, -6,
+  19, 19, 4, 5, 18, -20, -15, -11, -12, 17, 9, -20, -21, 9, -17, 19,
+  18, 18, -3, -1, 16, -16, -11, -15, -9, 15, 4, -20, -19, 13, -13, 20,
+  24, 24, 8, 10, 22, -25, -20, -11, -17, 21, 14, -25, -27, 9, -22, 22,
+  -1, 0, -4, -4, -1, 2, 2, -2, 2, -1, -3, 0, 1, 2, 2, 1,
+  21, 20, 27, 29, 19, -29, -27, 7, -25, 20, 27, -19, -26, -6, -29, 9,
+  -19, -20, 23, 22, -18, 10, 2, 32, -1, -15, 11, 24, 18, -28, 5, -32,
+  11, 14, -65, -65, 11, 12, 24, -60, 25, 5, -44, -21, -4, 52, 21, 43,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  -5, -8, 67, 67, -5, -18, -29, 57, -30, 1, 48, 14, -3, -50, -26, -37,
+  8, 8, -13, -13, 7, -3, 1, -16, 2, 5, -7, -10, -6, 14, 0, 14,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  31, 30, 0, 2, 28, -29, -21, -21, -17, 26, 10, -32, -33, 18, -24, 32,
+  12, 12, 0, 1, 11, -11, -8, -8, -6, 10, 4, -12, -12, 7, -9, 12,
+  -23, -22, -23, -25, -20, 29, 26, -2, 24, -21, -25, 21, 27, 3, 28, -13,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  -6, -6, -17, -18, -5, 12, 13, -9, 12, -7, -15, 4, 9, 8, 13, 2,
+  30, 30, -11, -9, 27, -25, -15, -29, -11, 25, 2, -33, -31, 25, -19, 37,
+  -16, -16, 2, 1, -15, 15, 10, 13, 8, -14, -4, 17, 17, -11, 12, -18,
+  5, 6, -31, -31, 5, 6, 12, -28, 12, 2, -21, -9, -1, 24, 10, 20,
+  22, 23, -17, -15, 20, -15, -7, -29, -4, 17, -5, -25, -21, 25, -9, 31,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  -5, -5, 1, 1, -4, 4, 3, 4, 2, -4, -1, 5, 5, -3, 3, -5,
+  3, 3, -5, -5, 3, -1, 0, -6, 1, 2, -3, -4, -2, 5, 0, 5,
+  7, 7, 2, 3, 6, -7, -6, -3, -5, 6, 4, -7, -8, 3, -6, 6,
+  4, 2, 40, 40, 3, -17, -22, 29, -21, 7, 31, 1, -9, -25, -21, -15,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  8, 7, 14, 14, 7, -12, -12, 5, -11, 8, 13, -7, -10, -5, -12, 2,
+  16, 16, -1, 0, 14, -14, -10, -12, -8, 13, 5, -17, -17, 10, -12, 17,
+  -3, -3, -16, -16, -3, 8, 10, -10, 9, -3, -12, 1, 5, 9, 9, 4,
+  -33, -32, -32, -34, -30, 42, 38, -2, 33, -31, -35, 31, 39, 2, 40, -20,
+  -8, -8, -15, -16, -7, 13, 13, -6, 12, -8, -14, 7, 11, 6, 13, -1,
+  2, 3, -43, -43, 2, 13, 20, -35, 20, -2, -31, -8, 4, 31, 18, 22,
+  13, 15, -45, -44, 12, 3, 13, -44, 14, 8, -28, -20, -8, 39, 10, 35,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  -16, -17, 21, 20, -15, 8, 1, 28, -1, -12, 10, 20, 15, -25, 3, -27,
+  14, 14, -2, -1, 13, -13, -8, -12, -7, 12, 3, -16, -15, 10, -10, 16,
+  26, 25, 7, 9, 23, -27, -21, -12, -17, 22, 14, -26, -28, 10, -23, 23,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  28, 30, -36, -34, 26, -15, -2, -48, 2, 21, -16, -35, -26, 42, -6, 47,
+  20, 18, 43, 44, 17, -33, -34, 20, -31, 20, 38, -15, -26, -18, -34, 0,
+  53, 53, 7, 10, 48, -52, -39, -32, -32, 46, 23, -56, -57, 27, -44, 53,
+  11, 10, 10, 11, 10, -14, -12, 1, -11, 10, 11, -10, -13, -1, -13, 7,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  -20, -20, 11, 9, -18, 15, 8, 22, 5, -16, 1, 22, 20, -19, 10, -26,
+  -3, -3, 1, 1, -2, 2, 1, 3, 1, -2, 0, 3, 3, -2, 1, -3,
+  21, 18, 74, 76, 18, -45, -50, 44, -47, 23, 62, -12, -31, -39, -49, -13,
+  2, 2, -18, -18, 2, 5, 7, -16, 8, 0, -12, -4, 0, 14, 7, 10,
+  34, 35, -41, -38, 31, -18, -3, -56, 1, 26, -18, -41, -31, 48, -8, 55,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  -10, -10, -1, -2, -9, 9, 7, 6, 6, -8, -4, 10, 10, -5, 8, -10,
+  -11, -11, 5, 4, -10, 9, 5, 12, 4, -9, 0, 13, 11, -10, 6, -14,
+  -28, -26, -37, -39, -25, 39, 37, -10, 33, -27, -37, 24, 34, 9, 38, -12,
+  16, 16, 3, 4, 14, -16, -12, -9, -10, 14, 8, -16, -17, 7, -14, 15,
+  -17, -19, 32, 31, -16, 6, -4, 38, -6, -12, 18, 23, 15, -33, -1, -34,
+  10, 8, 61, 62, 9, -30, -36, 41, -35, 13, 49, -3, -19, -36, -35, -18,
+  34, 32, 45, 48, 30, -47, -44, 12, -40, 32, 45, -30, -41, -11, -46, 14,
+  18, 19, -22, -21, 17, -10, -2, -30, 1, 14, -10, -22, -16, 26, -4, 29,
+  4, 5, -26, -25, 4, 5, 10, -23, 10, 1, -17, -8, -1, 20, 8, 16,
+  13, 11, 48, 48, 11, -28, -31, 29, -30, 15, 39, -7, -20, -25, -31, -9,
+  -19, -19, -18, -19, -17, 24, 21, 0, 19, -18, -19, 18, 23, 1, 23, -12,
+  4, 2, 44, 44, 3, -18, -23, 32, -23, 6, 33, 2, -9, -28, -22, -17,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  9, 9, -1, -1, 8, -8, -6, -7, -4, 8, 2, -10, -10, 6, -7, 10,
+  31, 33, -35, -33, 29, -18, -4, -50, 0, 24, -15, -38, -29, 43, -9, 50,
+  29, 30, -15, -13, 27, -22, -12, -33, -9, 24, -1, -33, -29, 28, -16, 38,
+  14, 15, -19, -18, 13, -7, 0, -25, 2, 11, -9, -18, -13, 22, -2, 24,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  -8, -7, -11, -12, -7, 11, 10, -4, 9, -7, -11, 6, 9, 3, 11, -3,
+  -13, -14, 16, 15, -12, 7, 1, 22, 0, -10, 7, 16, 12, -19, 3, -22,
+  -16, -16, 1, 0, -15, 15, 11, 12, 9, -14, -5, 18, 17, -10, 12, -18,
+  -36, -36, -7, -10, -33, 37, 28, 20, 23, -31, -17, 37, 39, -17, 31, -34,
+  -45, -44, -41, -45, -41, 57, 51, -1, 44, -42, -45, 42, 54, 1, 54, -29,
+  9, 9, 21, 21, 8, -16, -16, 10, -15, 10, 18, -7, -13, -9, -17, 0,
+  -14, -14, -8, -9, -13, 16, 13, 3, 11, -12, -10, 14, 16, -3, 14, -11,
+  32, 32, -4, -1, 29, -29, -20, -25, -16, 27, 8, -34, -33, 22, -23, 35,
+  19, 19, 2, 3, 17, -19, -14, -12, -11, 17, 8, -20, -21, 10, -16, 20,
+  29, 29, -1, 1, 27, -27, -19, -22, -15, 25, 9, -31, -31, 18, -22, 32,
+  -1, -2, 40, 40, -1, -13, -19, 33, -19, 2, 29, 6, -4, -29, -17, -20,
+  -26, -26, -9, -10, -23, 27, 22, 11, 18, -23, -15, 26, 29, -10, 24, -23,
+  25, 26, -40, -38, 23, -10, 2, -49, 5, 18, -21, -32, -21, 42, -2, 45,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  9, 9, -16, -16, 8, -3, 2, -19, 3, 6, -9, -11, -7, 17, 1, 17,
+  16, 16, -9, -8, 14, -12, -6, -18, -4, 13, -1, -18, -16, 15, -8, 21,
+  9, 9, -1, 0, 9, -8, -6, -8, -5, 8, 2, -10, -10, 6, -7, 10,
+  -7, -8, 36, 35, -7, -6, -13, 33, -13, -3, 24, 12, 3, -29, -11, -24,
+  8, 8, -13, -13, 7, -3, 1, -16, 2, 5, -7, -10, -6, 14, 0, 14,
+  0, -1, 26, 26, 0, -9, -13, 20, -13, 2, 19, 3, -3, -18, -12, -12,
+  -3, -2, -5, -6, -2, 4, 4, -2, 4, -3, -5, 2, 3, 2, 4, 0,
+  -21, -21, 1, -1, -19, 19, 14, 16, 11, -18, -6, 22, 22, -13, 16, -23,
+  -1, -1, 3, 3, -1, 0, -1, 3, -1, -1, 2, 1, 1, -3, -1, -2,
+  -12, -14, 39, 38, -12, -1, -10, 40, -12, -8, 24, 19, 8, -34, -8, -32,
+  13, 11, 39, 39, 11, -25, -27, 21, -26, 15, 33, -9, -19, -19, -28, -4,
+  -33, -37, 98, 96, -31, -2, -25, 101, -30, -20, 61, 48, 23, -88, -19, -81,
+  -9, -11, 44, 43, -8, -7, -15, 41, -16, -4, 29, 15, 4, -36, -13, -30,
+  11, 12, -17, -17, 10, -5, 1, -22, 2, 8, -9, -14, -10, 19, -1, 20,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  67, 68, -15, -10, 61, -58, -38, -59, -30, 56, 12, -73, -70, 50, -46, 78,
+  48, 50, -34, -31, 44, -34, -16, -61, -10, 39, -9, -56, -47, 53, -22, 67,
+  9, 10, -44, -44, 8, 7, 15, -41, 17, 4, -30, -15, -4, 36, 13, 30,
+  10, 10, -16, -16, 9, -3, 1, -20, 3, 7, -9, -12, -8, 17, 0, 18,
+  -2, -3, 35, 35, -2, -10, -16, 29, -16, 1, 25, 7, -3, -25, -14, -19,
+  35, 38, -55, -52, 33, -15, 2, -68, 7, 26, -28, -45, -31, 59, -3, 63,
+  32, 32, -4, -2, 29, -29, -20, -25, -16, 27, 8, -34, -33, 22, -23, 35,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  -5, -5, -18, -18, -5, 11, 12, -10, 12, -6, -15, 3, 8, 9, 12, 3,
+  28, 28, 7, 9, 26, -29, -22, -15, -19, 25, 14, -29, -31, 12, -25, 27,
+  12, 13, -14, -13, 12, -7, -2, -20, 0, 10, -6, -15, -12, 17, -4, 20,
+  12, 12, -14, -13, 11, -6, -1, -20, 0, 9, -6, -14, -11, 17, -3, 19,
+  -41, -41, -18, -21, -37, 45, 37, 15, 31, -37, -27, 41, 47, -12, 40, -35,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  -14, -14, 2, 1, -13, 12, 8, 12, 6, -12, -3, 15, 15, -10, 10, -16,
+  19, 20, -33, -32, 18, -7, 3, -40, 5, 14, -18, -25, -16, 34, 0, 36,
+  -8, -10, 42, 42, -8, -6, -15, 40, -16, -4, 28, 15, 4, -34, -13, -29,
+  4, 3, 41, 41, 3, -18, -22, 29, -22, 7, 31, 1, -10, -26, -21, -15,
+  17, 16, 5, 7, 15, -18, -14, -7, -12, 15, 10, -17, -18, 6, -15, 15,
+  -6, -5, -18, -18, -5, 11, 12, -10, 12, -6, -15, 4, 8, 9, 13, 2,
+  2, 3, -20, -20, 2, 5, 8, -17, 9, 0, -14, -5, 1, 15, 8, 12,
+  26, 24, 48, 50, 23, -41, -41, 20, -37, 26, 44, -21, -33, -18, -42, 4,
+  26, 26, 3, 5, 23, -25, -19, -16, -15, 22, 11, -27, -28, 13, -21, 26,
+  14, 14, -16, -15, 12, -7, -1, -22, 1, 10, -7, -17, -12, 19, -3, 22,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  6, 7, -4, -4, 6, -5, -2, -8, -1, 5, -1, -7, -6, 7, -3, 9,
+  32, 34, -59, -57, 30, -10, 7, -70, 11, 23, -33, -42, -27, 60, 2, 62,
+  4, 4, 0, 0, 4, -4, -2, -3, -2, 3, 1, -4, -4, 3, -3, 4,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  27, 28, -19, -17, 25, -19, -9, -34, -5, 22, -5, -31, -26, 30, -12, 38,
+  -26, -26, -9, -10, -23, 27, 22, 11, 18, -23, -15, 26, 29, -10, 24, -23,
+  22, 23, -16, -15, 20, -15, -7, -28, -4, 18, -5, -26, -21, 25, -10, 31,
+  16, 18, -32, -31, 15, -5, 4, -37, 6, 12, -18, -22, -14, 32, 1, 32,
+  3, 4, -38, -37, 3, 10, 16, -32, 16, 0, -27, -8, 2, 28, 15, 21,
+  -16, -14, -50, -52, -14, 32, 35, -29, 33, -18, -42, 10, 23, 25, 35, 7,
+  26, 26, -2, 0, 24, -24, -17, -20, -13, 22, 7, -28, -27, 17, -19, 28,
+  37, 38, -33, -30, 34, -23, -9, -52, -4, 29, -12, -43, -35, 44, -14, 54,
+  4, 4, -3, -2, 4, -3, -2, -5, -1, 3, 0, -5, -4, 4, -2, 6,
+  38, 39, -33, -31, 35, -24, -10, -53, -5, 30, -12, -45, -36, 46, -14, 55,
+  3, 3, 4, 4, 3, -4, -4, 0, -4, 3, 4, -3, -4, 0, -4, 2,
+  -19, -20, 11, 10, -17, 14, 7, 22, 5, -15, 2, 22, 19, -19, 10, -25,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  8, 10, -42, -42, 8, 6, 15, -39, 16, 4, -28, -15, -4, 34, 12, 29,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  -5, -4, -10, -10, -4, 8, 8, -5, 7, -5, -9, 3, 6, 4, 8, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  24, 21, 63, 64, 21, -44, -46, 33, -43, 25, 54, -17, -33, -29, -47, -4,
+  -19, -20, 27, 26, -18, 9, 0, 35, -3, -14, 14, 24, 17, -31, 3, -33,
+  11, 12, -37, -36, 10, 2, 10, -36, 12, 6, -23, -16, -7, 31, 8, 28,
+  -39, -38, -23, -25, -35, 44, 37, 10, 32, -35, -29, 38, 44, -8, 40, -31,
+  -20, -18, -30, -31, -17, 29, 28, -10, 25, -19, -29, 17, 25, 9, 29, -7,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  -19, -19, -18, -19, -17, 24, 21, 0, 19, -18, -19, 18, 23, 1, 23, -12,
+  -2, -4, 29, 29, -2, -8, -12, 25, -13, 0, 21, 6, -1, -22, -11, -16,
+  2, 1, 16, 16, 2, -7, -9, 11, -9, 3, 12, 0, -4, -10, -9, -5,
+  14, 14, -2, -1, 13, -13, -9, -12, -7, 12, 3, -16, -15, 10, -10, 16,
+  1, 1, 7, 7, 1, -4, -4, 5, -4, 2, 6, 0, -2, -4, -4, -2,
+  -20, -18, -30, -31, -17, 29, 28, -10, 25, -19, -29, 17, 25, 9, 29, -7,
+  -42, -44, 47, 44, -39, 24, 6, 67, 1, -33, 20, 51, 39, -58, 12, -67,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  9, 7, 42, 43, 7, -22, -26, 27, -25, 11, 34, -3, -14, -24, -26, -11,
+  -4, -3, -10, -11, -3, 7, 7, -6, 7, -4, -9, 2, 5, 5, 7, 1,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  -4, -5, 10, 9, -4, 1, -2, 11, -2, -3, 6, 6, 3, -9, -1, -9,
+  -1, -1, -14, -14, -1, 6, 7, -10, 7, -2, -11, -1, 3, 9, 7, 5,
+  17, 19, -45, -44, 16, -1, 10, -48, 12, 11, -27, -24, -13, 41, 7, 39,
+  -39, -39, -8, -11, -35, 40, 30, 21, 25, -34, -19, 40, 43, -18, 34, -37,
+  47, 49, -53, -50, 44, -27, -7, -75, 0, 36, -23, -57, -44, 65, -13, 75,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  -15, -15, -15, -16, -14, 20, 18, -1, 16, -14, -16, 14, 18, 1, 19, -9,
+  -8, -8, 11, 10, -7, 4, 0, 14, -1, -6, 5, 10, 7, -12, 1, -13,
+  2, 1, 21, 21, 2, -9, -12, 15, -11, 4, 16, 0, -5, -13, -11, -8,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  -4, -6, 35, 34, -4, -8, -14, 30, -14, -1, 24, 9, 0, -27, -12, -21,
+  6, 5, 19, 19, 5, -12, -13, 11, -12, 7, 16, -4, -9, -10, -13, -3,
+  -8, -9, 28, 27, -8, -1, -8, 28, -9, -5, 17, 13, 5, -24, -6, -22,
+  0, -2, 31, 31, -1, -10, -15, 25, -15, 2, 23, 5, -3, -22, -14, -15,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  -9, -8, -27, -28, -8, 17, 19, -15, 18, -9, -23, 6, 13, 13, 19, 4,
+  -14, -15, 12, 11, -13, 9, 4, 20, 2, -11, 4, 17, 14, -17, 6, -21,
+  36, 38, -44, -41, 33, -19, -3, -60, 1, 27, -20, -44, -33, 52, -8, 58,
+  3, 3, -4, -4, 3, -1, 0, -6, 0, 2, -2, -4, -3, 5, 0, 5,
+  6, 7, -13, -13, 6, -1, 2, -15, 3, 4, -8, -8, -5, 13, 1, 13,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  -9, -7, -46, -46, -7, 24, 28, -30, 27, -11, -36, 3, 15, 26, 27, 12,
+  -16, -16, 7, 6, -14, 12, 7, 16, 5, -13, 0, 17, 16, -14, 9, -20,
+  -7, -7, -5, -5, -6, 8, 7, 1, 6, -6, -6, 7, 8, -1, 7, -5,
+  -22, -22, -7, -9, -20, 23, 18, 10, 16, -19, -13, 22, 24, -8, 20, -20,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  9, 9, -16, -16, 8, -3, 2, -19, 3, 6, -9, -11, -7, 17, 1, 17,
+  -10, -10, 2, 1, -9, 8, 6, 8, 4, -8, -2, 10, 10, -7, 7, -11,
+  4, 3, 26, 26, 3, -12, -15, 18, -15, 5, 20, -1, -7, -15, -15, -8,
+  -19, -20, 27, 26, -18, 9, 0, 35, -3, -14, 14, 24, 17, -31, 3, -33,
+  1, -1, 34, 34, 0, -12, -17, 27, -17, 3, 25, 4, -5, -24, -16, -16,
+  16, 16, -9, -8, 14, -12, -6, -18, -4, 13, -1, -18, -16, 15, -8, 21,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  22, 20, 43, 44, 19, -35, -35, 18, -32, 22, 39, -17, -29, -16, -36, 3,
+  -15, -13, -56, -57, -13, 33, 37, -34, 35, -17, -46, 8, 23, 30, 36, 11,
+  -14, -17, 55, 54, -14, -5, -16, 54, -18, -8, 35, 23, 9, -47, -13, -41,
+  -36, -34, -48, -51, -32, 51, 48, -12, 43, -35, -47, 32, 45, 12, 50, -16,
+  -11, -10, -14, -15, -10, 15, 14, -4, 13, -10, -14, 10, 13, 3, 15, -5,
+  36, 34, 55, 58, 32, -53, -51, 18, -46, 35, 53, -31, -46, -16, -53, 12,
+  3, 2, 13, 13, 2, -7, -8, 8, -8, 3, 10, -1, -5, -7, -8, -3,
+  15, 16, -22, -21, 14, -7, 1, -28, 3, 11, -11, -19, -13, 25, -2, 26,
+  7, 5, 37, 38, 6, -19, -22, 25, -22, 9, 30, -2, -12, -22, -22, -11,
+  15, 15, -5, -4, 13, -12, -8, -14, -6, 12, 2, -16, -15, 12, -9, 18,
+  -35, -33, -61, -64, -31, 54, 53, -24, 49, -34, -57, 29, 45, 21, 55, -8,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  2, 2, 0, 0, 2, -2, -1, -2, -1, 2, 0, -2, -2, 2, -1, 2,
+  -29, -26, -70, -72, -25, 51, 53, -35, 49, -30, -61, 21, 39, 31, 54, 3,
+  -8, -8, -15, -16, -7, 13, 13, -6, 12, -8, -14, 7, 11, 6, 13, -1,
+  36, 38, -40, -37, 33, -21, -5, -57, -1, 28, -17, -44, -33, 49, -10, 57,
+  -47, -48, 12, 9, -43, 40, 26, 43, 20, -39, -7, 52, 49, -37, 31, -56,
+  10, 9, 31, 32, 9, -20, -22, 17, -20, 11, 26, -7, -15, -15, -22, -4,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  -45, -44, -37, -41, -41, 55, 49, 3, 43, -41, -43, 43, 53, -1, 52, -30,
+  -37, -38, 21, 19, -34, 27, 14, 43, 10, -29, 3, 42, 36, -37, 19, -49,
+  14, 14, -16, -15, 12, -7, -1, -22, 1, 10, -7, -17, -12, 19, -3, 22,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  11, 9, 38, 39, 9, -23, -26, 23, -24, 12, 32, -6, -16, -20, -25, -7,
+  6, 6, -10, -10, 6, -2, 1, -12, 2, 4, -5, -8, -5, 11, 0, 11,
+  20, 19, 13, 14, 18, -23, -20, -4, -17, 18, 16, -19, -23, 3, -21, 15,
+  -1, 1, -59, -60, 0, 21, 30, -46, 29, -6, -44, -7, 9, 40, 28, 27,
+  -28, -27, -20, -22, -25, 33, 28, 4, 25, -25, -24, 27, 32, -3, 31, -20,
+  8, 8, 4, 4, 7, -9, -7, -3, -6, 7, 5, -8, -9, 2, -8, 7,
+  -8, -8, -15, -16, -7, 13, 13, -6, 12, -8, -14, 7, 11, 6, 13, -1,
+  -9, -9, -15, -16, -8, 14, 13, -6, 12, -9, -14, 8, 12, 5, 14, -2,
+  0, -2, 54, 54, -1, -18, -26, 43, -26, 4, 40, 8, -7, -38, -24, -26,
+  15, 13, 47, 48, 13, -29, -32, 27, -30, 16, 39, -9, -21, -24, -32, -7,
+  1, 1, 3, 3, 1, -2, -2, 2, -2, 1, 2, -1, -1, -2, -2, 0,
+  -4, -4, 0, 0, -3, 3, 2, 3, 2, -3, -1, 4, 4, -2, 3, -4,
+  10, 10, 1, 2, 9, -9, -7, -6, -6, 8, 4, -10, -10, 5, -8, 10,
+  -5, -7, 48, 48, -5, -12, -20, 41, -20, -1, 34, 12, -1, -36, -18, -28,
+  19, 17, 22, 23, 16, -25, -23, 4, -21, 17, 22, -17, -22, -4, -24, 9,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  -20, -18, -30, -31, -17, 29, 28, -10, 25, -19, -29, 17, 25, 9, 29, -7,
+  -15, -16, 22, 21, -14, 6, -1, 28, -3, -11, 12, 19, 13, -24, 2, -26,
+  -14, -15, 19, 18, -13, 6, 0, 25, -2, -10, 10, 17, 12, -22, 2, -24,
+  -59, -57, -44, -49, -53, 70, 61, 6, 53, -53, -52, 56, 68, -4, 65, -41,
+  11, 9, 31, 32, 9, -20, -22, 17, -21, 11, 26, -7, -15, -15, -22, -4,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  -7, -7, -3, -4, -7, 8, 7, 3, 6, -7, -5, 7, 8, -2, 7, -6,
+  31, 30, 25, 27, 28, -38, -33, -2, -29, 28, 29, -30, -36, 1, -35, 21,
+  -14, -13, -12, -13, -12, 17, 15, 0, 13, -13, -14, 13, 16, 0, 16, -9,
+  -5, -7, 54, 53, -5, -14, -23, 46, -23, 0, 38, 12, -2, -40, -20, -30,
+  -5, -4, -20, -21, -4, 11, 13, -13, 12, -5, -16, 2, 7, 11, 13, 5,
+  -40, -42, 34, 31, -37, 26, 11, 55, 5, -31, 11, 47, 39, -48, 16, -58,
+  5, 6, -3, -2, 5, -4, -2, -6, -2, 4, 0, -6, -5, 5, -3, 7,
+  9, 10, -4, -4, 9, -7, -4, -10, -3, 8, 0, -11, -9, 9, -5, 12,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  18, 16, 41, 43, 15, -31, -32, 21, -30, 18, 36, -13, -24, -18, -32, -1,
+  -3, -1, -38, -38, -2, 15, 20, -28, 19, -5, -29, -3, 7, 25, 19, 15,
+  1, 0, 27, 27, 0, -10, -14, 21, -13, 3, 20, 3, -4, -18, -13, -12,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  3, 3, -16, -15, 3, 3, 6, -14, 6, 1, -10, -5, -1, 12, 5, 10,
+  3, 4, -15, -15, 3, 2, 5, -14, 5, 2, -10, -6, -2, 12, 4, 11,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  -46, -44, -47, -50, -41, 59, 53, -5, 47, -42, -50, 42, 54, 5, 56, -26,
+  76, 79, -84, -79, 70, -43, -11, -120, -1, 58, -36, -92, -71, 104, -21, 121,
+  -60, -59, -25, -29, -54, 65, 52, 23, 44, -53, -38, 61, 68, -19, 58, -52,
+  -4, -3, -25, -25, -4, 13, 15, -17, 14, -6, -20, 1, 8, 15, 15, 7,
+  2, 1, 21, 21, 2, -9, -12, 15, -11, 4, 16, 0, -5, -13, -11, -8,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  -12, -12, 13, 12, -11, 7, 2, 18, 0, -9, 6, 14, 11, -16, 3, -19,
+  6, 5, 31, 31, 5, -16, -19, 20, -18, 8, 25, -2, -10, -18, -19, -8,
+  2, -1, 61, 62, 1, -22, -30, 48, -30, 6, 46, 7, -9, -42, -29, -27,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  22, 21, 24, 25, 20, -29, -26, 3, -23, 21, 25, -20, -26, -3, -28, 12,
+  -26, -26, 14, 12, -24, 20, 11, 29, 7, -21, 1, 29, 26, -25, 14, -34,
+  -26, -24, -59, -61, -23, 45, 46, -28, 43, -27, -52, 20, 35, 25, 47, 0,
+  13, 11, 31, 32, 11, -22, -23, 16, -22, 13, 27, -9, -17, -14, -24, -1,
+  -45, -42, -66, -69, -40, 65, 62, -20, 56, -43, -63, 39, 56, 19, 65, -17,
+  -13, -12, -31, -32, -12, 23, 24, -15, 22, -14, -27, 10, 18, 13, 24, 0,
+  -10, -10, -8, -9, -9, 12, 11, 1, 9, -10, -9, 10, 12, -1, 12, -7,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  -24, -24, 8, 6, -22, 20, 12, 23, 9, -20, -2, 26, 24, -20, 15, -29,
+  -23, -23, -7, -8, -21, 24, 19, 11, 16, -20, -13, 24, 26, -9, 21, -21,
+  5, 7, -55, -54, 5, 14, 23, -47, 24, 0, -38, -13, 2, 41, 21, 31,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 2, 2, 0, -1, -1, 1, -1, 0, 1, 0, 0, -1, -1, 0,
+  0, 0, -2, -2, 0, 1, 1, -1, 1, -1, -2, 0, 1, 1, 1, 0,
+  19, 19, -2, -1, 17, -17, -12, -15, -9, 16, 5, -20, -20, 13, -14, 21,
+  9, 8, 40, 41, 8, -22, -26, 25, -24, 11, 33, -4, -15, -23, -25, -9,
+  26, 27, -5, -3, 24, -23, -15, -23, -12, 22, 5, -29, -27, 20, -18, 30,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  61, 57, 85, 89, 54, -86, -82, 25, -74, 58, 83, -53, -75, -23, -85, 24,
+  0, -1, 15, 15, -1, -5, -7, 12, -7, 1, 11, 3, -1, -11, -6, -8,
+  -5, -5, 9, 9, -5, 1, -1, 11, -2, -3, 5, 6, 4, -9, 0, -10,
+  -35, -33, -42, -45, -31, 47, 44, -9, 39, -33, -43, 31, 42, 9, 46, -17,
+  24, 23, 16, 18, 21, -28, -24, -4, -21, 21, 20, -23, -27, 3, -26, 17,
+  21, 21, -1, 1, 19, -20, -14, -15, -11, 18, 7, -23, -23, 13, -16, 23,
+  1, 0, 14, 14, 0, -5, -7, 10, -7, 2, 10, 1, -2, -9, -7, -6,
+  12, 11, 9, 10, 11, -14, -12, -1, -11, 11, 10, -11, -14, 1, -13, 8,
+  19, 20, -10, -9, 18, -15, -8, -21, -6, 16, -1, -22, -19, 18, -10, 25,
+  0, 0, 2, 2, 0, -1, -1, 1, -1, 0, 1, 0, 0, -1, -1, -1,
+  10, 8, 48, 49, 8, -25, -29, 31, -28, 12, 38, -4, -16, -27, -29, -12,
+  -34, -33, -24, -27, -31, 41, 35, 5, 30, -31, -29, 33, 40, -4, 38, -25,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  6, 5, 28, 29, 5, -15, -18, 18, -17, 7, 23, -3, -10, -16, -17, -7,
+  -26, -25, -16, -18, -23, 30, 25, 6, 22, -23, -20, 25, 29, -4, 27, -20,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  4, 2, 43, 43, 3, -18, -23, 31, -23, 7, 33, 2, -9, -28, -22, -16,
+  10, 12, -47, -47, 9, 7, 16, -44, 17, 5, -32, -17, -4, 39, 14, 33,
+  -9, -7, -41, -41, -8, 22, 26, -26, 24, -11, -33, 4, 15, 23, 25, 10,
+  12, 14, -51, -50, 12, 5, 16, -49, 18, 7, -33, -20, -7, 43, 13, 37,
+  14, 15, -19, -18, 13, -7, 0, -25, 2, 11, -9, -18, -13, 22, -2, 24,
+  18, 18, -4, -2, 16, -15, -10, -15, -8, 15, 3, -19, -18, 13, -12, 20,
+  9, 9, -16, -16, 8, -3, 2, -19, 3, 6, -9, -11, -7, 17, 1, 17,
+  -17, -16, -16, -17, -15, 21, 19, -1, 17, -15, -17, 15, 20, 1, 20, -10,
+  9, 9, 5, 5, 8, -10, -8, -3, -7, 8, 6, -9, -10, 2, -9, 7,
+  0, 0, -8, -8, 0, 3, 4, -6, 4, -1, -6, -1, 1, 5, 4, 3,
+  1, 0, 20, 20, 1, -8, -10, 15, -10, 2, 15, 2, -4, -13, -10, -8,
+  14, 16, -38, -37, 13, -1, 8, -40, 10, 9, -23, -20, -10, 35, 6, 33,
+  -27, -29, 39, 37, -25, 12, -1, 50, -4, -20, 20, 34, 24, -43, 3, -47,
+  11, 12, -37, -36, 10, 2, 10, -37, 12, 6, -23, -16, -7, 32, 8, 29,
+  -28, -26, -31, -34, -25, 37, 34, -5, 30, -26, -32, 25, 34, 5, 36, -14,
+  -5, -7, 54, 53, -5, -14, -23, 46, -23, 0, 38, 12, -2, -40, -20, -30,
+  -11, -8, -62, -63, -9, 31, 37, -42, 36, -14, -49, 3, 19, 37, 36, 18,
+  -21, -21, -17, -19, -19, 26, 23, 2, 20, -20, -20, 20, 25, -1, 24, -15,
+  -8, -8, -15, -16, -7, 13, 13, -6, 12, -8, -14, 7, 11, 6, 13, -1,
+  21, 23, -36, -34, 20, -8, 3, -44, 6, 16, -19, -28, -18, 38, -1, 40,
+  11, 12, -27, -26, 10, -1, 6, -29, 7, 7, -16, -15, -8, 25, 4, 24,
+  41, 39, 44, 47, 37, -54, -49, 6, -43, 39, 46, -38, -50, -6, -52, 23,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  -27, -26, -17, -19, -24, 31, 26, 5, 23, -24, -21, 26, 30, -4, 28, -20,
+  19, 20, -16, -15, 17, -12, -5, -26, -2, 15, -6, -22, -18, 23, -7, 28,
+  -25, -24, -25, -27, -22, 32, 29, -2, 26, -23, -27, 23, 30, 3, 31, -15,
+  -25, -25, 16, 15, -23, 18, 9, 30, 5, -20, 4, 28, 24, -26, 12, -34,
+  1, 0, 7, 7, 1, -3, -4, 5, -4, 1, 5, 0, -2, -4, -4, -3,
+  6, 4, 47, 48, 4, -21, -26, 33, -26, 8, 37, 1, -12, -29, -25, -16,
+  11, 11, -19, -18, 10, -4, 2, -22, 3, 8, -10, -14, -9, 19, 0, 20,
+  -14, -13, -20, -21, -12, 20, 19, -6, 17, -13, -19, 12, 17, 5, 19, -5,
+  -20, -18, -30, -31, -17, 29, 28, -10, 25, -19, -29, 17, 25, 9, 29, -7,
+  5, 4, 16, 17, 4, -10, -11, 9, -11, 5, 14, -3, -7, -8, -11, -3,
+  -49, -48, -24, -28, -44, 54, 45, 15, 38, -43, -34, 48, 55, -12, 49, -40,
+  17, 18, -32, -31, 16, -5, 4, -38, 6, 12, -18, -23, -14, 33, 1, 33,
+  14, 14, 11, 12, 13, -17, -15, -1, -13, 13, 13, -14, -17, 1, -16, 10,
+  -15, -15, -13, -14, -14, 19, 17, 0, 15, -14, -15, 14, 18, 0, 18, -10,
+  2, 2, 4, 4, 2, -3, -3, 1, -3, 2, 4, -2, -3, -1, -3, 1,
+  53, 54, -33, -30, 48, -38, -20, -64, -13, 42, -7, -61, -52, 55, -26, 72,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  -23, -22, -23, -25, -20, 29, 26, -2, 24, -21, -25, 21, 27, 3, 28, -13,
+  32, 34, -34, -32, 30, -19, -5, -50, -1, 25, -14, -39, -30, 43, -10, 51,
+  -2, -2, 4, 4, -2, 1, 0, 4, -1, -2, 2, 3, 2, -4, 0, -4,
+  -2, -2, -2, -2, -2, 3, 2, 0, 2, -2, -2, 2, 2, 0, 2, -1,
+  11, 12, -22, -21, 10, -3, 3, -25, 5, 8, -12, -15, -9, 22, 1, 22,
+  -1, -2, 40, 40, -1, -13, -19, 33, -19, 2, 29, 6, -4, -29, -17, -20,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  14, 15, -19, -18, 13, -7, 0, -25, 2, 11, -9, -18, -13, 22, -2, 24,
+  -8, -10, 46, 46, -8, -8, -16, 43, -18, -4, 31, 15, 3, -37, -14, -31,
+  9, 11, -55, -55, 9, 10, 20, -50, 22, 4, -37, -17, -3, 44, 18, 36,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  -57, -58, 39, 35, -52, 40, 19, 71, 12, -45, 10, 66, 56, -61, 26, -79,
+  4, 3, 37, 38, 3, -16, -21, 27, -20, 6, 29, 1, -9, -23, -20, -13,
+  -25, -27, 43, 42, -23, 9, -4, 52, -7, -18, 24, 33, 21, -45, 0, -47,
+  5, 6, -30, -29, 5, 6, 11, -27, 12, 2, -20, -9, -1, 23, 10, 19,
+  -13, -13, -8, -9, -12, 15, 12, 3, 11, -12, -10, 13, 15, -2, 13, -10,
+  7, 7, 4, 4, 7, -8, -7, -2, -6, 7, 5, -7, -8, 2, -7, 6,
+  -8, -10, 42, 42, -8, -6, -15, 40, -16, -4, 28, 15, 4, -34, -13, -29,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  -67, -63, -68, -73, -60, 86, 78, -7, 69, -62, -73, 61, 79, 8, 82, -38,
+  3, 3, -2, -2, 3, -2, -1, -4, -1, 2, -1, -3, -3, 3, -1, 4,
+  10, 10, 3, 4, 9, -11, -9, -5, -7, 9, 6, -11, -11, 4, -10, 9,
+  -2, -3, 33, 32, -2, -9, -14, 27, -15, 1, 23, 7, -2, -24, -13, -18,
+  -54, -51, -50, -54, -48, 67, 60, -2, 53, -49, -54, 50, 63, 3, 64, -33,
+  6, 7, -18, -17, 6, 0, 5, -18, 5, 4, -11, -9, -4, 16, 3, 14,
+  -25, -25, -17, -19, -23, 30, 25, 4, 22, -23, -21, 24, 29, -3, 27, -18,
+  14, 13, 21, 22, 12, -20, -19, 7, -18, 14, 20, -12, -18, -6, -20, 5,
+  -21, -22, 32, 31, -19, 9, -1, 40, -4, -15, 17, 27, 18, -35, 2, -37,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  -1, -1, -14, -14, -1, 6, 7, -10, 7, -2, -11, -1, 3, 9, 7, 5,
+  -22, -19, -57, -58, -19, 40, 42, -30, 39, -23, -49, 15, 30, 27, 42, 4,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  15, 15, -9, -8, 14, -11, -5, -18, -3, 12, -2, -17, -15, 15, -7, 20,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  3, 2, 26, 26, 3, -12, -14, 18, -14, 5, 20, 0, -7, -16, -14, -9,
+  4, 5, -14, -14, 4, 1, 4, -14, 5, 2, -9, -6, -3, 13, 3, 11,
+  -15, -13, -35, -36, -13, 26, 27, -17, 25, -15, -31, 11, 20, 15, 27, 1,
+  4, 1, 72, 72, 3, -28, -38, 55, -37, 9, 55, 6, -13, -48, -35, -30,
+  -1, -2, 35, 35, -1, -11, -16, 28, -16, 2, 25, 6, -4, -25, -15, -17,
+  0, -1, 2, 2, 0, 0, -1, 2, -1, 0, 1, 1, 0, -2, -1, -1,
+  29, 30, -28, -26, 26, -18, -6, -42, -2, 22, -10, -34, -27, 36, -10, 43,
+  108, 104, 41, 49, 97, -115, -92, -42, -78, 94, 67, -109, -119, 35, -101, 96,
+  9, 7, 42, 43, 7, -22, -26, 27, -25, 11, 34, -3, -14, -24, -26, -11,
+  24, 22, 27, 29, 21, -31, -29, 5, -26, 22, 28, -21, -28, -5, -30, 12,
+  10, 11, -10, -9, 10, -6, -2, -15, -1, 8, -4, -12, -10, 13, -4, 16,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  -23, -22, -21, -23, -20, 29, 26, -1, 23, -21, -23, 21, 27, 1, 27, -14,
+  -9, -10, 21, 20, -9, 2, -4, 23, -5, -6, 12, 13, 7, -20, -2, -20,
+  -34, -34, 8, 6, -31, 29, 19, 30, 14, -28, -5, 37, 35, -26, 22, -39,
+  10, 10, -4, -3, 9, -8, -5, -10, -4, 8, 0, -11, -10, 9, -6, 13,
+  8, 7, 35, 36, 7, -20, -22, 22, -21, 10, 28, -4, -13, -19, -22, -8,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  12, 12, 0, 1, 11, -11, -8, -9, -6, 10, 4, -13, -13, 8, -9, 13,
+  24, 27, -72, -71, 23, 1, 18, -74, 21, 15, -44, -35, -17, 64, 13, 59,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  -1, 1, -32, -32, 0, 11, 16, -25, 16, -3, -23, -4, 5, 22, 15, 14,
+  1, 2, -10, -10, 1, 2, 4, -8, 4, 0, -7, -3, 0, 7, 3, 6,
+  10, 10, 5, 5, 9, -11, -9, -3, -8, 9, 7, -10, -11, 3, -10, 8,
+  -11, -10, -19, -20, -10, 17, 17, -7, 15, -11, -18, 9, 14, 7, 17, -3,
+  -30, -30, 2, 0, -27, 27, 19, 23, 15, -25, -8, 32, 32, -20, 22, -33,
+  11, 12, -8, -7, 11, -8, -4, -14, -2, 9, -2, -13, -11, 12, -5, 16,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1, -1, 56, 56, 0, -20, -28, 44, -28, 6, 42, 6, -8, -38, -26, -25,
+  -13, -14, 14, 14, -12, 8, 2, 21, 0, -10, 6, 16, 12, -18, 4, -21,
+  -7, -5, -43, -43, -6, 21, 25, -29, 24, -9, -34, 1, 12, 26, 24, 13,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, -1, 8, 8, 0, -2, -4, 7, -4, 0, 6, 1, -1, -6, -3, -4,
+  1, 1, -15, -14, 1, 4, 6, -12, 6, -1, -10, -3, 1, 10, 6, 8,
+  -13, -13, -11, -12, -12, 16, 14, 0, 13, -12, -13, 12, 15, 0, 15, -8,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  33, 31, 50, 53, 29, -48, -46, 17, -42, 32, 48, -28, -41, -15, -48, 11,
+  -9, -10, 23, 22, -9, 1, -5, 25, -6, -6, 14, 13, 7, -22, -3, -21,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  -38, -37, -9, -11, -34, 38, 29, 20, 25, -33, -19, 39, 41, -16, 33, -36,
+  32, 33, -19, -17, 30, -24, -12, -38, -8, 26, -3, -37, -32, 33, -16, 43,
+  4, 3, 32, 32, 3, -15, -18, 22, -18, 6, 25, 0, -9, -20, -18, -11,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  -16, -18, 35, 34, -15, 3, -6, 39, -8, -11, 21, 22, 13, -34, -3, -33,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  11, 12, -18, -17, 11, -5, 1, -22, 3, 8, -9, -15, -10, 19, -1, 21,
+  11, 9, 54, 55, 9, -29, -34, 35, -32, 14, 44, -4, -19, -31, -33, -14,
+  0, -1, 5, 5, 0, -1, -2, 4, -2, 0, 3, 1, 0, -4, -2, -3,
+  -8, -8, -5, -6, -7, 10, 8, 2, 7, -7, -7, 8, 10, -1, 9, -6,
+  -8, -9, 26, 26, -7, -2, -7, 26, -8, -5, 17, 12, 5, -23, -6, -21,
+  14, 13, 29, 30, 12, -23, -23, 13, -21, 14, 26, -11, -18, -12, -24, 1,
+  -4, -4, -6, -7, -4, 6, 6, -2, 5, -4, -6, 3, 5, 2, 6, -1,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  21, 22, -3, -1, 20, -19, -13, -17, -10, 18, 5, -23, -22, 15, -15, 24,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  -4, -4, 14, 13, -3, -1, -4, 13, -5, -2, 9, 6, 2, -12, -3, -10,
+  -2, 0, -34, -34, -1, 13, 17, -26, 17, -4, -26, -3, 6, 23, 17, 15,
+  8, 9, -25, -24, 7, 1, 7, -25, 8, 5, -15, -12, -5, 22, 5, 20,
+  -33, -31, -39, -41, -29, 44, 41, -8, 36, -31, -39, 30, 40, 7, 43, -16,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  11, 11, -1, 0, 10, -10, -7, -8, -5, 9, 3, -11, -11, 7, -8, 12,
+  2, 1, 7, 7, 1, -4, -4, 4, -4, 2, 5, -1, -3, -4, -4, -1,
+  8, 8, 4, 5, 7, -9, -7, -2, -6, 7, 6, -8, -9, 2, -8, 6,
+  -22, -23, 23, 21, -21, 13, 4, 34, 1, -17, 9, 27, 21, -29, 7, -35,
+  10, 11, -23, -22, 9, -2, 4, -25, 5, 7, -13, -13, -8, 22, 2, 21,
+  -4, -5, 31, 30, -4, -7, -12, 27, -13, -1, 21, 8, 0, -24, -11, -18,
+  0, -1, 9, 9, 0, -3, -4, 7, -4, 0, 6, 1, -1, -6, -4, -4,
+  13, 13, -10, -9, 12, -9, -4, -17, -2, 10, -3, -15, -13, 15, -6, 19,
+  -1, -2, 32, 32, -1, -10, -14, 26, -15, 1, 23, 5, -3, -23, -13, -16,
+  12, 14, -40, -39, 12, 2, 11, -41, 13, 8, -25, -19, -8, 35, 8, 32,
+  -37, -37, 7, 5, -33, 32, 21, 32, 16, -31, -7, 40, 38, -27, 25, -42,
+  13, 13, -17, -17, 12, -6, 0, -23, 1, 10, -8, -16, -11, 20, -2, 22,
+  7, 8, -33, -32, 6, 5, 11, -31, 12, 3, -22, -12, -3, 27, 10, 23,
+  8, 7, 32, 33, 7, -18, -21, 20, -20, 9, 26, -4, -12, -18, -20, -7,
+  21, 22, -9, -8, 20, -17, -10, -22, -7, 18, 1, -24, -22, 19, -13, 27,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  -4, -3, -10, -11, -3, 7, 7, -6, 7, -4, -9, 2, 5, 5, 7, 1,
+  7, 7, -17, -17, 6, 0, 4, -18, 5, 4, -11, -9, -5, 16, 3, 15,
+  -24, -25, 18, 17, -22, 16, 7, 32, 4, -19, 5, 28, 23, -27, 10, -34,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  -2, -2, -8, -8, -2, 4, 5, -5, 5, -2, -6, 1, 3, 4, 5, 2,
+  -30, -30, 5, 3, -27, 27, 18, 25, 14, -25, -7, 33, 31, -21, 21, -34,
+  -29, -28, -20, -22, -26, 34, 29, 4, 25, -26, -24, 28, 33, -3, 31, -21,
+  6, 3, 57, 58, 4, -25, -32, 42, -31, 9, 44, 2, -13, -36, -30, -21,
+  43, 45, -44, -41, 40, -26, -8, -65, -2, 33, -18, -52, -40, 56, -14, 66,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  -4, -5, 15, 14, -4, -1, -4, 15, -5, -3, 9, 7, 3, -13, -3, -11,
+  -6, -8, 50, 49, -6, -11, -20, 44, -20, -2, 34, 14, 1, -38, -17, -30,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  32, 34, -34, -32, 30, -19, -5, -50, -1, 25, -14, -39, -30, 43, -10, 51,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  -39, -38, -32, -35, -35, 48, 42, 2, 37, -36, -37, 37, 45, -1, 45, -26,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  -28, -26, -49, -51, -25, 43, 42, -19, 39, -27, -45, 23, 36, 17, 43, -6,
+  13, 13, -4, -4, 11, -10, -6, -12, -5, 10, 1, -14, -13, 11, -8, 15,
+  -17, -18, 12, 11, -16, 12, 6, 22, 4, -14, 3, 20, 17, -19, 8, -24,
+  23, 23, -7, -6, 21, -19, -12, -22, -9, 19, 2, -25, -23, 19, -14, 27,
+  -12, -12, -8, -9, -11, 14, 12, 2, 11, -11, -10, 12, 14, -2, 13, -9,
+  9, 10, -18, -17, 8, -3, 2, -20, 4, 6, -10, -12, -7, 18, 1, 18,
+  -5, -9, 79, 78, -6, -21, -34, 66, -35, 1, 56, 17, -4, -58, -31, -43,
+  -3, -3, 6, 6, -3, 1, -1, 7, -1, -2, 3, 4, 3, -6, 0, -6,
+  -21, -21, -5, -7, -19, 22, 17, 11, 14, -18, -11, 22, 23, -9, 19, -20,
+  -43, -42, -39, -42, -39, 54, 48, 0, 42, -40, -43, 41, 51, 1, 51, -27,
+  54, 54, -3, 1, 49, -50, -35, -40, -28, 46, 16, -58, -57, 34, -41, 58,
+  11, 10, 40, 41, 10, -24, -27, 24, -26, 13, 33, -6, -17, -21, -27, -7,
+  -11, -11, -5, -6, -10, 12, 10, 4, 9, -10, -8, 11, 12, -3, 11, -9,
+  3, 2, 13, 13, 2, -7, -8, 8, -8, 3, 10, -1, -5, -7, -8, -3,
+  26, 27, -32, -30, 24, -14, -2, -44, 1, 20, -15, -32, -24, 38, -6, 43,
+  4, 3, 10, 11, 3, -7, -7, 6, -7, 4, 9, -2, -5, -5, -7, -1,
+  -17, -16, -35, -36, -15, 28, 28, -16, 26, -17, -31, 13, 23, 14, 29, -1,
+  -20, -22, 44, 43, -19, 4, -8, 49, -10, -14, 26, 27, 16, -43, -4, -42,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  -64, -62, -40, -45, -57, 74, 62, 13, 54, -57, -51, 62, 73, -10, 67, -48,
+  3, 4, -20, -20, 3, 4, 8, -18, 8, 1, -14, -6, 0, 16, 7, 13,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  -8, -8, -15, -16, -7, 13, 13, -6, 12, -8, -14, 7, 11, 6, 13, -1,
+  -47, -48, 34, 31, -43, 32, 15, 60, 9, -37, 9, 54, 45, -52, 21, -65,
+  -37, -37, 0, -2, -33, 34, 24, 26, 20, -31, -12, 39, 39, -22, 28, -39,
+  26, 27, -9, -7, 24, -22, -13, -26, -10, 22, 2, -29, -27, 22, -16, 32,
+  30, 34, -78, -76, 29, -2, 17, -83, 21, 20, -47, -43, -23, 72, 11, 69,
+  16, 17, -41, -40, 15, -1, 9, -43, 11, 10, -25, -22, -12, 38, 6, 36,
+  -17, -17, 19, 18, -15, 9, 2, 27, 0, -13, 8, 20, 15, -23, 4, -26,
+  -14, -15, -1, -2, -13, 14, 10, 10, 8, -12, -5, 15, 16, -8, 12, -15,
+  29, 30, -21, -19, 26, -20, -9, -37, -5, 23, -6, -33, -28, 32, -13, 40,
+  -25, -25, -8, -10, -23, 26, 21, 11, 17, -22, -14, 25, 28, -10, 23, -23,
+  -10, -10, 6, 5, -9, 8, 4, 12, 3, -8, 1, 12, 10, -10, 5, -14,
+  -32, -34, 33, 31, -30, 19, 6, 49, 2, -25, 13, 39, 30, -42, 10, -50,
+  34, 35, -16, -14, 32, -27, -15, -37, -11, 28, 0, -39, -35, 32, -20, 44,
+  0, -1, 27, 27, -1, -9, -13, 22, -13, 2, 20, 4, -3, -19, -12, -13,
+  3, 2, 13, 13, 2, -7, -8, 8, -8, 3, 10, -1, -5, -7, -8, -3,
+  -14, -16, 32, 31, -13, 3, -6, 35, -8, -10, 19, 20, 11, -31, -3, -30,
+  -50, -49, -19, -23, -45, 54, 43, 20, 37, -44, -31, 50, 56, -17, 48, -44,
+  -5, -4, -41, -42, -4, 19, 24, -29, 23, -8, -32, 0, 11, 25, 23, 14,
+  3, 5, -36, -36, 4, 9, 15, -31, 15, 0, -25, -9, 1, 27, 13, 21,
+  -25, -25, 11, 10, -22, 19, 11, 26, 8, -20, 0, 28, 25, -22, 14, -31,
+  -33, -33, 4, 2, -30, 30, 20, 27, 16, -28, -8, 36, 35, -23, 24, -37,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  -6, -6, -1, -2, -6, 6, 5, 3, 4, -5, -3, 6, 7, -3, 5, -6,
+  10, 9, 21, 22, 9, -16, -16, 10, -15, 10, 19, -7, -13, -9, -17, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  -37, -36, -13, -16, -33, 39, 31, 16, 26, -32, -22, 37, 41, -13, 34, -33,
+  1, 0, 8, 8, 0, -3, -4, 6, -4, 1, 6, 1, -2, -5, -4, -3,
+  31, 31, -5, -3, 28, -27, -18, -25, -14, 26, 7, -33, -32, 22, -22, 35,
+  14, 13, 7, 8, 12, -15, -13, -4, -11, 12, 10, -13, -15, 3, -14, 11,
+  -34, -33, -24, -27, -31, 41, 35, 5, 30, -31, -29, 33, 40, -4, 38, -25,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  -9, -8, -38, -38, -8, 21, 25, -22, 23, -11, -31, 5, 15, 20, 24, 7,
+  -12, -13, 24, 23, -11, 3, -4, 27, -5, -8, 14, 16, 9, -24, -2, -24,
+  -9, -8, -4, -5, -8, 10, 8, 3, 7, -8, -6, 8, 10, -2, 9, -7,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  5, 6, -13, -12, 5, -1, 2, -14, 3, 4, -7, -7, -4, 12, 1, 12,
+  -1, -2, 26, 26, -1, -8, -12, 21, -12, 1, 19, 4, -3, -19, -11, -13,
+  -17, -16, -16, -17, -15, 21, 19, -1, 17, -15, -17, 15, 20, 1, 20, -10,
+  0, 0, 3, 3, 0, -1, -1, 2, -1, 0, 2, 0, 0, -2, -1, -1,
+  9, 10, -20, -20, 9, -2, 3, -23, 5, 6, -12, -13, -7, 20, 2, 19,
+  -23, -23, -1, -3, -21, 22, 16, 15, 13, -20, -9, 24, 25, -13, 18, -23,
+  32, 34, -38, -36, 30, -17, -3, -53, 1, 24, -17, -39, -29, 46, -8, 52,
+  4, 4, -2, -2, 4, -3, -2, -4, -1, 3, 0, -5, -4, 4, -2, 5,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  -4, -5, 15, 14, -4, -1, -4, 15, -5, -3, 9, 7, 3, -13, -3, -11,
+  -4, -6, 41, 41, -4, -10, -17, 36, -18, 0, 29, 10, -1, -31, -16, -24,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  -39, -39, -21, -24, -36, 44, 37, 11, 32, -35, -29, 39, 45, -9, 40, -32,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  16, 15, 27, 28, 14, -24, -24, 11, -22, 15, 25, -13, -20, -10, -24, 4,
+  8, 9, -17, -17, 8, -2, 3, -20, 4, 6, -10, -11, -7, 17, 1, 17,
+  7, 9, -47, -47, 7, 9, 18, -42, 19, 2, -32, -14, -2, 37, 16, 30,
+  -19, -20, 27, 26, -18, 9, 0, 35, -3, -14, 13, 24, 17, -31, 3, -33,
+  -21, -21, -2, -3, -19, 21, 15, 14, 13, -18, -9, 22, 23, -11, 18, -22,
+  7, 8, -14, -14, 7, -2, 2, -16, 3, 5, -8, -9, -6, 14, 1, 14,
+  -1, -2, 23, 22, -2, -6, -10, 19, -10, 0, 16, 5, -1, -17, -9, -12,
+  6, 5, 26, 26, 5, -14, -16, 16, -16, 7, 21, -3, -10, -14, -16, -6,
+  3, 2, 20, 20, 2, -9, -11, 14, -11, 4, 16, 0, -5, -12, -11, -7,
+  -5, -5, 5, 4, -4, 3, 1, 7, 0, -3, 2, 5, 4, -6, 1, -7,
+  7, 9, -47, -47, 7, 9, 18, -42, 19, 2, -32, -14, -2, 37, 16, 30,
+  36, 36, 7, 10, 33, -37, -28, -19, -23, 31, 18, -38, -39, 16, -31, 35,
+  -57, -55, -72, -76, -51, 79, 73, -16, 66, -54, -72, 51, 70, 15, 77, -27,
+  5, 3, 37, 37, 4, -17, -21, 26, -20, 7, 29, 0, -10, -23, -20, -13,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  23, 22, 38, 40, 21, -35, -34, 14, -31, 23, 36, -19, -29, -13, -35, 6,
+  5, 3, 44, 44, 4, -19, -24, 32, -24, 7, 34, 1, -10, -28, -23, -16,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  -4, -4, -5, -5, -3, 5, 5, -1, 4, -4, -5, 3, 5, 1, 5, -2,
+  46, 46, -5, -2, 42, -41, -28, -36, -23, 39, 12, -49, -48, 31, -33, 51,
+  -4, -4, -4, -4, -3, 5, 5, -1, 4, -4, -4, 3, 5, 1, 5, -2,
+  7, 6, 4, 4, 6, -7, -6, -2, -5, 6, 5, -7, -8, 1, -7, 5,
+  -11, -11, -14, -14, -10, 15, 14, -3, 13, -11, -14, 10, 14, 3, 15, -6,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  5, 6, -15, -14, 5, 0, 4, -15, 4, 3, -9, -7, -3, 13, 3, 12,
+  5, 6, -17, -17, 5, 1, 5, -17, 6, 3, -11, -7, -3, 15, 4, 13,
+  -41, -41, 8, 5, -37, 36, 24, 35, 18, -34, -8, 44, 42, -30, 28, -47,
+  12, 13, -26, -25, 11, -3, 4, -28, 5, 8, -14, -16, -10, 25, 2, 24,
+  -13, -15, 39, 38, -13, -1, -10, 40, -12, -8, 24, 20, 9, -35, -7, -32,
+  3, 3, -2, -2, 2, -2, -1, -3, 0, 2, -1, -3, -2, 3, -1, 4,
+  21, 22, -34, -33, 19, -8, 3, -42, 5, 15, -18, -26, -18, 36, -1, 38,
+  0, 0, 11, 11, 0, -4, -6, 9, -6, 1, 8, 1, -2, -8, -5, -5,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  -1, -2, 40, 40, -1, -13, -19, 33, -19, 2, 29, 6, -4, -29, -17, -20,
+  -29, -28, -32, -35, -26, 39, 35, -5, 31, -27, -33, 27, 35, 5, 37, -16,
+  2, -3, 93, 94, 0, -33, -46, 73, -46, 8, 69, 11, -13, -64, -43, -43,
+  42, 43, -38, -35, 38, -27, -10, -59, -5, 33, -13, -49, -40, 51, -16, 62,
+  -14, -13, -14, -15, -12, 18, 16, -1, 14, -13, -15, 13, 17, 1, 17, -8,
+  23, 24, -16, -14, 21, -16, -8, -29, -5, 18, -4, -26, -22, 25, -11, 32,
+  29, 28, 27, 29, 26, -36, -32, 1, -29, 27, 30, -27, -34, -1, -35, 18,
+  -18, -17, -7, -9, -16, 19, 15, 7, 13, -16, -11, 18, 20, -5, 17, -15,
+  -8, -9, 29, 28, -8, -2, -8, 28, -9, -5, 18, 12, 5, -25, -7, -22,
+  -25, -23, -32, -33, -22, 34, 32, -8, 29, -24, -32, 22, 30, 7, 33, -11,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  4, 3, 6, 6, 3, -5, -5, 2, -5, 4, 6, -3, -5, -2, -5, 1,
+  9, 9, -4, -4, 8, -7, -4, -10, -3, 7, 0, -10, -9, 8, -5, 11,
+  27, 25, 41, 43, 24, -39, -38, 14, -34, 26, 39, -22, -33, -13, -39, 8,
+  11, 9, 41, 41, 9, -24, -27, 25, -25, 12, 33, -6, -16, -22, -26, -8,
+  31, 33, -40, -37, 29, -16, -2, -53, 2, 24, -18, -39, -29, 46, -7, 52,
+  -5, -5, 8, 8, -4, 2, -1, 10, -1, -3, 4, 6, 4, -8, 0, -9,
+  10, 10, -15, -14, 9, -4, 0, -19, 2, 7, -7, -12, -9, 16, -1, 17,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  2, 2, 0, 0, 2, -2, -1, -2, -1, 2, 1, -3, -2, 2, -2, 3,
+  41, 42, -25, -22, 38, -30, -16, -49, -10, 33, -5, -47, -41, 42, -21, 55,
+  10, 10, -13, -12, 9, -5, 0, -17, 1, 7, -6, -12, -9, 15, -2, 16,
+  -5, -4, -14, -14, -4, 9, 10, -7, 9, -5, -12, 3, 7, 7, 10, 1,
+  -1, -1, 7, 7, -1, -2, -3, 6, -3, 0, 5, 2, 0, -5, -3, -4,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  16, 16, -4, -3, 15, -14, -9, -14, -7, 13, 3, -18, -17, 12, -11, 19,
+  -4, -5, 19, 19, -4, -2, -6, 18, -7, -2, 12, 7, 2, -16, -5, -14,
+  -22, -23, 27, 26, -20, 12, 1, 37, -1, -17, 13, 27, 20, -32, 5, -36,
+  5, 5, -8, -7, 4, -2, 0, -9, 1, 3, -4, -6, -4, 8, 0, 9,
+  -1, 0, -25, -25, 0, 9, 12, -19, 12, -2, -18, -3, 4, 17, 11, 11,
+  37, 39, -37, -34, 34, -22, -7, -55, -2, 29, -15, -44, -35, 48, -12, 56,
+  11, 12, -17, -17, 10, -4, 1, -21, 2, 8, -9, -14, -9, 19, -1, 20,
+  27, 27, -2, 0, 24, -25, -17, -20, -14, 23, 8, -29, -28, 17, -20, 29,
+  -16, -19, 47, 46, -16, -1, -12, 50, -14, -11, 29, 24, 12, -43, -8, -40,
+  6, 4, 29, 30, 5, -15, -18, 19, -17, 7, 23, -2, -10, -17, -18, -8,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  -12, -11, -11, -11, -10, 15, 13, 0, 11, -11, -12, 11, 14, 0, 14, -7,
+  6, 5, 27, 27, 5, -15, -17, 17, -16, 7, 22, -2, -10, -15, -17, -7,
+  -21, -20, -23, -25, -19, 28, 25, -4, 23, -20, -24, 19, 25, 4, 27, -11,
+  5, 4, 19, 20, 4, -11, -13, 12, -12, 6, 16, -3, -8, -11, -12, -4,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  24, 24, 10, 12, 22, -26, -21, -9, -18, 21, 15, -24, -27, 7, -23, 21,
+  1, -1, 41, 41, 0, -15, -20, 32, -20, 4, 31, 5, -6, -28, -19, -19,
+  0, 0, 3, 3, 0, -1, -2, 2, -2, 0, 2, 0, -1, -2, -1, -1,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  -14, -14, -16, -17, -13, 19, 17, -3, 16, -14, -17, 13, 17, 3, 18, -8,
+  16, 16, -5, -3, 14, -13, -8, -15, -6, 13, 2, -17, -16, 13, -10, 19,
+  -16, -17, 9, 7, -15, 12, 7, 18, 5, -13, 1, 19, 16, -16, 9, -21,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  3, 2, 8, 8, 2, -5, -6, 5, -5, 3, 7, -2, -4, -4, -6, -1,
+  7, 6, 22, 22, 6, -14, -15, 13, -14, 7, 18, -4, -10, -11, -15, -3,
+  -9, -10, 20, 19, -8, 2, -3, 22, -5, -6, 11, 12, 7, -19, -2, -19,
+  1, 0, 12, 12, 1, -5, -6, 9, -6, 2, 9, 1, -2, -8, -6, -5,
+  -15, -14, -14, -15, -13, 19, 17, -1, 15, -14, -15, 14, 18, 1, 18, -9,
+  65, 67, -41, -37, 60, -47, -24, -79, -16, 52, -8, -75, -64, 68, -32, 89,
+  36, 37, -22, -20, 33, -26, -14, -43, -9, 29, -4, -41, -36, 37, -18, 48,
+  44, 47, -69, -66, 41, -19, 3, -86, 9, 33, -35, -56, -39, 74, -4, 80,
+  -19, -19, 6, 5, -17, 16, 10, 18, 7, -16, -2, 21, 20, -16, 12, -23,
+  -2, 0, -40, -40, -1, 15, 20, -30, 20, -5, -30, -3, 7, 26, 19, 17,
+  3, 1, 50, 50, 2, -20, -26, 37, -25, 6, 37, 4, -9, -33, -25, -20,
+  12, 12, -24, -23, 11, -3, 4, -27, 5, 8, -14, -15, -9, 24, 2, 24,
+  -4, -5, 10, 9, -4, 1, -2, 11, -2, -3, 6, 6, 3, -9, -1, -9,
+  -6, -6, 2, 2, -6, 5, 3, 6, 2, -5, -1, 7, 6, -5, 4, -7,
+  14, 15, -19, -18, 13, -7, 0, -25, 2, 11, -9, -18, -13, 22, -2, 24,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  -6, -5, -7, -8, -5, 8, 7, -2, 7, -5, -7, 5, 7, 2, 8, -3,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  -27, -26, -27, -29, -24, 34, 31, -2, 27, -25, -29, 25, 32, 2, 33, -16,
+  -39, -38, -21, -24, -35, 44, 36, 11, 31, -35, -28, 39, 44, -9, 40, -31,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  -8, -10, 42, 42, -8, -6, -15, 40, -16, -4, 28, 15, 4, -34, -13, -29,
+  0, 1, -19, -19, 1, 6, 9, -15, 9, -1, -14, -3, 2, 14, 8, 9,
+  27, 27, -8, -6, 25, -22, -14, -26, -11, 22, 3, -30, -28, 22, -17, 32,
+  -39, -38, -26, -29, -35, 46, 39, 7, 34, -35, -32, 38, 45, -6, 42, -29,
+  -3, -4, 34, 34, -3, -9, -14, 29, -15, 0, 24, 8, -1, -25, -13, -19,
+  -16, -14, -28, -29, -14, 24, 24, -11, 22, -15, -26, 13, 20, 10, 24, -3,
+  7, 6, 16, 16, 6, -12, -12, 8, -11, 7, 14, -5, -9, -7, -12, -1,
+  -7, -6, -12, -12, -6, 10, 10, -4, 9, -7, -11, 6, 9, 4, 11, -2,
+  -8, -9, 11, 11, -8, 4, 0, 15, -1, -6, 5, 10, 7, -13, 1, -14,
+  -17, -18, 22, 21, -16, 9, 1, 30, -1, -13, 10, 21, 16, -26, 4, -29,
+  41, 41, -9, -6, 37, -35, -23, -36, -18, 34, 7, -44, -42, 31, -28, 47,
+  3, 2, 18, 19, 2, -9, -11, 13, -10, 4, 14, 0, -5, -11, -10, -6,
+  -4, -5, 19, 19, -4, -3, -6, 18, -7, -2, 13, 7, 2, -16, -5, -13,
+  -7, -7, 1, 0, -7, 7, 5, 6, 4, -6, -2, 8, 8, -5, 5, -8,
+  -38, -37, -34, -37, -34, 48, 42, 0, 37, -35, -38, 36, 45, 1, 45, -24,
+  -5, -5, -8, -9, -5, 8, 8, -3, 7, -5, -8, 4, 7, 3, 8, -1,
+  -14, -15, 18, 17, -13, 7, 1, 24, -1, -11, 8, 17, 13, -21, 3, -23,
+  -32, -31, -21, -23, -29, 37, 32, 6, 27, -29, -26, 31, 37, -4, 34, -24,
+  4, 2, 26, 27, 3, -12, -15, 18, -15, 5, 20, 0, -7, -16, -14, -9,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  7, 5, 34, 35, 6, -18, -21, 22, -20, 8, 27, -3, -12, -20, -21, -9,
+  22, 23, -28, -26, 20, -11, -1, -37, 2, 16, -13, -27, -19, 32, -4, 36,
+  23, 21, 41, 43, 20, -35, -35, 17, -32, 22, 38, -18, -29, -15, -36, 4,
+  -7, -8, 36, 35, -7, -6, -13, 33, -13, -3, 24, 12, 3, -29, -11, -24,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  15, 17, -50, -49, 14, 3, 14, -50, 16, 9, -32, -23, -10, 44, 11, 39,
+  22, 21, 25, 26, 19, -29, -26, 4, -24, 20, 25, -20, -26, -4, -28, 11,
+  -34, -35, 9, 6, -31, 29, 19, 31, 14, -29, -5, 38, 35, -27, 23, -40,
+  -7, -7, -11, -12, -7, 11, 10, -4, 9, -7, -11, 6, 9, 3, 11, -3,
+  -12, -12, -4, -5, -11, 13, 10, 6, 9, -11, -7, 13, 14, -5, 11, -11,
+  17, 16, 44, 45, 15, -31, -33, 22, -30, 18, 38, -13, -24, -20, -33, -2,
+  -23, -24, 33, 31, -21, 11, 0, 42, -3, -17, 16, 29, 20, -36, 3, -40,
+  -24, -24, -11, -13, -22, 27, 22, 8, 19, -22, -16, 24, 27, -7, 24, -21,
+  6, 5, 23, 23, 5, -13, -15, 14, -14, 7, 18, -3, -9, -12, -14, -5,
+  -9, -10, 26, 25, -9, 0, -6, 27, -8, -6, 16, 13, 6, -24, -4, -22,
+  1, 0, 14, 14, 0, -5, -7, 10, -7, 2, 10, 1, -2, -9, -7, -6,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  28, 30, -36, -34, 26, -15, -2, -48, 2, 21, -16, -35, -26, 42, -6, 47,
+  19, 18, 17, 19, 17, -23, -21, 1, -18, 17, 19, -18, -22, -1, -22, 12,
+  6, 6, -12, -11, 5, -1, 2, -13, 3, 4, -7, -8, -5, 12, 1, 12,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  15, 17, -41, -40, 14, 0, 10, -43, 12, 10, -25, -21, -11, 38, 7, 35,
+  40, 42, -51, -48, 37, -21, -3, -69, 3, 30, -24, -50, -37, 60, -8, 67,
+  -16, -14, -28, -29, -14, 24, 24, -11, 22, -15, -26, 13, 20, 10, 24, -3,
+  17, 18, -31, -30, 16, -5, 4, -36, 6, 12, -17, -22, -14, 31, 1, 32,
+  -29, -28, -44, -46, -26, 43, 41, -14, 37, -28, -42, 25, 37, 13, 42, -10,
+  1, 1, 4, 4, 1, -2, -3, 2, -3, 2, 3, -1, -2, -2, -3, 0,
+  -18, -19, 12, 11, -17, 13, 6, 22, 4, -14, 3, 21, 18, -19, 9, -25,
+  1, 1, -3, -3, 1, 0, 1, -3, 1, 1, -2, -2, -1, 3, 0, 3,
+  60, 62, -38, -34, 55, -44, -22, -73, -14, 49, -8, -69, -60, 63, -30, 82,
+  2, 1, 10, 10, 1, -5, -6, 6, -5, 2, 8, 0, -3, -6, -6, -3,
+  9, 10, -26, -26, 8, 1, 7, -27, 8, 5, -16, -13, -6, 23, 5, 22,
+  21, 22, -23, -21, 20, -13, -4, -33, -1, 17, -9, -26, -20, 29, -7, 33,
+  22, 23, -33, -32, 20, -9, 1, -42, 4, 16, -17, -28, -19, 36, -2, 39,
+  -26, -26, -13, -15, -24, 29, 24, 9, 20, -23, -18, 26, 30, -7, 26, -22,
+  16, 17, -22, -21, 15, -8, -1, -29, 1, 12, -10, -20, -15, 25, -3, 28,
+  -2, -1, -43, -43, -1, 16, 22, -32, 22, -5, -32, -3, 8, 28, 21, 18,
+  -10, -11, 14, 13, -9, 5, 0, 18, -1, -7, 7, 12, 9, -16, 1, -17,
+  42, 41, 10, 13, 38, -43, -33, -21, -28, 36, 21, -43, -46, 18, -37, 39,
+  3, 5, -47, -47, 3, 13, 20, -39, 21, -1, -33, -9, 3, 34, 19, 25,
+  7, 5, 37, 38, 6, -19, -22, 25, -22, 9, 30, -2, -12, -22, -22, -11,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  5, 3, 43, 44, 4, -20, -24, 31, -24, 8, 34, 0, -11, -27, -23, -15,
+  34, 33, 3, 5, 30, -33, -24, -21, -20, 29, 13, -35, -36, 18, -27, 34,
+  18, 17, 12, 13, 16, -21, -18, -3, -15, 16, 15, -17, -21, 2, -19, 13,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  21, 21, 0, 1, 19, -20, -14, -15, -11, 18, 7, -22, -22, 13, -16, 23,
+  -52, -53, 19, 16, -47, 42, 25, 52, 19, -42, -3, 57, 53, -45, 32, -64,
+  -24, -28, 81, 79, -23, -5, -23, 81, -26, -14, 51, 37, 16, -71, -17, -64,
+  -8, -7, -12, -13, -7, 11, 11, -4, 10, -8, -12, 7, 10, 4, 12, -3,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  -3, -6, 75, 75, -4, -22, -34, 62, -34, 3, 54, 14, -6, -54, -31, -39,
+  -4, -4, -14, -15, -4, 9, 10, -8, 9, -4, -12, 3, 6, 7, 10, 2,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  2, 1, 21, 21, 2, -9, -12, 15, -11, 4, 16, 0, -5, -13, -11, -8,
+  -13, -13, 2, 1, -12, 12, 8, 11, 6, -11, -3, 14, 14, -9, 9, -15,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  2, -1, 78, 78, 1, -28, -39, 60, -38, 8, 58, 9, -12, -53, -36, -35,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  -14, -15, 35, 34, -13, 1, -8, 38, -9, -9, 21, 19, 10, -33, -5, -31,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  -10, -11, 27, 26, -10, 1, -6, 29, -7, -7, 16, 15, 8, -25, -4, -24,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  21, 21, 0, 1, 19, -20, -14, -15, -11, 18, 7, -22, -22, 13, -16, 23,
+  -9, -6, -77, -78, -7, 35, 43, -55, 42, -14, -60, -1, 19, 48, 42, 27,
+  -6, -7, 33, 33, -6, -5, -12, 31, -13, -3, 22, 11, 2, -27, -10, -22,
+  -55, -52, -75, -79, -49, 77, 73, -21, 66, -52, -74, 48, 68, 20, 76, -22,
+  9, 10, -23, -23, 9, -1, 5, -25, 6, 6, -14, -13, -7, 22, 3, 21,
+  13, 14, -26, -25, 12, -3, 4, -29, 6, 9, -15, -17, -10, 26, 2, 26,
+  31, 31, -1, 1, 28, -29, -21, -23, -16, 26, 10, -33, -33, 19, -24, 33,
+  0, 0, 2, 2, 0, -1, -1, 2, -1, 0, 1, 0, 0, -1, -1, -1,
+  1, 0, 25, 25, 0, -9, -12, 19, -12, 2, 19, 3, -4, -17, -12, -11,
+  -16, -17, 23, 22, -15, 8, 0, 29, -2, -12, 11, 20, 14, -25, 2, -28,
+  30, 32, -60, -58, 28, -8, 9, -69, 13, 21, -34, -40, -24, 60, 4, 60,
+  -67, -65, -60, -65, -60, 84, 75, 0, 65, -61, -66, 63, 79, 1, 79, -43,
+  12, 13, -23, -22, 11, -4, 3, -27, 4, 9, -13, -16, -10, 23, 1, 24,
+  10, 10, -11, -11, 9, -5, -1, -16, 0, 8, -5, -12, -9, 14, -3, 16,
+  17, 18, -23, -22, 16, -9, -1, -30, 2, 13, -11, -22, -16, 26, -3, 29,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1, 1, -3, -3, 1, 0, 1, -3, 1, 1, -2, -1, -1, 3, 1, 3,
+  6, 4, 47, 48, 4, -21, -26, 33, -26, 8, 37, 1, -12, -29, -25, -16,
+  -16, -16, -10, -12, -15, 19, 16, 3, 14, -15, -13, 16, 19, -2, 17, -12,
+  14, 14, 7, 8, 13, -15, -13, -4, -11, 12, 10, -14, -16, 4, -14, 12,
+  9, 7, 42, 43, 8, -23, -27, 27, -25, 11, 34, -4, -15, -24, -26, -10,
+  2, 2, -14, -14, 2, 3, 6, -12, 6, 0, -10, -4, 0, 10, 5, 8,
+  -2, -2, -5, -5, -2, 4, 4, -2, 4, -2, -4, 2, 3, 2, 4, 0,
+  -6, -5, -45, -46, -5, 21, 26, -31, 25, -9, -36, 1, 13, 28, 25, 15,
+  17, 18, -17, -16, 16, -10, -3, -25, -1, 14, -6, -20, -16, 22, -6, 26,
+  5, 6, -6, -5, 5, -3, -1, -8, 0, 4, -2, -6, -5, 7, -2, 8,
+  -11, -11, -5, -6, -10, 12, 10, 4, 9, -10, -8, 11, 12, -3, 11, -9,
+  13, 10, 79, 80, 11, -39, -47, 54, -46, 18, 63, -3, -24, -48, -45, -24,
+  -2, -4, 29, 29, -2, -8, -12, 25, -13, 0, 21, 6, -1, -22, -11, -16,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, -3, 60, 60, -1, -20, -29, 48, -29, 4, 44, 9, -7, -42, -27, -29,
+  -4, -8, 90, 90, -5, -26, -40, 74, -41, 3, 65, 17, -7, -65, -37, -47,
+  13, 15, -31, -30, 13, -2, 6, -34, 8, 9, -18, -19, -10, 30, 3, 29,
+  13, 13, 3, 4, 12, -14, -11, -7, -9, 12, 7, -14, -14, 6, -12, 12,
+  1, -2, 76, 76, 0, -26, -37, 60, -37, 6, 56, 10, -10, -52, -35, -35,
+  -53, -50, -69, -73, -47, 73, 69, -18, 62, -50, -68, 47, 65, 16, 72, -23,
+  -7, -9, 42, 42, -7, -8, -16, 39, -17, -3, 29, 13, 2, -34, -14, -27,
+  11, 11, 4, 5, 10, -12, -9, -5, -8, 10, 7, -11, -12, 4, -10, 10,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  13, 12, 29, 30, 11, -22, -22, 14, -21, 13, 26, -10, -17, -12, -23, 0,
+  9, 9, -16, -16, 8, -3, 2, -19, 3, 6, -9, -11, -7, 17, 1, 17,
+  6, 5, 16, 17, 5, -11, -12, 9, -11, 6, 14, -4, -8, -8, -12, -2,
+  -18, -18, -20, -21, -16, 24, 22, -3, 19, -17, -21, 17, 22, 3, 23, -10,
+  13, 10, 73, 75, 11, -37, -44, 49, -43, 17, 59, -4, -23, -43, -43, -21,
+  -30, -28, -53, -55, -27, 46, 46, -21, 42, -30, -49, 25, 39, 19, 47, -7,
+  -24, -24, -11, -13, -22, 27, 22, 8, 19, -22, -16, 24, 27, -7, 24, -21,
+  -54, -56, 31, 27, -50, 41, 22, 63, 15, -44, 5, 62, 54, -54, 28, -72,
+  -36, -35, -28, -30, -33, 44, 38, 4, 33, -33, -32, 35, 42, -3, 41, -25,
+  14, 15, -14, -13, 13, -9, -3, -21, -1, 11, -5, -17, -14, 18, -5, 22,
+  17, 18, -30, -29, 16, -6, 3, -36, 5, 12, -17, -22, -14, 31, 0, 32,
+  -49, -54, 115, 112, -46, 7, -23, 127, -29, -33, 69, 67, 38, -109, -14, -107,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  23, 22, 17, 19, 21, -27, -24, -3, -21, 21, 20, -22, -27, 2, -25, 16,
+  26, 26, -12, -10, 24, -21, -12, -27, -9, 21, 1, -29, -26, 23, -15, 33,
+  -2, -1, -10, -10, -1, 5, 6, -7, 6, -2, -8, 0, 3, 6, 6, 3,
+  -1, -1, -14, -14, -1, 6, 7, -10, 7, -2, -11, -1, 3, 9, 7, 5,
+  -13, -12, -16, -16, -11, 17, 16, -3, 14, -12, -16, 11, 16, 3, 17, -6,
+  31, 30, 26, 29, 28, -38, -34, -1, -30, 29, 30, -30, -37, 0, -36, 21,
+  -2, -3, 14, 14, -2, -2, -5, 13, -5, -1, 9, 4, 1, -11, -4, -9,
+  -16, -16, -7, -9, -15, 18, 15, 6, 12, -15, -11, 16, 19, -5, 16, -14,
+  -16, -17, 13, 11, -15, 11, 5, 21, 3, -13, 4, 19, 16, -19, 7, -23,
+  -7, -8, 26, 26, -6, -3, -8, 26, -9, -4, 17, 11, 4, -22, -7, -20,
+  -12, -14, 34, 33, -12, 0, -8, 36, -10, -8, 21, 18, 9, -31, -6, -29,
+  -14, -13, -8, -9, -12, 15, 13, 3, 11, -12, -10, 13, 15, -3, 14, -11,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  -2, -2, -2, -2, -2, 2, 2, 0, 2, -2, -2, 2, 2, 0, 2, -1,
+  -15, -13, -54, -56, -13, 32, 36, -32, 34, -17, -45, 8, 23, 29, 36, 10,
+  -3, -3, -4, -4, -2, 4, 4, -1, 3, -3, -4, 2, 3, 1, 4, -1,
+  -4, -6, 31, 31, -4, -6, -12, 28, -13, -1, 21, 9, 1, -24, -11, -19,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  22, 23, -28, -26, 20, -11, -1, -37, 2, 16, -13, -27, -19, 32, -4, 36,
+  -19, -19, -22, -23, -17, 26, 23, -4, 21, -18, -22, 18, 23, 3, 25, -10,
+  8, 7, 29, 29, 7, -17, -19, 17, -18, 9, 24, -4, -12, -15, -19, -5,
+  -23, -24, 29, 27, -21, 12, 2, 39, -1, -18, 13, 29, 21, -34, 5, -38,
+  3, 2, 8, 8, 2, -5, -6, 4, -5, 3, 7, -2, -4, -4, -6, -1,
+  -6, -4, -43, -43, -5, 20, 24, -29, 24, -8, -33, 0, 12, 26, 24, 14,
+  -28, -30, 44, 42, -26, 12, -2, 55, -6, -21, 23, 36, 25, -47, 2, -51,
+  11, 10, 31, 32, 10, -21, -22, 17, -21, 12, 27, -8, -16, -15, -23, -3,
+  11, 12, -17, -17, 10, -5, 1, -22, 2, 8, -9, -14, -10, 19, -1, 20,
+  4, 4, -11, -11, 3, 0, 3, -12, 3, 2, -7, -5, -2, 10, 2, 9,
+  -5, -5, 15, 15, -4, -1, -4, 15, -5, -3, 10, 7, 3, -13, -3, -12,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  -13, -11, -50, -51, -11, 29, 32, -31, 31, -15, -41, 6, 20, 27, 32, 10,
+  1, 0, 27, 27, 0, -10, -14, 21, -13, 3, 20, 3, -4, -18, -13, -12,
+  20, 22, -39, -38, 19, -6, 5, -45, 8, 14, -22, -27, -16, 39, 2, 40,
+  -11, -11, -3, -4, -10, 11, 9, 5, 7, -9, -6, 11, 12, -4, 10, -10,
+  -7, -7, -5, -5, -6, 8, 7, 1, 6, -6, -6, 7, 8, -1, 7, -5,
+  9, 9, -14, -13, 8, -3, 1, -17, 2, 6, -7, -11, -7, 15, -1, 15,
+  16, 16, -19, -18, 14, -8, -1, -26, 1, 12, -9, -19, -14, 23, -3, 26,
+  2, 2, -3, -3, 2, -1, 0, -4, 0, 2, -2, -3, -2, 3, 0, 4,
+  -18, -18, 0, -1, -16, 17, 12, 13, 10, -15, -6, 19, 19, -11, 14, -19,
+  21, 20, 13, 14, 19, -24, -20, -5, -17, 19, 16, -20, -24, 4, -22, 16,
+  24, 24, -13, -12, 22, -18, -10, -27, -7, 19, -2, -27, -24, 24, -13, 31,
+  -13, -12, -34, -35, -11, 24, 25, -17, 23, -14, -29, 9, 18, 16, 25, 2,
+  18, 17, 11, 12, 16, -20, -17, -4, -15, 16, 14, -17, -20, 3, -19, 13,
+  -35, -33, -33, -35, -31, 44, 39, -1, 35, -32, -36, 32, 41, 2, 42, -21,
+  -16, -16, -3, -4, -15, 17, 13, 9, 10, -14, -8, 17, 18, -8, 14, -16,
+  -7, -8, 34, 34, -7, -5, -12, 32, -13, -3, 23, 12, 3, -28, -10, -23,
+  20, 20, -8, -7, 18, -16, -10, -20, -7, 16, 1, -22, -20, 17, -12, 25,
+  -26, -30, 71, 69, -25, 1, -17, 75, -20, -17, 44, 38, 19, -65, -11, -62,
+  -12, -11, -15, -16, -10, 16, 15, -4, 14, -11, -15, 10, 14, 4, 16, -5,
+  -33, -32, -40, -42, -30, 45, 41, -8, 37, -31, -40, 30, 40, 7, 44, -16,
+  1, 0, 12, 12, 1, -5, -6, 9, -6, 2, 9, 1, -2, -8, -6, -5,
+  -12, -12, 1, 0, -11, 11, 7, 9, 6, -10, -3, 13, 12, -8, 8, -13,
+  0, 0, 2, 2, 0, -1, -1, 2, -1, 0, 2, 0, 0, -1, -1, -1,
+  5, 3, 33, 34, 4, -16, -19, 23, -18, 6, 26, 0, -9, -20, -18, -11,
+  -20, -21, 14, 12, -19, 15, 7, 25, 5, -16, 3, 24, 20, -22, 10, -28,
+  19, 19, 12, 14, 17, -22, -19, -4, -16, 17, 15, -19, -22, 3, -20, 14,
+  3, 3, 1, 2, 3, -3, -3, -1, -2, 3, 2, -3, -3, 1, -3, 3,
+  5, 4, 8, 8, 4, -7, -7, 3, -6, 5, 7, -4, -6, -3, -7, 1,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  -12, -10, -43, -44, -10, 26, 29, -26, 27, -13, -35, 6, 18, 23, 28, 8,
+  -13, -13, 3, 2, -12, 11, 7, 12, 6, -11, -2, 14, 14, -10, 9, -15,
+  -3, -3, 9, 9, -3, 0, -3, 9, -3, -2, 6, 4, 2, -8, -2, -7,
+  -18, -18, -2, -3, -16, 18, 13, 12, 11, -16, -7, 19, 20, -10, 15, -18,
+  -12, -11, -36, -37, -11, 24, 26, -20, 24, -13, -31, 8, 18, 18, 26, 4,
+  14, 16, -30, -29, 14, -4, 4, -34, 6, 10, -17, -19, -12, 29, 2, 29,
+  0, 1, -26, -26, 1, 9, 12, -21, 12, -2, -19, -4, 3, 18, 11, 12,
+  12, 12, 0, 1, 11, -11, -8, -8, -6, 10, 4, -12, -12, 7, -9, 12,
+  -34, -33, -24, -27, -31, 41, 35, 5, 30, -31, -29, 33, 40, -4, 38, -25,
+  5, 6, -41, -41, 5, 10, 17, -36, 17, 1, -29, -11, 0, 32, 15, 24,
+  -31, -31, 17, 15, -28, 23, 13, 35, 9, -25, 2, 35, 30, -30, 16, -40,
+  2, 2, -4, -4, 2, -1, 0, -5, 1, 2, -2, -3, -2, 4, 0, 4,
+  -8, -7, -12, -13, -7, 11, 11, -4, 10, -8, -12, 7, 10, 4, 12, -3,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  17, 17, -1, 1, 15, -16, -11, -12, -9, 14, 5, -18, -18, 10, -13, 18,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  -6, -9, 65, 64, -6, -16, -27, 55, -28, 0, 46, 15, -2, -48, -24, -37,
+  -15, -17, 34, 33, -14, 3, -6, 38, -8, -10, 20, 21, 12, -33, -4, -32,
+  -1, -1, 7, 7, -1, -2, -3, 6, -3, 0, 5, 2, 0, -5, -3, -4,
+  -19, -20, 27, 26, -18, 9, 0, 35, -3, -14, 14, 24, 17, -31, 3, -33,
+  37, 38, -27, -24, 34, -25, -12, -47, -7, 29, -7, -42, -36, 41, -16, 51,
+  16, 17, -19, -18, 15, -9, -2, -27, 0, 13, -8, -20, -15, 23, -4, 26,
+  -1, -1, 1, 0, -1, 1, 0, 1, 0, -1, 0, 1, 1, -1, 0, -1,
+  -13, -12, -39, -40, -12, 26, 28, -22, 26, -14, -33, 9, 19, 19, 28, 5,
+  -3, -4, 21, 21, -3, -4, -8, 19, -8, -1, 14, 6, 1, -16, -7, -13,
+  -17, -16, -10, -11, -15, 19, 16, 4, 14, -15, -13, 16, 19, -3, 17, -13,
+  26, 27, -43, -41, 24, -10, 3, -52, 7, 19, -23, -33, -22, 45, -1, 47,
+  -7, -7, 8, 7, -6, 4, 1, 11, 0, -5, 3, 8, 6, -10, 2, -11,
+  18, 15, 68, 69, 15, -39, -44, 41, -42, 20, 56, -9, -27, -37, -44, -14,
+  10, 9, 32, 32, 9, -20, -22, 18, -21, 11, 27, -7, -15, -16, -22, -4,
+  -35, -34, -26, -29, -31, 42, 36, 4, 32, -32, -31, 34, 41, -3, 39, -25,
+  21, 20, 28, 29, 19, -29, -27, 7, -25, 20, 28, -18, -26, -7, -29, 9,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  -28, -28, 4, 2, -25, 25, 17, 22, 13, -23, -6, 30, 29, -19, 20, -31,
+  -5, -6, 30, 30, -5, -5, -11, 27, -12, -2, 20, 9, 2, -24, -9, -19,
+  7, 7, -10, -10, 6, -3, 0, -13, 1, 5, -5, -9, -6, 11, -1, 12,
+  20, 21, -23, -22, 19, -11, -3, -32, 0, 15, -10, -24, -19, 28, -5, 32,
+  32, 35, -71, -69, 30, -7, 12, -79, 16, 22, -41, -44, -26, 68, 6, 67,
+  1, 0, 14, 14, 0, -5, -7, 10, -7, 2, 10, 1, -2, -9, -7, -6,
+  0, -1, 28, 28, 0, -9, -13, 22, -13, 2, 20, 4, -4, -19, -12, -13,
+  3, 3, -17, -16, 3, 3, 6, -15, 6, 1, -11, -5, -1, 13, 5, 11,
+  -33, -32, -30, -33, -30, 42, 37, 0, 33, -31, -33, 31, 39, 1, 39, -21,
+  -9, -9, -4, -5, -8, 10, 8, 3, 7, -8, -6, 9, 10, -3, 9, -7,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  -28, -27, -22, -24, -25, 34, 29, 2, 26, -25, -26, 26, 32, -1, 31, -19,
+  -20, -19, -11, -12, -18, 22, 18, 5, 16, -18, -14, 19, 22, -4, 20, -16,
+  15, 15, -15, -14, 13, -9, -3, -22, -1, 11, -6, -18, -14, 19, -5, 22,
+  0, 0, -9, -9, 0, 3, 4, -7, 4, -1, -6, -1, 1, 6, 4, 4,
+  80, 78, 38, 43, 72, -88, -72, -26, -62, 71, 55, -80, -90, 21, -79, 66,
+  -5, -3, -56, -57, -4, 24, 30, -41, 30, -8, -43, -2, 13, 36, 29, 21,
+  -20, -21, 41, 40, -18, 5, -6, 46, -9, -14, 23, 27, 16, -40, -3, -40,
+  -6, -5, -32, -33, -5, 17, 20, -22, 19, -8, -26, 2, 10, 19, 19, 9,
+  -1, -3, 62, 62, -2, -20, -29, 50, -29, 4, 45, 9, -7, -43, -27, -30,
+  12, 13, -17, -16, 11, -6, 0, -22, 1, 9, -8, -15, -11, 19, -2, 21,
+  -17, -16, -35, -36, -15, 28, 29, -16, 26, -17, -31, 14, 23, 14, 29, -2,
+  5, 5, 11, 11, 4, -8, -8, 5, -8, 5, 9, -4, -7, -4, -9, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  -9, -10, 36, 35, -8, -4, -11, 35, -13, -5, 24, 14, 5, -30, -9, -26,
+  18, 19, -16, -15, 16, -11, -4, -25, -2, 14, -6, -21, -17, 22, -7, 27,
+  0, -1, 26, 26, 0, -9, -13, 20, -13, 2, 19, 3, -3, -18, -12, -12,
+  -10, -13, 71, 70, -10, -14, -27, 63, -29, -3, 49, 21, 2, -55, -24, -44,
+  21, 20, 13, 14, 19, -24, -20, -5, -17, 19, 16, -20, -24, 4, -22, 16,
+  7, 7, -8, -8, 6, -4, -1, -11, 0, 5, -4, -8, -6, 10, -2, 11,
+  -4, -3, -20, -21, -4, 11, 13, -13, 12, -5, -16, 2, 7, 11, 12, 5,
+  9, 8, 24, 25, 8, -16, -18, 13, -17, 9, 21, -6, -12, -12, -18, -2,
+  -1, -2, 22, 23, -1, -7, -10, 19, -10, 1, 16, 4, -2, -16, -9, -12,
+  25, 24, 14, 16, 22, -28, -23, -6, -20, 22, 18, -24, -28, 5, -25, 20,
+  5, 5, 11, 11, 4, -8, -8, 5, -8, 5, 9, -4, -7, -4, -9, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  -2, -2, -4, -4, -2, 4, 3, -1, 3, -2, -4, 2, 3, 1, 4, -1,
+  1, 1, -2, -2, 1, 0, 0, -2, 0, 0, -1, -1, 0, 1, 0, 1,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  -26, -26, 7, 5, -24, 22, 14, 23, 11, -21, -4, 28, 27, -20, 17, -30,
+  28, 28, -11, -9, 25, -22, -13, -28, -10, 23, 1, -31, -28, 24, -16, 34,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  -11, -11, 9, 8, -10, 7, 3, 15, 2, -9, 3, 13, 10, -12, 5, -16,
+  -5, -7, 34, 34, -5, -7, -13, 31, -13, -2, 23, 10, 1, -27, -11, -22,
+  -48, -47, -37, -40, -43, 58, 50, 5, 44, -44, -43, 46, 56, -3, 54, -33,
+  14, 14, -16, -15, 12, -7, -1, -22, 0, 10, -7, -17, -12, 19, -3, 22,
+  -47, -44, -66, -70, -42, 67, 64, -20, 57, -45, -65, 40, 58, 18, 66, -18,
+  -51, -54, 84, 81, -47, 19, -6, 103, -13, -37, 45, 65, 44, -89, 2, -94,
+  5, 5, -7, -7, 5, -2, 0, -9, 1, 4, -4, -7, -5, 8, -1, 9,
+  -19, -17, -37, -39, -17, 30, 31, -16, 28, -19, -34, 15, 25, 15, 31, -2,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  -16, -19, 76, 75, -16, -10, -26, 71, -28, -8, 50, 27, 8, -62, -21, -53,
+  4, 3, 23, 24, 4, -12, -14, 15, -14, 6, 19, -2, -8, -14, -14, -6,
+  0, 0, 2, 2, 0, -1, -1, 1, -1, 0, 1, 0, 0, -1, -1, 0,
+  -4, -4, -3, -4, -3, 5, 4, 0, 4, -4, -4, 4, 4, 0, 4, -2,
+  -17, -17, 3, 2, -15, 15, 10, 14, 7, -14, -3, 18, 17, -12, 11, -19,
+  -14, -16, 33, 32, -13, 2, -6, 36, -8, -10, 19, 20, 11, -31, -4, -31,
+  4, 3, 10, 11, 3, -7, -7, 6, -7, 4, 9, -2, -5, -5, -7, -1,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  3, 4, -28, -28, 3, 6, 11, -23, 11, 0, -19, -7, 0, 21, 10, 16,
+  -12, -11, -15, -16, -10, 16, 15, -4, 14, -11, -15, 10, 14, 4, 16, -5,
+  5, 4, 25, 26, 4, -13, -15, 17, -15, 6, 20, -2, -8, -15, -15, -7,
+  -5, -6, 28, 28, -5, -5, -10, 26, -11, -2, 19, 9, 2, -23, -9, -19,
+  15, 16, -18, -17, 14, -8, -1, -25, 0, 11, -8, -18, -14, 21, -4, 24,
+  -2, -2, 11, 11, -2, -2, -4, 10, -4, -1, 7, 4, 1, -9, -3, -7,
+  -12, -12, -12, -13, -11, 15, 14, -1, 12, -11, -13, 11, 14, 1, 15, -7,
+  -12, -11, -15, -16, -10, 16, 15, -4, 14, -11, -15, 10, 14, 4, 16, -5,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  24, 22, 56, 58, 21, -42, -43, 27, -40, 25, 49, -18, -33, -24, -44, -1,
+  -36, -36, -2, -5, -33, 35, 26, 24, 21, -31, -14, 38, 39, -20, 29, -37,
+  -28, -27, -4, -6, -25, 27, 20, 16, 17, -24, -12, 29, 30, -14, 23, -27,
+  -18, -18, 9, 8, -16, 14, 8, 19, 5, -14, 1, 20, 18, -17, 10, -23,
+  13, 14, -19, -18, 12, -6, 0, -24, 2, 10, -9, -16, -12, 21, -2, 23,
+  -14, -13, -13, -14, -12, 17, 15, -1, 14, -13, -14, 13, 16, 1, 16, -8,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  -14, -17, 69, 68, -14, -10, -24, 65, -26, -7, 46, 24, 6, -57, -20, -48,
+  -13, -13, 2, 1, -12, 12, 8, 11, 6, -11, -3, 14, 14, -9, 9, -15,
+  -2, -4, 29, 29, -2, -8, -12, 25, -13, 0, 21, 6, -1, -22, -11, -16,
+  20, 21, -42, -41, 18, -4, 7, -47, 10, 13, -24, -27, -16, 41, 4, 41,
+  -78, -78, -2, -7, -71, 74, 53, 53, 43, -66, -27, 83, 83, -46, 61, -82,
+  -32, -31, -23, -26, -29, 38, 33, 4, 29, -29, -28, 31, 37, -3, 36, -23,
+  -9, -6, -71, -72, -7, 32, 40, -50, 39, -13, -55, 0, 18, 44, 39, 24,
+  12, 13, -7, -6, 11, -9, -5, -14, -4, 10, -1, -14, -12, 12, -7, 16,
+  -14, -12, -43, -44, -12, 27, 30, -24, 28, -15, -36, 9, 20, 21, 30, 6,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  32, 34, -34, -32, 30, -19, -5, -50, -1, 25, -14, -39, -30, 43, -10, 51,
+  9, 9, 9, 10, 8, -12, -11, 1, -10, 9, 10, -9, -11, -1, -11, 6,
+  17, 18, -24, -23, 16, -8, 0, -31, 2, 12, -12, -21, -15, 27, -2, 29,
+};
+
+static const int8_t HIDDEN_W[] PROGMEM = {
+  43, 37, -18, -17, 37, -33, -20, -49, -15, 33, 2, -48, -41, 34, -24, 49,
+  -32, -42, -30, -31, -31, 43, 34, 10, 27, -28, -30, 32, 40, -7, 38, -29,
+  24, 18, 34, 31, 17, -32, -27, 17, -24, 22, 30, -16, -28, -15, -31, 6,
+  37, 36, -34, -30, 36, -25, -11, -38, -7, 30, -8, -37, -33, 40, -17, 49,
+  34, 36, -27, -31, 32, -23, -9, -36, -5, 27, -10, -43, -33, 45, -14, 35,
+  2, -4, 126, 127, 0, -44, -62, 100, -62, 11, 94, 16, -17, -87, -58, -58,
+  19, 17, 29, 32, 18, -30, -27, 13, -28, 18, 28, -18, -27, -14, -27, 6,
+  -29, -27, -35, -36, -29, 34, 39, -3, 27, -25, -39, 30, 36, 3, 41, -20,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  24, 19, 32, 34, 19, -32, -31, 16, -27, 20, 34, -19, -25, -14, -30, 6,
+  27, 32, -36, -31, 26, -16, -1, -52, 1, 21, -18, -41, -27, 36, -8, 57,
+  -30, -32, -28, -39, -28, 38, 38, -3, 37, -27, -29, 28, 36, 1, 35, -19,
+  35, 35, 11, 11, 33, -34, -27, -21, -27, 43, 21, -36, -42, 16, -33, 45,
+  4, 0, 44, 39, 2, -24, -22, 35, -28, 10, 30, 3, -9, -30, -30, -30,
+  -34, -34, 8, 1, -28, 33, 21, 45, 14, -23, -4, 38, 31, -38, 20, -40,
+  38, 39, -27, -26, 33, -26, -12, -45, -7, 29, -8, -38, -37, 37, -17, 47,
+};
+static const int32_t HIDDEN_B[] PROGMEM = {
+  4112, 9204, 4267, 3494, 3349, 6288, 3722, 10673, -734, 3837, 7381, 8886, 4825, 3713, 7958, 3353,
+};
+
+static const int8_t OUT_W[] PROGMEM = {
+  37, -30, 5, 38, 36, -63, 6, -27, 0, 4, 38, -28, 39, -20, -35, 45,
+  -52, 38, -35, -36, -33, -66, -35, 38, 0, -44, -23, 37, -40, -26, 28, -36,
+  -27, -26, 25, -34, -35, 127, 27, -39, 0, 29, -37, -35, 12, 32, 6, -31,
+};
+static const int32_t OUT_B[] PROGMEM = {
+  -1255, 941, 770,
+};
+
+const ClassifierModel CLASSIFIER_MODEL = {
+  EMBED, HIDDEN_W, HIDDEN_B, OUT_W, OUT_B, 1899998906, 38, 0.0004008515209327279f
+};
@@ -53,6 +53,12 @@
 // WebSocket
 #define DO_WS_URL "ws://" DO_DROPLET_IP ":8080/ws"
 
+// PEM root CA for wss:// endpoints; without one TLS is encrypted but the
+// server is not authenticated
+#ifndef WS_CA_CERT
+#define WS_CA_CERT nullptr
+#endif
+
 // Auth (optional)
 #ifndef DO_API_KEY
 #define DO_API_KEY "your-do-api-key"
@@ -90,7 +96,7 @@
 // Enclave endpoints (secure AI processing)
 #define ENCLAVE_API_URL "https://api.enclave.ai/v1"
 #define ENCLAVE_INFERENCE_URL ENCLAVE_API_URL "/inference"
-#define ENCLAVE_EMBEDDINGS_URL ENCLAVE_API_URL "/embeddings"
+#define ENCLAVE_EMBEDDINGS_URL ENCLAVE_API_URL "/embeddings"  // backend fills the hub's vector cache
 #define ENCLAVE_SECURE_CHAT_URL ENCLAVE_API_URL "/chat/secure"
 
 // Models
@@ -124,11 +130,26 @@
 #define CLOUD_OTA_CHECK_INTERVAL 3600000       // 1 hour
 #define CLOUD_STATUS_UPDATE_INTERVAL 60000     // 1 minute
 
-// Feature flags
-#define ENABLE_CLOUDFLARE true
-#define ENABLE_DIGITALOCEAN true
-#define ENABLE_HUGGINGFACE false  // Disabled by default (token required)
-#define ENABLE_ENCLAVE_AI false   // Disabled by default (token required)
+// Cached inference results are kept in NVS across reboots; build with
+// -DINFERENCE_CACHE_PERSIST=0 to keep them in RAM only
+#ifndef INFERENCE_CACHE_PERSIST
+#define INFERENCE_CACHE_PERSIST 1
+#endif
+
+// Feature flags; override per build with -DENABLE_<SERVICE>=0 or 1.
+// A disabled service is compiled out entirely (see cloud_services.h)
+#ifndef ENABLE_CLOUDFLARE
+#define ENABLE_CLOUDFLARE 1
+#endif
+#ifndef ENABLE_DIGITALOCEAN
+#define ENABLE_DIGITALOCEAN 1
+#endif
+#ifndef ENABLE_HUGGINGFACE
+#define ENABLE_HUGGINGFACE 0  // Disabled by default (token required)
+#endif
+#ifndef ENABLE_ENCLAVE_AI
+#define ENABLE_ENCLAVE_AI 0   // Disabled by default (token required)
+#endif
 
 // ══════════════════════════════════════════════════════════════════════════
 // HELPER MACROS
@@ -139,6 +160,7 @@
 #define CLOUD_SERVICE_HUGGINGFACE 0x04
 #define CLOUD_SERVICE_ENCLAVE_AI 0x08
 
-#define IS_CLOUD_ENABLED(service) ((service) && (ENABLE_##service))
+// Constant expression: usable in #if and if constexpr, e.g. IS_CLOUD_ENABLED(HUGGINGFACE)
+#define IS_CLOUD_ENABLED(service) (ENABLE_##service != 0)
 
 #endif // CLOUD_CONFIG_H
@@ -0,0 +1,60 @@
+/**
+ * ══════════════════════════════════════════════════════════════════════════
+ *                    🖤🛣️ CLOUD SERVICES 🛣️🖤
+ * ══════════════════════════════════════════════════════════════════════════
+ */
+
+#include "cloud_services.h"
+#include <string.h>
+
+#ifdef ARDUINO
+#include "commands.h"
+#include "inference_cache.h"
+#endif
+
+#if ENABLE_HUGGINGFACE || ENABLE_ENCLAVE_AI
+// Credentials still holding the cloud_config.h placeholders
+static bool placeholder(const char* secret) {
+  return strncmp(secret, "your-", 5) == 0;
+}
+#endif
+
+// Only enabled services are compiled; see the header
+
+#if ENABLE_CLOUDFLARE
+// The OTA manifest is public on Pages, so there is nothing to check yet
+bool CloudflareService::begin() {
+  return true;
+}
+#endif
+
+#if ENABLE_DIGITALOCEAN
+bool DigitalOceanService::begin() {
+#ifdef ARDUINO
+  commandHttpBegin(DO_COMMANDS_ENDPOINT, DO_API_KEY);
+#endif
+  return true;
+}
+#endif
+
+#if ENABLE_HUGGINGFACE
+bool HuggingFaceService::begin() {
+  if (placeholder(HF_API_TOKEN)) return false;
+#ifdef ARDUINO
+  inferenceHttpRoute(INFER_SUMMARY, HF_SUMMARIZATION_URL, HF_API_TOKEN);
+  inferenceHttpRoute(INFER_ANSWER, HF_QA_URL, HF_API_TOKEN);
+  inferenceHttpRoute(INFER_SENTIMENT, HF_SENTIMENT_URL, HF_API_TOKEN);
+#endif
+  return true;
+}
+#endif
+
+#if ENABLE_ENCLAVE_AI
+bool EnclaveAiService::begin() {
+  if (placeholder(ENCLAVE_API_KEY)) return false;
+#ifdef ARDUINO
+  inferenceHttpRoute(INFER_CHAT, ENCLAVE_SECURE_CHAT_URL, ENCLAVE_API_KEY);
+#endif
+  return true;
+}
+#endif
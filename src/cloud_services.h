@@ -0,0 +1,107 @@
+/**
+ * ══════════════════════════════════════════════════════════════════════════
+ *                    🖤🛣️ CLOUD SERVICES 🛣️🖤
+ * ══════════════════════════════════════════════════════════════════════════
+ *
+ * Each cloud integration is a policy: its ENABLE_* switch from
+ * cloud_config.h, a name, and a begin() that starts its client. Nothing
+ * calls a policy except under `if constexpr (Service::enabled)`, so a
+ * disabled service's code, strings, buffers and libraries are never
+ * referenced and --gc-sections drops them from the image. Its begin() is
+ * not even compiled, which turns a stray ungated call into a link error.
+ *
+ *   if constexpr (DigitalOceanService::enabled) commandHttpPost(id, json);
+ *
+ * Switch a service off per build with -DENABLE_<SERVICE>=0.
+ *
+ * CloudLayer::begin() starts the enabled services in list order and
+ * records how long each took and how much heap it claimed (task stacks,
+ * queues, TLS contexts), shown by the `cloud` serial command. Flash and
+ * static RAM per service come from tools/footprint_report.py, which
+ * builds with each service switched off and diffs the sizes.
+ */
+
+#ifndef CLOUD_SERVICES_H
+#define CLOUD_SERVICES_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "cloud_config.h"
+
+// ══════════════════════════════════════════════════════════════════════════
+// SERVICE POLICIES
+// ══════════════════════════════════════════════════════════════════════════
+
+// begin() returns false when the service is compiled in but cannot start
+// (e.g. its credentials are still the placeholders)
+
+struct CloudflareService {
+  static constexpr bool enabled = ENABLE_CLOUDFLARE;
+  static constexpr const char* name = "cloudflare";
+  static bool begin();
+};
+
+struct DigitalOceanService {
+  static constexpr bool enabled = ENABLE_DIGITALOCEAN;
+  static constexpr const char* name = "digitalocean";
+  static bool begin();  // starts the command HTTP worker
+};
+
+struct HuggingFaceService {
+  static constexpr bool enabled = ENABLE_HUGGINGFACE;
+  static constexpr const char* name = "huggingface";
+  static bool begin();  // inference routes, sentiment included, given a token
+};
+
+struct EnclaveAiService {
+  static constexpr bool enabled = ENABLE_ENCLAVE_AI;
+  static constexpr const char* name = "enclave-ai";
+  static bool begin();  // routes secure chat through the inference worker
+};
+
+// ══════════════════════════════════════════════════════════════════════════
+// LAYER
+// ══════════════════════════════════════════════════════════════════════════
+
+struct CloudFootprint {
+  const char* name;
+  bool enabled;      // compiled in
+  bool started;      // begin() succeeded
+  uint32_t beginUs;
+  int32_t heapBytes; // free heap taken by begin()
+};
+
+template <typename... Services>
+class CloudLayer {
+ public:
+  static constexpr size_t count = sizeof...(Services);
+  static constexpr size_t enabledCount = (size_t(Services::enabled) + ... + 0);
+
+  // Clock and heap gauge are passed in to keep the layer host-compilable
+  void begin(uint32_t (*nowUs)(), uint32_t (*freeHeap)()) {
+    size_t i = 0;
+    (beginOne<Services>(footprints[i++], nowUs, freeHeap), ...);
+  }
+
+  const CloudFootprint& footprint(size_t i) const { return footprints[i]; }
+
+ private:
+  CloudFootprint footprints[count] = {};
+
+  template <typename Service>
+  static void beginOne(CloudFootprint& f, uint32_t (*nowUs)(), uint32_t (*freeHeap)()) {
+    f.name = Service::name;
+    f.enabled = Service::enabled;
+    if constexpr (Service::enabled) {
+      uint32_t heapBefore = freeHeap();
+      uint32_t start = nowUs();
+      f.started = Service::begin();
+      f.beginUs = nowUs() - start;
+      f.heapBytes = (int32_t)(heapBefore - freeHeap());
+    }
+  }
+};
+
+typedef CloudLayer<CloudflareService, DigitalOceanService, HuggingFaceService, EnclaveAiService> Cloud;
+
+#endif // CLOUD_SERVICES_H
@@ -0,0 +1,23 @@
+/**
+ * ══════════════════════════════════════════════════════════════════════════
+ *                    🖤🛣️ BLACKROAD OFFICIAL BRAND COLORS 🛣️🖤
+ * ══════════════════════════════════════════════════════════════════════════
+ *
+ * RGB565 palette shared by every screen and UI component.
+ */
+
+#ifndef COLORS_H
+#define COLORS_H
+
+#define COLOR_HOT_PINK   0xF8B6  // #FF1D6C
+#define COLOR_AMBER      0xFD20  // #F5A623
+#define COLOR_BLUE       0x24DF  // #2979FF
+#define COLOR_VIOLET     0x9136  // #9C27B0
+#define COLOR_BLACK      0x0000
+#define COLOR_WHITE      0xFFFF
+#define COLOR_DARK_GRAY  0x2104
+#define COLOR_LIGHT_GRAY 0x7BEF
+#define COLOR_GREEN      0x07E0
+#define COLOR_RED        0xF800
+
+#endif // COLORS_H
@@ -0,0 +1,243 @@
+/**
+ * ══════════════════════════════════════════════════════════════════════════
+ *                    🖤🛣️ COMMAND CHANNEL 🛣️🖤
+ * ══════════════════════════════════════════════════════════════════════════
+ */
+
+#include "commands.h"
+#include "logger.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#define MS_TO_US(ms) ((uint32_t)(ms) * 1000u)
+
+static const char* const kindNames[CMD_KINDS] = { "deploy", "restartGroup" };
+static const char* const routeNames[CMD_ROUTES] = { "ws", "http" };
+
+static inline bool reached(uint32_t now, uint32_t at) {
+  return (int32_t)(now - at) >= 0;
+}
+
+const char* commandKindName(CommandKind kind) {
+  return kind < CMD_KINDS ? kindNames[kind] : "?";
+}
+
+void CommandQueue::begin(CommandSink* commandSink, CommandListener onChange, uint32_t firstId) {
+  sink = commandSink;
+  listener = onChange;
+  nextId = firstId ? firstId : 1;
+  memset(slots, 0, sizeof(slots));
+  resetStats();
+}
+
+void CommandQueue::resetStats() {
+  counters = {};
+  for (LogHistogram& h : counters.latencyUs) h.reset();
+}
+
+uint32_t CommandQueue::submit(CommandKind kind, uint32_t target, uint32_t nowUs) {
+  // A free slot, else the oldest finished one; pending commands are never dropped
+  Command* cmd = nullptr;
+  for (Command& c : slots) {
+    if (c.state == CMD_FREE) {
+      cmd = &c;
+      break;
+    }
+    if (c.state != CMD_PENDING && (!cmd || (int32_t)(c.deadlineUs - cmd->deadlineUs) < 0)) cmd = &c;
+  }
+  if (!cmd) return 0;
+
+  memset(cmd, 0, sizeof(*cmd));
+  cmd->id = nextId++;
+  if (nextId == 0) nextId = 1;
+  cmd->kind = kind;
+  cmd->target = target;
+  cmd->state = CMD_PENDING;
+  cmd->submittedUs = nowUs;
+  counters.submitted++;
+
+  if (listener) listener(*cmd);  // optimistic: the UI changes before the wire
+  attempt(*cmd, nowUs, false);
+  return cmd->id;
+}
+
+void CommandQueue::attempt(Command& cmd, uint32_t nowUs, bool avoidWs) {
+  char json[CMD_JSON_MAX];
+  snprintf(json, sizeof(json), "{\"type\":\"command\",\"id\":%lu,\"cmd\":\"%s\",\"target\":%lu,\"attempt\":%u}",
+    (unsigned long)cmd.id, commandKindName(cmd.kind), (unsigned long)cmd.target, (unsigned)(cmd.attempts + 1));
+
+  cmd.attempts++;
+  bool sent = false;
+  if (!avoidWs && sink->wsUp() && sink->send(CMD_VIA_WS, cmd.id, json)) {
+    cmd.route = CMD_VIA_WS;
+    sent = true;
+  } else if (sink->send(CMD_VIA_HTTP, cmd.id, json)) {
+    cmd.route = CMD_VIA_HTTP;
+    sent = true;
+  }
+
+  if (sent) {
+    counters.sent[cmd.route]++;
+    if (cmd.attempts == 1) {
+      LOG(CMD_SENT, (unsigned long)cmd.id, commandKindName(cmd.kind), (unsigned long)cmd.target, routeNames[cmd.route]);
+    } else {
+      LOG(CMD_RETRY, (unsigned long)cmd.id, (unsigned)cmd.attempts, routeNames[cmd.route]);
+    }
+    cmd.deadlineUs = nowUs + MS_TO_US(cmd.route == CMD_VIA_WS ? CMD_WS_TIMEOUT_MS : CMD_HTTP_TIMEOUT_MS);
+  } else {
+    // No route at all; wait a WebSocket timeout and try again
+    counters.unsent++;
+    cmd.deadlineUs = nowUs + MS_TO_US(CMD_WS_TIMEOUT_MS);
+  }
+}
+
+void CommandQueue::finish(Command& cmd, CommandState state, const char* error, uint32_t nowUs) {
+  cmd.state = state;
+  cmd.deadlineUs = nowUs + MS_TO_US(CMD_LINGER_MS);
+  if (error) {
+    strncpy(cmd.error, error, CMD_ERROR_LEN - 1);
+    cmd.error[CMD_ERROR_LEN - 1] = '\0';
+  }
+  if (state == CMD_ACKED) {
+    counters.acked++;
+    LOG(CMD_ACKED, (unsigned long)cmd.id, (unsigned long)(cmd.latencyUs / 1000), routeNames[cmd.route]);
+  } else {
+    counters.failed++;
+    LOG(CMD_FAILED, (unsigned long)cmd.id, cmd.error);
+  }
+  if (listener) listener(cmd);
+}
+
+uint32_t CommandQueue::service(uint32_t nowUs) {
+  uint32_t next = 0;
+  for (Command& cmd : slots) {
+    if (cmd.state == CMD_FREE) continue;
+
+    if (reached(nowUs, cmd.deadlineUs)) {
+      if (cmd.state != CMD_PENDING) {
+        cmd.state = CMD_FREE;  // shown long enough
+        if (listener) listener(cmd);
+        continue;
+      }
+      counters.timeouts++;
+      if (cmd.attempts >= CMD_MAX_ATTEMPTS) {
+        finish(cmd, CMD_FAILED, "no answer", nowUs);
+      } else {
+        // An unanswered WebSocket attempt suggests a half-dead link: go HTTP
+        counters.retries++;
+        attempt(cmd, nowUs, cmd.route == CMD_VIA_WS);
+      }
+    }
+
+    uint32_t wait = cmd.deadlineUs - nowUs;
+    if (next == 0 || wait < next) next = wait ? wait : 1;
+  }
+  return next;
+}
+
+void CommandQueue::onAck(uint32_t id, bool ok, const char* error, uint32_t nowUs) {
+  for (Command& cmd : slots) {
+    if (cmd.state != CMD_PENDING || cmd.id != id) continue;
+    cmd.latencyUs = nowUs - cmd.submittedUs;
+    counters.latencyUs[cmd.route].record(cmd.latencyUs);
+    finish(cmd, ok ? CMD_ACKED : CMD_FAILED, ok ? nullptr : (error ? error : "rejected"), nowUs);
+    return;
+  }
+  counters.stray++;
+}
+
+const Command* CommandQueue::find(CommandKind kind, uint32_t target) const {
+  const Command* latest = nullptr;
+  for (const Command& cmd : slots) {
+    if (cmd.state == CMD_FREE || cmd.kind != kind || cmd.target != target) continue;
+    if (!latest || (int32_t)(cmd.id - latest->id) > 0) latest = &cmd;
+  }
+  return latest;
+}
+
+// ══════════════════════════════════════════════════════════════════════════
+// HTTP FALLBACK
+// ══════════════════════════════════════════════════════════════════════════
+
+#ifdef ARDUINO
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include <HTTPClient.h>
+#include <WiFi.h>
+#include "idle.h"
+
+#define HTTP_TASK_STACK    6144
+#define HTTP_TASK_PRIORITY 1
+#define HTTP_TASK_CORE     0
+#define HTTP_QUEUE_DEPTH   4
+#define HTTP_REQUEST_MS    5000   // below CMD_HTTP_TIMEOUT_MS, so a reply is never late
+
+struct HttpRequest {
+  uint32_t id;
+  char json[CMD_JSON_MAX];
+};
+
+static QueueHandle_t requests = nullptr;
+static QueueHandle_t results = nullptr;
+static const char* postUrl = nullptr;
+static const char* postKey = nullptr;
+
+static void report(uint32_t id, bool ok, const char* error) {
+  CommandHttpResult r = { id, ok, "" };
+  if (error) strncpy(r.error, error, CMD_ERROR_LEN - 1);
+  xQueueSend(results, &r, 0);
+  idleNotify();
+}
+
+// Blocking POSTs, one at a time, off the loop task
+static void httpWorker(void*) {
+  HttpRequest req;
+  for (;;) {
+    if (xQueueReceive(requests, &req, portMAX_DELAY) != pdTRUE) continue;
+
+    HTTPClient http;
+    http.setTimeout(HTTP_REQUEST_MS);
+    http.setConnectTimeout(HTTP_REQUEST_MS);
+    if (!http.begin(postUrl)) continue;
+    http.addHeader("Content-Type", "application/json");
+    if (postKey && *postKey) http.addHeader("Authorization", String("Bearer ") + postKey);
+
+    int status = http.POST((uint8_t*)req.json, strlen(req.json));
+    if (status >= 200 && status < 300) {
+      JsonDocument doc;
+      if (!deserializeJson(doc, http.getString())) {
+        report(doc["id"] | req.id, doc["ok"] | false, doc["error"] | "rejected");
+      }
+    } else if (status >= 400 && status < 500) {
+      // The server looked at it and said no; retrying will not help
+      char error[CMD_ERROR_LEN];
+      snprintf(error, sizeof(error), "HTTP %d", status);
+      report(req.id, false, error);
+    }
+    // Transport errors and 5xx stay unanswered; the command times out and retries
+    http.end();
+  }
+}
+
+void commandHttpBegin(const char* url, const char* apiKey) {
+  postUrl = url;
+  postKey = apiKey;
+  requests = xQueueCreate(HTTP_QUEUE_DEPTH, sizeof(HttpRequest));
+  results = xQueueCreate(HTTP_QUEUE_DEPTH, sizeof(CommandHttpResult));
+  xTaskCreatePinnedToCore(httpWorker, "cmdHttp", HTTP_TASK_STACK, nullptr,
+    HTTP_TASK_PRIORITY, nullptr, HTTP_TASK_CORE);
+}
+
+bool commandHttpPost(uint32_t id, const char* json) {
+  if (!requests || WiFi.status() != WL_CONNECTED) return false;
+  HttpRequest req = { id, "" };
+  strncpy(req.json, json, CMD_JSON_MAX - 1);
+  return xQueueSend(requests, &req, 0) == pdTRUE;
+}
+
+bool commandHttpResult(CommandHttpResult& out) {
+  return results && xQueueReceive(results, &out, 0) == pdTRUE;
+}
+
+#endif
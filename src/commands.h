@@ -0,0 +1,147 @@
+/**
+ * ══════════════════════════════════════════════════════════════════════════
+ *                    🖤🛣️ COMMAND CHANNEL 🛣️🖤
+ * ══════════════════════════════════════════════════════════════════════════
+ *
+ * Sends commands (deploy a project, restart an agent group) to the
+ * backend and tracks each until the server answers.
+ *
+ *   → {"type":"command","id":17,"cmd":"deploy","target":4242,"attempt":1}
+ *   ← {"type":"commandAck","id":17,"ok":true}
+ *   ← {"type":"commandAck","id":17,"ok":false,"error":"build failed"}
+ *
+ * The command goes over the open WebSocket. Without one, or after a
+ * WebSocket attempt went unanswered, it is POSTed to the HTTP commands
+ * endpoint instead, and the response body is the same ack. Every attempt
+ * reuses the command's ID, so the server must treat a repeated ID as the
+ * same command. A late ack for an earlier attempt still counts.
+ *
+ * The UI is optimistic: the listener hears about a command the moment it
+ * is submitted (PENDING), again when it is ACKED or FAILED, and once more
+ * when it is released (FREE). A failure is an error ack, or
+ * CMD_MAX_ATTEMPTS attempts without one. Finished commands stay visible
+ * for CMD_LINGER_MS before they are released.
+ * Round-trip latency is measured from submit to ack, per route.
+ *
+ * Pure logic: times are passed in and transports sit behind CommandSink.
+ * Only the HTTP worker task is ESP32-specific.
+ */
+
+#ifndef COMMANDS_H
+#define COMMANDS_H
+
+#include <stdint.h>
+#include "histogram.h"
+
+#define CMD_SLOTS          8
+#define CMD_ERROR_LEN      40
+#define CMD_JSON_MAX       128
+#define CMD_WS_TIMEOUT_MS  2000   // per WebSocket attempt
+#define CMD_HTTP_TIMEOUT_MS 6000  // per HTTP attempt, request timeout included
+#define CMD_MAX_ATTEMPTS   3
+#define CMD_LINGER_MS      4000   // finished commands stay on screen
+
+enum CommandKind : uint8_t {
+  CMD_DEPLOY = 0,        // target: project ID
+  CMD_RESTART_GROUP,     // target: agent group index
+  CMD_KINDS
+};
+
+enum CommandState : uint8_t {
+  CMD_FREE = 0,
+  CMD_PENDING,
+  CMD_ACKED,
+  CMD_FAILED
+};
+
+enum CommandRoute : uint8_t {
+  CMD_VIA_WS = 0,
+  CMD_VIA_HTTP,
+  CMD_ROUTES
+};
+
+struct Command {
+  uint32_t id;
+  uint32_t target;
+  CommandKind kind;
+  CommandState state;
+  CommandRoute route;      // of the latest attempt
+  uint8_t attempts;
+  uint32_t submittedUs;
+  uint32_t deadlineUs;     // attempt timeout while pending, slot release after
+  uint32_t latencyUs;      // submit -> ack
+  char error[CMD_ERROR_LEN];
+};
+
+struct CommandStats {
+  uint32_t submitted;
+  uint32_t acked;
+  uint32_t failed;
+  uint32_t timeouts;       // attempts that got no answer in time
+  uint32_t retries;
+  uint32_t unsent;         // attempts no route would take
+  uint32_t stray;          // acks for unknown or finished IDs
+  uint32_t sent[CMD_ROUTES];
+  LogHistogram latencyUs[CMD_ROUTES];  // by the route that got the ack
+};
+
+// Transport for one attempt; false when that route is unavailable
+class CommandSink {
+ public:
+  virtual ~CommandSink() {}
+  virtual bool wsUp() = 0;
+  virtual bool send(CommandRoute route, uint32_t id, const char* json) = 0;
+};
+
+typedef void (*CommandListener)(const Command& cmd);
+
+const char* commandKindName(CommandKind kind);
+
+class CommandQueue {
+ public:
+  // IDs count up from firstId; seed it randomly so a reboot does not
+  // reuse the IDs of commands sent before it
+  void begin(CommandSink* sink, CommandListener listener, uint32_t firstId);
+
+  // Sends now; returns the command ID, 0 when every slot is busy
+  uint32_t submit(CommandKind kind, uint32_t target, uint32_t nowUs);
+
+  // Timeouts, retries and slot release; returns µs until the next
+  // deadline, 0 when nothing is left to watch
+  uint32_t service(uint32_t nowUs);
+
+  // Server answer from either route; error may be null
+  void onAck(uint32_t id, bool ok, const char* error, uint32_t nowUs);
+
+  // Latest command for this target, or null
+  const Command* find(CommandKind kind, uint32_t target) const;
+  const Command& slot(uint8_t i) const { return slots[i]; }
+  const CommandStats& stats() const { return counters; }
+  void resetStats();
+
+ private:
+  CommandSink* sink = nullptr;
+  CommandListener listener = nullptr;
+  Command slots[CMD_SLOTS] = {};
+  uint32_t nextId = 1;
+  CommandStats counters = {};
+
+  void attempt(Command& cmd, uint32_t nowUs, bool avoidWs);
+  void finish(Command& cmd, CommandState state, const char* error, uint32_t nowUs);
+};
+
+#ifdef ARDUINO
+struct CommandHttpResult {
+  uint32_t id;
+  bool ok;
+  char error[CMD_ERROR_LEN];
+};
+
+// Worker task that POSTs command JSON to `url`; results come back
+// through commandHttpResult() and wake the loop via idleNotify()
+void commandHttpBegin(const char* url, const char* apiKey);
+bool commandHttpPost(uint32_t id, const char* json);
+bool commandHttpResult(CommandHttpResult& out);
+#endif
+
+#endif // COMMANDS_H
@@ -0,0 +1,170 @@
+/**
+ * ══════════════════════════════════════════════════════════════════════════
+ *                    🖤🛣️ ALLOCATION-FREE FORMATTING 🛣️🖤
+ * ══════════════════════════════════════════════════════════════════════════
+ */
+
+#include "fmt.h"
+
+// Bounded appender: silently truncates, always leaves room for '\0'
+struct FmtWriter {
+  char* out;
+  size_t size;
+  size_t len;
+
+  FmtWriter(char* o, size_t s) : out(o), size(s), len(0) {
+    if (size) out[0] = '\0';
+  }
+
+  void put(char c) {
+    if (len + 1 < size) {
+      out[len++] = c;
+      out[len] = '\0';
+    }
+  }
+
+  void str(const char* s) {
+    while (*s) put(*s++);
+  }
+
+  void uint(uint32_t v, uint8_t minDigits = 1) {
+    char digits[10];
+    uint8_t n = 0;
+    do {
+      digits[n++] = '0' + (v % 10);
+      v /= 10;
+    } while (v);
+    while (n < minDigits && n < sizeof(digits)) digits[n++] = '0';
+    while (n) put(digits[--n]);
+  }
+};
+
+static const uint32_t pow10Table[] = { 1, 10, 100, 1000, 10000, 100000, 1000000 };
+
+// Value with one decimal and a unit suffix, e.g. "30.2K"
+static void unitTenths(FmtWriter& w, uint64_t tenths, const char* unit) {
+  w.uint((uint32_t)(tenths / 10));
+  w.put('.');
+  w.put('0' + (char)(tenths % 10));
+  w.str(unit);
+}
+
+// Picks the largest unit that keeps the mantissa below 1000.0 after rounding
+static void scaled(FmtWriter& w, uint32_t value, uint32_t base, const char* const* units, uint8_t unitCount) {
+  uint64_t div = base;
+  for (uint8_t u = 1; u < unitCount; u++) {
+    uint64_t tenths = ((uint64_t)value * 10 + div / 2) / div;
+    if (tenths < 10000 || u == unitCount - 1) {
+      unitTenths(w, tenths, units[u]);
+      return;
+    }
+    div *= base;
+  }
+}
+
+size_t fmtUint(char* out, size_t size, uint32_t value) {
+  FmtWriter w(out, size);
+  w.uint(value);
+  return w.len;
+}
+
+size_t fmtInt(char* out, size_t size, int32_t value) {
+  FmtWriter w(out, size);
+  uint32_t mag = (uint32_t)value;
+  if (value < 0) {
+    w.put('-');
+    mag = 0u - mag;
+  }
+  w.uint(mag);
+  return w.len;
+}
+
+static void fixed(FmtWriter& w, bool negative, uint32_t mag, uint8_t decimals) {
+  if (negative) w.put('-');
+  uint32_t div = pow10Table[decimals];
+  w.uint(mag / div);
+  if (decimals) {
+    w.put('.');
+    w.uint(mag % div, decimals);
+  }
+}
+
+size_t fmtFixed(char* out, size_t size, int32_t scaledValue, uint8_t decimals) {
+  FmtWriter w(out, size);
+  if (decimals > 6) decimals = 6;
+  uint32_t mag = (uint32_t)scaledValue;
+  if (scaledValue < 0) mag = 0u - mag;
+  fixed(w, scaledValue < 0, mag, decimals);
+  return w.len;
+}
+
+size_t fmtFloat(char* out, size_t size, float value, uint8_t decimals) {
+  FmtWriter w(out, size);
+  if (decimals > 6) decimals = 6;
+  if (value != value) {  // NaN
+    w.str("nan");
+    return w.len;
+  }
+
+  // Like printf, a negative value that rounds to zero keeps its sign
+  bool negative = value < 0;
+  float s = (negative ? -value : value) * (float)pow10Table[decimals] + 0.5f;
+  uint32_t mag = s < 4294967040.0f ? (uint32_t)s : UINT32_MAX;
+  fixed(w, negative, mag, decimals);
+  return w.len;
+}
+
+size_t fmtSI(char* out, size_t size, uint32_t value) {
+  static const char* const units[] = { "", "K", "M", "G" };
+  FmtWriter w(out, size);
+  if (value < 1000) {
+    w.uint(value);
+  } else {
+    scaled(w, value, 1000, units, 4);
+  }
+  return w.len;
+}
+
+size_t fmtBytes(char* out, size_t size, uint32_t bytes) {
+  static const char* const units[] = { "B", "KB", "MB", "GB" };
+  FmtWriter w(out, size);
+  if (bytes < 1024) {
+    w.uint(bytes);
+    w.put('B');
+  } else {
+    scaled(w, bytes, 1024, units, 4);
+  }
+  return w.len;
+}
+
+size_t fmtDuration(char* out, size_t size, uint32_t seconds) {
+  FmtWriter w(out, size);
+  uint32_t days = seconds / 86400;
+  uint32_t hours = (seconds / 3600) % 24;
+  uint32_t minutes = (seconds / 60) % 60;
+  uint32_t secs = seconds % 60;
+
+  if (days) {
+    w.uint(days); w.str("d ");
+    w.uint(hours); w.str("h ");
+    w.uint(minutes); w.put('m');
+  } else if (hours) {
+    w.uint(hours); w.str("h ");
+    w.uint(minutes); w.put('m');
+  } else if (minutes) {
+    w.uint(minutes); w.str("m ");
+    w.uint(secs); w.put('s');
+  } else {
+    w.uint(secs); w.put('s');
+  }
+  return w.len;
+}
+
+size_t fmtIPv4(char* out, size_t size, const uint8_t octets[4]) {
+  FmtWriter w(out, size);
+  for (int i = 0; i < 4; i++) {
+    if (i) w.put('.');
+    w.uint(octets[i]);
+  }
+  return w.len;
+}
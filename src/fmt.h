@@ -0,0 +1,41 @@
+/**
+ * ══════════════════════════════════════════════════════════════════════════
+ *                    🖤🛣️ ALLOCATION-FREE FORMATTING 🛣️🖤
+ * ══════════════════════════════════════════════════════════════════════════
+ *
+ * Number formatting into caller-provided buffers. Replaces the Arduino
+ * String based formatNumber()/formatBytes() and the %f printf paths, which
+ * churn (and eventually fragment) the heap on every redraw.
+ *
+ * Every function writes at most `size` bytes including the terminator,
+ * always NUL-terminates (when size > 0), truncates instead of overflowing
+ * and returns the number of characters written.
+ */
+
+#ifndef FMT_H
+#define FMT_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Big enough for any single value produced below
+#define FMT_BUF_SIZE 24
+
+size_t fmtUint(char* out, size_t size, uint32_t value);
+size_t fmtInt(char* out, size_t size, int32_t value);
+
+// `scaled` holds the value times 10^decimals: fmtFixed(buf, n, 4200, 4) -> "0.4200"
+size_t fmtFixed(char* out, size_t size, int32_t scaled, uint8_t decimals);
+// Rounds to `decimals` (max 6) and formats without touching printf's dtoa
+size_t fmtFloat(char* out, size_t size, float value, uint8_t decimals);
+
+// 950 -> "950", 30247 -> "30.2K", 1500000 -> "1.5M"
+size_t fmtSI(char* out, size_t size, uint32_t value);
+// 512 -> "512B", 2048 -> "2.0KB", 3145728 -> "3.0MB"
+size_t fmtBytes(char* out, size_t size, uint32_t bytes);
+// 42 -> "42s", 125 -> "2m 5s", 7260 -> "2h 1m", 90061 -> "1d 1h 1m"
+size_t fmtDuration(char* out, size_t size, uint32_t seconds);
+// {192,168,4,74} -> "192.168.4.74"
+size_t fmtIPv4(char* out, size_t size, const uint8_t octets[4]);
+
+#endif // FMT_H
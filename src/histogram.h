@@ -0,0 +1,95 @@
+/**
+ * ══════════════════════════════════════════════════════════════════════════
+ *                    🖤🛣️ LOG-SCALE HISTOGRAM 🛣️🖤
+ * ══════════════════════════════════════════════════════════════════════════
+ *
+ * Fixed-size log-linear histogram for timing data (µs, cycles, ...).
+ * Values 0..3 get their own bucket, every power of two above that is split
+ * into 4 sub-buckets, so any bucket is at most 25% wide. The default 96
+ * buckets cover 0 .. 2^25-1 (the last is 7 * 2^22 .. 2^25-1),
+ * HISTOGRAM_BUCKETS_FULL covers all of uint32_t; values past the range
+ * land in the last bucket.
+ *
+ * No heap, no floats on the record path - safe to call from hot code.
+ */
+
+#ifndef HISTOGRAM_H
+#define HISTOGRAM_H
+
+#include <stdint.h>
+#include <string.h>
+
+#define HISTOGRAM_SUB_BITS 2
+#define HISTOGRAM_SUB_COUNT (1 << HISTOGRAM_SUB_BITS)
+#define HISTOGRAM_BUCKETS 96
+#define HISTOGRAM_BUCKETS_FULL 124
+
+template <uint8_t BUCKETS>
+struct LogHistogramT {
+  uint32_t buckets[BUCKETS];
+  uint32_t count;
+  uint32_t minValue;
+  uint32_t maxValue;
+  uint64_t sum;
+
+  void reset() {
+    memset(buckets, 0, sizeof(buckets));
+    count = 0;
+    minValue = UINT32_MAX;
+    maxValue = 0;
+    sum = 0;
+  }
+
+  static uint8_t bucketFor(uint32_t value) {
+    if (value < HISTOGRAM_SUB_COUNT) return (uint8_t)value;
+    uint8_t msb = 31 - __builtin_clz(value);
+    uint8_t sub = (value >> (msb - HISTOGRAM_SUB_BITS)) & (HISTOGRAM_SUB_COUNT - 1);
+    uint32_t idx = HISTOGRAM_SUB_COUNT + (msb - HISTOGRAM_SUB_BITS) * HISTOGRAM_SUB_COUNT + sub;
+    return idx < BUCKETS ? (uint8_t)idx : BUCKETS - 1;
+  }
+
+  // Smallest value that maps to bucket idx
+  static uint32_t bucketLow(uint8_t idx) {
+    if (idx < HISTOGRAM_SUB_COUNT) return idx;
+    uint8_t msb = (idx - HISTOGRAM_SUB_COUNT) / HISTOGRAM_SUB_COUNT + HISTOGRAM_SUB_BITS;
+    uint32_t sub = (idx - HISTOGRAM_SUB_COUNT) % HISTOGRAM_SUB_COUNT;
+    return (1UL << msb) + (sub << (msb - HISTOGRAM_SUB_BITS));
+  }
+
+  void record(uint32_t value) {
+    buckets[bucketFor(value)]++;
+    count++;
+    sum += value;
+    if (value < minValue) minValue = value;
+    if (value > maxValue) maxValue = value;
+  }
+
+  // Approximate quantile (q in 0..1000 permille), bucket midpoint clamped to min/max
+  uint32_t percentile(uint16_t permille) const {
+    if (count == 0) return 0;
+    uint32_t target = ((uint64_t)count * permille + 999) / 1000;
+    if (target == 0) target = 1;
+
+    uint32_t seen = 0;
+    for (uint8_t i = 0; i < BUCKETS; i++) {
+      seen += buckets[i];
+      if (seen >= target) {
+        uint32_t lo = bucketLow(i);
+        uint32_t hi = (i + 1 < BUCKETS) ? bucketLow(i + 1) - 1 : maxValue;
+        uint32_t mid = lo + (hi - lo) / 2;
+        if (mid < minValue) mid = minValue;
+        if (mid > maxValue) mid = maxValue;
+        return mid;
+      }
+    }
+    return maxValue;
+  }
+
+  uint32_t mean() const {
+    return count ? (uint32_t)(sum / count) : 0;
+  }
+};
+
+typedef LogHistogramT<HISTOGRAM_BUCKETS> LogHistogram;
+
+#endif // HISTOGRAM_H
@@ -0,0 +1,128 @@
+// Generated by tools/asset_compiler.py from assets/icons - do not edit
+
+#include "icon_data.h"
+
+static const uint16_t ICON_AI_PALETTE[] PROGMEM = {
+  0x0000, 0xE56B, 0xF7BE, 0xFFFF, 0xFFDF, 0xCF1F, 0x64DF, 0x2BBF, 0xDF3E, 0x2251, 0xBE3A
+};
+static const uint8_t ICON_AI_DATA[] PROGMEM = {
+  0x80, 0x11, 0xF0, 0x10, 0x11, 0xF0, 0x20, 0x02, 0xF0, 0x20, 0x03, 0xC0, 0xC3, 0x50, 0xE3, 0x30,
+  0x43, 0x04, 0x43, 0x04, 0x33, 0x30, 0x23, 0x05, 0x06, 0x07, 0x05, 0x13, 0x05, 0x06, 0x07, 0x05,
+  0x23, 0x30, 0x13, 0x04, 0x06, 0x27, 0x08, 0x03, 0x06, 0x27, 0x08, 0x13, 0x30, 0x13, 0x02, 0x37,
+  0x05, 0x03, 0x37, 0x05, 0x13, 0x30, 0x23, 0x05, 0x17, 0x06, 0x13, 0x05, 0x17, 0x06, 0x23, 0x30,
+  0x33, 0x08, 0x05, 0x33, 0x08, 0x05, 0x33, 0x30, 0x43, 0x04, 0x42, 0x43, 0x30, 0x13, 0x04, 0x03,
+  0x02, 0x59, 0x0A, 0x03, 0x04, 0x13, 0x30, 0x13, 0x04, 0x03, 0x04, 0x5A, 0x02, 0x33, 0x30, 0xF3,
+  0x40, 0xD3, 0xF0, 0xF0, 0xF0, 0xE0,
+};
+const Icon ICON_AI = { 20, 20, ICON_RLE4, 11, ICON_AI_PALETTE, ICON_AI_DATA, 102 };
+
+static const uint16_t ICON_DOT_DEGRADED_PALETTE[] PROGMEM = {
+  0x0000, 0xF544, 0xFD64, 0xF524
+};
+static const uint8_t ICON_DOT_DEGRADED_DATA[] PROGMEM = {
+  0x10, 0x31, 0x20, 0x01, 0x02, 0x13, 0x02, 0x01, 0x00, 0x03, 0x02, 0x33, 0x02, 0xF3, 0x13, 0x02,
+  0x33, 0x02, 0x03, 0x00, 0x01, 0x02, 0x13, 0x02, 0x01, 0x20, 0x31, 0x10,
+};
+const Icon ICON_DOT_DEGRADED = { 8, 8, ICON_RLE4, 4, ICON_DOT_DEGRADED_PALETTE, ICON_DOT_DEGRADED_DATA, 28 };
+
+static const uint16_t ICON_DOT_OFFLINE_PALETTE[] PROGMEM = {
+  0x0000, 0xF800
+};
+static const uint8_t ICON_DOT_OFFLINE_DATA[] PROGMEM = {
+  0x10, 0x31, 0x20, 0x51, 0x00, 0xF1, 0xF1, 0x00, 0x51, 0x20, 0x31, 0x10,
+};
+const Icon ICON_DOT_OFFLINE = { 8, 8, ICON_RLE4, 2, ICON_DOT_OFFLINE_PALETTE, ICON_DOT_OFFLINE_DATA, 12 };
+
+static const uint16_t ICON_DOT_ONLINE_PALETTE[] PROGMEM = {
+  0x0000, 0x07E0, 0x07C0
+};
+static const uint8_t ICON_DOT_ONLINE_DATA[] PROGMEM = {
+  0x10, 0x31, 0x20, 0x11, 0x12, 0x11, 0x00, 0x02, 0x01, 0x32, 0x01, 0xF2, 0x12, 0x01, 0x32, 0x01,
+  0x02, 0x00, 0x11, 0x12, 0x11, 0x20, 0x31, 0x10,
+};
+const Icon ICON_DOT_ONLINE = { 8, 8, ICON_RLE4, 3, ICON_DOT_ONLINE_PALETTE, ICON_DOT_ONLINE_DATA, 24 };
+
+static const uint16_t ICON_DOT_UNKNOWN_PALETTE[] PROGMEM = {
+  0x0000, 0x7BEF, 0x7BCF, 0x73AE
+};
+static const uint8_t ICON_DOT_UNKNOWN_DATA[] PROGMEM = {
+  0x10, 0x01, 0x12, 0x01, 0x20, 0x02, 0x01, 0x12, 0x01, 0x02, 0x00, 0x03, 0x01, 0x03, 0x12, 0x03,
+  0x01, 0x03, 0x02, 0x03, 0x32, 0x03, 0x12, 0x03, 0x32, 0x03, 0x02, 0x03, 0x01, 0x03, 0x12, 0x03,
+  0x01, 0x03, 0x00, 0x02, 0x01, 0x12, 0x01, 0x02, 0x20, 0x01, 0x12, 0x01, 0x10,
+};
+const Icon ICON_DOT_UNKNOWN = { 8, 8, ICON_RLE4, 4, ICON_DOT_UNKNOWN_PALETTE, ICON_DOT_UNKNOWN_DATA, 45 };
+
+static const uint16_t ICON_FINANCE_PALETTE[] PROGMEM = {
+  0x0000, 0xF545, 0xF524, 0xFD44, 0xF586, 0xF6D4, 0xFFBC, 0xFF59, 0xF5CA, 0xF503, 0xF60D, 0xFFDE, 0xF502, 0xFFFF, 0xF4E1
+};
+static const uint8_t ICON_FINANCE_DATA[] PROGMEM = {
+  0xF0, 0xA0, 0x01, 0x32, 0x01, 0xB0, 0x01, 0x23, 0x14, 0x01, 0x13, 0x01, 0x80, 0x01, 0x03, 0x01,
+  0x05, 0x36, 0x07, 0x08, 0x13, 0x60, 0x02, 0x03, 0x08, 0x06, 0x05, 0x18, 0x04, 0x08, 0x05, 0x06,
+  0x05, 0x09, 0x01, 0x40, 0x02, 0x03, 0x0A, 0x0B, 0x18, 0x07, 0x16, 0x07, 0x0A, 0x04, 0x06, 0x05,
+  0x0C, 0x02, 0x30, 0x03, 0x01, 0x0B, 0x08, 0x05, 0x5D, 0x07, 0x01, 0x06, 0x08, 0x03, 0x20, 0x01,
+  0x03, 0x15, 0x09, 0x0D, 0x0B, 0x0A, 0x07, 0x0D, 0x0A, 0x05, 0x07, 0x04, 0x0A, 0x07, 0x03, 0x02,
+  0x10, 0x02, 0x03, 0x06, 0x0A, 0x0C, 0x07, 0x0D, 0x16, 0x0D, 0x08, 0x0E, 0x19, 0x01, 0x06, 0x04,
+  0x09, 0x10, 0x09, 0x04, 0x06, 0x04, 0x09, 0x01, 0x05, 0x0B, 0x1D, 0x08, 0x0E, 0x12, 0x09, 0x07,
+  0x0A, 0x09, 0x10, 0x09, 0x04, 0x06, 0x01, 0x12, 0x09, 0x01, 0x07, 0x0D, 0x07, 0x05, 0x01, 0x02,
+  0x09, 0x07, 0x0A, 0x09, 0x10, 0x02, 0x01, 0x06, 0x08, 0x1C, 0x09, 0x0E, 0x07, 0x2D, 0x07, 0x12,
+  0x06, 0x08, 0x09, 0x10, 0x02, 0x03, 0x07, 0x05, 0x0C, 0x15, 0x04, 0x07, 0x0D, 0x05, 0x06, 0x0D,
+  0x18, 0x06, 0x03, 0x02, 0x20, 0x03, 0x08, 0x0B, 0x01, 0x07, 0x0D, 0x1B, 0x0D, 0x06, 0x0D, 0x06,
+  0x02, 0x07, 0x0A, 0x03, 0x02, 0x20, 0x02, 0x09, 0x05, 0x06, 0x01, 0x05, 0x06, 0x1D, 0x0B, 0x05,
+  0x04, 0x05, 0x07, 0x09, 0x01, 0x40, 0x01, 0x09, 0x05, 0x06, 0x0A, 0x04, 0x18, 0x04, 0x08, 0x17,
+  0x02, 0x03, 0x60, 0x01, 0x0C, 0x08, 0x07, 0x06, 0x17, 0x16, 0x0A, 0x09, 0x03, 0x02, 0x70, 0x01,
+  0x13, 0x04, 0x1A, 0x08, 0x13, 0x01, 0xB0, 0x01, 0x39, 0x02, 0x01, 0xF0, 0x90,
+};
+const Icon ICON_FINANCE = { 20, 20, ICON_RLE4, 15, ICON_FINANCE_PALETTE, ICON_FINANCE_DATA, 237 };
+
+static const uint16_t ICON_HOME_PALETTE[] PROGMEM = {
+  0x0000, 0xFFFF, 0xFFDD, 0xFD66, 0xF546, 0xF503, 0xF524, 0xFFFE
+};
+static const uint8_t ICON_HOME_DATA[] PROGMEM = {
+  0xF0, 0xD0, 0x01, 0xF0, 0x00, 0x31, 0xE0, 0x51, 0xC0, 0x71, 0xA0, 0x91, 0x80, 0xB1, 0x60, 0xD1,
+  0x40, 0xF1, 0x01, 0x30, 0xD1, 0x50, 0xD1, 0x50, 0x41, 0x32, 0x41, 0x50, 0x31, 0x02, 0x03, 0x14,
+  0x03, 0x02, 0x31, 0x50, 0x31, 0x02, 0x04, 0x15, 0x04, 0x02, 0x31, 0x50, 0x31, 0x02, 0x04, 0x16,
+  0x04, 0x02, 0x31, 0x50, 0x31, 0x02, 0x04, 0x16, 0x04, 0x02, 0x31, 0x50, 0x31, 0x02, 0x04, 0x16,
+  0x04, 0x02, 0x31, 0x50, 0x31, 0x07, 0x03, 0x16, 0x03, 0x07, 0x31, 0x50, 0x31, 0x02, 0x04, 0x16,
+  0x04, 0x02, 0x31, 0xF0, 0x60,
+};
+const Icon ICON_HOME = { 20, 20, ICON_RLE4, 8, ICON_HOME_PALETTE, ICON_HOME_DATA, 85 };
+
+static const uint16_t ICON_PROJECTS_PALETTE[] PROGMEM = {
+  0x0000, 0xFFFF, 0xF524, 0xF544, 0xFD44
+};
+static const uint8_t ICON_PROJECTS_DATA[] PROGMEM = {
+  0xF0, 0xF0, 0xF0, 0x50, 0x31, 0xF0, 0x31, 0xF0, 0x31, 0xF0, 0x31, 0x90, 0x02, 0x13, 0x02, 0x10,
+  0x31, 0x90, 0x02, 0x14, 0x02, 0x10, 0x31, 0x90, 0x32, 0x10, 0x31, 0x90, 0x02, 0x13, 0x02, 0x10,
+  0x31, 0x90, 0x02, 0x13, 0x02, 0x10, 0x31, 0x30, 0x31, 0x10, 0x02, 0x13, 0x02, 0x10, 0x31, 0x30,
+  0x31, 0x10, 0x02, 0x13, 0x02, 0x10, 0x31, 0x30, 0x31, 0x10, 0x02, 0x13, 0x02, 0x10, 0x31, 0x30,
+  0x31, 0x10, 0x02, 0x13, 0x02, 0x10, 0x31, 0x30, 0x31, 0x10, 0x02, 0x13, 0x02, 0x10, 0x31, 0x30,
+  0x31, 0x10, 0x32, 0x10, 0x31, 0x30, 0x31, 0x10, 0x02, 0x14, 0x02, 0x10, 0x31, 0x30, 0x31, 0x10,
+  0x32, 0x10, 0x31, 0xF0, 0x50,
+};
+const Icon ICON_PROJECTS = { 20, 20, ICON_RLE4, 5, ICON_PROJECTS_PALETTE, ICON_PROJECTS_DATA, 101 };
+
+static const uint16_t ICON_SETTINGS_PALETTE[] PROGMEM = {
+  0x0000, 0xFFFF
+};
+static const uint8_t ICON_SETTINGS_DATA[] PROGMEM = {
+  0x80, 0x11, 0xF0, 0x00, 0x31, 0xB0, 0x11, 0x10, 0x31, 0x10, 0x11, 0x60, 0xD1, 0x40, 0xF1, 0x30,
+  0xF1, 0x40, 0xD1, 0x50, 0x51, 0x20, 0x41, 0x30, 0x61, 0x40, 0x51, 0x00, 0x61, 0x50, 0xD1, 0x50,
+  0x61, 0x00, 0x51, 0x50, 0x51, 0x30, 0x41, 0x30, 0x41, 0x50, 0xD1, 0x40, 0xF1, 0x30, 0xF1, 0x40,
+  0xD1, 0x60, 0x11, 0x10, 0x31, 0x10, 0x11, 0xB0, 0x31, 0xF0, 0x00, 0x11, 0x80,
+};
+const Icon ICON_SETTINGS = { 20, 20, ICON_RLE4, 2, ICON_SETTINGS_PALETTE, ICON_SETTINGS_DATA, 61 };
+
+static const uint16_t ICON_STUDIO_PALETTE[] PROGMEM = {
+  0x0000, 0xFFFF, 0xFFDF, 0xFFDE, 0xD639, 0xDCEE, 0xF7BF, 0xF75D, 0xC8B0, 0x835A
+};
+static const uint8_t ICON_STUDIO_DATA[] PROGMEM = {
+  0xF0, 0xF0, 0xE0, 0x11, 0x02, 0x21, 0xB0, 0x41, 0x03, 0x31, 0x80, 0x41, 0x04, 0x15, 0x03, 0x02,
+  0x21, 0x50, 0x21, 0x06, 0x01, 0x03, 0x25, 0x07, 0x01, 0x06, 0x21, 0x30, 0x21, 0x04, 0x08, 0x05,
+  0x03, 0x25, 0x03, 0x04, 0x19, 0x02, 0x01, 0x30, 0x11, 0x06, 0x28, 0x07, 0x01, 0x07, 0x03, 0x06,
+  0x29, 0x07, 0x11, 0x10, 0x21, 0x02, 0x05, 0x18, 0x07, 0x21, 0x02, 0x29, 0x06, 0x11, 0x10, 0x41,
+  0x04, 0x06, 0x51, 0x07, 0x06, 0x21, 0x10, 0x41, 0x02, 0xB1, 0x10, 0x11, 0x02, 0x01, 0x04, 0x08,
+  0x09, 0x02, 0x31, 0x10, 0x31, 0x10, 0x21, 0x06, 0x28, 0x04, 0x01, 0x02, 0x01, 0x30, 0x21, 0x20,
+  0x11, 0x02, 0x09, 0x08, 0x09, 0x06, 0x21, 0x30, 0x11, 0x30, 0x31, 0x04, 0x06, 0x41, 0x20, 0x11,
+  0x40, 0xD1, 0x70, 0xA1, 0x90, 0x71, 0xF0, 0xF0, 0xD0,
+};
+const Icon ICON_STUDIO = { 20, 20, ICON_RLE4, 10, ICON_STUDIO_PALETTE, ICON_STUDIO_DATA, 121 };
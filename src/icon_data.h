@@ -0,0 +1,19 @@
+// Generated by tools/asset_compiler.py from assets/icons - do not edit
+
+#ifndef ICON_DATA_H
+#define ICON_DATA_H
+
+#include "icons.h"
+
+extern const Icon ICON_AI;  // 20x20, 10 colors, 124 B
+extern const Icon ICON_DOT_DEGRADED;  // 8x8, 3 colors, 36 B
+extern const Icon ICON_DOT_OFFLINE;  // 8x8, 1 colors, 16 B
+extern const Icon ICON_DOT_ONLINE;  // 8x8, 2 colors, 30 B
+extern const Icon ICON_DOT_UNKNOWN;  // 8x8, 3 colors, 53 B
+extern const Icon ICON_FINANCE;  // 20x20, 14 colors, 267 B
+extern const Icon ICON_HOME;  // 20x20, 7 colors, 101 B
+extern const Icon ICON_PROJECTS;  // 20x20, 4 colors, 111 B
+extern const Icon ICON_SETTINGS;  // 20x20, 1 colors, 65 B
+extern const Icon ICON_STUDIO;  // 20x20, 9 colors, 141 B
+
+#endif // ICON_DATA_H
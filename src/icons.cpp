@@ -0,0 +1,59 @@
+/**
+ * ══════════════════════════════════════════════════════════════════════════
+ *                    🖤🛣️ RLE ICONS 🛣️🖤
+ * ══════════════════════════════════════════════════════════════════════════
+ */
+
+#include "icons.h"
+#include "profiler.h"
+
+// On the ESP32 flash constants are memory-mapped, so PROGMEM data is read
+// directly, no pgm_read_*() needed
+
+bool iconDecode(const Icon& icon, uint16_t* out, uint16_t background) {
+  uint32_t pixels = (uint32_t)icon.width * icon.height;
+  if (pixels > ICON_MAX_PIXELS) return false;
+
+  // Resolve transparency once, then the inner loop is a table fill
+  uint16_t palette[256];
+  palette[0] = background;
+  for (uint16_t i = 1; i < icon.colors; i++) palette[i] = icon.palette[i];
+
+  const uint8_t* p = icon.data;
+  const uint8_t* end = icon.data + icon.size;
+  uint32_t pos = 0;
+  while (pos < pixels && p < end) {
+    uint32_t run;
+    uint8_t index;
+    if (icon.encoding == ICON_RLE4) {
+      run = (*p >> 4) + 1;
+      index = *p++ & 0x0F;
+    } else {
+      if (end - p < 2) return false;
+      run = p[0] + 1;
+      index = p[1];
+      p += 2;
+    }
+    if (index >= icon.colors || run > pixels - pos) return false;
+
+    uint16_t color = palette[index];
+    for (uint32_t i = 0; i < run; i++) out[pos++] = color;
+  }
+  return pos == pixels;
+}
+
+#ifdef ARDUINO
+
+void drawIcon(TFT_eSPI& target, const Icon& icon, int16_t x, int16_t y, uint16_t background) {
+  PROFILE_ZONE(PROF_DRAW_ICON);
+
+  uint16_t buffer[ICON_MAX_PIXELS];
+  if (!iconDecode(icon, buffer, background)) return;
+
+  bool swap = target.getSwapBytes();
+  target.setSwapBytes(true);
+  target.pushImage(x, y, icon.width, icon.height, buffer);
+  target.setSwapBytes(swap);
+}
+
+#endif
@@ -0,0 +1,59 @@
+/**
+ * ══════════════════════════════════════════════════════════════════════════
+ *                    🖤🛣️ RLE ICONS 🛣️🖤
+ * ══════════════════════════════════════════════════════════════════════════
+ *
+ * Small bitmaps compiled from assets/icons by tools/asset_compiler.py into
+ * flash (icon_data.h). The GLCD font cannot draw emoji, so every icon on
+ * screen goes through here.
+ *
+ * Each icon has its own RGB565 palette with index 0 transparent, and a
+ * row-major run-length stream:
+ *
+ *   ICON_RLE4  one byte per run: (run - 1) << 4 | index    (<= 15 colors)
+ *   ICON_RLE8  two bytes per run: run - 1, index
+ *
+ * Drawing expands the whole icon into a stack buffer (transparent pixels
+ * take the background color) and pushes it in one address window, so the
+ * cost is one pass over a few dozen bytes plus width * height pixel writes.
+ */
+
+#ifndef ICONS_H
+#define ICONS_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef ARDUINO
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+#else
+#define PROGMEM
+#endif
+
+#define ICON_MAX_PIXELS (24 * 24)
+
+enum IconEncoding : uint8_t {
+  ICON_RLE4 = 0,
+  ICON_RLE8
+};
+
+struct Icon {
+  uint8_t width;
+  uint8_t height;
+  uint8_t encoding;
+  uint8_t colors;           // palette entries incl. transparent
+  const uint16_t* palette;  // PROGMEM
+  const uint8_t* data;      // PROGMEM
+  uint16_t size;
+};
+
+// Expands into out[width * height]; false if the stream is short or bad
+bool iconDecode(const Icon& icon, uint16_t* out, uint16_t background);
+
+#ifdef ARDUINO
+// Works for the panel and for a TFT_eSprite alike
+void drawIcon(TFT_eSPI& target, const Icon& icon, int16_t x, int16_t y, uint16_t background);
+#endif
+
+#endif // ICONS_H
@@ -0,0 +1,154 @@
+/**
+ * ══════════════════════════════════════════════════════════════════════════
+ *                    🖤🛣️ IDLE WAIT 🛣️🖤
+ * ══════════════════════════════════════════════════════════════════════════
+ */
+
+#include "idle.h"
+
+#include <driver/gpio.h>
+#include <driver/uart.h>
+#include <esp_sleep.h>
+#include <esp_timer.h>
+#include <lwip/sockets.h>
+
+#define NET_WATCH_STACK 2048
+#define NET_WATCH_POLL_MS 100  // how often the watcher checks it is still wanted
+
+static TaskHandle_t loopTask = nullptr;
+static TaskHandle_t watchTask = nullptr;
+static int8_t touchPin = -1;
+
+static volatile bool touchFlag = false;
+static volatile bool serialFlag = false;
+static volatile bool netFlag = false;
+static volatile bool watchArmed = false;
+static volatile int watchFd = -1;
+
+static IdleStats stats = {};
+
+static const char* const wakeNames[IDLE_WAKE_COUNT] = { "timer", "touch", "network", "serial" };
+
+static void IRAM_ATTR onTouchIrq() {
+  BaseType_t woken = pdFALSE;
+  touchFlag = true;
+  vTaskNotifyGiveFromISR(loopTask, &woken);
+  if (woken) portYIELD_FROM_ISR();
+}
+
+static void onSerialReceive() {
+  serialFlag = true;
+  xTaskNotifyGive(loopTask);
+}
+
+// Blocks in select() on the WebSocket socket while the loop waits
+static void netWatch(void*) {
+  for (;;) {
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    while (watchArmed) {
+      int fd = watchFd;
+      if (fd < 0) break;
+
+      fd_set readable;
+      FD_ZERO(&readable);
+      FD_SET(fd, &readable);
+      timeval tv = { 0, NET_WATCH_POLL_MS * 1000 };
+      int ready = select(fd + 1, &readable, nullptr, nullptr, &tv);
+      if (ready < 0) break;  // socket closed under us
+      if (ready > 0 && watchArmed) {
+        netFlag = true;
+        xTaskNotifyGive(loopTask);
+        break;
+      }
+    }
+  }
+}
+
+void idleBegin(int8_t touchIrqPin) {
+  loopTask = xTaskGetCurrentTaskHandle();
+  touchPin = touchIrqPin;
+
+  if (touchPin >= 0) {
+    pinMode(touchPin, INPUT);
+    attachInterrupt(digitalPinToInterrupt(touchPin), onTouchIrq, FALLING);
+  }
+  Serial.onReceive(onSerialReceive);
+  xTaskCreatePinnedToCore(netWatch, "netWatch", NET_WATCH_STACK, nullptr, 1, &watchTask, ARDUINO_RUNNING_CORE);
+  idleReset();
+}
+
+static IdleWake lightSleep(uint32_t ms) {
+  Serial.flush();
+
+  esp_sleep_enable_timer_wakeup((uint64_t)ms * 1000);
+  if (touchPin >= 0) {
+    gpio_wakeup_enable((gpio_num_t)touchPin, GPIO_INTR_LOW_LEVEL);
+    esp_sleep_enable_gpio_wakeup();
+  }
+  uart_set_wakeup_threshold(UART_NUM_0, 3);
+  esp_sleep_enable_uart_wakeup(UART_NUM_0);
+
+  esp_light_sleep_start();
+
+  // gpio_wakeup_enable() replaced the pin's edge interrupt with a level one
+  if (touchPin >= 0) {
+    gpio_wakeup_disable((gpio_num_t)touchPin);
+    gpio_set_intr_type((gpio_num_t)touchPin, GPIO_INTR_NEGEDGE);
+  }
+  stats.lightSleeps++;
+
+  switch (esp_sleep_get_wakeup_cause()) {
+    case ESP_SLEEP_WAKEUP_GPIO: return IDLE_WAKE_TOUCH;
+    case ESP_SLEEP_WAKEUP_UART: return IDLE_WAKE_SERIAL;
+    default: return IDLE_WAKE_TIMER;
+  }
+}
+
+static IdleWake block(uint32_t ms, int socketFd) {
+  if (socketFd >= 0) {
+    watchFd = socketFd;
+    watchArmed = true;
+    xTaskNotifyGive(watchTask);
+  }
+
+  ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(ms));
+  watchArmed = false;
+
+  if (touchFlag) return IDLE_WAKE_TOUCH;
+  if (netFlag) return IDLE_WAKE_NETWORK;
+  if (serialFlag) return IDLE_WAKE_SERIAL;
+  return IDLE_WAKE_TIMER;
+}
+
+IdleWake idleWait(uint32_t ms, int socketFd, bool sleep) {
+  if (ms > IDLE_MAX_MS) ms = IDLE_MAX_MS;
+  if (ms == 0) return IDLE_WAKE_TIMER;
+
+  touchFlag = serialFlag = netFlag = false;
+  int64_t start = esp_timer_get_time();
+  IdleWake wake = sleep && ms >= IDLE_MIN_SLEEP_MS ? lightSleep(ms) : block(ms, socketFd);
+
+  stats.idleUs += esp_timer_get_time() - start;
+  stats.waits++;
+  stats.wakes[wake]++;
+  return wake;
+}
+
+void idleNotify() {
+  if (!loopTask) return;
+  netFlag = true;
+  xTaskNotifyGive(loopTask);
+}
+
+const IdleStats& idleStats() {
+  return stats;
+}
+
+void idleReset() {
+  stats = {};
+  stats.sinceUs = esp_timer_get_time();
+}
+
+const char* idleWakeName(uint8_t wake) {
+  return wake < IDLE_WAKE_COUNT ? wakeNames[wake] : "?";
+}
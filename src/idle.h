@@ -0,0 +1,59 @@
+/**
+ * ══════════════════════════════════════════════════════════════════════════
+ *                    🖤🛣️ IDLE WAIT 🛣️🖤
+ * ══════════════════════════════════════════════════════════════════════════
+ *
+ * Where loop() goes between timer deadlines instead of delay(10).
+ *
+ * With the radio off (a WiFi attempt gave up and the next one is not
+ * due yet) the CPU light-sleeps: wakes on the deadline, the XPT2046 pen
+ * interrupt or UART RX. Light sleep powers the radio down, so it is
+ * never used while associating or connected. The panel keeps its
+ * image and the backlight GPIO holds its level. The character that wakes
+ * the UART is lost, so type a serial command twice.
+ *
+ * Otherwise the loop task blocks on a task notification, so FreeRTOS idles
+ * the core and WiFi modem sleep saves the rest. The pen interrupt, serial
+ * RX and a small watcher task select()ing on the WebSocket socket each
+ * give the notification, so input and server frames still wake the loop
+ * at once.
+ */
+
+#ifndef IDLE_H
+#define IDLE_H
+
+#include <Arduino.h>
+
+#define IDLE_MAX_MS       1000  // upper bound on one wait, keeps the WS client polled
+#define IDLE_MIN_SLEEP_MS 3     // shorter waits are not worth a light sleep entry
+
+enum IdleWake : uint8_t {
+  IDLE_WAKE_TIMER = 0,
+  IDLE_WAKE_TOUCH,
+  IDLE_WAKE_NETWORK,
+  IDLE_WAKE_SERIAL,
+  IDLE_WAKE_COUNT
+};
+
+struct IdleStats {
+  uint32_t waits;
+  uint32_t lightSleeps;
+  uint64_t idleUs;
+  uint64_t sinceUs;   // esp_timer time of the last reset
+  uint32_t wakes[IDLE_WAKE_COUNT];
+};
+
+void idleBegin(int8_t touchIrqPin);
+
+// Waits up to `ms`; socketFd < 0 disables the network wake-up
+IdleWake idleWait(uint32_t ms, int socketFd, bool lightSleep);
+
+// Ends the current wait from another task that has network results for
+// the loop (a finished HTTP request); counts as a network wake-up
+void idleNotify();
+
+const IdleStats& idleStats();
+void idleReset();
+const char* idleWakeName(uint8_t wake);
+
+#endif // IDLE_H
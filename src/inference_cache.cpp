@@ -0,0 +1,423 @@
+/**
+ * ══════════════════════════════════════════════════════════════════════════
+ *                    🖤🛣️ INFERENCE CACHE 🛣️🖤
+ * ══════════════════════════════════════════════════════════════════════════
+ */
+
+#include "inference_cache.h"
+#include <string.h>
+
+#define FNV64_OFFSET 14695981039346656037ULL
+#define FNV64_PRIME  1099511628211ULL
+
+#define BLOB_MAGIC   0x43495242  // "BRIC"
+#define BLOB_FORMAT  1
+#define BLOB_HEADER  6           // magic, format, count
+#define BLOB_ENTRY   14          // key, kind, latency, length
+
+static uint64_t fnv64(uint64_t h, const char* s) {
+  for (; *s; s++) h = (h ^ (uint8_t)*s) * FNV64_PRIME;
+  return h;
+}
+
+void InferenceCache::clear() {
+  memset(entries, 0, sizeof(entries));
+  tick = 0;
+  changed = false;
+}
+
+uint64_t InferenceCache::keyOf(InferKind kind, const char* text, const char* context) {
+  uint64_t h = (FNV64_OFFSET ^ kind) * FNV64_PRIME;
+  h = fnv64(h, text);
+  if (context) h = fnv64((h ^ 0xFF) * FNV64_PRIME, context);  // 0xFF never occurs in UTF-8
+  return h ? h : 1;  // 0 marks a free slot
+}
+
+uint32_t InferenceCache::ttl(InferKind kind) {
+  switch (kind) {
+    case INFER_SUMMARY:   return INFER_TTL_SUMMARY_MS;
+    case INFER_ANSWER:    return INFER_TTL_ANSWER_MS;
+    case INFER_SENTIMENT: return INFER_TTL_SENTIMENT_MS;
+    default:              return INFER_TTL_CHAT_MS;
+  }
+}
+
+int8_t InferenceCache::slot(uint64_t key) const {
+  for (uint8_t i = 0; i < INFER_ENTRIES; i++) {
+    if (entries[i].key == key) return i;
+  }
+  return -1;
+}
+
+// A free slot, else the least recently used one without a live call
+int8_t InferenceCache::victim(uint32_t nowMs) const {
+  int8_t best = -1;
+  for (uint8_t i = 0; i < INFER_ENTRIES; i++) {
+    const Entry& e = entries[i];
+    if (e.key == 0) return i;
+    if (e.pending && nowMs - e.sentMs < INFER_ABANDON_MS) continue;
+    if (best < 0 || e.used < entries[best].used) best = i;
+  }
+  return best;
+}
+
+InferLookup InferenceCache::request(InferKind kind, const char* text, const char* context,
+                                    uint8_t waiter, uint32_t nowMs) {
+  InferLookup out = { INFER_MISS, false, keyOf(kind, text, context), nullptr };
+  counters.requests++;
+
+  int8_t i = slot(out.key);
+  if (i >= 0) {
+    Entry& e = entries[i];
+    e.used = ++tick;
+    // No reply by now: the worker dropped it, so the next ask calls again
+    if (e.pending && nowMs - e.sentMs >= INFER_ABANDON_MS) e.pending = false;
+    bool backoff = e.failed && nowMs - e.failedMs < INFER_RETRY_MS;
+
+    if (e.valid) {
+      uint32_t age = nowMs - e.storedMs;
+      if (age < ttl(kind)) {
+        out.state = INFER_HIT;
+        out.result = e.result;
+        counters.hits++;
+        counters.savedUs += e.latencyUs;
+        return out;
+      }
+      if (age < ttl(kind) * INFER_STALE_FACTOR) {
+        out.state = INFER_STALE;
+        out.result = e.result;
+        counters.staleHits++;
+        counters.savedUs += e.latencyUs;
+        e.waiters |= waiter;  // told again when the refresh lands
+        if (!e.pending && !backoff) {
+          e.pending = true;
+          e.sentMs = nowMs;
+          out.fetch = true;
+          counters.calls++;
+        }
+        return out;
+      }
+      e.valid = false;  // too old to show
+    }
+
+    if (e.pending) {
+      out.state = INFER_WAIT;
+      e.waiters |= waiter;
+      counters.coalesced++;
+      return out;
+    }
+    counters.misses++;
+    if (backoff) return out;
+    e.pending = true;
+    e.sentMs = nowMs;
+    e.waiters |= waiter;
+    out.fetch = true;
+    counters.calls++;
+    return out;
+  }
+
+  i = victim(nowMs);
+  if (i < 0) {
+    out.state = INFER_BUSY;
+    counters.busy++;
+    return out;
+  }
+  Entry& e = entries[i];
+  if (e.valid) {
+    counters.evictions++;
+    changed = true;
+  }
+  memset(&e, 0, sizeof(e));
+  e.key = out.key;
+  e.kind = kind;
+  e.used = ++tick;
+  e.pending = true;
+  e.sentMs = nowMs;
+  e.waiters = waiter;
+  out.fetch = true;
+  counters.misses++;
+  counters.calls++;
+  return out;
+}
+
+uint8_t InferenceCache::complete(uint64_t key, const char* result, uint32_t latencyUs, uint32_t nowMs) {
+  int8_t i = slot(key);
+  if (i < 0) return 0;  // evicted after it was given up on
+  Entry& e = entries[i];
+  strncpy(e.result, result, INFER_RESULT_MAX - 1);
+  e.result[INFER_RESULT_MAX - 1] = '\0';
+  e.valid = true;
+  e.storedMs = nowMs;
+  e.latencyUs = latencyUs;
+  e.pending = false;
+  e.failed = false;
+  changed = true;
+  counters.answers++;
+  counters.upstreamUs += latencyUs;
+
+  uint8_t waiters = e.waiters;
+  e.waiters = 0;
+  return waiters;
+}
+
+uint8_t InferenceCache::fail(uint64_t key, uint32_t nowMs) {
+  int8_t i = slot(key);
+  if (i < 0) return 0;
+  Entry& e = entries[i];
+  e.pending = false;
+  e.failed = true;
+  e.failedMs = nowMs;
+  counters.failures++;
+
+  uint8_t waiters = e.waiters;
+  e.waiters = 0;
+  return waiters;
+}
+
+const char* InferenceCache::find(uint64_t key) const {
+  int8_t i = slot(key);
+  return i >= 0 && entries[i].valid ? entries[i].result : nullptr;
+}
+
+// ══════════════════════════════════════════════════════════════════════════
+// PERSISTENCE
+// ══════════════════════════════════════════════════════════════════════════
+
+size_t InferenceCache::saveSize() const {
+  size_t n = BLOB_HEADER;
+  for (const Entry& e : entries) {
+    if (e.valid) n += BLOB_ENTRY + strlen(e.result);
+  }
+  return n;
+}
+
+bool InferenceCache::save(uint8_t* out, size_t size) {
+  if (size < saveSize()) return false;
+  uint32_t magic = BLOB_MAGIC;
+  memcpy(out, &magic, 4);
+  out[4] = BLOB_FORMAT;
+  out[5] = 0;
+  size_t n = BLOB_HEADER;
+  for (const Entry& e : entries) {
+    if (!e.valid) continue;
+    uint8_t length = strlen(e.result);
+    memcpy(out + n, &e.key, 8);
+    out[n + 8] = e.kind;
+    memcpy(out + n + 9, &e.latencyUs, 4);
+    out[n + 13] = length;
+    memcpy(out + n + BLOB_ENTRY, e.result, length);
+    n += BLOB_ENTRY + length;
+    out[5]++;
+  }
+  changed = false;
+  return true;
+}
+
+bool InferenceCache::load(const uint8_t* data, size_t length, uint32_t nowMs) {
+  uint32_t magic;
+  if (length < BLOB_HEADER) return false;
+  memcpy(&magic, data, 4);
+  if (magic != BLOB_MAGIC || data[4] != BLOB_FORMAT || data[5] > INFER_ENTRIES) return false;
+
+  clear();
+  size_t n = BLOB_HEADER;
+  for (uint8_t i = 0; i < data[5]; i++) {
+    if (n + BLOB_ENTRY > length) break;
+    uint8_t size = data[n + 13];
+    if (n + BLOB_ENTRY + size > length || size >= INFER_RESULT_MAX || data[n + 8] >= INFER_KINDS) break;
+
+    Entry& e = entries[i];
+    memcpy(&e.key, data + n, 8);
+    e.kind = (InferKind)data[n + 8];
+    memcpy(&e.latencyUs, data + n + 9, 4);
+    memcpy(e.result, data + n + BLOB_ENTRY, size);
+    e.result[size] = '\0';
+    // Age unknown across a reboot: shown, but refreshed on first use
+    e.storedMs = nowMs - ttl(e.kind);
+    e.valid = e.key != 0;
+    e.used = ++tick;
+    n += BLOB_ENTRY + size;
+  }
+  return true;
+}
+
+InferStats InferenceCache::stats() const {
+  InferStats s = counters;
+  s.entries = 0;
+  s.inFlight = 0;
+  for (const Entry& e : entries) {
+    s.entries += e.valid;
+    s.inFlight += e.pending;
+  }
+  return s;
+}
+
+void InferenceCache::resetStats() {
+  counters = {};
+}
+
+// ══════════════════════════════════════════════════════════════════════════
+// HTTP CLIENT
+// ══════════════════════════════════════════════════════════════════════════
+
+#ifdef ARDUINO
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include <HTTPClient.h>
+#include <WiFi.h>
+#include <stdio.h>
+#include "cloud_config.h"
+#include "idle.h"
+
+#define INFER_TASK_STACK    8192   // TLS handshake
+#define INFER_TASK_PRIORITY 1
+#define INFER_TASK_CORE     0
+#define INFER_QUEUE_DEPTH   4
+#define INFER_REQUEST_MS    20000  // summarization on a cold model is slow
+
+struct InferenceCall {
+  uint64_t key;
+  InferKind kind;
+  char text[INFER_TEXT_MAX];
+  char context[INFER_CONTEXT_MAX];
+};
+
+static QueueHandle_t calls = nullptr;
+static QueueHandle_t replies = nullptr;
+static const char* routeUrl[INFER_KINDS] = {};
+static const char* routeToken[INFER_KINDS] = {};
+
+// Appends `text` as a JSON string body; quotes and backslashes escaped,
+// control bytes dropped
+static size_t appendEscaped(char* out, size_t size, size_t n, const char* text) {
+  for (const char* p = text; *p && n + 4 < size; p++) {
+    if ((uint8_t)*p < 0x20) continue;
+    if (*p == '"' || *p == '\\') out[n++] = '\\';
+    out[n++] = *p;
+  }
+  out[n] = '\0';
+  return n;
+}
+
+static size_t requestBody(char* out, size_t size, const InferenceCall& call) {
+  size_t n;
+  switch (call.kind) {
+    case INFER_SUMMARY:
+      n = snprintf(out, size, "{\"inputs\":\"");
+      n = appendEscaped(out, size, n, call.text);
+      n += snprintf(out + n, size - n, "\",\"parameters\":{\"max_length\":60}}");
+      break;
+    case INFER_ANSWER:
+      n = snprintf(out, size, "{\"inputs\":{\"question\":\"");
+      n = appendEscaped(out, size, n, call.text);
+      n += snprintf(out + n, size - n, "\",\"context\":\"");
+      n = appendEscaped(out, size, n, call.context);
+      n += snprintf(out + n, size - n, "\"}}");
+      break;
+    case INFER_SENTIMENT:
+      n = snprintf(out, size, "{\"inputs\":\"");
+      n = appendEscaped(out, size, n, call.text);
+      n += snprintf(out + n, size - n, "\"}");
+      break;
+    default:
+      n = snprintf(out, size, "{\"model\":\"%s\",\"messages\":[{\"role\":\"user\",\"content\":\"",
+        ENCLAVE_MODEL_SECURE);
+      n = appendEscaped(out, size, n, call.text);
+      n += snprintf(out + n, size - n, "\"}]}");
+      break;
+  }
+  return n;
+}
+
+// The answer text out of each service's response
+static const char* answerText(JsonDocument& doc, InferKind kind) {
+  switch (kind) {
+    case INFER_SUMMARY: return doc[0]["summary_text"];                  // [{"summary_text":"..."}]
+    case INFER_ANSWER:  return doc["answer"];                           // {"answer":"...","score":0.9}
+    case INFER_SENTIMENT: {
+      // [[{"label":"NEGATIVE","score":0.99},{"label":"POSITIVE",...}]]
+      JsonArrayConst scores = doc[0].is<JsonArrayConst>() ? doc[0].as<JsonArrayConst>() : doc.as<JsonArrayConst>();
+      const char* best = nullptr;
+      float bestScore = -1;
+      for (JsonVariantConst s : scores) {
+        float score = s["score"] | 0.0f;
+        if (score > bestScore) {
+          bestScore = score;
+          best = s["label"];
+        }
+      }
+      return best;
+    }
+    default: {
+      const char* content = doc["choices"][0]["message"]["content"];   // chat completion
+      return content ? content : (const char*)doc["response"];
+    }
+  }
+}
+
+// Blocking POSTs, one at a time, off the loop task. Every call gets a
+// reply, failed or not, so the cache never waits on a lost one
+static void inferenceWorker(void*) {
+  static InferenceCall call;
+  static char body[2 * (INFER_TEXT_MAX + INFER_CONTEXT_MAX) + 128];
+  static InferenceReply reply;
+  for (;;) {
+    if (xQueueReceive(calls, &call, portMAX_DELAY) != pdTRUE) continue;
+
+    memset(&reply, 0, sizeof(reply));
+    reply.key = call.key;
+    uint32_t start = micros();
+
+    HTTPClient http;
+    http.setTimeout(INFER_REQUEST_MS);
+    http.setConnectTimeout(CLOUD_CONNECTION_TIMEOUT);
+    if (http.begin(routeUrl[call.kind])) {
+      http.addHeader("Content-Type", "application/json");
+      http.addHeader("Authorization", String("Bearer ") + routeToken[call.kind]);
+      size_t length = requestBody(body, sizeof(body), call);
+
+      if (http.POST((uint8_t*)body, length) == 200) {
+        JsonDocument doc;
+        if (!deserializeJson(doc, http.getString())) {
+          const char* text = answerText(doc, call.kind);
+          if (text) {
+            strncpy(reply.result, text, INFER_RESULT_MAX - 1);
+            reply.ok = true;
+          }
+        }
+      }
+      http.end();
+    }
+
+    reply.latencyUs = micros() - start;
+    xQueueSend(replies, &reply, portMAX_DELAY);
+    idleNotify();
+  }
+}
+
+void inferenceHttpRoute(InferKind kind, const char* url, const char* token) {
+  routeUrl[kind] = url;
+  routeToken[kind] = token;
+  if (calls) return;
+  calls = xQueueCreate(INFER_QUEUE_DEPTH, sizeof(InferenceCall));
+  replies = xQueueCreate(INFER_QUEUE_DEPTH, sizeof(InferenceReply));
+  xTaskCreatePinnedToCore(inferenceWorker, "inference", INFER_TASK_STACK, nullptr,
+    INFER_TASK_PRIORITY, nullptr, INFER_TASK_CORE);
+}
+
+bool inferenceHttpPost(uint64_t key, InferKind kind, const char* text, const char* context) {
+  if (!calls || !routeUrl[kind] || WiFi.status() != WL_CONNECTED) return false;
+  static InferenceCall call;  // loop task only
+  memset(&call, 0, sizeof(call));
+  call.key = key;
+  call.kind = kind;
+  strncpy(call.text, text, INFER_TEXT_MAX - 1);
+  if (context) strncpy(call.context, context, INFER_CONTEXT_MAX - 1);
+  return xQueueSend(calls, &call, 0) == pdTRUE;
+}
+
+bool inferenceHttpResult(InferenceReply& out) {
+  return replies && xQueueReceive(replies, &out, 0) == pdTRUE;
+}
+
+#endif
@@ -0,0 +1,159 @@
+/**
+ * ══════════════════════════════════════════════════════════════════════════
+ *                    🖤🛣️ INFERENCE CACHE 🛣️🖤
+ * ══════════════════════════════════════════════════════════════════════════
+ *
+ * Results of slow, rate-limited cloud calls (Hugging Face summarization,
+ * QA and sentiment, Enclave secure chat), kept by a 64-bit hash of what
+ * was asked.
+ * Asking again within the kind's TTL is answered from RAM.
+ *
+ *   - Coalescing: while a call is in flight, asking the same thing joins
+ *     it. Each caller passes a waiter bit, and complete() hands back the
+ *     bits to tell, so one upstream call answers everyone.
+ *   - Stale while refreshing: an expired result is still returned, up to
+ *     INFER_STALE_FACTOR times its TTL, and the first such request starts
+ *     a refresh in the background.
+ *   - Failures: a failed call keeps any stale result, and the same input
+ *     is not retried for INFER_RETRY_MS.
+ *   - Eviction: least recently used entry without a call in flight.
+ *   - Persistence: save() / load() pack the results into a blob for
+ *     flash. Loaded results count as expired (the hub has no wall clock
+ *     at boot), so they are shown at once and refreshed on first use.
+ *
+ * Pure logic with times passed in. The HTTP client below is a worker
+ * task; the caller owns the cache and feeds it the worker's replies.
+ */
+
+#ifndef INFERENCE_CACHE_H
+#define INFERENCE_CACHE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define INFER_ENTRIES        24
+#define INFER_RESULT_MAX     192     // bytes incl. NUL; longer answers are cut
+#define INFER_TEXT_MAX       384     // prompt, question or text to summarize
+#define INFER_CONTEXT_MAX    384     // QA context
+#define INFER_STALE_FACTOR   8
+#define INFER_RETRY_MS       30000
+#define INFER_ABANDON_MS     30000   // a call with no reply by then is lost
+
+#define INFER_TTL_SUMMARY_MS   (24UL * 3600 * 1000)
+#define INFER_TTL_ANSWER_MS    (3600UL * 1000)
+#define INFER_TTL_CHAT_MS      (6UL * 3600 * 1000)
+#define INFER_TTL_SENTIMENT_MS (24UL * 3600 * 1000)
+
+enum InferKind : uint8_t {
+  INFER_SUMMARY = 0,   // HF_SUMMARIZATION_URL
+  INFER_ANSWER,        // HF_QA_URL, with a context
+  INFER_CHAT,          // ENCLAVE_SECURE_CHAT_URL
+  INFER_SENTIMENT,     // HF_SENTIMENT_URL; the result is the top label
+  INFER_KINDS
+};
+
+enum InferState : uint8_t {
+  INFER_HIT = 0,   // fresh result
+  INFER_STALE,     // expired result; a refresh is running or starting
+  INFER_WAIT,      // no result yet; joined the call in flight
+  INFER_MISS,      // no result; a call starts (fetch), or failed recently
+  INFER_BUSY       // every slot has a call in flight
+};
+
+struct InferLookup {
+  InferState state;
+  bool fetch;            // caller sends the upstream call for `key` now
+  uint64_t key;
+  const char* result;    // HIT / STALE; valid until the cache next changes
+};
+
+struct InferStats {
+  uint32_t requests;
+  uint32_t hits;
+  uint32_t staleHits;
+  uint32_t coalesced;    // joined a call in flight
+  uint32_t misses;
+  uint32_t busy;
+  uint32_t calls;        // upstream calls started
+  uint32_t answers;
+  uint32_t failures;
+  uint32_t evictions;
+  uint64_t savedUs;      // upstream latency hits did not wait for
+  uint64_t upstreamUs;   // total latency of answered calls
+  uint16_t entries;      // slots holding a result
+  uint16_t inFlight;
+};
+
+class InferenceCache {
+ public:
+  void clear();
+
+  static uint64_t keyOf(InferKind kind, const char* text, const char* context = nullptr);
+
+  // `waiter` is one bit naming the caller; it comes back from complete()
+  // or fail() when the call it joined or started ends
+  InferLookup request(InferKind kind, const char* text, const char* context, uint8_t waiter, uint32_t nowMs);
+
+  // The call for `key` answered / failed; returns the waiter bits
+  uint8_t complete(uint64_t key, const char* result, uint32_t latencyUs, uint32_t nowMs);
+  uint8_t fail(uint64_t key, uint32_t nowMs);
+
+  // Result for `key`, fresh or stale; null when there is none
+  const char* find(uint64_t key) const;
+
+  // Blob of every result, for flash; false when `size` is too small.
+  // dirty() is set by new results and evictions, cleared by save()
+  size_t saveSize() const;
+  bool save(uint8_t* out, size_t size);
+  bool load(const uint8_t* data, size_t length, uint32_t nowMs);
+  bool dirty() const { return changed; }
+
+  InferStats stats() const;
+  void resetStats();
+
+ private:
+  struct Entry {
+    uint64_t key;
+    uint32_t storedMs;    // when the result arrived
+    uint32_t sentMs;      // call in flight since
+    uint32_t failedMs;
+    uint32_t latencyUs;   // of the call that produced the result
+    uint32_t used;        // LRU tick
+    InferKind kind;
+    uint8_t waiters;
+    bool valid;           // result holds an answer
+    bool pending;         // call in flight
+    bool failed;
+    char result[INFER_RESULT_MAX];
+  };
+
+  Entry entries[INFER_ENTRIES] = {};
+  uint32_t tick = 0;
+  bool changed = false;
+  InferStats counters = {};
+
+  int8_t slot(uint64_t key) const;
+  int8_t victim(uint32_t nowMs) const;
+  static uint32_t ttl(InferKind kind);
+};
+
+// ══════════════════════════════════════════════════════════════════════════
+// HTTP CLIENT
+// ══════════════════════════════════════════════════════════════════════════
+
+#ifdef ARDUINO
+struct InferenceReply {
+  uint64_t key;
+  bool ok;
+  uint32_t latencyUs;
+  char result[INFER_RESULT_MAX];
+};
+
+// Sets where a kind is sent; starts the worker task with the first route
+void inferenceHttpRoute(InferKind kind, const char* url, const char* token);
+// false when the kind has no route, WiFi is down or the queue is full
+bool inferenceHttpPost(uint64_t key, InferKind kind, const char* text, const char* context);
+bool inferenceHttpResult(InferenceReply& out);
+#endif
+
+#endif // INFERENCE_CACHE_H
@@ -0,0 +1,145 @@
+/**
+ * ══════════════════════════════════════════════════════════════════════════
+ *                    🖤🛣️ JSON ARENA ALLOCATOR 🛣️🖤
+ * ══════════════════════════════════════════════════════════════════════════
+ */
+
+#include "json_arena.h"
+#include <string.h>
+
+// Each block is preceded by its size so reallocate() can copy it
+struct ArenaHeader {
+  uint32_t size;
+  uint32_t reserved;
+};
+
+static_assert(sizeof(ArenaHeader) % JSON_ARENA_ALIGN == 0, "header must keep alignment");
+
+static inline size_t alignUp(size_t n) {
+  return (n + JSON_ARENA_ALIGN - 1) & ~(size_t)(JSON_ARENA_ALIGN - 1);
+}
+
+alignas(JSON_ARENA_ALIGN) static uint8_t jsonArenaBuffer[JSON_ARENA_SIZE];
+JsonArena jsonArena(jsonArenaBuffer, sizeof(jsonArenaBuffer));
+
+// ══════════════════════════════════════════════════════════════════════════
+// ARENA
+// ══════════════════════════════════════════════════════════════════════════
+
+JsonArena::JsonArena(uint8_t* buffer, size_t cap)
+  : base(buffer), capacity(cap), top(0), lastBlock(NO_BLOCK), peak(0),
+    lastPeak(0), highWater(0), messages(0), allocations(0), failures(0) {
+}
+
+void* JsonArena::allocate(size_t size) {
+  size_t need = sizeof(ArenaHeader) + alignUp(size);
+  if (need > capacity - top) {
+    failures++;
+    return nullptr;
+  }
+
+  ArenaHeader* header = (ArenaHeader*)(base + top);
+  header->size = (uint32_t)size;
+  lastBlock = top;
+  top += need;
+  allocations++;
+
+  if (top > peak) peak = top;
+  if (peak > highWater) highWater = peak;
+  return header + 1;
+}
+
+void JsonArena::deallocate(void* ptr) {
+  // Only the newest block can be given back early; the rest waits for reset()
+  if (ptr && lastBlock != NO_BLOCK && (uint8_t*)ptr == base + lastBlock + sizeof(ArenaHeader)) {
+    top = lastBlock;
+    lastBlock = NO_BLOCK;
+  }
+}
+
+void* JsonArena::reallocate(void* ptr, size_t newSize) {
+  if (!ptr) return allocate(newSize);
+
+  ArenaHeader* header = (ArenaHeader*)ptr - 1;
+  size_t offset = (uint8_t*)header - base;
+
+  // Newest block: grow or shrink in place
+  if (offset == lastBlock) {
+    size_t end = offset + sizeof(ArenaHeader) + alignUp(newSize);
+    if (end > capacity) {
+      failures++;
+      return nullptr;
+    }
+    header->size = (uint32_t)newSize;
+    top = end;
+    if (top > peak) peak = top;
+    if (peak > highWater) highWater = peak;
+    return ptr;
+  }
+
+  // Older block: shrinking is free, growing means a copy
+  if (newSize <= header->size) {
+    return ptr;
+  }
+
+  void* fresh = allocate(newSize);
+  if (fresh) {
+    memcpy(fresh, ptr, header->size);
+  }
+  return fresh;
+}
+
+void JsonArena::reset() {
+  if (top > 0 || peak > 0) {
+    messages++;
+  }
+  top = 0;
+  lastBlock = NO_BLOCK;
+  if (peak > 0) {
+    lastPeak = peak;
+  }
+  peak = 0;
+}
+
+JsonArenaStats JsonArena::stats() const {
+  JsonArenaStats s;
+  s.capacity = capacity;
+  s.used = top;
+  s.lastPeak = lastPeak;
+  s.highWater = highWater;
+  s.messages = messages;
+  s.allocations = allocations;
+  s.failures = failures;
+  return s;
+}
+
+// ══════════════════════════════════════════════════════════════════════════
+// MESSAGE BUFFER
+// ══════════════════════════════════════════════════════════════════════════
+
+ArenaMessageBuffer::ArenaMessageBuffer(JsonArena& a)
+  : arena(a), buffer(nullptr), size(0), overflow(false) {
+}
+
+void ArenaMessageBuffer::begin() {
+  arena.reset();
+  buffer = nullptr;
+  size = 0;
+  overflow = false;
+}
+
+bool ArenaMessageBuffer::append(const uint8_t* data, size_t length) {
+  if (overflow) return false;
+
+  char* grown = (char*)arena.reallocate(buffer, size + length + 1);
+  if (!grown) {
+    overflow = true;
+    return false;
+  }
+
+  buffer = grown;
+  memcpy(buffer + size, data, length);
+  size += length;
+  buffer[size] = '\0';
+  return true;
+}
@@ -0,0 +1,97 @@
+/**
+ * ══════════════════════════════════════════════════════════════════════════
+ *                    🖤🛣️ JSON ARENA ALLOCATOR 🛣️🖤
+ * ══════════════════════════════════════════════════════════════════════════
+ *
+ * Bump allocator over one preallocated buffer, plugged into ArduinoJson 7
+ * as a custom Allocator. Everything for one incoming message - the
+ * reassembled WebSocket payload and the JsonDocument built from it - is
+ * carved out of the arena and released in one go with reset(), so
+ * sustained traffic never touches (or fragments) the system heap.
+ *
+ * One gap: a message that arrives in a single frame is parsed from the
+ * payload buffer WebSocketsClient malloc'd for it, and the library frees
+ * it after the callback. The library allocates that buffer inside
+ * WebSockets::handleWebsocketPayloadCb(), which is not virtual and takes
+ * no allocator, so a subclass cannot move it into the arena. Only
+ * fragmented messages are reassembled here. Single frames still cost one
+ * malloc/free pair each on the WebSocket path, but none in the parse.
+ *
+ * The arena size is the per-message ceiling. Override with
+ * -DJSON_ARENA_SIZE=<bytes>; high-water-mark statistics show how much of
+ * it real traffic needs.
+ */
+
+#ifndef JSON_ARENA_H
+#define JSON_ARENA_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <ArduinoJson.h>
+
+#ifndef JSON_ARENA_SIZE
+#define JSON_ARENA_SIZE 16384
+#endif
+
+#define JSON_ARENA_ALIGN 8
+
+struct JsonArenaStats {
+  size_t capacity;
+  size_t used;          // bytes in use right now
+  size_t lastPeak;      // peak of the last message (before reset)
+  size_t highWater;     // peak since boot
+  uint32_t messages;    // reset() calls
+  uint32_t allocations;
+  uint32_t failures;    // requests that did not fit
+};
+
+class JsonArena : public ArduinoJson::Allocator {
+ public:
+  JsonArena(uint8_t* buffer, size_t capacity);
+
+  void* allocate(size_t size) override;
+  void deallocate(void* ptr) override;
+  void* reallocate(void* ptr, size_t newSize) override;
+
+  // Releases everything; no pointer handed out before may be used after
+  void reset();
+  JsonArenaStats stats() const;
+
+ private:
+  uint8_t* base;
+  size_t capacity;
+  size_t top;
+  size_t lastBlock;  // header offset of the most recent block, or NO_BLOCK
+  size_t peak;
+  size_t lastPeak;
+  size_t highWater;
+  uint32_t messages;
+  uint32_t allocations;
+  uint32_t failures;
+
+  static const size_t NO_BLOCK = (size_t)-1;
+};
+
+// Growable byte buffer inside an arena, for reassembling fragmented
+// WebSocket messages. Always NUL-terminated so it can be parsed in place.
+class ArenaMessageBuffer {
+ public:
+  explicit ArenaMessageBuffer(JsonArena& arena);
+
+  void begin();  // resets the arena and drops any partial message
+  bool append(const uint8_t* data, size_t length);
+
+  const char* data() const { return buffer; }
+  size_t length() const { return size; }
+  bool overflowed() const { return overflow; }
+
+ private:
+  JsonArena& arena;
+  char* buffer;
+  size_t size;
+  bool overflow;
+};
+
+extern JsonArena jsonArena;
+
+#endif // JSON_ARENA_H
@@ -0,0 +1,72 @@
+/**
+ * ══════════════════════════════════════════════════════════════════════════
+ *                    🖤🛣️ ON-SCREEN KEYBOARD 🛣️🖤
+ * ══════════════════════════════════════════════════════════════════════════
+ */
+
+#include "keyboard.h"
+#include "colors.h"
+
+static const char* const KEY_ROWS[KEYBOARD_ROWS - 1] = {
+  "1234567890",
+  "qwertyuiop",
+  "asdfghjkl'",
+  "zxcvbnm-._"
+};
+
+// Function row: mode | space | delete | done
+#define FN_MODE_W   60
+#define FN_SPACE_W  84
+#define FN_DEL_W    48
+#define FN_DONE_W   48
+
+void OnScreenKeyboard::begin(TFT_eSPI* display, int16_t top) {
+  tft = display;
+  areaTop = top;
+}
+
+void OnScreenKeyboard::drawKey(int16_t x, int16_t y, int16_t w, const char* label, uint16_t fill) {
+  tft->fillRect(x + 1, y + 1, w - 2, KEYBOARD_KEY_H - 2, fill);
+  tft->setTextColor(COLOR_WHITE, fill);
+  tft->setTextSize(1);
+  int16_t textW = strlen(label) * 6;
+  tft->setCursor(x + (w - textW) / 2, y + (KEYBOARD_KEY_H - 8) / 2);
+  tft->print(label);
+}
+
+void OnScreenKeyboard::draw(const char* modeLabel) {
+  tft->fillRect(0, areaTop, 240, KEYBOARD_HEIGHT, COLOR_BLACK);
+
+  char label[2] = { 0, 0 };
+  for (int row = 0; row < KEYBOARD_ROWS - 1; row++) {
+    for (int col = 0; col < KEYBOARD_COLS; col++) {
+      label[0] = KEY_ROWS[row][col];
+      drawKey(col * KEYBOARD_KEY_W, areaTop + row * KEYBOARD_KEY_H, KEYBOARD_KEY_W, label, COLOR_DARK_GRAY);
+    }
+  }
+
+  int16_t y = areaTop + (KEYBOARD_ROWS - 1) * KEYBOARD_KEY_H;
+  drawModeKey(modeLabel);
+  drawKey(FN_MODE_W, y, FN_SPACE_W, "space", COLOR_DARK_GRAY);
+  drawKey(FN_MODE_W + FN_SPACE_W, y, FN_DEL_W, "del", COLOR_DARK_GRAY);
+  drawKey(FN_MODE_W + FN_SPACE_W + FN_DEL_W, y, FN_DONE_W, "done", COLOR_HOT_PINK);
+}
+
+void OnScreenKeyboard::drawModeKey(const char* modeLabel) {
+  int16_t y = areaTop + (KEYBOARD_ROWS - 1) * KEYBOARD_KEY_H;
+  drawKey(0, y, FN_MODE_W, modeLabel, COLOR_VIOLET);
+}
+
+char OnScreenKeyboard::keyAt(int16_t x, int16_t y) const {
+  if (!contains(y) || x < 0 || x >= 240) return KEY_NONE;
+
+  int row = (y - areaTop) / KEYBOARD_KEY_H;
+  if (row < KEYBOARD_ROWS - 1) {
+    return KEY_ROWS[row][x / KEYBOARD_KEY_W];
+  }
+
+  if (x < FN_MODE_W) return KEY_MODE;
+  if (x < FN_MODE_W + FN_SPACE_W) return ' ';
+  if (x < FN_MODE_W + FN_SPACE_W + FN_DEL_W) return KEY_BACKSPACE;
+  return KEY_DONE;
+}
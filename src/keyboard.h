@@ -0,0 +1,46 @@
+/**
+ * ══════════════════════════════════════════════════════════════════════════
+ *                    🖤🛣️ ON-SCREEN KEYBOARD 🛣️🖤
+ * ══════════════════════════════════════════════════════════════════════════
+ *
+ * Compact 240px-wide keyboard for search input: four rows of ten 24x24
+ * keys plus a function row (mode, space, delete, done). Only draws and
+ * hit-tests; what a key does is up to the caller.
+ */
+
+#ifndef KEYBOARD_H
+#define KEYBOARD_H
+
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+
+#define KEYBOARD_KEY_W   24
+#define KEYBOARD_KEY_H   24
+#define KEYBOARD_COLS    10
+#define KEYBOARD_ROWS    5     // incl. function row
+#define KEYBOARD_HEIGHT  (KEYBOARD_ROWS * KEYBOARD_KEY_H)
+
+// Function keys returned by keyAt()
+#define KEY_NONE       0
+#define KEY_BACKSPACE  '\b'
+#define KEY_DONE       '\n'
+#define KEY_MODE       '\t'
+
+class OnScreenKeyboard {
+ public:
+  void begin(TFT_eSPI* display, int16_t top);
+
+  void draw(const char* modeLabel);
+  void drawModeKey(const char* modeLabel);
+
+  bool contains(int16_t y) const { return y >= areaTop && y < areaTop + KEYBOARD_HEIGHT; }
+  char keyAt(int16_t x, int16_t y) const;
+
+ private:
+  TFT_eSPI* tft = nullptr;
+  int16_t areaTop = 0;
+
+  void drawKey(int16_t x, int16_t y, int16_t w, const char* label, uint16_t fill);
+};
+
+#endif // KEYBOARD_H
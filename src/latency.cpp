@@ -0,0 +1,165 @@
+/**
+ * ══════════════════════════════════════════════════════════════════════════
+ *                    🖤🛣️ TOUCH-TO-PHOTON LATENCY 🛣️🖤
+ * ══════════════════════════════════════════════════════════════════════════
+ */
+
+#include "latency.h"
+
+bool latencyOverlayEnabled = false;
+
+static uint32_t stageTime[LAT_STAGE_COUNT];
+static uint8_t stageMask = 0;
+
+static LogHistogram spans[SPAN_COUNT];
+static bool spansReady = false;
+
+static const char* spanNames[SPAN_COUNT] = {
+  "touch->gesture", "gesture->switch", "switch->photon", "touch->photon"
+};
+
+static void ensureInit() {
+  if (spansReady) return;
+  for (int i = 0; i < SPAN_COUNT; i++) spans[i].reset();
+  spansReady = true;
+}
+
+// ══════════════════════════════════════════════════════════════════════════
+// TRACE
+// ══════════════════════════════════════════════════════════════════════════
+
+void latencyBegin() {
+  stageTime[LAT_TOUCH] = micros();
+  stageMask = 1 << LAT_TOUCH;
+}
+
+void latencyMark(LatencyStage stage) {
+  // Only meaningful inside a trace started by a touch
+  if (!(stageMask & (1 << LAT_TOUCH))) return;
+  stageTime[stage] = micros();
+  stageMask |= 1 << stage;
+}
+
+bool latencyComplete() {
+  const uint8_t required = (1 << LAT_TOUCH) | (1 << LAT_GESTURE) | (1 << LAT_SWITCH);
+  if ((stageMask & required) != required) {
+    stageMask = 0;
+    return false;
+  }
+
+  stageTime[LAT_PHOTON] = micros();
+  stageMask = 0;
+  ensureInit();
+
+  spans[SPAN_TOUCH_TO_GESTURE].record(stageTime[LAT_GESTURE] - stageTime[LAT_TOUCH]);
+  spans[SPAN_GESTURE_TO_SWITCH].record(stageTime[LAT_SWITCH] - stageTime[LAT_GESTURE]);
+  spans[SPAN_SWITCH_TO_PHOTON].record(stageTime[LAT_PHOTON] - stageTime[LAT_SWITCH]);
+  spans[SPAN_TOUCH_TO_PHOTON].record(stageTime[LAT_PHOTON] - stageTime[LAT_TOUCH]);
+  return true;
+}
+
+// ══════════════════════════════════════════════════════════════════════════
+// RESULTS
+// ══════════════════════════════════════════════════════════════════════════
+
+void latencyReset() {
+  spansReady = false;
+  stageMask = 0;
+  ensureInit();
+}
+
+const LogHistogram& latencyHistogram(LatencySpan span) {
+  ensureInit();
+  return spans[span];
+}
+
+const char* latencySpanName(LatencySpan span) {
+  return spanNames[span];
+}
+
+// ══════════════════════════════════════════════════════════════════════════
+// EXPORT
+// ══════════════════════════════════════════════════════════════════════════
+
+void latencyPrintReport(Print& out) {
+  ensureInit();
+  out.println("Touch latency (us):        n      p50      p90      p99      max");
+  for (int i = 0; i < SPAN_COUNT; i++) {
+    const LogHistogram& h = spans[i];
+    out.printf("  %-18s %8lu %8lu %8lu %8lu %8lu\n", spanNames[i],
+      (unsigned long)h.count,
+      (unsigned long)h.percentile(500),
+      (unsigned long)h.percentile(900),
+      (unsigned long)h.percentile(990),
+      (unsigned long)(h.count ? h.maxValue : 0));
+  }
+}
+
+// Streams the frame twice: once to size it, once for real. Avoids a
+// worst-case sized scratch buffer for what is a rare debug command.
+struct FrameWriter {
+  Print* out;
+  size_t length;
+  uint8_t crc;
+
+  void byte(uint8_t b) {
+    length++;
+    if (!out) return;
+    out->write(b);
+    crc ^= b;
+    for (int i = 0; i < 8; i++) {
+      crc = (crc & 0x80) ? (uint8_t)((crc << 1) ^ 0x07) : (uint8_t)(crc << 1);
+    }
+  }
+
+  void varint(uint64_t v) {
+    while (v >= 0x80) {
+      byte((uint8_t)(v | 0x80));
+      v >>= 7;
+    }
+    byte((uint8_t)v);
+  }
+};
+
+static void writePayload(FrameWriter& w) {
+  w.byte(LATENCY_FRAME_VERSION);
+  w.byte(SPAN_COUNT);
+
+  for (int i = 0; i < SPAN_COUNT; i++) {
+    const LogHistogram& h = spans[i];
+    uint8_t used = 0;
+    for (int b = 0; b < HISTOGRAM_BUCKETS; b++) {
+      if (h.buckets[b]) used++;
+    }
+
+    w.byte(i);
+    w.varint(h.count);
+    w.varint(h.count ? h.minValue : 0);
+    w.varint(h.maxValue);
+    w.varint(h.sum);
+    w.byte(used);
+    for (int b = 0; b < HISTOGRAM_BUCKETS; b++) {
+      if (!h.buckets[b]) continue;
+      w.byte(b);
+      w.varint(h.buckets[b]);
+    }
+  }
+}
+
+size_t latencyExport(Print& out) {
+  ensureInit();
+
+  FrameWriter sizer = { nullptr, 0, 0 };
+  writePayload(sizer);
+
+  out.write((uint8_t)LATENCY_FRAME_SYNC);
+  out.write((uint8_t)LATENCY_FRAME_TYPE);
+  out.write((uint8_t)(sizer.length & 0xFF));
+  out.write((uint8_t)(sizer.length >> 8));
+
+  FrameWriter writer = { &out, 0, 0 };
+  writePayload(writer);
+  out.write(writer.crc);
+
+  return sizer.length + 5;
+}
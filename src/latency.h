@@ -0,0 +1,61 @@
+/**
+ * ══════════════════════════════════════════════════════════════════════════
+ *                    🖤🛣️ TOUCH-TO-PHOTON LATENCY 🛣️🖤
+ * ══════════════════════════════════════════════════════════════════════════
+ *
+ * Timestamps one touch interaction at each stage of the pipeline:
+ *
+ *   TOUCH    handleTouch() accepted a sample (tap) or the release (swipe)
+ *   GESTURE  the input was classified as a navbar tap or a swipe
+ *   SWITCH   switchScreen() entry
+ *   PHOTON   last SPI transaction of the redraw has completed
+ *
+ * Completed traces are folded into per-span µs histograms that can be
+ * dumped over serial as text or as a compact binary frame (see
+ * tools/latency_report.py for the decoder).
+ */
+
+#ifndef LATENCY_H
+#define LATENCY_H
+
+#include <Arduino.h>
+#include "histogram.h"
+
+enum LatencyStage {
+  LAT_TOUCH = 0,
+  LAT_GESTURE,
+  LAT_SWITCH,
+  LAT_PHOTON,
+  LAT_STAGE_COUNT
+};
+
+enum LatencySpan {
+  SPAN_TOUCH_TO_GESTURE = 0,
+  SPAN_GESTURE_TO_SWITCH,
+  SPAN_SWITCH_TO_PHOTON,
+  SPAN_TOUCH_TO_PHOTON,
+  SPAN_COUNT
+};
+
+// Binary export framing: SYNC, TYPE, LEN (u16 LE), PAYLOAD, CRC-8 of payload
+#define LATENCY_FRAME_SYNC    0xA5
+#define LATENCY_FRAME_TYPE    'L'
+#define LATENCY_FRAME_VERSION 1
+
+extern bool latencyOverlayEnabled;
+
+// Trace
+void latencyBegin();
+void latencyMark(LatencyStage stage);
+bool latencyComplete();  // stamps PHOTON, true if a full trace was recorded
+
+// Results
+void latencyReset();
+const LogHistogram& latencyHistogram(LatencySpan span);
+const char* latencySpanName(LatencySpan span);
+
+// Export
+void latencyPrintReport(Print& out);
+size_t latencyExport(Print& out);
+
+#endif // LATENCY_H
@@ -0,0 +1,74 @@
+/**
+ * ══════════════════════════════════════════════════════════════════════════
+ *                    🖤🛣️ LOG MESSAGE TABLE 🛣️🖤
+ * ══════════════════════════════════════════════════════════════════════════
+ *
+ * Every log line the firmware can emit. Records carry only the message's
+ * position in this table plus its raw arguments; the format string stays
+ * in flash. tools/log_decode.py reads this file to turn binary captures
+ * back into text, so append new messages at the end and keep each entry
+ * on one line.
+ *
+ *   X(name, module, level, "printf format")
+ */
+
+#ifndef LOG_MESSAGES_H
+#define LOG_MESSAGES_H
+
+#define LOG_MODULES(X) \
+  X(SYS,   "sys")   \
+  X(NET,   "net")   \
+  X(WS,    "ws")    \
+  X(UI,    "ui")    \
+  X(TOUCH, "touch") \
+  X(DATA,  "data")
+
+#define LOG_MESSAGES(X) \
+  X(SEARCH_UNAVAILABLE,     SYS,   WARN,  "✗ Search index unavailable (no data partition)") \
+  X(WIFI_CONNECTING,        NET,   INFO,  "Connecting to WiFi: %s") \
+  X(WIFI_CONNECTED,         NET,   INFO,  "✓ WiFi connected, IP %u.%u.%u.%u") \
+  X(WIFI_FAILED,            NET,   WARN,  "✗ WiFi connection failed") \
+  X(WS_CONNECTING,          WS,    INFO,  "Connecting to WebSocket: %s") \
+  X(WS_CONNECTED,           WS,    INFO,  "✓ WebSocket Connected") \
+  X(WS_DISCONNECTED,        WS,    WARN,  "✗ WebSocket Disconnected") \
+  X(WS_ERROR,               WS,    ERROR, "✗ WebSocket Error") \
+  X(WS_RECEIVED,            WS,    DEBUG, "← Received: %u bytes") \
+  X(WS_RECEIVED_FRAGMENTS,  WS,    DEBUG, "← Received: %u bytes (fragmented)") \
+  X(WS_OVERSIZED,           WS,    ERROR, "✗ Message over %u byte arena, dropped") \
+  X(WS_UNKNOWN_BINARY,      WS,    WARN,  "✗ Unknown binary message (%u bytes)") \
+  X(JSON_ERROR,             DATA,  ERROR, "JSON parse error: %s") \
+  X(AGENT_DIFF_GAP,         DATA,  WARN,  "✗ Agent diff out of sequence") \
+  X(AGENT_DIFF_BAD,         DATA,  ERROR, "✗ Bad agent diff") \
+  X(TICK_FRAME_BAD,         DATA,  ERROR, "✗ Bad tick frame") \
+  X(INDEX_START_FAILED,     DATA,  ERROR, "✗ Search index: cannot start snapshot") \
+  X(INDEX_SNAPSHOT_DROPPED, DATA,  WARN,  "✗ Search index: snapshot out of order or full, dropped") \
+  X(INDEX_SYNCED,           DATA,  INFO,  "✓ Search index v%lu: %lu projects") \
+  X(INDEX_COMMIT_FAILED,    DATA,  ERROR, "✗ Search index: snapshot commit failed") \
+  X(TOUCH,                  TOUCH, DEBUG, "Touch: x=%d, y=%d") \
+  X(SWIPE,                  TOUCH, INFO,  "Swipe %s") \
+  X(SCREEN,                 UI,    INFO,  "→ Screen: %s") \
+  X(PROJECT_OPEN,           UI,    INFO,  "→ Project #%lu %s") \
+  X(NOTIFICATION,           UI,    INFO,  "📢 Notification: %s") \
+  X(WS_SWITCH,              WS,    WARN,  "⇄ Switching to %s (%s)") \
+  X(WS_ALL_BACKING_OFF,     WS,    WARN,  "✗ All WebSocket endpoints backing off") \
+  X(WS_RECOVERED,           WS,    INFO,  "✓ WebSocket back after %lu ms") \
+  X(CMD_SENT,               NET,   INFO,  "→ Command %lu %s %lu via %s") \
+  X(CMD_RETRY,              NET,   WARN,  "⟳ Command %lu attempt %u via %s") \
+  X(CMD_ACKED,              NET,   INFO,  "✓ Command %lu acked in %lu ms via %s") \
+  X(CMD_FAILED,             NET,   WARN,  "✗ Command %lu failed: %s") \
+  X(ANOMALY,                DATA,  WARN,  "⚠ Anomaly: %s") \
+  X(EVENT_TRIAGED,          DATA,  DEBUG, "Event %s %u%% in %lu us%s: %s") \
+  X(VECTOR_UNAVAILABLE,     SYS,   WARN,  "✗ Vector index unavailable, no related projects") \
+  X(VECTOR_SYNCED,          DATA,  INFO,  "✓ Vector index v%lu: %u projects, %u lists") \
+  X(VECTOR_SNAPSHOT_FAILED, DATA,  ERROR, "✗ Vector index: snapshot failed") \
+  X(RELATED,                UI,    INFO,  "→ Related to #%lu: %u in %lu us") \
+  X(INFERENCE,              NET,   DEBUG, "Inference %s in %lu ms") \
+  X(INFERENCE_SAVED,        DATA,  DEBUG, "Inference cache saved, %u bytes") \
+  X(BOOT_RESTORED,          SYS,   INFO,  "Dashboard restored from snapshot, %u bytes") \
+  X(BOOT_FIRST_FRAME,       UI,    INFO,  "First frame %lu ms after start%s") \
+  X(BOOT_FRESH,             DATA,  INFO,  "Fresh data %lu ms after start") \
+  X(BOOT_SAVED,             DATA,  DEBUG, "Boot snapshot saved, %u bytes") \
+  X(METRICS_HTTP,           NET,   INFO,  "Metrics at http://%u.%u.%u.%u:%u/metrics") \
+  X(METRICS_HTTP_FAILED,    NET,   WARN,  "✗ Metrics endpoint could not listen on port %u")
+
+#endif // LOG_MESSAGES_H
@@ -0,0 +1,416 @@
+/**
+ * ══════════════════════════════════════════════════════════════════════════
+ *                    🖤🛣️ DEFERRED BINARY LOGGER 🛣️🖤
+ * ══════════════════════════════════════════════════════════════════════════
+ */
+
+#include "logger.h"
+
+#include <stdio.h>
+
+#ifndef ARDUINO
+#include <chrono>
+#endif
+
+#define RING_MASK (LOG_RING_BYTES - 1)
+
+static_assert((LOG_RING_BYTES & RING_MASK) == 0, "ring size must be a power of two");
+static_assert(LOG_RECORD_MAX <= 255, "record length is one byte");
+
+#define LOG_MESSAGE_ENTRY(name, module, level, format) { format, LOG_MOD_##module, LOG_##level },
+const LogMessage logMessages[LOG_MESSAGE_COUNT] = { LOG_MESSAGES(LOG_MESSAGE_ENTRY) };
+
+#define LOG_MODULE_NAME(name, label) label,
+static const char* const moduleNames[LOG_MODULE_COUNT] = { LOG_MODULES(LOG_MODULE_NAME) };
+static const char* const levelNames[LOG_LEVEL_COUNT] = { "error", "warn", "info", "debug" };
+
+#define LOG_MODULE_DEFAULT(name, label) LOG_INFO,
+uint8_t logLevels[LOG_MODULE_COUNT] = { LOG_MODULES(LOG_MODULE_DEFAULT) };
+
+static LogRing ring;
+
+uint32_t logClock() {
+#ifdef ARDUINO
+  return millis();
+#else
+  using namespace std::chrono;
+  return (uint32_t)duration_cast<milliseconds>(steady_clock::now().time_since_epoch()).count();
+#endif
+}
+
+// ══════════════════════════════════════════════════════════════════════════
+// RING
+// ══════════════════════════════════════════════════════════════════════════
+
+bool LogRing::push(const uint8_t* record, uint8_t length) {
+  uint32_t h = head.load(std::memory_order_relaxed);
+  uint32_t used = h - tail.load(std::memory_order_acquire);
+  uint32_t need = (uint32_t)length + 1;
+  if (need > LOG_RING_BYTES - used) {
+    counters.dropped++;
+    return false;
+  }
+
+  buffer[h & RING_MASK] = length;
+  uint32_t at = (h + 1) & RING_MASK;
+  uint32_t first = LOG_RING_BYTES - at;
+  if (first > length) first = length;
+  memcpy(buffer + at, record, first);
+  memcpy(buffer, record + first, length - first);
+  head.store(h + need, std::memory_order_release);
+
+  counters.written++;
+  if (used + need > counters.highWater) counters.highWater = used + need;
+  return true;
+}
+
+uint8_t LogRing::pop(uint8_t* out) {
+  uint32_t t = tail.load(std::memory_order_relaxed);
+  if (t == head.load(std::memory_order_acquire)) return 0;
+
+  uint8_t length = buffer[t & RING_MASK];
+  uint32_t at = (t + 1) & RING_MASK;
+  uint32_t first = LOG_RING_BYTES - at;
+  if (first > length) first = length;
+  memcpy(out, buffer + at, first);
+  memcpy(out + first, buffer, length - first);
+  tail.store(t + 1 + length, std::memory_order_release);
+  return length;
+}
+
+// ══════════════════════════════════════════════════════════════════════════
+// RECORDING
+// ══════════════════════════════════════════════════════════════════════════
+
+void LogWriter::put(const char* s) {
+  if (!s) s = "(null)";
+  if (length >= LOG_RECORD_MAX) return;
+  size_t n = strnlen(s, LOG_STR_MAX);
+  if (n > (size_t)(LOG_RECORD_MAX - length - 1)) n = LOG_RECORD_MAX - length - 1;
+  bytes[length++] = (uint8_t)n;
+  raw(s, n);
+}
+
+#ifdef ARDUINO
+static TaskHandle_t drainTask = nullptr;
+#endif
+
+void logCommit(const LogWriter& record) {
+#ifdef ARDUINO
+  // Only an empty -> non-empty transition needs to wake the drain task
+  bool wake = ring.empty();
+  if (ring.push(record.data(), record.size()) && wake && drainTask) xTaskNotifyGive(drainTask);
+#else
+  ring.push(record.data(), record.size());
+#endif
+}
+
+// ══════════════════════════════════════════════════════════════════════════
+// FORMATTING
+// ══════════════════════════════════════════════════════════════════════════
+
+struct ArgReader {
+  const uint8_t* p;
+  const uint8_t* end;
+
+  bool take(void* out, size_t n) {
+    if ((size_t)(end - p) < n) return false;
+    memcpy(out, p, n);
+    p += n;
+    return true;
+  }
+};
+
+static inline bool isDigit(char c) {
+  return c >= '0' && c <= '9';
+}
+
+size_t logFormat(char* out, size_t capacity, const char* format, const uint8_t* args, size_t length) {
+  if (!capacity) return 0;
+  ArgReader in = { args, args + length };
+  size_t n = 0;
+  const char* f = format;
+
+  while (*f && n + 1 < capacity) {
+    if (*f != '%') {
+      out[n++] = *f++;
+      continue;
+    }
+    if (f[1] == '%') {
+      out[n++] = '%';
+      f += 2;
+      continue;
+    }
+
+    // %[flags][width][.precision][length]conversion; width and precision
+    // are kept, the length modifier only tells how many bytes were stored
+    const char* start = f++;
+    while (*f == '-' || *f == '+' || *f == ' ' || *f == '#' || *f == '0') f++;
+    while (isDigit(*f)) f++;
+    if (*f == '.') {
+      f++;
+      while (isDigit(*f)) f++;
+    }
+    size_t specLen = f - start;
+
+    size_t intBytes = 4;
+    if (f[0] == 'l' && f[1] == 'l') { intBytes = 8; f += 2; }
+    else if (*f == 'l') { intBytes = sizeof(long) > 4 ? 8 : 4; f++; }
+    else if (*f == 'z') { intBytes = sizeof(size_t) > 4 ? 8 : 4; f++; }
+    else if (*f == 't') { intBytes = sizeof(ptrdiff_t) > 4 ? 8 : 4; f++; }
+    else if (*f == 'j') { intBytes = 8; f++; }
+    while (*f == 'h') f++;  // short and char arguments were promoted to int
+
+    char conv = *f;
+    if (!conv) break;
+    f++;
+
+    char spec[24];
+    if (specLen > sizeof(spec) - 4) specLen = sizeof(spec) - 4;
+    memcpy(spec, start, specLen);
+
+    size_t room = capacity - n;
+    int written = 0;
+    bool ok = true;
+    switch (conv) {
+      case 'd': case 'i': {
+        int64_t v = 0;
+        if (intBytes == 8) ok = in.take(&v, 8);
+        else { int32_t v32 = 0; ok = in.take(&v32, 4); v = v32; }
+        memcpy(spec + specLen, "lld", 4);
+        if (ok) written = snprintf(out + n, room, spec, (long long)v);
+        break;
+      }
+      case 'u': case 'x': case 'X': case 'o': {
+        uint64_t v = 0;
+        if (intBytes == 8) ok = in.take(&v, 8);
+        else { uint32_t v32 = 0; ok = in.take(&v32, 4); v = v32; }
+        spec[specLen] = 'l';
+        spec[specLen + 1] = 'l';
+        spec[specLen + 2] = conv;
+        spec[specLen + 3] = '\0';
+        if (ok) written = snprintf(out + n, room, spec, (unsigned long long)v);
+        break;
+      }
+      case 'c': {
+        int32_t v = 0;
+        ok = in.take(&v, 4);
+        memcpy(spec + specLen, "c", 2);
+        if (ok) written = snprintf(out + n, room, spec, (int)v);
+        break;
+      }
+      case 'f': case 'F': case 'e': case 'E': case 'g': case 'G': case 'a': case 'A': {
+        float v = 0;
+        ok = in.take(&v, 4);
+        spec[specLen] = conv;
+        spec[specLen + 1] = '\0';
+        if (ok) written = snprintf(out + n, room, spec, (double)v);
+        break;
+      }
+      case 's': {
+        uint8_t len = 0;
+        char text[LOG_STR_MAX + 1];
+        ok = in.take(&len, 1) && len <= LOG_STR_MAX && in.take(text, len);
+        if (ok) text[len] = '\0';
+        memcpy(spec + specLen, "s", 2);
+        if (ok) written = snprintf(out + n, room, spec, text);
+        break;
+      }
+      case 'p': {
+        uint32_t v = 0;
+        ok = in.take(&v, 4);
+        if (ok) written = snprintf(out + n, room, "0x%08lx", (unsigned long)v);
+        break;
+      }
+      default:
+        // Unknown conversion: copy it through untouched
+        written = snprintf(out + n, room, "%.*s%c", (int)specLen, start, conv);
+        break;
+    }
+    // Record cut short (LOG_RECORD_MAX): mark the missing argument
+    if (!ok) written = snprintf(out + n, room, "?");
+    if (written > 0) n += (size_t)written < room ? (size_t)written : room - 1;
+  }
+
+  out[n] = '\0';
+  return n;
+}
+
+uint8_t logNext(uint8_t* record) {
+  return ring.pop(record);
+}
+
+size_t logFormatRecord(char* out, size_t capacity, const uint8_t* record, uint8_t length) {
+  uint16_t id;
+  if (length < 6) return 0;
+  memcpy(&id, record, 2);
+  if (id >= LOG_MESSAGE_COUNT) {
+    char unknown[24];
+    snprintf(unknown, sizeof(unknown), "<message %u>", id);
+    return logFormat(out, capacity, unknown, nullptr, 0);
+  }
+  return logFormat(out, capacity, logMessages[id].format, record + 6, length - 6);
+}
+
+// ══════════════════════════════════════════════════════════════════════════
+// LEVELS & STATS
+// ══════════════════════════════════════════════════════════════════════════
+
+LogStats logStats() {
+  return ring.stats();
+}
+
+uint16_t logTableHash() {
+  // CRC-16/CCITT-FALSE over each format and its terminating NUL
+  uint16_t crc = 0xFFFF;
+  for (uint16_t i = 0; i < LOG_MESSAGE_COUNT; i++) {
+    const char* s = logMessages[i].format;
+    do {
+      crc ^= (uint16_t)((uint8_t)*s << 8);
+      for (int b = 0; b < 8; b++) crc = (crc & 0x8000) ? (uint16_t)((crc << 1) ^ 0x1021) : (uint16_t)(crc << 1);
+    } while (*s++);
+  }
+  return crc;
+}
+
+const char* logModuleName(uint8_t module) {
+  return module < LOG_MODULE_COUNT ? moduleNames[module] : "?";
+}
+
+const char* logLevelName(uint8_t level) {
+  return level < LOG_LEVEL_COUNT ? levelNames[level] : "?";
+}
+
+bool logSetLevel(const char* module, const char* level) {
+  uint8_t lv = 0;
+  while (lv < LOG_LEVEL_COUNT && strcmp(level, levelNames[lv]) != 0) lv++;
+  if (lv == LOG_LEVEL_COUNT) return false;
+
+  bool all = strcmp(module, "all") == 0;
+  bool found = false;
+  for (uint8_t m = 0; m < LOG_MODULE_COUNT; m++) {
+    if (all || strcmp(module, moduleNames[m]) == 0) {
+      logLevels[m] = lv;
+      found = true;
+    }
+  }
+  return found;
+}
+
+// ══════════════════════════════════════════════════════════════════════════
+// DRAIN TASK
+// ══════════════════════════════════════════════════════════════════════════
+
+#ifdef ARDUINO
+
+#define LOG_TASK_STACK    4096
+#define LOG_TASK_PRIORITY 1     // above idle, below WiFi and the loop's core
+#define LOG_TASK_CORE     0
+#define LOG_POLL_MS       1000  // catches a wake-up lost to a concurrent drain
+
+static Print* sink = nullptr;
+static volatile LogOutput output = LOG_OUTPUT_TEXT;
+static uint32_t reportedDrops = 0;
+static uint16_t tableHash = 0;
+
+static uint8_t crc8(uint8_t crc, const uint8_t* data, size_t n) {
+  while (n--) {
+    crc ^= *data++;
+    for (int i = 0; i < 8; i++) crc = (crc & 0x80) ? (uint8_t)((crc << 1) ^ 0x07) : (uint8_t)(crc << 1);
+  }
+  return crc;
+}
+
+static uint32_t newDrops() {
+  uint32_t dropped = ring.stats().dropped;
+  uint32_t fresh = dropped - reportedDrops;
+  reportedDrops = dropped;
+  return fresh;
+}
+
+static void drainText() {
+  uint8_t record[LOG_RECORD_MAX];
+  char line[LOG_LINE_MAX];
+
+  uint32_t drops = newDrops();
+  if (drops) {
+    int n = snprintf(line, sizeof(line), "[%6lu.%03lu] %-5s … %lu records dropped\n",
+      (unsigned long)(millis() / 1000), (unsigned long)(millis() % 1000), "log", (unsigned long)drops);
+    sink->write((const uint8_t*)line, n);
+  }
+
+  while (uint8_t length = ring.pop(record)) {
+    uint16_t id;
+    uint32_t time;
+    memcpy(&id, record, 2);
+    memcpy(&time, record + 2, 4);
+    int n = snprintf(line, sizeof(line), "[%6lu.%03lu] %-5s ", (unsigned long)(time / 1000),
+      (unsigned long)(time % 1000), id < LOG_MESSAGE_COUNT ? moduleNames[logMessages[id].module] : "?");
+    n += logFormatRecord(line + n, sizeof(line) - n - 1, record, length);
+    line[n++] = '\n';
+    sink->write((const uint8_t*)line, n);
+  }
+}
+
+// Payload: version, table hash u16, records dropped since the last frame
+// (varint), then [len u8][record] until the frame is full or the ring empty
+static void drainBinary() {
+  static uint8_t frame[LOG_FRAME_MAX + 5];
+  uint8_t* payload = frame + 4;
+
+  for (;;) {
+    size_t n = 0;
+    payload[n++] = LOG_FRAME_VERSION;
+    payload[n++] = tableHash & 0xFF;
+    payload[n++] = tableHash >> 8;
+    uint32_t drops = newDrops();
+    while (drops >= 0x80) {
+      payload[n++] = (uint8_t)(drops | 0x80);
+      drops >>= 7;
+    }
+    payload[n++] = (uint8_t)drops;
+    size_t header = n;
+
+    while (n + 1 + LOG_RECORD_MAX <= LOG_FRAME_MAX) {
+      uint8_t length = ring.pop(payload + n + 1);
+      if (!length) break;
+      payload[n] = length;
+      n += 1 + length;
+    }
+    if (n == header && payload[header - 1] == 0) return;  // nothing new at all
+
+    frame[0] = LOG_FRAME_SYNC;
+    frame[1] = LOG_FRAME_TYPE;
+    frame[2] = n & 0xFF;
+    frame[3] = n >> 8;
+    payload[n] = crc8(0, payload, n);
+    sink->write(frame, n + 5);
+    if (ring.empty()) return;
+  }
+}
+
+static void logTask(void*) {
+  for (;;) {
+    ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(LOG_POLL_MS));
+    if (output == LOG_OUTPUT_BINARY) drainBinary();
+    else drainText();
+  }
+}
+
+void logBegin(Print& out) {
+  sink = &out;
+  tableHash = logTableHash();
+  if (!drainTask) {
+    xTaskCreatePinnedToCore(logTask, "log", LOG_TASK_STACK, nullptr, LOG_TASK_PRIORITY, &drainTask, LOG_TASK_CORE);
+  }
+}
+
+void logSetOutput(LogOutput mode) {
+  output = mode;
+}
+
+LogOutput logOutput() {
+  return output;
+}
+
+#endif
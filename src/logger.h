@@ -0,0 +1,202 @@
+/**
+ * ══════════════════════════════════════════════════════════════════════════
+ *                    🖤🛣️ DEFERRED BINARY LOGGER 🛣️🖤
+ * ══════════════════════════════════════════════════════════════════════════
+ *
+ * LOG(NAME, args...) never formats and never touches the UART. It checks
+ * the module's runtime level, then copies a record into a ring buffer:
+ *
+ *   len u8 | message id u16 | millis u32 | raw arguments
+ *
+ * Integers go in as 4 bytes (8 for 64-bit types), floats as 4-byte
+ * floats and strings as a length byte plus up to LOG_STR_MAX bytes. The
+ * format string stays in flash (log_messages.h); the compiler still
+ * checks the arguments against it.
+ *
+ * A low-priority task on the other core drains the ring. In text mode it
+ * formats each record and writes the line to the sink. In binary mode it
+ * forwards raw records in CRC'd frames for tools/log_decode.py. When the
+ * ring is full new records are dropped and counted, never blocked on.
+ *
+ * The ring is single-producer: log from the loop task only.
+ */
+
+#ifndef LOGGER_H
+#define LOGGER_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <atomic>
+#include <type_traits>
+#include "log_messages.h"
+
+#define LOG_RING_BYTES  4096  // power of two
+#define LOG_RECORD_MAX  96    // id + time + arguments
+#define LOG_STR_MAX     40    // longer string arguments are truncated
+#define LOG_LINE_MAX    192
+
+// Binary output framing, as for the latency export:
+// SYNC, TYPE, LEN (u16 LE), PAYLOAD, CRC-8 of payload
+#define LOG_FRAME_SYNC    0xA5
+#define LOG_FRAME_TYPE    'G'
+#define LOG_FRAME_VERSION 1
+#define LOG_FRAME_MAX     512
+
+enum LogLevel : uint8_t {
+  LOG_ERROR = 0,
+  LOG_WARN,
+  LOG_INFO,
+  LOG_DEBUG,
+  LOG_LEVEL_COUNT
+};
+
+enum LogOutput : uint8_t {
+  LOG_OUTPUT_TEXT = 0,
+  LOG_OUTPUT_BINARY
+};
+
+#define LOG_MODULE_ENUM(name, label) LOG_MOD_##name,
+enum LogModule : uint8_t {
+  LOG_MODULES(LOG_MODULE_ENUM)
+  LOG_MODULE_COUNT
+};
+
+#define LOG_MESSAGE_ENUM(name, module, level, format) LOG_ID_##name,
+enum LogMessageId : uint16_t {
+  LOG_MESSAGES(LOG_MESSAGE_ENUM)
+  LOG_MESSAGE_COUNT
+};
+
+struct LogMessage {
+  const char* format;
+  uint8_t module;
+  uint8_t level;
+};
+
+struct LogStats {
+  uint32_t written;
+  uint32_t dropped;    // ring full
+  uint32_t highWater;  // most bytes ever queued
+};
+
+extern const LogMessage logMessages[LOG_MESSAGE_COUNT];
+extern uint8_t logLevels[LOG_MODULE_COUNT];  // most verbose level shown per module
+
+// ══════════════════════════════════════════════════════════════════════════
+// RING
+// ══════════════════════════════════════════════════════════════════════════
+
+class LogRing {
+ public:
+  // Producer side; false (and counted) when the record does not fit
+  bool push(const uint8_t* record, uint8_t length);
+  // Consumer side; returns the record length, 0 when empty
+  uint8_t pop(uint8_t* out);
+
+  bool empty() const { return head.load(std::memory_order_acquire) == tail.load(std::memory_order_acquire); }
+  const LogStats& stats() const { return counters; }
+
+ private:
+  uint8_t buffer[LOG_RING_BYTES];
+  std::atomic<uint32_t> head{0};  // written by the producer only
+  std::atomic<uint32_t> tail{0};  // written by the consumer only
+  LogStats counters = {};
+};
+
+// ══════════════════════════════════════════════════════════════════════════
+// RECORDING
+// ══════════════════════════════════════════════════════════════════════════
+
+class LogWriter {
+ public:
+  LogWriter(uint16_t id, uint32_t time) : length(0) {
+    u16(id);
+    u32(time);
+  }
+
+  template <typename T>
+  typename std::enable_if<std::is_integral<T>::value || std::is_enum<T>::value>::type put(T v) {
+    if (sizeof(T) > 4) u64((uint64_t)v);
+    else u32((uint32_t)v);
+  }
+  void put(float v) { u32(floatBits(v)); }
+  void put(double v) { u32(floatBits((float)v)); }
+  void put(const char* s);
+  void put(char* s) { put((const char*)s); }
+  void put(const void* p) { u32((uint32_t)(uintptr_t)p); }
+
+  const uint8_t* data() const { return bytes; }
+  uint8_t size() const { return length; }
+
+ private:
+  uint8_t bytes[LOG_RECORD_MAX];
+  uint8_t length;
+
+  void raw(const void* src, size_t n) {
+    if (n > (size_t)(LOG_RECORD_MAX - length)) n = LOG_RECORD_MAX - length;
+    memcpy(bytes + length, src, n);  // little-endian target and host
+    length += n;
+  }
+  void u16(uint16_t v) { raw(&v, 2); }
+  void u32(uint32_t v) { raw(&v, 4); }
+  void u64(uint64_t v) { raw(&v, 8); }
+  static uint32_t floatBits(float v) {
+    uint32_t bits;
+    memcpy(&bits, &v, 4);
+    return bits;
+  }
+};
+
+uint32_t logClock();
+void logCommit(const LogWriter& record);
+
+template <typename... Args>
+void logRecord(uint16_t id, Args... args) {
+  LogWriter w(id, logClock());
+  int expand[] = { 0, (w.put(args), 0)... };
+  (void)expand;
+  logCommit(w);
+}
+
+// Never called: lets -Wformat check LOG() arguments against the table
+inline void logFormatCheck(const char*, ...) __attribute__((format(printf, 1, 2)));
+inline void logFormatCheck(const char*, ...) {}
+
+#define LOG_MESSAGE_FN(name, module, level, format)                          \
+  template <typename... Args>                                               \
+  inline void logMsg_##name(Args... args) {                                 \
+    if (false) logFormatCheck(format, args...);                             \
+    if (LOG_##level <= logLevels[LOG_MOD_##module]) logRecord(LOG_ID_##name, args...); \
+  }
+LOG_MESSAGES(LOG_MESSAGE_FN)
+
+#define LOG(name, ...) logMsg_##name(__VA_ARGS__)
+
+// ══════════════════════════════════════════════════════════════════════════
+// DRAINING
+// ══════════════════════════════════════════════════════════════════════════
+
+// Pops the oldest queued record, 0 when the ring is empty
+uint8_t logNext(uint8_t* record);
+// Message text of one record (no timestamp or newline)
+size_t logFormatRecord(char* out, size_t capacity, const uint8_t* record, uint8_t length);
+// printf-style formatting from packed arguments
+size_t logFormat(char* out, size_t capacity, const char* format, const uint8_t* args, size_t length);
+
+LogStats logStats();
+uint16_t logTableHash();  // CRC-16 of every format string, checked by the decoder
+const char* logModuleName(uint8_t module);
+const char* logLevelName(uint8_t level);
+bool logSetLevel(const char* module, const char* level);  // "all" sets every module
+
+#ifdef ARDUINO
+#include <Arduino.h>
+
+// Starts the drain task; records logged before this wait in the ring
+void logBegin(Print& sink);
+void logSetOutput(LogOutput output);
+LogOutput logOutput();
+#endif
+
+#endif // LOGGER_H
@@ -39,6 +39,37 @@
 #include <WiFi.h>
 #include <WebSocketsClient.h>
 #include <ArduinoJson.h>
+#include <esp_timer.h>
+#include "colors.h"
+#include "latency.h"
+#include "profiler.h"
+#include "fmt.h"
+#include "alloc_guard.h"
+#include "json_arena.h"
+#include "project_list.h"
+#include "search_index.h"
+#include "vector_index.h"
+#include "keyboard.h"
+#include "agent_status.h"
+#include "candles.h"
+#include "icon_data.h"
+#include "timer_wheel.h"
+#include "idle.h"
+#include "logger.h"
+#include "ws_session.h"
+#include "notifications.h"
+#include "chart.h"
+#include "metrics.h"
+#include "commands.h"
+#include "quantile_sketch.h"
+#include "anomaly.h"
+#include "text_classifier.h"
+#include "cloud_config.h"
+#include "cloud_services.h"
+#include "inference_cache.h"
+#include "boot_snapshot.h"
+#include "prom_export.h"
+#include <Preferences.h>
 
 // ══════════════════════════════════════════════════════════════════════════
 // CONFIGURATION
@@ -48,31 +79,143 @@
 const char* WIFI_SSID = "your-wifi-ssid";      // Update with your WiFi
 const char* WIFI_PASSWORD = "your-wifi-pass";  // Update with your password
 
-// Backend Configuration
-const char* WS_HOST = "192.168.4.74";  // operator-watcher-server
-const uint16_t WS_PORT = 8080;
-const char* WS_PATH = "/ws";
+// Backend endpoints, most preferred first; ws:// or wss://
+const char* const WS_ENDPOINTS[] = {
+  "ws://192.168.4.74:8080/ws",  // operator-watcher-server on the LAN
+#if ENABLE_DIGITALOCEAN
+  DO_WS_URL,                    // DigitalOcean droplet
+#endif
+};
+
+// Prometheus scrape endpoint (http://<hub>:PORT/metrics); 0 turns it off
+#define HUB_METRICS_PORT 9100
 
 // Display & Touch
 TFT_eSPI tft = TFT_eSPI();
 
-// WebSocket Client
-WebSocketsClient webSocket;
-
-// ══════════════════════════════════════════════════════════════════════════
-// BLACKROAD OFFICIAL BRAND COLORS
-// ══════════════════════════════════════════════════════════════════════════
-
-#define COLOR_HOT_PINK   0xF8B6  // #FF1D6C
-#define COLOR_AMBER      0xFD20  // #F5A623
-#define COLOR_BLUE       0x24DF  // #2979FF
-#define COLOR_VIOLET     0x9136  // #9C27B0
-#define COLOR_BLACK      0x0000
-#define COLOR_WHITE      0xFFFF
-#define COLOR_DARK_GRAY  0x2104
-#define COLOR_LIGHT_GRAY 0x7BEF
-#define COLOR_GREEN      0x07E0
-#define COLOR_RED        0xF800
+// WebSocket Client, driven by the session layer. Exposes its socket so
+// the idle wait can watch it (plain TCP only; TLS sockets report -1)
+class HubWebSocket : public WebSocketsClient, public WsTransport {
+ public:
+  int socketFd() { return _client.tcp ? _client.tcp->fd() : -1; }
+  bool bufferedInput() { return _client.tcp && _client.tcp->available() > 0; }
+
+  void open(const WsEndpoint& e) override {
+    LOG(WS_CONNECTING, e.url);
+    if (!e.secure) begin(e.host, e.port, e.path);
+    else if (WS_CA_CERT) beginSslWithCA(e.host, e.port, e.path, WS_CA_CERT);
+    else beginSSL(e.host, e.port, e.path);
+    // The session decides when to retry and where
+    setReconnectInterval(WS_CONNECT_TIMEOUT_MS);
+  }
+  void close() override {
+    disconnect();
+    _port = 0;  // stops the library's own reconnect to this endpoint
+  }
+  bool send(const char* text) override { return sendTXT(text); }
+};
+HubWebSocket webSocket;
+WsSession wsSession;
+uint32_t wsReceivedUs = 0;  // arrival of the message being parsed, for pong RTT
+
+// Deploy and restart commands: over the WebSocket while the session is
+// up, else (or after an unanswered attempt) through the HTTP worker
+class HubCommandSink : public CommandSink {
+ public:
+  bool wsUp() override { return wsSession.connected(); }
+  bool send(CommandRoute route, uint32_t id, const char* json) override {
+    if (route == CMD_VIA_WS) return webSocket.sendTXT(json);
+    if constexpr (DigitalOceanService::enabled) return commandHttpPost(id, json);
+    return false;
+  }
+};
+HubCommandSink commandSink;
+CommandQueue commands;
+
+// Cloud integrations compiled into this build
+Cloud cloud;
+
+// Reassembly of fragmented messages, lives in the JSON arena
+ArenaMessageBuffer wsMessage(jsonArena);
+bool wsMessageBinary = false;
+
+// Projects list, paged in from the backend as it scrolls
+#define PROJECT_LIST_TOP 150
+#define PROJECT_LIST_HEIGHT 138
+ProjectPageCache projectPages;
+ProjectListView projectList;
+
+// Project search: flash index synced from the backend + on-screen keyboard
+#define SEARCH_BAR_Y 54
+#define SEARCH_RESULTS_Y 88
+#define SEARCH_ROWS 6
+#define SEARCH_ROW_H 13
+#define SEARCH_ACTION_X 190  // "deploy" at the end of a result row
+#define KEYBOARD_Y 168
+#define SEARCH_KEY_BUDGET_US 8000   // per keystroke, keeps typing under 10ms
+#define SEARCH_IDLE_BUDGET_US 2000  // per loop() while a scan or compaction runs
+#define SEARCH_SYNC_MS 60000
+PartitionSearchStorage searchStorage;
+StorageSlice searchSlice;   // the partition minus the vector cache
+SearchIndex searchIndex;
+OnScreenKeyboard keyboard;
+bool searchOpen = false;
+char searchText[SEARCH_NAME_MAX] = "";
+uint8_t searchLength = 0;
+SearchMode searchMode = SEARCH_PREFIX;
+uint16_t searchShown = 0;
+bool searchShownComplete = false;
+
+// Related projects: embedding cache at the tail of the search partition,
+// shown in place of the search results for the tapped hit
+StorageSlice vectorSlice;
+VectorIndex vectorIndex;
+uint32_t relatedFor = 0;
+char relatedName[SEARCH_NAME_MAX] = "";
+VectorHit relatedHits[VECTOR_MAX_RESULTS];
+uint8_t relatedCount = 0;
+uint32_t relatedUs = 0;
+uint64_t relatedSummaryKey = 0;  // Enclave's line about the project
+bool relatedSummaryFailed = false;
+
+// Live status of every agent, 2 bits each, kept current by binary diffs
+#define HEATMAP_X 8
+#define HEATMAP_Y 190
+#define HEATMAP_W 224  // 14 status words per row
+#define HEATMAP_ROWS ((AGENT_MAX + HEATMAP_W - 1) / HEATMAP_W)
+#define AGENT_GROUP_Y 108
+#define AGENT_GROUP_ROW_H 13
+#define AGENT_GROUP_ACTION_X 150  // taps right of this restart the group
+AgentStatusTable agentStatus;
+uint32_t agentApplyUs = 0;
+
+// RoadCoin ticks aggregated into candles; only the newest candle repaints
+#define FINANCE_PRICE_Y 95
+#define FINANCE_CHANGE_Y 125
+#define FINANCE_STATS_Y 210
+#define CANDLE_TABS_Y 150
+#define CANDLE_CHART_X 10
+#define CANDLE_CHART_Y 165
+#define CANDLE_CHART_W 220
+#define CANDLE_CHART_H 40
+#define CANDLE_W 5                 // 3px body, 2px gap
+#define CANDLE_VISIBLE (CANDLE_CHART_W / CANDLE_W)
+#define CANDLE_FRAME_MS 50         // repaint cap while a burst streams in
+CandleAggregator candles;
+CandleFrame candleFrame = CANDLE_5M;
+bool tickStream = false;           // server ticks seen; their clock replaces ours
+uint8_t candlesOpened = 0;         // frames that opened a candle since the last paint
+uint32_t lastCandleDraw = 0;
+uint32_t tickApplyUs = 0;
+Price chartLow = 0;                // scale the chart was last drawn with
+Price chartHigh = 0;
+
+// Every price shown since boot, one sample per second of uptime, drawn
+// as a line decimated to the chart width; the fourth chart tab
+ChartSeries priceHistory;
+uint32_t priceHistorySecond = 0;
+Price priceHistoryLast = 0;
+bool priceLineView = false;
 
 // ══════════════════════════════════════════════════════════════════════════
 // APP SCREENS & STATE
@@ -92,8 +235,9 @@ const char* screenNames[] = {
   "HOME", "PROJECTS", "AI", "FINANCE", "STUDIO", "SETTINGS"
 };
 
-const char* screenIcons[] = {
-  "🏠", "📊", "🤖", "💰", "🎨", "⚙️"
+// Compiled from assets/icons; the GLCD font has no emoji
+const Icon* const screenIcons[] = {
+  &ICON_HOME, &ICON_PROJECTS, &ICON_AI, &ICON_FINANCE, &ICON_STUDIO, &ICON_SETTINGS
 };
 
 // State
@@ -102,38 +246,140 @@ Screen previousScreen = SCREEN_HOME;
 bool wifiConnected = false;
 bool wsConnected = false;
 
-// Data
+// Data; the boot snapshot replaces these first-boot seeds
 uint32_t projectCount = 30247;
 uint32_t agentCount = 15892;
-float roadCoinPrice = 0.42;
-float roadCoinChange24h = 5.23;
+int32_t roadCoinChangeBp = 523;   // 24h change, basis points
 uint32_t activeAgents = 47;
 uint32_t cpuUsage = 0;
 uint32_t memUsage = 0;
 uint32_t networkTraffic = 0;
 
-// Notifications
-struct Notification {
-  char message[100];
-  uint16_t color;
-  unsigned long timestamp;
-  bool active;
+// Rolling p50/p95/p99 of the system metrics, for the Home panel
+MetricWindowsT<SKETCH_BUCKETS_PERCENT> cpuWindows;
+MetricWindowsT<SKETCH_BUCKETS_PERCENT> memWindows;
+MetricWindowsT<SKETCH_BUCKETS_WIDE> networkWindows;
+SketchWindow homeWindow = SKETCH_1H;
+#define HOME_METRICS_Y 229
+#define HOME_QUANTILE_X 136  // p50, p95, p99 columns
+#define HOME_QUANTILE_W 34
+
+// Local alerts on every metric stream, no server involved
+enum AnomalyMetric : uint8_t {
+  ANOMALY_CPU = 0,
+  ANOMALY_MEMORY,
+  ANOMALY_NETWORK,
+  ANOMALY_PRICE,
+  ANOMALY_HEAP,
+  ANOMALY_METRICS
 };
-
-#define MAX_NOTIFICATIONS 5
-Notification notifications[MAX_NOTIFICATIONS];
-int notificationCount = 0;
+AnomalyDetector anomalyDetectors[ANOMALY_METRICS];
+
+// Event text is triaged on the hub; below this confidence Hugging Face
+// gets a say too
+#define TRIAGE_MIN_CONFIDENCE 70
+uint32_t eventsTriaged = 0;
+uint32_t eventsAsked = 0;
+
+// Event text waiting on its sentiment call, by inference key; 0 is free
+#define TRIAGE_PENDING 4
+struct TriagePending {
+  uint64_t key;
+  char text[NOTIFY_MSG_LEN];
+};
+TriagePending triagePending[TRIAGE_PENDING] = {};
+uint8_t triagePendingNext = 0;
+
+// Cloud inference results by content hash; a waiter bit per caller
+#define INFER_SAVE_MS 600000  // flash write at most every 10 min, when changed
+enum InferWaiter : uint8_t {
+  INFER_FOR_SERIAL = 0x01,
+  INFER_FOR_RELATED = 0x02,
+  INFER_FOR_TRIAGE = 0x04
+};
+InferenceCache inference;
+
+// The dashboard as last seen, kept in NVS so boot paints it before WiFi
+// is up; marked stale until the server sends something fresh
+#define BOOT_SAVE_MS 120000  // flash write at most every 2 min, when changed
+#define BOOT_SEED_PRICE 420000
+BootSnapshot bootSaved = {};  // what flash holds
+bool bootRestored = false;
+bool dashboardStale = true;
+
+// Boot timeline in µs since start; 0 until reached
+struct BootTimes {
+  uint32_t firstFrame;
+  uint32_t setupDone;
+  uint32_t wifiUp;
+  uint32_t wsUp;
+  uint32_t freshData;
+};
+BootTimes bootTimes = {};
+
+// Counters for the /metrics endpoint, bumped where the work happens and
+// only formatted when scraped
+struct HubCounters {
+  uint32_t wifiConnects;
+  uint32_t wifiFailures;
+  uint32_t wsText;
+  uint32_t wsBinary;
+  uint32_t wsBytes;
+  uint32_t jsonErrors;
+};
+HubCounters hubCounters = {};
+LogHistogram frameHistogram;   // drawCurrentScreen(), µs
+LogHistogram parseHistogram;   // deserializeJson() of one message, µs
+
+// Notifications: toasts over the header bar, the one band no screen
+// draws into. Each is composited in a sprite, and the panel pixels it
+// covers are kept so taking it down repaints only those
+#define TOAST_X     5
+#define TOAST_Y     20
+#define TOAST_W     230
+#define TOAST_H     9
+#define TOAST_PITCH 10
+#define TOAST_ROWS  3
+NotificationQueue notifications;
+TFT_eSprite toastSprite = TFT_eSprite(&tft);
+bool toastSpriteReady = false;
+uint16_t toastUnder[TOAST_ROWS][TOAST_W * TOAST_H];
+uint8_t toastRows = 0;            // toasts on the panel, their pixels in toastUnder
+uint32_t toastRevision = 0;       // notifications.revision() they show
 
 // Touch state
 int16_t touchX = 0, touchY = 0;
 bool touched = false;
 unsigned long lastTouchTime = 0;
+bool swiping = false;             // a debounced touch is down; release checks the swipe
 int16_t swipeStartX = 0, swipeStartY = 0;
-
-// Timers
-unsigned long lastUpdate = 0;
-unsigned long lastPing = 0;
-unsigned long lastMetricsUpdate = 0;
+bool listTouching = false;        // every sample since press, debounce or not
+
+// Scheduled work; loop() waits for the next deadline instead of polling
+#define METRICS_MS 5000
+#define SIMULATE_MS 10000
+#define TICK_SIM_MS 250
+#define RECONNECT_MS 30000
+#define WIFI_POLL_MS 250
+#define WIFI_TIMEOUT_MS 10000
+#define HEALTH_MS 5000     // free-heap sample for the anomaly detector
+#define IDLE_BUSY_MS 2     // loop pace while a gesture, scroll or scan is running
+#define TOUCH_IRQ_PIN 36   // XPT2046 PENIRQ, low while pressed
+TimerWheel timers;
+TimerId metricsTimer;
+TimerId indexSyncTimer;
+TimerId simulateTimer;
+TimerId tickSimTimer;
+TimerId reconnectTimer;
+TimerId notifyTimer;
+TimerId candleTimer;
+TimerId sessionTimer;
+TimerId commandTimer;
+TimerId healthTimer;
+TimerId inferSaveTimer;
+TimerId wifiTimer;
+TimerId bootSaveTimer;
+uint32_t wifiStartMs = 0;
 
 // ══════════════════════════════════════════════════════════════════════════
 // FORWARD DECLARATIONS
@@ -146,10 +392,35 @@ void drawStatusBar();
 void drawNotification(const char* msg, uint16_t color);
 void drawHomeScreen();
 void drawProjectsScreen();
+void drawProjectStats();
 void drawAIScreen();
 void drawFinanceScreen();
 void drawStudioScreen();
 void drawSettingsScreen();
+void drawCurrentScreen();
+void refreshCurrentScreen();
+void drawAgentSummary();
+void drawFinancePrice();
+void drawFinanceStats();
+void drawCandleTabs();
+void drawCandleChart(bool full);
+void drawPriceLine(bool full);
+void recordPriceHistory();
+void recordSystemMetrics(uint8_t fields);
+void beginAnomalyDetection();
+void checkAnomaly(AnomalyMetric metric, float value);
+void onHealthTimer();
+void triageEvent(const char* text);
+void triageAnswered(uint64_t key, const char* label);
+InferLookup askInference(InferKind kind, const char* text, const char* context, uint8_t waiter);
+bool drainInferenceResults();
+void loadInferenceCache();
+void saveInferenceCache();
+bool ingestServerSketch(JsonVariantConst msg);
+void drawSystemMetrics();
+int candleY(Price price);
+void drawCandle(int column, const Candle& c);
+void drawAgentHeatmap(bool full);
 void drawMiniChart(int x, int y, int w, int h, uint8_t* data, int dataSize, uint16_t color);
 void drawProgressBar(int x, int y, int w, int h, float percentage, uint16_t color);
 
@@ -166,19 +437,70 @@ int getTappedNavButton(int16_t x);
 
 // Network
 void connectWiFi();
+void onWiFiTimer();
 void connectWebSocket();
 void webSocketEvent(WStype_t type, uint8_t * payload, size_t length);
 void sendMetricsRequest();
-void parseMetricsData(const char* json);
+bool requestProjectPage(uint32_t cursor, uint16_t limit);
+void requestIndexSync(bool full);
+void requestVectorSync(bool full);
+void ingestIndexSnapshot(JsonVariantConst msg);
+void ingestIndexDelta(JsonVariantConst msg);
+void requestAgentSnapshot();
+void handleBinaryMessage(const uint8_t* data, size_t length);
+void ingestAgentGroups(JsonVariantConst msg);
+void simulateAgentDiff();
+void handleAgentStatus(const uint8_t* data, size_t length);
+void ingestTicks(const uint8_t* data, size_t length);
+void simulateTick();
+void parseMetricsData(const char* json, size_t length);
+
+// Commands
+uint32_t submitCommand(CommandKind kind, uint32_t target);
+bool drainCommandResults();
+void serviceCommands();
+void onCommandChange(const Command& cmd);
+void drawCommandLabel(int x, int y, const Command* cmd, const char* action);
+
+// Project search
+void openSearch();
+void closeSearch();
+void runSearch();
+void searchKey(char key);
+void handleSearchTap(int16_t x, int16_t y);
+void handleAgentTap(int16_t x, int16_t y);
+void drawSearchBar();
+void drawSearchResults(bool force);
+void showRelated(uint32_t id, const char* name);
+void drawRelated();
+void drawRelatedSummary();
+
+// Boot snapshot
+void restoreBootSnapshot();
+void saveBootSnapshot();
+void markDashboardFresh();
+
+// Metrics endpoint
+void collectHubMetrics(PromWriter& w);
+
+// Scheduler
+void beginTimers();
+void serviceLoop();
+void idleUntilDue();
+void requestCandleRepaint();
 
 // Notifications
-void addNotification(const char* msg, uint16_t color);
+void addNotification(const char* msg, uint16_t color, uint8_t priority = NOTIFY_INFO);
+void raiseNotification(const char* msg, uint16_t color, uint8_t priority);
 void updateNotifications();
 void drawNotifications();
 
-// Utils
-String formatNumber(uint32_t num);
-String formatBytes(uint32_t bytes);
+// Serial console
+void handleSerialCommands();
+void runSerialCommand(const char* cmd);
+
+// Debug overlays
+void drawLatencyOverlay();
 
 // ══════════════════════════════════════════════════════════════════════════
 // SETUP
@@ -186,7 +508,7 @@ String formatBytes(uint32_t bytes);
 
 void setup() {
   Serial.begin(115200);
-  delay(100);
+  logBegin(Serial);
 
   Serial.println("\n\n══════════════════════════════════════════");
   Serial.println("   🖤🛣️ BLACKROAD CEO HUB v2.0 🛣️🖤");
@@ -198,57 +520,86 @@ void setup() {
   // Initialize display
   tft.init();
   tft.setRotation(0);  // Portrait mode
-  tft.fillScreen(COLOR_BLACK);
-
-  // Set backlight (Pin 21 on ESP32-2432S028R)
-  pinMode(21, OUTPUT);
-  digitalWrite(21, HIGH);
-
-  // Show boot logo
-  tft.setTextColor(COLOR_HOT_PINK, COLOR_BLACK);
-  tft.setTextSize(3);
-  tft.setCursor(20, 100);
-  tft.println("BLACKROAD");
 
-  tft.setTextColor(COLOR_AMBER, COLOR_BLACK);
-  tft.setTextSize(2);
-  tft.setCursor(30, 140);
-  tft.println("CEO HUB v2.0");
+  // Last dashboard from flash; nothing slow runs before it is on screen
+  restoreBootSnapshot();
 
-  tft.setTextColor(COLOR_BLUE, COLOR_BLACK);
-  tft.setTextSize(1);
-  tft.setCursor(30, 180);
-  tft.println("Initializing systems...");
-
-  delay(1000);
+  // Timers first: connecting and notifying already schedule work
+  beginTimers();
 
   // Initialize touch calibration (if needed)
   uint16_t calData[5] = { 275, 3620, 264, 3532, 1 };
   tft.setTouch(calData);
 
-  // Connect to WiFi
-  tft.setCursor(30, 200);
-  tft.setTextColor(COLOR_VIOLET, COLOR_BLACK);
-  tft.println("Connecting to WiFi...");
-  connectWiFi();
-
-  // Initialize notifications
-  for (int i = 0; i < MAX_NOTIFICATIONS; i++) {
-    notifications[i].active = false;
-  }
-
-  // Draw initial screen
+  // Initialize notifications; without the sprite toasts draw on the panel
+  notifications.clear();
+  toastSpriteReady = toastSprite.createSprite(TOAST_W, TOAST_H) != nullptr;
+  frameHistogram.reset();
+  parseHistogram.reset();
+
+  // Projects list pages are fetched on demand
+  projectPages.begin(requestProjectPage);
+  projectList.begin(&tft, &projectPages, PROJECT_LIST_TOP, PROJECT_LIST_HEIGHT);
+  keyboard.begin(&tft, KEYBOARD_Y);
+
+  agentStatus.clear();
+
+  // Offline the chart starts from the last known price on device uptime
+  candles.begin();
+  beginAnomalyDetection();
+  cpuWindows.begin(millis() / 1000);
+  memWindows.begin(millis() / 1000);
+  networkWindows.begin(millis() / 1000);
+  candles.addTick(millis() / 1000, bootSaved.price > 0 ? bootSaved.price : BOOT_SEED_PRICE, 0);
+  priceHistory.clear();
+  recordPriceHistory();
+
+  // First frame: the restored screen, stale-marked in the status bar
   tft.fillScreen(COLOR_BLACK);
   drawStatusBar();
   drawHeader();
-  drawHomeScreen();
+  drawCurrentScreen();
   drawNavBar();
 
+  // Backlight on only now, so the panel never shows a half-drawn frame
+  // (Pin 21 on ESP32-2432S028R)
+  pinMode(21, OUTPUT);
+  digitalWrite(21, HIGH);
+  bootTimes.firstFrame = micros();
+  LOG(BOOT_FIRST_FRAME, (unsigned long)(bootTimes.firstFrame / 1000), bootRestored ? "" : " (no snapshot)");
+
+  // Endpoint list and probes; the session connects once WiFi is up
+  wsSession.begin(&webSocket, WS_ENDPOINTS, sizeof(WS_ENDPOINTS) / sizeof(WS_ENDPOINTS[0]));
+  webSocket.onEvent(webSocketEvent);
+  wsSession.startProbing();
+
+  // Command IDs start at random so a reboot cannot repeat recent ones
+  commands.begin(&commandSink, onCommandChange, esp_random());
+  cloud.begin([]() -> uint32_t { return micros(); }, []() -> uint32_t { return ESP.getFreeHeap(); });
+  loadInferenceCache();
+
+  // Associates in the background; wifiTimer finishes the job
+  connectWiFi();
+
+  // Project search index lives in the flash data partition; the vector
+  // cache takes its last VECTOR_STORAGE_BYTES when there is room
+  if (searchStorage.begin()) {
+    uint32_t size = searchStorage.size();
+    uint32_t split = size >= 2 * VECTOR_STORAGE_BYTES ? size - VECTOR_STORAGE_BYTES : size;
+    searchSlice.begin(&searchStorage, 0, split);
+    vectorSlice.begin(&searchStorage, split, size - split);
+  }
+  if (!searchIndex.begin(&searchSlice)) LOG(SEARCH_UNAVAILABLE);
+  if (!vectorIndex.begin(&vectorSlice)) LOG(VECTOR_UNAVAILABLE);
+
   Serial.println("✓ CEO Hub v2.0 ready!");
   Serial.println("Touch screen to navigate");
   Serial.println();
 
   addNotification("CEO Hub v2.0 Online", COLOR_GREEN);
+
+  idleBegin(TOUCH_IRQ_PIN);
+  bootTimes.setupDone = micros();
 }
 
 // ══════════════════════════════════════════════════════════════════════════
@@ -256,122 +607,281 @@ void setup() {
 // ══════════════════════════════════════════════════════════════════════════
 
 void loop() {
-  // Handle WebSocket
-  if (wsConnected) {
+  serviceLoop();
+  idleUntilDue();
+}
+
+// One pass over input and due timers; the wait afterwards stays outside
+// PROF_LOOP so stall detection only sees real work
+void serviceLoop() {
+  PROFILE_ZONE(PROF_LOOP);
+
+  // The client needs polling while it connects too, not just once connected
+  if (wifiConnected) {
     webSocket.loop();
   }
 
   // Handle touch input
   handleTouch();
 
-  // Update notifications
-  updateNotifications();
-
-  // Request metrics every 5 seconds
-  if (wsConnected && millis() - lastMetricsUpdate > 5000) {
-    lastMetricsUpdate = millis();
-    sendMetricsRequest();
-  }
-
-  // Simulate data updates if not connected
-  if (!wsConnected && millis() - lastUpdate > 10000) {
-    lastUpdate = millis();
-    projectCount += random(-10, 50);
-    agentCount += random(-5, 20);
-    roadCoinPrice += (random(-100, 100) / 10000.0);
-    roadCoinChange24h = random(-1000, 2000) / 100.0;
-    cpuUsage = random(20, 90);
-    memUsage = random(30, 85);
-    networkTraffic = random(100, 5000);
-
-    // Redraw current screen
-    tft.fillRect(0, 40, 240, 240, COLOR_BLACK);
-
-    switch(currentScreen) {
-      case SCREEN_HOME: drawHomeScreen(); break;
-      case SCREEN_PROJECTS: drawProjectsScreen(); break;
-      case SCREEN_AI: drawAIScreen(); break;
-      case SCREEN_FINANCE: drawFinanceScreen(); break;
-      case SCREEN_STUDIO: drawStudioScreen(); break;
-      case SCREEN_SETTINGS: drawSettingsScreen(); break;
-    }
+  // Kinetic scrolling keeps running after the finger lifts
+  if (currentScreen == SCREEN_PROJECTS) {
+    projectList.update(millis());
   }
 
-  // Reconnect WiFi/WS if needed
-  if (!wifiConnected && millis() - lastPing > 30000) {
-    lastPing = millis();
-    connectWiFi();
+  // Debug commands from the serial monitor
+  handleSerialCommands();
+
+  // Answers from the HTTP command worker; it wakes the idle wait
+  if (drainCommandResults()) serviceCommands();
+  drainInferenceResults();
+
+  // A scrape is waiting on the HTTP worker; it wakes the idle wait too
+  if (promServerPending()) promServerRender(collectHubMetrics);
+
+  // Search: background compaction, then the rest of a running scan
+  if (searchIndex.needsService()) {
+    searchIndex.service(SEARCH_IDLE_BUDGET_US);
+  }
+  if (vectorIndex.needsService()) vectorIndex.service();
+  if (searchOpen && !relatedFor && !searchIndex.complete()) {
+    searchIndex.step(SEARCH_IDLE_BUDGET_US);
+    drawSearchResults(false);
   }
 
-  delay(10);
+  timers.advance(millis());
+}
+
+void idleUntilDue() {
+  // Interactive work has no deadline; keep a short fixed pace while it runs
+  bool busy = touched || swiping || projectList.moving() ||
+              searchIndex.needsService() || (searchOpen && !searchIndex.complete()) ||
+              (wifiConnected && webSocket.bufferedInput());
+  if (busy) {
+    delay(IDLE_BUSY_MS);
+    return;
+  }
+
+  uint32_t due = timers.nextDeadline(millis());
+  if (due == 0) return;
+  // Light sleep powers the radio down, which would stall an association
+  // or the STA auto-reconnect; only sleep while the radio is off between
+  // attempts
+  bool radioOff = WiFi.getMode() == WIFI_OFF && !timers.armed(wifiTimer);
+  idleWait(due < IDLE_MAX_MS ? due : IDLE_MAX_MS,
+           wifiConnected ? webSocket.socketFd() : -1, radioOff);
+}
+
+// ══════════════════════════════════════════════════════════════════════════
+// SCHEDULED WORK
+// ══════════════════════════════════════════════════════════════════════════
+
+// Request metrics every 5 seconds
+void onMetricsTimer() {
+  if (wsConnected) sendMetricsRequest();
+}
+
+// Keep the search index in step with the backend
+void onIndexSyncTimer() {
+  if (wsConnected) requestIndexSync(false);
+}
+
+// Simulate data updates if not connected
+void onSimulateTimer() {
+  if (wsConnected) return;
+  projectCount += random(-10, 50);
+  simulateAgentDiff();
+  cpuUsage = random(20, 90);
+  memUsage = random(30, 85);
+  networkTraffic = random(100, 5000);
+  recordSystemMetrics(METRIC_CPU | METRIC_MEMORY | METRIC_NETWORK);
+
+  refreshCurrentScreen();
+}
+
+void onTickSimTimer() {
+  if (!wsConnected && !tickStream) simulateTick();
+}
+
+// Endpoint selection, pings and failover; runs only while WiFi is up
+void serviceSession() {
+  wsSession.service(wifiConnected && WiFi.status() == WL_CONNECTED, micros());
+}
+
+// Reconnect WiFi/WS if needed
+void onReconnectTimer() {
+  if (!wifiConnected) connectWiFi();
+}
+
+void repaintCandles() {
+  lastCandleDraw = millis();
+  if (currentScreen == SCREEN_FINANCE) {
+    drawFinancePrice();
+    drawCandleChart(false);
+    drawFinanceStats();
+  }
+}
+
+void beginTimers() {
+  uint32_t now = millis();
+  timers.begin(now);
+  metricsTimer = timers.add("metrics", onMetricsTimer, METRICS_MS);
+  indexSyncTimer = timers.add("indexSync", onIndexSyncTimer, SEARCH_SYNC_MS);
+  simulateTimer = timers.add("simulate", onSimulateTimer, SIMULATE_MS);
+  tickSimTimer = timers.add("tickSim", onTickSimTimer, TICK_SIM_MS);
+  reconnectTimer = timers.add("reconnect", onReconnectTimer, RECONNECT_MS);
+  notifyTimer = timers.add("notify", updateNotifications, 0);
+  candleTimer = timers.add("candles", repaintCandles, 0);
+  sessionTimer = timers.add("wsSession", serviceSession, WS_TICK_MS);
+  commandTimer = timers.add("commands", serviceCommands, 0);
+  healthTimer = timers.add("health", onHealthTimer, HEALTH_MS);
+  inferSaveTimer = timers.add("inferSave", saveInferenceCache, INFER_SAVE_MS);
+  wifiTimer = timers.add("wifi", onWiFiTimer, WIFI_POLL_MS);
+  bootSaveTimer = timers.add("bootSave", saveBootSnapshot, BOOT_SAVE_MS);
+
+  // Offline until the server says otherwise
+  timers.start(simulateTimer, SIMULATE_MS, now);
+  timers.start(tickSimTimer, TICK_SIM_MS, now);
+  timers.start(reconnectTimer, RECONNECT_MS, now);
+  timers.start(healthTimer, HEALTH_MS, now);
+  timers.start(inferSaveTimer, INFER_SAVE_MS, now);
+  timers.start(bootSaveTimer, BOOT_SAVE_MS, now);
+}
+
+// Coalesce tick bursts into one repaint per frame
+void requestCandleRepaint() {
+  if (timers.armed(candleTimer)) return;
+  uint32_t now = millis();
+  uint32_t since = now - lastCandleDraw;
+  timers.start(candleTimer, since < CANDLE_FRAME_MS ? CANDLE_FRAME_MS - since : 0, now);
 }
 
 // ══════════════════════════════════════════════════════════════════════════
 // NETWORKING
 // ══════════════════════════════════════════════════════════════════════════
 
+// Starts associating and returns; onWiFiTimer polls for the outcome so
+// boot and the loop never block on the access point
 void connectWiFi() {
-  Serial.print("Connecting to WiFi: ");
-  Serial.println(WIFI_SSID);
+  if (timers.armed(wifiTimer)) return;
+  PROFILE_ZONE(PROF_CONNECT_WIFI);
 
-  WiFi.begin(WIFI_SSID, WIFI_PASSWORD);
+  LOG(WIFI_CONNECTING, WIFI_SSID);
 
-  int attempts = 0;
-  while (WiFi.status() != WL_CONNECTED && attempts < 20) {
-    delay(500);
-    Serial.print(".");
-    attempts++;
-  }
+  WiFi.mode(WIFI_STA);  // off since the last attempt gave up
+  WiFi.begin(WIFI_SSID, WIFI_PASSWORD);
+  wifiStartMs = millis();
+  timers.start(wifiTimer, WIFI_POLL_MS, wifiStartMs);
+}
 
+void onWiFiTimer() {
   if (WiFi.status() == WL_CONNECTED) {
+    timers.stop(wifiTimer);
     wifiConnected = true;
-    Serial.println("\n✓ WiFi connected!");
-    Serial.print("IP: ");
-    Serial.println(WiFi.localIP());
+    hubCounters.wifiConnects++;
+    if (!bootTimes.wifiUp) bootTimes.wifiUp = micros();
+    IPAddress ip = WiFi.localIP();
+    LOG(WIFI_CONNECTED, ip[0], ip[1], ip[2], ip[3]);
+    if (HUB_METRICS_PORT) {
+      if (promServerBegin(HUB_METRICS_PORT)) LOG(METRICS_HTTP, ip[0], ip[1], ip[2], ip[3], HUB_METRICS_PORT);
+      else LOG(METRICS_HTTP_FAILED, HUB_METRICS_PORT);
+    }
 
     // Connect WebSocket
     connectWebSocket();
 
     drawStatusBar();
-  } else {
+  } else if (millis() - wifiStartMs >= WIFI_TIMEOUT_MS) {
+    timers.stop(wifiTimer);
     wifiConnected = false;
-    Serial.println("\n✗ WiFi connection failed");
+    hubCounters.wifiFailures++;
+    LOG(WIFI_FAILED);
+    // Radio off until reconnectTimer tries again; the loop may light-sleep
+    WiFi.disconnect(true);
+    WiFi.mode(WIFI_OFF);
+    timers.stop(sessionTimer);
+    serviceSession();
     drawStatusBar();
   }
 }
 
+// The session opens the best endpoint now and keeps watching it
 void connectWebSocket() {
-  Serial.printf("Connecting to WebSocket: ws://%s:%d%s\n", WS_HOST, WS_PORT, WS_PATH);
-
-  webSocket.begin(WS_HOST, WS_PORT, WS_PATH);
-  webSocket.onEvent(webSocketEvent);
-  webSocket.setReconnectInterval(5000);
+  serviceSession();
+  timers.start(sessionTimer, WS_TICK_MS, millis());
 }
 
 void webSocketEvent(WStype_t type, uint8_t * payload, size_t length) {
   switch(type) {
     case WStype_DISCONNECTED:
-      Serial.println("✗ WebSocket Disconnected");
+      LOG(WS_DISCONNECTED);
+      wsSession.onDisconnected(micros());
       wsConnected = false;
+      timers.stop(metricsTimer);
+      timers.stop(indexSyncTimer);
+      timers.start(simulateTimer, SIMULATE_MS, millis());
+      if (!tickStream) timers.start(tickSimTimer, TICK_SIM_MS, millis());
       drawStatusBar();
       addNotification("Server disconnected", COLOR_RED);
       break;
 
     case WStype_CONNECTED:
-      Serial.println("✓ WebSocket Connected");
+      LOG(WS_CONNECTED);
+      wsSession.onConnected(micros());
       wsConnected = true;
+      if (!bootTimes.wsUp) bootTimes.wsUp = micros();
+      timers.start(metricsTimer, METRICS_MS, millis());
+      timers.stop(simulateTimer);
+      timers.stop(tickSimTimer);
       drawStatusBar();
       addNotification("Server connected", COLOR_GREEN);
       webSocket.sendTXT("{\"type\":\"subscribe\",\"channel\":\"metrics\"}");
+      requestIndexSync(false);
+      requestAgentSnapshot();
       break;
 
+    // The payload is the library's own malloc'd buffer (see json_arena.h);
+    // only the parse runs in the arena
     case WStype_TEXT:
-      Serial.printf("← Received: %s\n", payload);
-      parseMetricsData((char*)payload);
+      wsReceivedUs = micros();
+      LOG(WS_RECEIVED, (unsigned)length);
+      parseMetricsData((char*)payload, length);
+      break;
+
+    case WStype_BIN:
+      handleBinaryMessage(payload, length);
+      break;
+
+    // Large snapshots arrive fragmented; stitch them together in the arena
+    case WStype_FRAGMENT_TEXT_START:
+    case WStype_FRAGMENT_BIN_START:
+      wsMessage.begin();
+      wsMessageBinary = type == WStype_FRAGMENT_BIN_START;
+      wsMessage.append(payload, length);
+      break;
+
+    case WStype_FRAGMENT:
+      wsMessage.append(payload, length);
+      break;
+
+    case WStype_FRAGMENT_FIN:
+      if (wsMessage.append(payload, length)) {
+        wsReceivedUs = micros();
+        LOG(WS_RECEIVED_FRAGMENTS, (unsigned)wsMessage.length());
+        if (wsMessageBinary) {
+          handleBinaryMessage((const uint8_t*)wsMessage.data(), wsMessage.length());
+          jsonArena.reset();
+        } else {
+          parseMetricsData(wsMessage.data(), wsMessage.length());
+        }
+      } else {
+        LOG(WS_OVERSIZED, (unsigned)JSON_ARENA_SIZE);
+        jsonArena.reset();
+      }
       break;
 
     case WStype_ERROR:
-      Serial.println("✗ WebSocket Error");
+      LOG(WS_ERROR);
       break;
   }
 }
@@ -382,34 +892,784 @@ void sendMetricsRequest() {
   webSocket.sendTXT("{\"type\":\"getMetrics\"}");
 }
 
-void parseMetricsData(const char* json) {
-  StaticJsonDocument<512> doc;
-  DeserializationError error = deserializeJson(doc, json);
+bool requestProjectPage(uint32_t cursor, uint16_t limit) {
+  if (!wsConnected) return false;
+
+  char request[64];
+  snprintf(request, sizeof(request), "{\"type\":\"getProjects\",\"cursor\":%lu,\"limit\":%u}",
+    (unsigned long)cursor, (unsigned)limit);
+  return webSocket.sendTXT(request);
+}
+
+void requestIndexSync(bool full) {
+  timers.start(indexSyncTimer, SEARCH_SYNC_MS, millis());
+  if (!wsConnected) return;
+
+  // Version 0 asks for a full snapshot, anything else for deltas since then
+  char request[64];
+  if (searchIndex.ready()) {
+    snprintf(request, sizeof(request), "{\"type\":\"getIndex\",\"version\":%lu}",
+      full ? 0UL : (unsigned long)searchIndex.version());
+    webSocket.sendTXT(request);
+  }
+  if (vectorIndex.ready()) requestVectorSync(full);
+}
+
+void requestVectorSync(bool full) {
+  if (!wsConnected || !vectorIndex.ready()) return;
+  char request[64];
+  // The backend picks which projects fit the cache
+  snprintf(request, sizeof(request), "{\"type\":\"getVectors\",\"version\":%lu,\"limit\":%u}",
+    full ? 0UL : (unsigned long)vectorIndex.version(), (unsigned)VECTOR_CAPACITY);
+  webSocket.sendTXT(request);
+}
+
+void requestAgentSnapshot() {
+  if (!wsConnected) return;
+  webSocket.sendTXT("{\"type\":\"getAgents\"}");
+}
+
+void handleBinaryMessage(const uint8_t* data, size_t length) {
+  hubCounters.wsBinary++;
+  hubCounters.wsBytes += length;
+  switch (length ? data[0] : 0) {
+    case AGENT_MSG_STATUS: handleAgentStatus(data, length); break;
+    case CANDLE_MSG_TICKS: ingestTicks(data, length); break;
+    default:
+      LOG(WS_UNKNOWN_BINARY, (unsigned)length);
+      break;
+  }
+}
+
+void handleAgentStatus(const uint8_t* data, size_t length) {
+  uint32_t start = micros();
+  AgentDiffResult result = agentStatus.apply(data, length);
+  if (result != AGENT_DIFF_OK) {
+    if (result == AGENT_DIFF_GAP) LOG(AGENT_DIFF_GAP);
+    else LOG(AGENT_DIFF_BAD);
+    requestAgentSnapshot();
+    return;
+  }
+  agentStatus.aggregate();
+  agentApplyUs = micros() - start;
+
+  agentCount = agentStatus.size();
+  activeAgents = agentStatus.totals().online;
+
+  // Only the counts and the changed heatmap rows need repainting
+  if (currentScreen == SCREEN_AI) {
+    drawAgentSummary();
+    drawAgentHeatmap(false);
+  }
+}
+
+// Ticks stream in bursts; aggregate now, repaint at most every CANDLE_FRAME_MS
+void ingestTicks(const uint8_t* data, size_t length) {
+  if (!tickStream) {
+    candles.begin();  // drop the uptime-clocked history
+    priceHistory.clear();
+    tickStream = true;
+    timers.stop(tickSimTimer);
+  }
+
+  uint32_t start = micros();
+  uint8_t opened;
+  int32_t count = candles.apply(data, length, opened);
+  tickApplyUs = micros() - start;
+  if (count < 0) LOG(TICK_FRAME_BAD);
+  else markDashboardFresh();
+
+  roadCoinChangeBp = candles.changeBasisPoints();
+  candlesOpened |= opened;
+  recordPriceHistory();
+  requestCandleRepaint();
+}
+
+// Offline demo data: a random walk on device uptime
+void simulateTick() {
+  Price price = candles.lastPrice() + random(-400, 401);
+  if (price < 1000) price = 1000;
+  candlesOpened |= candles.addTick(millis() / 1000, price, random(1, 500));
+  roadCoinChangeBp = candles.changeBasisPoints();
+  recordPriceHistory();
+  requestCandleRepaint();
+}
+
+// Folds the current price into this second's sample; seconds without a
+// tick repeat the previous price so the time axis stays even
+void recordPriceHistory() {
+  Price price = candles.lastPrice();
+  if (price) checkAnomaly(ANOMALY_PRICE, price);  // 0 until the first tick
+  uint32_t now = millis() / 1000;
+  if (priceHistory.samples() == 0) {
+    priceHistory.push(price);
+  } else if (now == priceHistorySecond) {
+    priceHistory.merge(price);
+  } else {
+    for (uint32_t s = priceHistorySecond + 1; s < now; s++) priceHistory.push(priceHistoryLast);
+    priceHistory.push(price);
+  }
+  priceHistorySecond = now;
+  priceHistoryLast = price;
+}
+
+// Every sample that arrives goes into the rolling sketches
+void recordSystemMetrics(uint8_t fields) {
+  uint32_t now = millis() / 1000;
+  if (fields & METRIC_CPU) cpuWindows.record(cpuUsage, now);
+  if (fields & METRIC_MEMORY) memWindows.record(memUsage, now);
+  if (fields & METRIC_NETWORK) networkWindows.record(networkTraffic, now);
+  if (fields & METRIC_CPU) checkAnomaly(ANOMALY_CPU, cpuUsage);
+  if (fields & METRIC_MEMORY) checkAnomaly(ANOMALY_MEMORY, memUsage);
+  if (fields & METRIC_NETWORK) checkAnomaly(ANOMALY_NETWORK, networkTraffic);
+}
+
+// ══════════════════════════════════════════════════════════════════════════
+// ANOMALY DETECTION
+// ══════════════════════════════════════════════════════════════════════════
+
+size_t fmtPercentValue(char* out, size_t size, float value) {
+  size_t n = fmtUint(out, size - 1, value > 0 ? (uint32_t)(value + 0.5f) : 0);
+  out[n++] = '%';
+  out[n] = '\0';
+  return n;
+}
+
+size_t fmtBytesValue(char* out, size_t size, float value) {
+  return fmtBytes(out, size, value > 0 ? (uint32_t)value : 0);
+}
+
+size_t fmtPriceValue(char* out, size_t size, float value) {
+  return fmtPrice(out, size, (Price)value, 4);
+}
+
+// name, format, alpha, warmup, zLimit, minSigma, hasHigh, hasLow, high, low,
+// riseLimit, fallLimit, relative, rateWindowMs, cooldownMs
+const AnomalyConfig ANOMALY_CONFIGS[ANOMALY_METRICS] = {
+  { "CPU",       fmtPercentValue, 0.10f, 20, 4.0f, 3.0f,   true,  false, 95, 0,     0,     0,     false, 0,     300000 },
+  { "Memory",    fmtPercentValue, 0.10f, 20, 4.0f, 2.0f,   true,  false, 90, 0,     0,     0,     false, 0,     300000 },
+  { "Network",   fmtBytesValue,   0.10f, 20, 5.0f, 256.0f, false, false, 0,  0,     0,     0,     false, 0,     300000 },
+  // Crash: 5% down within a minute or two; price in 1/1000000
+  { "RoadCoin",  fmtPriceValue,   0.05f, 30, 6.0f, 100.0f, false, false, 0,  0,     10.0f, 5.0f,  true,  60000, 600000 },
+  // Leak: 16 KB gone within a minute or two, or under 24 KB left
+  { "Free heap", fmtBytesValue,   0.05f, 10, 0,    0,      false, true,  0,  24576, 0,     16384, false, 60000, 600000 },
+};
+
+void beginAnomalyDetection() {
+  for (uint8_t m = 0; m < ANOMALY_METRICS; m++) anomalyDetectors[m].begin(&ANOMALY_CONFIGS[m]);
+}
+
+// Judges one sample; anything found is posted at once, critical first
+void checkAnomaly(AnomalyMetric metric, float value) {
+  AnomalyEvent events[ANOMALY_RULES];
+  uint8_t count = anomalyDetectors[metric].update(value, millis(), events);
+  for (uint8_t i = 0; i < count; i++) {
+    char msg[NOTIFY_MSG_LEN];
+    anomalyDescribe(msg, sizeof(msg), ANOMALY_CONFIGS[metric], events[i]);
+    LOG(ANOMALY, msg);
+    bool critical = events[i].severity == ANOMALY_CRITICAL;
+    addNotification(msg, critical ? COLOR_RED : COLOR_AMBER, critical ? NOTIFY_CRITICAL : NOTIFY_WARN);
+  }
+}
+
+// Device health needs no backend: sampled here, offline or not
+void onHealthTimer() {
+  checkAnomaly(ANOMALY_HEAP, ESP.getFreeHeap());
+}
+
+// ══════════════════════════════════════════════════════════════════════════
+// EVENT TRIAGE
+// ══════════════════════════════════════════════════════════════════════════
+
+uint16_t triageColor(TextClass label) {
+  return label == TEXT_CRITICAL ? COLOR_RED : label == TEXT_WARN ? COLOR_AMBER : COLOR_BLUE;
+}
+
+// Shown at once with the local verdict; an unsure one is also sent to
+// Hugging Face, whose answer can only raise the priority. A sentiment
+// the inference cache already holds counts at once
+void triageEvent(const char* text) {
+  uint32_t start = micros();
+  TextVerdict v = classifyText(text);
+  uint32_t tookUs = micros() - start;
+  eventsTriaged++;
+
+  TextClass label = v.label;
+  bool ask = false;
+  if constexpr (HuggingFaceService::enabled) {
+    if (v.confidence < TRIAGE_MIN_CONFIDENCE) {
+      InferLookup r = askInference(INFER_SENTIMENT, text, nullptr, INFER_FOR_TRIAGE);
+      if (r.result) {
+        TextClass asked = sentimentClass(r.result);
+        if (asked > label) label = asked;
+      } else if (r.fetch || r.state == INFER_WAIT) {
+        TriagePending& p = triagePending[triagePendingNext];
+        triagePendingNext = (triagePendingNext + 1) % TRIAGE_PENDING;
+        p.key = r.key;
+        strncpy(p.text, text, NOTIFY_MSG_LEN - 1);
+        p.text[NOTIFY_MSG_LEN - 1] = '\0';
+      }
+      ask = r.fetch;
+      eventsAsked += ask;
+    }
+  }
+  LOG(EVENT_TRIAGED, textClassName(label), (unsigned)v.confidence, (unsigned long)tookUs,
+    ask ? ", asking HF" : "", text);
+
+  addNotification(text, triageColor(label), label);
+}
+
+// A sentiment answer (null when the call failed) for the texts waiting on
+// it. POSITIVE only confirms; NEGATIVE lifts an info toast still showing
+// to a warning. One that has expired is left gone, not posted again
+void triageAnswered(uint64_t key, const char* label) {
+  for (TriagePending& p : triagePending) {
+    if (p.key != key) continue;
+    p.key = 0;
+    TextClass c = sentimentClass(label);
+    if (c != TEXT_INFO) raiseNotification(p.text, triageColor(c), c);
+  }
+}
+
+// Cached answer, or the upstream call started for it. A kind whose
+// service is compiled out never leaves the hub
+InferLookup askInference(InferKind kind, const char* text, const char* context, uint8_t waiter) {
+  InferLookup r = inference.request(kind, text, context, waiter, millis());
+  if (!r.fetch) return r;
+
+  bool sent = false;
+  if (kind == INFER_CHAT) {
+    if constexpr (EnclaveAiService::enabled) sent = inferenceHttpPost(r.key, kind, text, context);
+  } else {
+    if constexpr (HuggingFaceService::enabled) sent = inferenceHttpPost(r.key, kind, text, context);
+  }
+  if (!sent) {
+    inference.fail(r.key, millis());
+    r.fetch = false;
+  }
+  return r;
+}
+
+// Replies from the inference worker go into the cache, then to whoever
+// was waiting on them; true when there were any
+bool drainInferenceResults() {
+  bool any = false;
+  if constexpr (HuggingFaceService::enabled || EnclaveAiService::enabled) {
+    static InferenceReply r;
+    while (inferenceHttpResult(r)) {
+      uint32_t now = millis();
+      uint8_t waiters = r.ok ? inference.complete(r.key, r.result, r.latencyUs, now) : inference.fail(r.key, now);
+      LOG(INFERENCE, r.ok ? "answered" : "failed", (unsigned long)(r.latencyUs / 1000));
+
+      if (waiters & INFER_FOR_SERIAL) Serial.printf("→ %s\n", r.ok ? r.result : "(call failed)");
+      if (waiters & INFER_FOR_TRIAGE) triageAnswered(r.key, r.ok ? r.result : nullptr);
+      if ((waiters & INFER_FOR_RELATED) && relatedFor && r.key == relatedSummaryKey) {
+        relatedSummaryFailed = !r.ok;
+        if (searchOpen) drawRelatedSummary();
+      }
+      any = true;
+    }
+  }
+  return any;
+}
+
+// Results survive a reboot in NVS, when built with INFERENCE_CACHE_PERSIST
+void loadInferenceCache() {
+#if INFERENCE_CACHE_PERSIST
+  Preferences prefs;
+  if (!prefs.begin("infer", true)) return;
+  size_t length = prefs.getBytesLength("cache");
+  uint8_t* blob = length ? (uint8_t*)malloc(length) : nullptr;
+  if (blob) {
+    prefs.getBytes("cache", blob, length);
+    inference.load(blob, length, millis());
+    free(blob);
+  }
+  prefs.end();
+#endif
+}
+
+void saveInferenceCache() {
+#if INFERENCE_CACHE_PERSIST
+  if (!inference.dirty()) return;
+  size_t length = inference.saveSize();
+  uint8_t* blob = (uint8_t*)malloc(length);
+  if (!blob) return;
+  Preferences prefs;
+  if (inference.save(blob, length) && prefs.begin("infer", false)) {
+    prefs.putBytes("cache", blob, length);
+    prefs.end();
+    LOG(INFERENCE_SAVED, (unsigned)length);
+  }
+  free(blob);
+#endif
+}
+
+// Paints the last dashboard at boot; a first boot keeps the seed values
+void restoreBootSnapshot() {
+  bootSaved = { (uint8_t)currentScreen, (uint8_t)homeWindow, (uint8_t)candleFrame, projectCount, agentCount,
+                activeAgents, BOOT_SEED_PRICE, roadCoinChangeBp, cpuUsage, memUsage, networkTraffic };
+  Preferences prefs;
+  if (!prefs.begin("boot", true)) return;
+  uint8_t blob[BOOT_SNAPSHOT_MAX];
+  size_t length = prefs.getBytesLength("dash");
+  if (length && length <= sizeof(blob)) length = prefs.getBytes("dash", blob, length);
+  prefs.end();
+
+  BootSnapshot s;
+  if (!length || !bootSnapshotDecode(blob, length, s)) return;
+  bootSaved = s;
+  bootRestored = true;
+  if (s.screen < SCREEN_COUNT) currentScreen = (Screen)s.screen;
+  if (s.homeWindow < SKETCH_WINDOWS) homeWindow = (SketchWindow)s.homeWindow;
+  if (s.candleView < CANDLE_FRAMES) candleFrame = (CandleFrame)s.candleView;
+  priceLineView = s.candleView == CANDLE_FRAMES;
+  projectCount = s.projects;
+  agentCount = s.agents;
+  activeAgents = s.activeAgents;
+  roadCoinChangeBp = s.changeBp;
+  cpuUsage = s.cpu;
+  memUsage = s.memory;
+  networkTraffic = s.network;
+  LOG(BOOT_RESTORED, (unsigned)length);
+}
+
+// Writes only when something changed; while stale the data fields keep
+// what flash already holds so offline simulation never gets saved
+void saveBootSnapshot() {
+  BootSnapshot s = bootSaved;
+  s.screen = currentScreen;
+  s.homeWindow = homeWindow;
+  s.candleView = priceLineView ? CANDLE_FRAMES : candleFrame;
+  if (!dashboardStale) {
+    s.projects = projectCount;
+    s.agents = agentCount;
+    s.activeAgents = activeAgents;
+    s.price = candles.lastPrice();
+    s.changeBp = roadCoinChangeBp;
+    s.cpu = cpuUsage;
+    s.memory = memUsage;
+    s.network = networkTraffic;
+  }
+
+  uint8_t blob[BOOT_SNAPSHOT_MAX], saved[BOOT_SNAPSHOT_MAX];
+  size_t length = bootSnapshotEncode(s, blob, sizeof(blob));
+  if (length == bootSnapshotEncode(bootSaved, saved, sizeof(saved)) && !memcmp(blob, saved, length)) return;
+
+  Preferences prefs;
+  if (!prefs.begin("boot", false)) return;
+  if (prefs.putBytes("dash", blob, length) == length) {
+    bootSaved = s;
+    LOG(BOOT_SAVED, (unsigned)length);
+  }
+  prefs.end();
+}
+
+// First data from the server since boot; the restored values are gone
+void markDashboardFresh() {
+  if (!dashboardStale) return;
+  dashboardStale = false;
+  bootTimes.freshData = micros();
+  LOG(BOOT_FRESH, (unsigned long)(bootTimes.freshData / 1000));
+  drawStatusBar();
+}
+
+static void printInferLookup(const InferLookup& r) {
+  switch (r.state) {
+    case INFER_HIT:   Serial.printf("%s\n(cached)\n", r.result); break;
+    case INFER_STALE: Serial.printf("%s\n(stale%s)\n", r.result, r.fetch ? ", refreshing" : ""); break;
+    case INFER_WAIT:  Serial.println("Joined the call in flight"); break;
+    case INFER_BUSY:  Serial.println("Every cache slot is waiting on a call, try again"); break;
+    default:
+      Serial.println(r.fetch ? "Asking..." : "Unavailable: service off, or it failed in the last 30 s");
+      break;
+  }
+}
+
+// counts[i] is the number of samples at sketch index base + i
+template <uint16_t BUCKETS>
+bool mergeServerSketch(MetricWindowsT<BUCKETS>& windows, SketchWindow w, JsonVariantConst msg) {
+  QuantileSketchT<BUCKETS> remote;
+  remote.reset();
+  uint32_t idx = msg["base"] | 0UL;
+  for (JsonVariantConst c : msg["counts"].as<JsonArrayConst>()) {
+    if (idx >= SKETCH_INDEX_COUNT) return false;
+    remote.addIndex(idx++, c | 0UL);
+  }
+  if (remote.count == 0) return false;
+  remote.noteRange(msg["min"] | remote.indexLow(remote.base), msg["max"] | remote.valueAt(remote.top));
+  windows.mergeRemote(w, remote, millis() / 1000);
+  return true;
+}
+
+bool ingestServerSketch(JsonVariantConst msg) {
+  SketchWindow w;
+  const char* metric = msg["metric"] | "";
+  if ((msg["subBits"] | SKETCH_SUB_BITS) != SKETCH_SUB_BITS || !sketchWindowParse(msg["window"], w)) return false;
+  if (strcmp(metric, "cpu") == 0) return mergeServerSketch(cpuWindows, w, msg);
+  if (strcmp(metric, "memory") == 0) return mergeServerSketch(memWindows, w, msg);
+  if (strcmp(metric, "network") == 0) return mergeServerSketch(networkWindows, w, msg);
+  return false;
+}
+
+void ingestAgentGroups(JsonVariantConst msg) {
+  agentStatus.clearGroups();
+  for (JsonVariantConst g : msg["groups"].as<JsonArrayConst>()) {
+    agentStatus.addGroup(g["name"] | "?", g["start"].as<uint32_t>(), g["count"].as<uint32_t>());
+  }
+  agentStatus.aggregate();
+}
+
+// Offline demo data: random outages and recoveries through the real diff path
+void simulateAgentDiff() {
+  uint8_t msg[64];
+  uint8_t length = 0;
+  auto varint = [&](uint32_t v) {
+    do {
+      uint8_t byte = v & 0x7F;
+      v >>= 7;
+      msg[length++] = v ? (byte | 0x80) : byte;
+    } while (v);
+  };
+
+  bool snapshot = !agentStatus.synced();
+  uint32_t total = agentCount < AGENT_MAX ? agentCount : AGENT_MAX;
+  msg[length++] = AGENT_MSG_STATUS;
+  msg[length++] = snapshot ? 2 : 0;  // snapshot : RLE
+  varint(snapshot ? 1 : agentStatus.sequence() + 1);
+  varint(total);
+
+  if (snapshot) {
+    varint(0);
+    varint(total);
+    msg[length++] = AGENT_ONLINE;
+  }
+  uint32_t pos = 0;
+  for (int i = 0; i < 4; i++) {
+    uint32_t skip = random(0, total / 4);
+    uint32_t run = random(1, 300);
+    if (pos + skip + run > total) break;
+    varint(skip);
+    varint(run);
+    msg[length++] = random(AGENT_ONLINE, AGENT_OFFLINE + 1);
+    pos += skip + run;
+  }
+
+  handleBinaryMessage(msg, length);
+}
+
+void ingestIndexSnapshot(JsonVariantConst msg) {
+  if (msg["first"] | false) {
+    if (!searchIndex.snapshotBegin(msg["version"].as<uint32_t>())) {
+      LOG(INDEX_START_FAILED);
+      return;
+    }
+  }
+  if (!searchIndex.snapshotActive()) return;
+
+  for (JsonVariantConst item : msg["items"].as<JsonArrayConst>()) {
+    if (!searchIndex.snapshotAdd(item[0].as<uint32_t>(), item[1] | "")) {
+      LOG(INDEX_SNAPSHOT_DROPPED);
+      searchIndex.snapshotAbort();
+      return;
+    }
+  }
+
+  if (msg["done"] | false) {
+    if (searchIndex.snapshotEnd()) {
+      SearchIndexStats stats = searchIndex.stats();
+      LOG(INDEX_SYNCED, (unsigned long)stats.version, (unsigned long)stats.entries);
+    } else {
+      LOG(INDEX_COMMIT_FAILED);
+    }
+  }
+}
+
+void ingestIndexDelta(JsonVariantConst msg) {
+  // A gap in the version chain can only be repaired by a snapshot
+  if (msg["from"].as<uint32_t>() != searchIndex.version()) {
+    requestIndexSync(true);
+    return;
+  }
+
+  for (JsonVariantConst op : msg["ops"].as<JsonArrayConst>()) {
+    uint32_t id = op["id"].as<uint32_t>();
+    bool applied = strcmp(op["op"] | "", "del") == 0
+      ? searchIndex.remove(id)
+      : searchIndex.put(id, op["name"] | "");
+    // Overlay busy or full: the version stays put and the next sync resends
+    if (!applied) return;
+  }
+  searchIndex.setVersion(msg["to"].as<uint32_t>());
+}
+
+// [[id, "name", "<base64 int8 vector>"], ...] in pages, like the search index
+void ingestVectorSnapshot(JsonVariantConst msg) {
+  if (msg["first"] | false) {
+    if (!vectorIndex.snapshotBegin(msg["version"].as<uint32_t>())) {
+      LOG(VECTOR_SNAPSHOT_FAILED);
+      return;
+    }
+  }
+  if (!vectorIndex.snapshotActive()) return;
+
+  int8_t vector[VECTOR_DIM];
+  for (JsonVariantConst item : msg["items"].as<JsonArrayConst>()) {
+    if (!vectorDecode(item[2] | "", vector) ||
+        !vectorIndex.snapshotAdd(item[0].as<uint32_t>(), item[1] | "", vector)) {
+      LOG(VECTOR_SNAPSHOT_FAILED);
+      vectorIndex.snapshotAbort();
+      return;
+    }
+  }
+
+  if (msg["done"] | false) {
+    if (vectorIndex.snapshotEnd()) {
+      VectorIndexStats stats = vectorIndex.stats();
+      LOG(VECTOR_SYNCED, (unsigned long)stats.version, stats.entries, stats.lists);
+    } else {
+      LOG(VECTOR_SNAPSHOT_FAILED);
+    }
+  }
+}
 
-  if (error) {
-    Serial.print("JSON parse error: ");
-    Serial.println(error.c_str());
+void ingestVectorDelta(JsonVariantConst msg) {
+  if (msg["from"].as<uint32_t>() != vectorIndex.version()) {
+    requestVectorSync(true);
     return;
   }
 
+  int8_t vector[VECTOR_DIM];
+  for (JsonVariantConst op : msg["ops"].as<JsonArrayConst>()) {
+    uint32_t id = op["id"].as<uint32_t>();
+    bool applied = strcmp(op["op"] | "", "del") == 0
+      ? vectorIndex.remove(id)
+      : vectorDecode(op["vec"] | "", vector) && vectorIndex.put(id, op["name"] | "", vector);
+    // Cache full or flash failed: resync from scratch rather than drift
+    if (!applied) {
+      requestVectorSync(true);
+      return;
+    }
+  }
+  vectorIndex.setVersion(msg["to"].as<uint32_t>());
+}
+
+// What parseMetricsData() does once the document is gone; outside the
+// guarded parse, since commands, triage and repaints are not parsing
+enum ParseFollowUp : uint8_t {
+  PARSED_NOTHING = 0,
+  PARSED_COMMAND_ACK,
+  PARSED_SKETCH,
+  PARSED_EVENT,
+  PARSED_PROJECT_PAGE,
+  PARSED_AGENT_GROUPS,
+  PARSED_METRICS
+};
+
+// Applies one message while its document is alive; anything needed
+// after the arena reset is copied out (event text, project page)
+ParseFollowUp applyMessage(JsonVariantConst msg, char* text, int32_t& page) {
+  const char* type = msg["type"] | "";
+
+  // Heartbeat reply; timed from arrival, not from the end of parsing
+  if (strcmp(type, "pong") == 0) {
+    wsSession.onPong(msg["seq"] | 0UL, wsReceivedUs);
+    return PARSED_NOTHING;
+  }
+
+  // Command answer; latency runs to its arrival
+  if (strcmp(type, "commandAck") == 0) {
+    commands.onAck(msg["id"] | 0UL, msg["ok"] | false, msg["error"].as<const char*>(), wsReceivedUs);
+    return PARSED_COMMAND_ACK;
+  }
+
+  // Sketch of samples the hub did not see; joins the current window slot
+  if (strcmp(type, "sketch") == 0) {
+    return ingestServerSketch(msg) ? PARSED_SKETCH : PARSED_NOTHING;
+  }
+
+  // Event text for the notification bar
+  if (strcmp(type, "event") == 0) {
+    strncpy(text, msg["text"] | "", NOTIFY_MSG_LEN - 1);
+    return PARSED_EVENT;
+  }
+
+  // Project list page: only the list repaints, not the whole screen
+  if (strcmp(type, "projects") == 0) {
+    page = projectPages.ingest(msg["cursor"] | 0, msg["total"] | 0, msg["items"]);
+    return PARSED_PROJECT_PAGE;
+  }
+
+  // Search index sync; no repaint needed
+  if (strcmp(type, "indexSnapshot") == 0) {
+    ingestIndexSnapshot(msg);
+    return PARSED_NOTHING;
+  }
+  if (strcmp(type, "indexDelta") == 0) {
+    ingestIndexDelta(msg);
+    return PARSED_NOTHING;
+  }
+  if (strcmp(type, "vectorSnapshot") == 0) {
+    ingestVectorSnapshot(msg);
+    return PARSED_NOTHING;
+  }
+  if (strcmp(type, "vectorDelta") == 0) {
+    ingestVectorDelta(msg);
+    return PARSED_NOTHING;
+  }
+  if (strcmp(type, "agentGroups") == 0) {
+    ingestAgentGroups(msg);
+    return PARSED_AGENT_GROUPS;
+  }
+
   // Update data from server
-  if (doc.containsKey("projects")) projectCount = doc["projects"];
-  if (doc.containsKey("agents")) agentCount = doc["agents"];
-  if (doc.containsKey("roadcoin")) roadCoinPrice = doc["roadcoin"];
-  if (doc.containsKey("change24h")) roadCoinChange24h = doc["change24h"];
-  if (doc.containsKey("cpu")) cpuUsage = doc["cpu"];
-  if (doc.containsKey("memory")) memUsage = doc["memory"];
-  if (doc.containsKey("network")) networkTraffic = doc["network"];
-
-  // Redraw screen with new data
-  tft.fillRect(0, 40, 240, 240, COLOR_BLACK);
-  switch(currentScreen) {
-    case SCREEN_HOME: drawHomeScreen(); break;
-    case SCREEN_PROJECTS: drawProjectsScreen(); break;
-    case SCREEN_AI: drawAIScreen(); break;
-    case SCREEN_FINANCE: drawFinanceScreen(); break;
-    case SCREEN_STUDIO: drawStudioScreen(); break;
-    case SCREEN_SETTINGS: drawSettingsScreen(); break;
+  MetricsUpdate m;
+  metricsRead(msg, m);
+  if (m.fields) markDashboardFresh();
+  if (m.fields & METRIC_PROJECTS) projectCount = m.projects;
+  // Once the bitset is live it is the source of truth for agent counts
+  if ((m.fields & METRIC_AGENTS) && !agentStatus.synced()) agentCount = m.agents;
+  // Without a tick stream the polled price is the only tick there is
+  if (!tickStream) {
+    if (m.fields & METRIC_PRICE) {
+      candlesOpened |= candles.addTick(millis() / 1000, m.price, 0);
+      recordPriceHistory();
+      requestCandleRepaint();
+    }
+    if (m.fields & METRIC_CHANGE) roadCoinChangeBp = m.change24hBp;
+  }
+  if (m.fields & METRIC_CPU) cpuUsage = m.cpu;
+  if (m.fields & METRIC_MEMORY) memUsage = m.memory;
+  if (m.fields & METRIC_NETWORK) networkTraffic = m.network;
+  recordSystemMetrics(m.fields);
+  return PARSED_METRICS;
+}
+
+void parseMetricsData(const char* json, size_t length) {
+  PROFILE_ZONE(PROF_PARSE_METRICS);
+  ParseFollowUp next = PARSED_NOTHING;
+  char text[NOTIFY_MSG_LEN] = "";
+  int32_t page = -1;
+
+  {
+    ALLOC_GUARD_SCOPE("parse");
+    // Document and its strings live in the arena until the reset below
+    JsonDocument doc(&jsonArena);
+    uint32_t start = micros();
+    DeserializationError error = deserializeJson(doc, json, length);
+    parseHistogram.record(micros() - start);
+    hubCounters.wsText++;
+    hubCounters.wsBytes += length;
+
+    if (error) {
+      hubCounters.jsonErrors++;
+      LOG(JSON_ERROR, error.c_str());
+    } else {
+      next = applyMessage(doc.as<JsonVariantConst>(), text, page);
+    }
+  }
+  jsonArena.reset();
+
+  switch (next) {
+    case PARSED_COMMAND_ACK:
+      serviceCommands();
+      break;
+    case PARSED_SKETCH:
+      if (currentScreen == SCREEN_HOME) drawSystemMetrics();
+      break;
+    case PARSED_EVENT:
+      if (text[0]) triageEvent(text);
+      break;
+    case PARSED_PROJECT_PAGE:
+      if (page >= 0 && currentScreen == SCREEN_PROJECTS) projectList.pageArrived(page);
+      break;
+    case PARSED_AGENT_GROUPS:
+      if (currentScreen == SCREEN_AI) drawAgentSummary();
+      break;
+    case PARSED_METRICS:
+      // Redraw screen with new data
+      refreshCurrentScreen();
+      break;
+    default:
+      break;
+  }
+}
+
+// ══════════════════════════════════════════════════════════════════════════
+// COMMANDS
+// ══════════════════════════════════════════════════════════════════════════
+
+// Sends at once; the listener has already repainted when this returns
+uint32_t submitCommand(CommandKind kind, uint32_t target) {
+  uint32_t id = commands.submit(kind, target, micros());
+  if (!id) addNotification("Too many commands in flight", COLOR_RED);
+  serviceCommands();
+  return id;
+}
+
+// Answers the HTTP worker has finished; true when there were any
+bool drainCommandResults() {
+  bool any = false;
+  if constexpr (DigitalOceanService::enabled) {
+    CommandHttpResult r;
+    while (commandHttpResult(r)) {
+      commands.onAck(r.id, r.ok, r.error, micros());
+      any = true;
+    }
+  }
+  return any;
+}
+
+// Timeouts and retries; re-arms itself for the next deadline
+void serviceCommands() {
+  drainCommandResults();
+  uint32_t next = commands.service(micros());
+  if (next) timers.start(commandTimer, (next + 999) / 1000, millis());
+  else timers.stop(commandTimer);
+}
+
+// Every state change repaints the row showing the command; outcomes
+// are also announced
+void onCommandChange(const Command& cmd) {
+  char what[40], msg[NOTIFY_MSG_LEN];
+  if (cmd.kind == CMD_DEPLOY) {
+    snprintf(what, sizeof(what), "Deploy #%lu", (unsigned long)cmd.target);
+  } else {
+    snprintf(what, sizeof(what), "Restart %s",
+      cmd.target < agentStatus.groupCount() ? agentStatus.group(cmd.target).name : "group");
+  }
+  if (cmd.state == CMD_ACKED) {
+    snprintf(msg, sizeof(msg), "%s done (%lu ms)", what, (unsigned long)(cmd.latencyUs / 1000));
+    addNotification(msg, COLOR_GREEN);
+  } else if (cmd.state == CMD_FAILED) {
+    snprintf(msg, sizeof(msg), "%s failed: %s", what, cmd.error);
+    addNotification(msg, COLOR_RED);
+  }
+
+  if (cmd.kind == CMD_DEPLOY && currentScreen == SCREEN_PROJECTS && searchOpen) {
+    drawSearchResults(true);
+  } else if (cmd.kind == CMD_RESTART_GROUP && currentScreen == SCREEN_AI) {
+    drawAgentSummary();
+  }
+}
+
+// The action a row offers (`action`, may be null) or how its command is doing
+void drawCommandLabel(int x, int y, const Command* cmd, const char* action) {
+  tft.fillRect(x, y, 240 - x, 8, COLOR_BLACK);
+  tft.setCursor(x, y);
+  if (!cmd) {
+    if (!action) return;
+    tft.setTextColor(COLOR_HOT_PINK, COLOR_BLACK);
+    tft.print(action);
+  } else if (cmd->state == CMD_PENDING) {
+    tft.setTextColor(COLOR_AMBER, COLOR_BLACK);
+    tft.print(cmd->attempts > 1 ? "retry" : "...");
+  } else if (cmd->state == CMD_ACKED) {
+    tft.setTextColor(COLOR_GREEN, COLOR_BLACK);
+    tft.print("done");
+  } else {
+    tft.setTextColor(COLOR_RED, COLOR_BLACK);
+    tft.print("failed");
   }
 }
 
@@ -418,6 +1678,8 @@ void parseMetricsData(const char* json) {
 // ══════════════════════════════════════════════════════════════════════════
 
 void handleTouch() {
+  PROFILE_ZONE(PROF_HANDLE_TOUCH);
+
   uint16_t x, y;
   touched = tft.getTouch(&x, &y);
 
@@ -425,34 +1687,88 @@ void handleTouch() {
     touchX = x;
     touchY = y;
 
+    // The list tracks every sample from the press on; the debounce below
+    // would make it stutter and lose quick flicks
+    if (currentScreen == SCREEN_PROJECTS && !searchOpen) {
+      if (!listTouching) {
+        listTouching = true;
+        if (projectList.contains(touchY)) projectList.touchDown(touchY, millis());
+      } else {
+        projectList.touchMove(touchY, millis());
+      }
+    }
+
     // Debounce
     if (millis() - lastTouchTime < 200) {
       return;
     }
 
     lastTouchTime = millis();
+    latencyBegin();
+
+    LOG(TOUCH, touchX, touchY);
+
+    // Project search: tap the title to open, then keyboard and results
+    if (currentScreen == SCREEN_PROJECTS) {
+      if (searchOpen) {
+        handleSearchTap(touchX, touchY);
+      } else if (touchY >= 50 && touchY < 80) {
+        openSearch();
+      }
+    }
+
+    // Home: tap the metrics heading to cycle the percentile window
+    if (currentScreen == SCREEN_HOME && touchY >= HOME_METRICS_Y - 5 && touchY < HOME_METRICS_Y + 12) {
+      homeWindow = (SketchWindow)((homeWindow + 1) % SKETCH_WINDOWS);
+      drawSystemMetrics();
+    }
 
-    Serial.printf("Touch: x=%d, y=%d\n", touchX, touchY);
+    // AI: tap the right of a group row to restart that group
+    if (currentScreen == SCREEN_AI) {
+      handleAgentTap(touchX, touchY);
+    }
+
+    // Finance: tap the chart to cycle 1m / 5m / 1h candles and the full history
+    if (currentScreen == SCREEN_FINANCE && touchY >= CANDLE_TABS_Y - 5 && touchY < CANDLE_CHART_Y + CANDLE_CHART_H) {
+      if (priceLineView) {
+        priceLineView = false;
+        candleFrame = CANDLE_1M;
+      } else if (candleFrame == CANDLE_FRAMES - 1) {
+        priceLineView = true;
+      } else {
+        candleFrame = (CandleFrame)(candleFrame + 1);
+      }
+      drawCandleTabs();
+      drawCandleChart(true);
+    }
 
     // Handle navbar taps
     if (isTouchInNavBar(touchY)) {
       int button = getTappedNavButton(touchX);
       if (button >= 0 && button < SCREEN_COUNT) {
+        latencyMark(LAT_GESTURE);
         switchScreen((Screen)button);
       }
     }
 
     // Track swipe start
-    if (swipeStartX == 0) {
+    if (!swiping) {
+      swiping = true;
       swipeStartX = touchX;
       swipeStartY = touchY;
     }
   } else {
+    // Released, even inside the debounce: the list lets go or flings
+    if (listTouching) {
+      listTouching = false;
+      projectList.touchUp(millis());
+    }
+
     // Touch released - check for swipe
-    if (swipeStartX != 0) {
+    if (swiping) {
+      latencyBegin();  // release completes the swipe
       checkSwipeGesture();
-      swipeStartX = 0;
-      swipeStartY = 0;
+      swiping = false;
     }
   }
 }
@@ -463,14 +1779,15 @@ void checkSwipeGesture() {
 
   // Swipe threshold: 80 pixels
   if (abs(deltaX) > 80 && abs(deltaX) > abs(deltaY)) {
+    latencyMark(LAT_GESTURE);
     if (deltaX > 0) {
       // Swipe right -> previous screen
       prevScreen();
-      Serial.println("Swipe RIGHT");
+      LOG(SWIPE, "RIGHT");
     } else {
       // Swipe left -> next screen
       nextScreen();
-      Serial.println("Swipe LEFT");
+      LOG(SWIPE, "LEFT");
     }
   }
 }
@@ -489,95 +1806,316 @@ int getTappedNavButton(int16_t x) {
 // ══════════════════════════════════════════════════════════════════════════
 
 void switchScreen(Screen newScreen) {
+  latencyMark(LAT_SWITCH);
   if (newScreen == currentScreen) return;
+  ALLOC_GUARD_SCOPE("switchScreen");
+
+  // Hardware scroll must be off before anything else paints the panel
+  if (currentScreen == SCREEN_PROJECTS) {
+    projectList.deactivate();
+    searchOpen = false;
+  }
 
   previousScreen = currentScreen;
   currentScreen = newScreen;
 
   tft.fillRect(0, 20, 240, 270, COLOR_BLACK);
   drawHeader();
+  drawCurrentScreen();
+  drawNavBar();
 
-  switch(currentScreen) {
-    case SCREEN_HOME: drawHomeScreen(); break;
-    case SCREEN_PROJECTS: drawProjectsScreen(); break;
-    case SCREEN_AI: drawAIScreen(); break;
-    case SCREEN_FINANCE: drawFinanceScreen(); break;
-    case SCREEN_STUDIO: drawStudioScreen(); break;
-    case SCREEN_SETTINGS: drawSettingsScreen(); break;
+  // TFT_eSPI writes are blocking (no DMA), so the bus is idle here
+  if (latencyComplete() && latencyOverlayEnabled) {
+    drawLatencyOverlay();
   }
 
-  drawNavBar();
+  LOG(SCREEN, screenNames[currentScreen]);
+}
+
+void nextScreen() {
+  switchScreen((Screen)((currentScreen + 1) % SCREEN_COUNT));
+}
+
+void prevScreen() {
+  switchScreen((Screen)((currentScreen + SCREEN_COUNT - 1) % SCREEN_COUNT));
+}
+
+// ══════════════════════════════════════════════════════════════════════════
+// PROJECT SEARCH
+// ══════════════════════════════════════════════════════════════════════════
+
+static const char* searchModeLabel() {
+  return searchMode == SEARCH_PREFIX ? "prefix" : "contains";
+}
+
+void openSearch() {
+  projectList.deactivate();
+  searchOpen = true;
+  relatedFor = 0;
+
+  tft.fillRect(0, 50, 240, 240, COLOR_BLACK);
+  keyboard.draw(searchModeLabel());
+  runSearch();
+}
+
+void closeSearch() {
+  searchOpen = false;
+  tft.fillRect(0, 50, 240, 240, COLOR_BLACK);
+  drawProjectsScreen();
+}
 
-  Serial.printf("→ Screen: %s\n", screenNames[currentScreen]);
+void runSearch() {
+  // One keystroke gets a fixed slice; a long substring scan finishes in loop()
+  searchIndex.query(searchText, searchMode);
+  searchIndex.step(SEARCH_KEY_BUDGET_US);
+  drawSearchBar();
+  drawSearchResults(true);
+}
+
+void searchKey(char key) {
+  // Any key leaves the related view for the search it came from
+  relatedFor = 0;
+  switch (key) {
+    case KEY_DONE:
+      closeSearch();
+      return;
+    case KEY_MODE:
+      searchMode = searchMode == SEARCH_PREFIX ? SEARCH_SUBSTRING : SEARCH_PREFIX;
+      keyboard.drawModeKey(searchModeLabel());
+      break;
+    case KEY_BACKSPACE:
+      if (searchLength > 0) searchText[--searchLength] = '\0';
+      break;
+    default:
+      if (searchLength < SEARCH_NAME_MAX - 1) {
+        searchText[searchLength++] = key;
+        searchText[searchLength] = '\0';
+      }
+      break;
+  }
+  runSearch();
+}
+
+void handleSearchTap(int16_t x, int16_t y) {
+  char key = keyboard.keyAt(x, y);
+  if (key != KEY_NONE) {
+    searchKey(key);
+    return;
+  }
+
+  if (y >= SEARCH_RESULTS_Y && y < SEARCH_RESULTS_Y + SEARCH_ROWS * SEARCH_ROW_H) {
+    uint16_t row = (y - SEARCH_RESULTS_Y) / SEARCH_ROW_H;
+    uint32_t id;
+    const char* name;
+    if (relatedFor) {
+      if (row >= relatedCount) return;
+      id = relatedHits[row].id;
+      name = relatedHits[row].name;
+    } else {
+      if (row >= searchIndex.hitCount()) return;
+      id = searchIndex.hit(row).id;
+      name = searchIndex.hit(row).name;
+    }
+
+    if (x >= SEARCH_ACTION_X) {
+      // One deploy at a time per project
+      const Command* running = commands.find(CMD_DEPLOY, id);
+      if (!running || running->state != CMD_PENDING) submitCommand(CMD_DEPLOY, id);
+      return;
+    }
+    LOG(PROJECT_OPEN, (unsigned long)id, name);
+    if (vectorIndex.contains(id)) {
+      showRelated(id, name);
+    } else {
+      addNotification(name, COLOR_BLUE);
+    }
+  }
+}
+
+void handleAgentTap(int16_t x, int16_t y) {
+  if (!agentStatus.synced() || x < AGENT_GROUP_ACTION_X || y < AGENT_GROUP_Y) return;
+  uint16_t g = (y - AGENT_GROUP_Y) / AGENT_GROUP_ROW_H;
+  if (g >= agentStatus.groupCount() || AGENT_GROUP_Y + g * AGENT_GROUP_ROW_H >= HEATMAP_Y - 12) return;
+
+  const Command* running = commands.find(CMD_RESTART_GROUP, g);
+  if (!running || running->state != CMD_PENDING) submitCommand(CMD_RESTART_GROUP, g);
+}
+
+void drawSearchBar() {
+  tft.fillRect(0, SEARCH_BAR_Y - 4, 240, 26, COLOR_BLACK);
+  tft.drawRect(5, SEARCH_BAR_Y - 2, 230, 20, COLOR_HOT_PINK);
+
+  tft.setTextColor(COLOR_WHITE, COLOR_BLACK);
+  tft.setTextSize(1);
+  tft.setCursor(10, SEARCH_BAR_Y + 4);
+  // Show the tail when the query is wider than the box
+  const char* shown = searchLength > 36 ? searchText + searchLength - 36 : searchText;
+  tft.printf("> %s_", shown);
+}
+
+void drawSearchResults(bool force) {
+  if (relatedFor) {
+    if (force) drawRelated();
+    return;
+  }
+  uint16_t count = searchIndex.hitCount();
+  bool complete = searchIndex.complete();
+  if (!force && count == searchShown && complete == searchShownComplete) return;
+  searchShown = count;
+  searchShownComplete = complete;
+
+  tft.fillRect(0, SEARCH_RESULTS_Y - 12, 240, 12 + SEARCH_ROWS * SEARCH_ROW_H, COLOR_BLACK);
+  tft.setTextSize(1);
+
+  tft.setTextColor(COLOR_AMBER, COLOR_BLACK);
+  tft.setCursor(10, SEARCH_RESULTS_Y - 10);
+  if (complete) {
+    tft.printf("%u%s matches  %luus", count, count == SEARCH_MAX_HITS ? "+" : "",
+      (unsigned long)searchIndex.stats().lastQueryUs);
+  } else {
+    tft.printf("%u matches, searching...", count);
+  }
+
+  for (uint16_t i = 0; i < count && i < SEARCH_ROWS; i++) {
+    const SearchHit& hit = searchIndex.hit(i);
+    int y = SEARCH_RESULTS_Y + i * SEARCH_ROW_H + 2;
+    tft.setTextColor(COLOR_LIGHT_GRAY, COLOR_BLACK);
+    tft.setCursor(10, y);
+    tft.printf("%.30s", hit.name);
+    drawCommandLabel(SEARCH_ACTION_X + 6, y, commands.find(CMD_DEPLOY, hit.id), "deploy");
+  }
+}
+
+// Nearest projects by embedding, from the on-device cache; tapping one
+// walks on to its own neighbours
+void showRelated(uint32_t id, const char* name) {
+  uint32_t start = micros();
+  relatedCount = vectorIndex.related(id, relatedHits, VECTOR_MAX_RESULTS);
+  relatedUs = micros() - start;
+  relatedFor = id;
+  strncpy(relatedName, name, SEARCH_NAME_MAX - 1);
+  relatedName[SEARCH_NAME_MAX - 1] = '\0';
+
+  LOG(RELATED, (unsigned long)id, relatedCount, (unsigned long)relatedUs);
+
+  // The same project asks the same question, so this is mostly a cache hit
+  if constexpr (EnclaveAiService::enabled) {
+    char prompt[INFER_TEXT_MAX];
+    int n = snprintf(prompt, sizeof(prompt), "In one sentence, what is the project \"%s\"?", relatedName);
+    for (uint8_t i = 0; i < relatedCount && i < 3 && n < (int)sizeof(prompt); i++) {
+      n += snprintf(prompt + n, sizeof(prompt) - n, "%s%s", i ? ", " : " Related projects: ", relatedHits[i].name);
+    }
+    InferLookup r = askInference(INFER_CHAT, prompt, nullptr, INFER_FOR_RELATED);
+    relatedSummaryKey = r.key;
+    relatedSummaryFailed = r.state == INFER_MISS && !r.fetch;
+  }
+  drawRelated();
+}
+
+// Over the search bar until a key is typed
+void drawRelatedSummary() {
+  tft.fillRect(0, SEARCH_BAR_Y - 4, 240, 26, COLOR_BLACK);
+  tft.setTextSize(1);
+  tft.setCursor(5, SEARCH_BAR_Y);
+  const char* text = inference.find(relatedSummaryKey);
+  if (text) {
+    tft.setTextColor(COLOR_WHITE, COLOR_BLACK);
+    tft.printf("%.78s", text);  // two lines
+  } else {
+    tft.setTextColor(COLOR_LIGHT_GRAY, COLOR_BLACK);
+    tft.print(relatedSummaryFailed ? "No summary: Enclave unreachable" : "Asking Enclave...");
+  }
 }
 
-void nextScreen() {
-  switchScreen((Screen)((currentScreen + 1) % SCREEN_COUNT));
-}
+void drawRelated() {
+  if constexpr (EnclaveAiService::enabled) drawRelatedSummary();
+  tft.fillRect(0, SEARCH_RESULTS_Y - 12, 240, 12 + SEARCH_ROWS * SEARCH_ROW_H, COLOR_BLACK);
+  tft.setTextSize(1);
 
-void prevScreen() {
-  switchScreen((Screen)((currentScreen + SCREEN_COUNT - 1) % SCREEN_COUNT));
+  tft.setTextColor(COLOR_AMBER, COLOR_BLACK);
+  tft.setCursor(10, SEARCH_RESULTS_Y - 10);
+  tft.printf("Like %.20s  %luus", relatedName, (unsigned long)relatedUs);
+
+  for (uint8_t i = 0; i < relatedCount && i < SEARCH_ROWS; i++) {
+    const VectorHit& hit = relatedHits[i];
+    int y = SEARCH_RESULTS_Y + i * SEARCH_ROW_H + 2;
+    tft.setTextColor(COLOR_LIGHT_GRAY, COLOR_BLACK);
+    tft.setCursor(10, y);
+    tft.printf("%.22s", hit.name);
+    tft.setTextColor(COLOR_VIOLET, COLOR_BLACK);
+    tft.setCursor(150, y);
+    tft.printf("%3d%%", hit.score / 10);
+    drawCommandLabel(SEARCH_ACTION_X + 6, y, commands.find(CMD_DEPLOY, hit.id), "deploy");
+  }
 }
 
 // ══════════════════════════════════════════════════════════════════════════
 // NOTIFICATIONS
 // ══════════════════════════════════════════════════════════════════════════
 
-void addNotification(const char* msg, uint16_t color) {
-  // Find free slot or oldest
-  int slot = -1;
-  unsigned long oldestTime = millis();
-
-  for (int i = 0; i < MAX_NOTIFICATIONS; i++) {
-    if (!notifications[i].active) {
-      slot = i;
-      break;
-    }
-    if (notifications[i].timestamp < oldestTime) {
-      oldestTime = notifications[i].timestamp;
-      slot = i;
-    }
-  }
+void addNotification(const char* msg, uint16_t color, uint8_t priority) {
+  if (!notifications.add(msg, color, millis(), priority)) return;  // outranked or rate limited
+  // Drawn once per loop pass, however many arrive in it
+  timers.start(notifyTimer, 0, millis());
 
-  if (slot >= 0) {
-    strncpy(notifications[slot].message, msg, 99);
-    notifications[slot].message[99] = '\0';
-    notifications[slot].color = color;
-    notifications[slot].timestamp = millis();
-    notifications[slot].active = true;
-  }
+  LOG(NOTIFICATION, msg);
+}
 
-  Serial.printf("📢 Notification: %s\n", msg);
+// A toast still showing gets a higher priority without being posted again
+void raiseNotification(const char* msg, uint16_t color, uint8_t priority) {
+  if (!notifications.raise(msg, color, millis(), priority)) return;  // gone, or already that high
+  timers.start(notifyTimer, 0, millis());
 }
 
+// Runs from notifyTimer after a post and at each expiry
 void updateNotifications() {
-  unsigned long now = millis();
+  uint32_t now = millis();
+  uint32_t next = notifications.expire(now);
+  if (next) timers.start(notifyTimer, next, now);
+  drawNotifications();
+}
 
-  for (int i = 0; i < MAX_NOTIFICATIONS; i++) {
-    if (notifications[i].active) {
-      // Expire after 5 seconds
-      if (now - notifications[i].timestamp > 5000) {
-        notifications[i].active = false;
-      }
-    }
+void drawToast(TFT_eSPI& target, int x, int y, const Notification& n) {
+  target.fillRect(x, y, TOAST_W, TOAST_H, n.color);
+  target.setTextSize(1);
+  target.setTextColor(COLOR_WHITE, n.color);
+
+  // Cut to the row rather than wrapped, leaving room for the count
+  char count[8] = "";
+  if (n.repeats > 1) snprintf(count, sizeof(count), " x%u", (unsigned)n.repeats);
+  int room = (TOAST_W - 6) / 6 - (int)strlen(count);
+  target.setCursor(x + 3, y + 1);
+  target.printf("%.*s", room, n.message);
+  if (count[0]) {
+    target.setCursor(x + TOAST_W - 3 - strlen(count) * 6, y + 1);
+    target.print(count);
   }
 }
 
+// The top TOAST_ROWS, newest first within a priority, on any screen. A
+// row is read back before its first toast covers it and pushed back when
+// the last one leaves, so no screen ever repaints for a toast
 void drawNotifications() {
-  int y = 25;
-  int count = 0;
-
-  for (int i = 0; i < MAX_NOTIFICATIONS && count < 3; i++) {
-    if (notifications[i].active) {
-      tft.fillRect(5, y, 230, 12, notifications[i].color);
-      tft.setTextColor(COLOR_WHITE, notifications[i].color);
-      tft.setTextSize(1);
-      tft.setCursor(8, y + 2);
-      tft.print(notifications[i].message);
-      y += 14;
-      count++;
+  uint8_t order[TOAST_ROWS];
+  uint8_t count = notifications.ranked(order, TOAST_ROWS);
+  if (count == toastRows && notifications.revision() == toastRevision) return;
+
+  for (uint8_t i = 0; i < count; i++) {
+    int y = TOAST_Y + i * TOAST_PITCH;
+    if (i >= toastRows) tft.readRect(TOAST_X, y, TOAST_W, TOAST_H, toastUnder[i]);
+    const Notification& n = notifications.slot(order[i]);
+    if (toastSpriteReady) {
+      drawToast(toastSprite, 0, 0, n);
+      toastSprite.pushSprite(TOAST_X, y);
+    } else {
+      drawToast(tft, TOAST_X, y, n);
     }
   }
+  for (uint8_t i = count; i < toastRows; i++) {
+    tft.pushRect(TOAST_X, TOAST_Y + i * TOAST_PITCH, TOAST_W, TOAST_H, toastUnder[i]);
+  }
+  toastRows = count;
+  toastRevision = notifications.revision();
 }
 
 // ══════════════════════════════════════════════════════════════════════════
@@ -617,6 +2155,29 @@ void drawStatusBar() {
   tft.setCursor(150, 6);
   uint32_t uptime = millis() / 1000;
   tft.printf("%02d:%02d:%02d", uptime/3600, (uptime%3600)/60, uptime%60);
+
+  // Restored or seed values until the server sends fresh ones
+  if (dashboardStale) {
+    tft.setTextColor(COLOR_AMBER, COLOR_DARK_GRAY);
+    tft.setCursor(205, 6);
+    tft.print("STALE");
+  }
+
+  if (latencyOverlayEnabled) {
+    drawLatencyOverlay();
+  }
+}
+
+void drawLatencyOverlay() {
+  // Touch-to-photon p50/p99 in ms, squeezed between WS and uptime
+  const LogHistogram& h = latencyHistogram(SPAN_TOUCH_TO_PHOTON);
+  tft.fillRect(60, 0, 88, 20, COLOR_DARK_GRAY);
+  tft.setTextSize(1);
+  tft.setTextColor(COLOR_AMBER, COLOR_DARK_GRAY);
+  tft.setCursor(60, 6);
+  tft.printf("L%lu/%lums",
+    (unsigned long)(h.percentile(500) / 1000),
+    (unsigned long)(h.percentile(990) / 1000));
 }
 
 void drawHeader() {
@@ -624,8 +2185,13 @@ void drawHeader() {
   tft.fillRect(0, 20, 240, 30, COLOR_HOT_PINK);
   tft.setTextColor(COLOR_WHITE, COLOR_HOT_PINK);
   tft.setTextSize(2);
-  tft.setCursor(10, 28);
-  tft.printf("%s %s", screenIcons[currentScreen], screenNames[currentScreen]);
+  drawIcon(tft, *screenIcons[currentScreen], 10, 25, COLOR_HOT_PINK);
+  tft.setCursor(36, 28);
+  tft.print(screenNames[currentScreen]);
+
+  // The toasts were painted over; what is under them now is this header
+  toastRows = 0;
+  drawNotifications();
 }
 
 void drawNavBar() {
@@ -637,16 +2203,13 @@ void drawNavBar() {
   for (int i = 0; i < SCREEN_COUNT; i++) {
     int x = i * buttonWidth;
 
+    uint16_t background = COLOR_DARK_GRAY;
     if (i == currentScreen) {
-      tft.fillRect(x, navY, buttonWidth, 30, COLOR_HOT_PINK);
-      tft.setTextColor(COLOR_WHITE, COLOR_HOT_PINK);
-    } else {
-      tft.setTextColor(COLOR_LIGHT_GRAY, COLOR_DARK_GRAY);
+      background = COLOR_HOT_PINK;
+      tft.fillRect(x, navY, buttonWidth, 30, background);
     }
 
-    tft.setTextSize(2);
-    tft.setCursor(x + 8, navY + 8);
-    tft.print(screenIcons[i]);
+    drawIcon(tft, *screenIcons[i], x + 10, navY + 5, background);
   }
 }
 
@@ -654,7 +2217,39 @@ void drawNavBar() {
 // UI DRAWING - SCREENS
 // ══════════════════════════════════════════════════════════════════════════
 
+void drawCurrentScreen() {
+  // Render path must stay off the heap (see alloc_guard.h)
+  ALLOC_GUARD_SCOPE("frame");
+  uint32_t start = micros();
+
+  switch(currentScreen) {
+    case SCREEN_HOME: drawHomeScreen(); break;
+    case SCREEN_PROJECTS: drawProjectsScreen(); break;
+    case SCREEN_AI: drawAIScreen(); break;
+    case SCREEN_FINANCE: drawFinanceScreen(); break;
+    case SCREEN_STUDIO: drawStudioScreen(); break;
+    case SCREEN_SETTINGS: drawSettingsScreen(); break;
+  }
+  frameHistogram.record(micros() - start);
+}
+
+void refreshCurrentScreen() {
+  // The project list repaints itself; only the stats above it go stale
+  if (currentScreen == SCREEN_PROJECTS) {
+    if (searchOpen) return;
+    ALLOC_GUARD_SCOPE("frame");
+    tft.fillRect(0, 80, 240, PROJECT_LIST_TOP - 80, COLOR_BLACK);
+    drawProjectStats();
+    return;
+  }
+
+  tft.fillRect(0, 50, 240, 240, COLOR_BLACK);
+  drawCurrentScreen();
+}
+
 void drawHomeScreen() {
+  PROFILE_ZONE(PROF_DRAW_HOME);
+
   int y = 60;
 
   // Welcome message
@@ -682,215 +2277,288 @@ void drawHomeScreen() {
 
   // Projects
   tft.setCursor(10, y);
-  tft.printf("Projects: %s", formatNumber(projectCount).c_str());
+  char num[FMT_BUF_SIZE];
+  fmtSI(num, sizeof(num), projectCount);
+  tft.printf("Projects: %s", num);
   y += 15;
   drawProgressBar(10, y, 220, 8, (projectCount % 100) / 100.0, COLOR_BLUE);
   y += 15;
 
   // Agents
   tft.setCursor(10, y);
-  tft.printf("AI Agents: %s (%d active)", formatNumber(agentCount).c_str(), activeAgents);
+  fmtSI(num, sizeof(num), agentCount);
+  tft.printf("AI Agents: %s (%d active)", num, activeAgents);
   y += 15;
-  drawProgressBar(10, y, 220, 8, activeAgents / 100.0, COLOR_VIOLET);
+  drawProgressBar(10, y, 220, 8, agentCount ? (float)activeAgents / agentCount : 0, COLOR_VIOLET);
   y += 15;
 
   // RoadCoin
   tft.setCursor(10, y);
-  tft.printf("RoadCoin: $%.4f", roadCoinPrice);
-  uint16_t changeColor = roadCoinChange24h >= 0 ? COLOR_GREEN : COLOR_RED;
+  fmtPrice(num, sizeof(num), candles.lastPrice(), 4);
+  tft.printf("RoadCoin: $%s", num);
+  uint16_t changeColor = roadCoinChangeBp >= 0 ? COLOR_GREEN : COLOR_RED;
   tft.setTextColor(changeColor, COLOR_BLACK);
-  tft.printf(" %.2f%%", roadCoinChange24h);
+  fmtFixed(num, sizeof(num), roadCoinChangeBp, 2);
+  tft.printf(" %s%%", num);
   tft.setTextColor(COLOR_WHITE, COLOR_BLACK);
-  y += 20;
 
-  // System metrics
-  y += 10;
+  drawSystemMetrics();
+}
+
+// p50/p95/p99 of one metric over the selected window, fixed-width so a
+// repaint needs no clear
+template <uint16_t BUCKETS>
+void drawMetricQuantiles(int y, MetricWindowsT<BUCKETS>& windows, bool percent) {
+  static const uint16_t permille[] = { 500, 950, 990 };
+  typename MetricWindowsT<BUCKETS>::Sketch sketch;
+  windows.query(homeWindow, sketch, millis() / 1000);
+
+  tft.setTextColor(COLOR_WHITE, COLOR_BLACK);
+  for (uint8_t i = 0; i < 3; i++) {
+    char num[FMT_BUF_SIZE] = "-";
+    if (sketch.count && percent) {
+      size_t n = fmtUint(num, sizeof(num) - 1, sketch.quantile(permille[i]));
+      num[n] = '%';
+      num[n + 1] = '\0';
+    } else if (sketch.count) {
+      fmtSI(num, sizeof(num), sketch.quantile(permille[i]));
+    }
+    tft.setCursor(HOME_QUANTILE_X + i * HOME_QUANTILE_W, y);
+    tft.printf("%-5s", num);
+  }
+}
+
+// System metrics with rolling percentiles; tap the heading to switch
+// between the 1m, 1h and 24h windows
+void drawSystemMetrics() {
+  int y = HOME_METRICS_Y;
+  char num[FMT_BUF_SIZE];
+  tft.setTextSize(1);
+
   tft.setTextColor(COLOR_AMBER, COLOR_BLACK);
   tft.setCursor(10, y);
-  tft.println("System Metrics:");
+  tft.print("System Metrics");
+  tft.setTextColor(COLOR_LIGHT_GRAY, COLOR_BLACK);
+  tft.setCursor(100, y);
+  tft.printf("%-3s", sketchWindowName(homeWindow));
+  for (uint8_t i = 0; i < 3; i++) {
+    tft.setCursor(HOME_QUANTILE_X + i * HOME_QUANTILE_W, y);
+    tft.print(i == 0 ? "p50" : i == 1 ? "p95" : "p99");
+  }
   y += 15;
 
   tft.setTextColor(COLOR_WHITE, COLOR_BLACK);
   tft.setCursor(15, y);
   tft.printf("CPU: %d%%", cpuUsage);
+  drawMetricQuantiles(y, cpuWindows, true);
   y += 12;
-  drawProgressBar(70, y - 10, 160, 6, cpuUsage / 100.0, COLOR_HOT_PINK);
+  drawProgressBar(70, y - 10, 56, 6, cpuUsage / 100.0, COLOR_HOT_PINK);
 
   tft.setCursor(15, y);
   tft.printf("Memory: %d%%", memUsage);
+  drawMetricQuantiles(y, memWindows, true);
   y += 12;
-  drawProgressBar(70, y - 10, 160, 6, memUsage / 100.0, COLOR_AMBER);
+  drawProgressBar(70, y - 10, 56, 6, memUsage / 100.0, COLOR_AMBER);
 
   tft.setCursor(15, y);
-  tft.printf("Network: %s/s", formatBytes(networkTraffic).c_str());
-
-  // Notifications area
-  drawNotifications();
+  fmtBytes(num, sizeof(num), networkTraffic);
+  tft.printf("Network: %s/s", num);
+  drawMetricQuantiles(y, networkWindows, false);
 }
 
 void drawProjectsScreen() {
-  int y = 60;
+  PROFILE_ZONE(PROF_DRAW_PROJECTS);
 
   tft.setTextColor(COLOR_BLUE, COLOR_BLACK);
   tft.setTextSize(2);
-  tft.setCursor(30, y);
+  tft.setCursor(30, 60);
   tft.println("PROJECTS");
-  y += 35;
 
-  // Stats
+  tft.setTextColor(COLOR_LIGHT_GRAY, COLOR_BLACK);
+  tft.setTextSize(1);
+  tft.setCursor(186, 64);
+  tft.print("find >");
+
+  drawProjectStats();
+
+  // Everything below the stats belongs to the scrolling list
+  projectPages.setTotal(projectCount);
+  projectList.activate();
+}
+
+void drawProjectStats() {
+  int y = 82;
+
   tft.setTextColor(COLOR_WHITE, COLOR_BLACK);
   tft.setTextSize(1);
 
   uint32_t activeProjects = (projectCount * 38) / 100;
   uint32_t completedProjects = (projectCount * 62) / 100;
 
+  char total[FMT_BUF_SIZE], active[FMT_BUF_SIZE], done[FMT_BUF_SIZE];
+  fmtSI(total, sizeof(total), projectCount);
+  fmtSI(active, sizeof(active), activeProjects);
+  fmtSI(done, sizeof(done), completedProjects);
   tft.setCursor(10, y);
-  tft.printf("Total: %s", formatNumber(projectCount).c_str());
-  y += 15;
-
-  tft.setCursor(10, y);
-  tft.printf("Active: %s (38%%)", formatNumber(activeProjects).c_str());
+  tft.printf("Total %s  Active %s  Done %s", total, active, done);
   y += 12;
-  drawProgressBar(10, y, 220, 8, 0.38, COLOR_GREEN);
-  y += 15;
 
-  tft.setCursor(10, y);
-  tft.printf("Done: %s (62%%)", formatNumber(completedProjects).c_str());
+  // Active and done share one bar
+  tft.fillRect(10, y, 220, 6, COLOR_DARK_GRAY);
+  tft.fillRect(10, y, 220 * 38 / 100, 6, COLOR_GREEN);
+  tft.fillRect(10 + 220 * 38 / 100, y, 220 * 62 / 100, 6, COLOR_VIOLET);
   y += 12;
-  drawProgressBar(10, y, 220, 8, 0.62, COLOR_VIOLET);
-  y += 20;
 
   // Mini chart
-  y += 5;
   tft.setTextColor(COLOR_AMBER, COLOR_BLACK);
   tft.setCursor(10, y);
   tft.println("Activity (last 30 days):");
-  y += 15;
+  y += 11;
 
   uint8_t chartData[30];
   for (int i = 0; i < 30; i++) {
     chartData[i] = random(20, 100);
   }
-  drawMiniChart(10, y, 220, 50, chartData, 30, COLOR_BLUE);
-  y += 55;
-
-  // Top projects
-  tft.setTextColor(COLOR_AMBER, COLOR_BLACK);
-  tft.setCursor(10, y);
-  tft.println("Recent:");
-  y += 15;
-
-  const char* projects[] = {
-    "RoadView Platform",
-    "Lucidia AI Core",
-    "RoadCoin Exchange"
-  };
-
-  tft.setTextColor(COLOR_LIGHT_GRAY, COLOR_BLACK);
-  for (int i = 0; i < 3; i++) {
-    tft.setCursor(15, y);
-    tft.printf("• %s", projects[i]);
-    y += 15;
-  }
+  drawMiniChart(10, y, 220, 28, chartData, 30, COLOR_BLUE);
 }
 
 void drawAIScreen() {
-  int y = 60;
+  PROFILE_ZONE(PROF_DRAW_AI);
 
   tft.setTextColor(COLOR_VIOLET, COLOR_BLACK);
   tft.setTextSize(2);
-  tft.setCursor(30, y);
+  tft.setCursor(30, 60);
   tft.println("AI AGENTS");
-  y += 35;
 
-  // Agent status
-  const char* agents[] = {
-    "Lucidia", "Master AI", "🟢",
-    "Roadie", "Tutor", "🟢",
-    "Radius", "Quantum", "🟢",
-    "Athena", "Code Review", "🟡",
-    "Guardian", "Security", "🟢",
-    "Alice", "Governance", "🟢",
-    "Aria", "Design", "🟢",
-    "Cece", "Personal AI", "🟢"
-  };
+  drawAgentSummary();
+  drawAgentHeatmap(true);
+
+  // Legend under the heatmap
+  static const Icon* const legendIcons[] = { &ICON_DOT_ONLINE, &ICON_DOT_DEGRADED, &ICON_DOT_OFFLINE, &ICON_DOT_UNKNOWN };
+  static const char* const legendNames[] = { "online", "degraded", "offline", "unknown" };
+  tft.setTextSize(1);
+  for (int i = 0; i < 4; i++) {
+    int x = 10 + i * 58;
+    drawIcon(tft, *legendIcons[i], x, HEATMAP_Y + HEATMAP_ROWS + 5, COLOR_BLACK);
+    tft.setTextColor(COLOR_LIGHT_GRAY, COLOR_BLACK);
+    tft.setCursor(x + 11, HEATMAP_Y + HEATMAP_ROWS + 5);
+    tft.print(legendNames[i]);
+  }
+}
 
+void drawAgentSummary() {
+  tft.fillRect(0, 80, 240, HEATMAP_Y - 84, COLOR_BLACK);
   tft.setTextSize(1);
 
-  for (int i = 0; i < 8; i++) {
-    uint16_t color = (i % 2 == 0) ? COLOR_BLUE : COLOR_AMBER;
-    tft.setTextColor(color, COLOR_BLACK);
+  char num[FMT_BUF_SIZE];
+  if (!agentStatus.synced()) {
+    tft.setTextColor(COLOR_LIGHT_GRAY, COLOR_BLACK);
+    tft.setCursor(10, 84);
+    fmtSI(num, sizeof(num), agentCount);
+    tft.printf("%s agents, waiting for status...", num);
+    return;
+  }
+
+  // Fleet totals, then one stacked bar across all states
+  const AgentCounts& t = agentStatus.totals();
+  uint32_t size = agentStatus.size();
+  tft.setCursor(10, 84);
+  tft.setTextColor(COLOR_GREEN, COLOR_BLACK);
+  fmtSI(num, sizeof(num), t.online);
+  tft.printf("On %s  ", num);
+  tft.setTextColor(COLOR_AMBER, COLOR_BLACK);
+  fmtSI(num, sizeof(num), t.degraded);
+  tft.printf("Degr %s  ", num);
+  tft.setTextColor(COLOR_RED, COLOR_BLACK);
+  fmtSI(num, sizeof(num), t.offline);
+  tft.printf("Off %s", num);
+
+  const uint32_t parts[] = { t.online, t.degraded, t.offline, t.unknown };
+  const uint16_t colors[] = { COLOR_GREEN, COLOR_AMBER, COLOR_RED, COLOR_DARK_GRAY };
+  int x = 10;
+  for (int i = 0; i < 4; i++) {
+    int w = size ? (int)((uint64_t)parts[i] * 220 / size) : 0;
+    if (i == 3) w = 230 - x;  // absorbs rounding
+    tft.fillRect(x, 96, w, 6, colors[i]);
+    x += w;
+  }
+
+  // Per-group online share, trouble shown from the right
+  int y = AGENT_GROUP_Y;
+  for (uint8_t g = 0; g < agentStatus.groupCount() && y < HEATMAP_Y - 12; g++) {
+    const AgentGroup& group = agentStatus.group(g);
+    char online[FMT_BUF_SIZE], count[FMT_BUF_SIZE];
+    fmtSI(online, sizeof(online), group.counts.online);
+    fmtSI(count, sizeof(count), group.count);
+
+    tft.setTextColor(g % 2 == 0 ? COLOR_BLUE : COLOR_AMBER, COLOR_BLACK);
     tft.setCursor(10, y);
-    tft.printf("%s - %s", agents[i*3], agents[i*3+1]);
+    tft.printf("%-11s %s/%s", group.name, online, count);
 
-    // Status indicator
-    tft.setCursor(210, y);
-    if (agents[i*3+2][0] == '🟢') {
-      tft.setTextColor(COLOR_GREEN, COLOR_BLACK);
-      tft.print("●");
+    // A restart in flight shows in place of the bar
+    const Command* restart = commands.find(CMD_RESTART_GROUP, g);
+    if (restart) {
+      drawCommandLabel(160, y, restart, nullptr);
     } else {
-      tft.setTextColor(COLOR_AMBER, COLOR_BLACK);
-      tft.print("●");
+      tft.fillRect(160, y + 1, 70, 5, COLOR_DARK_GRAY);
+      if (group.count) {
+        int good = (int)((uint64_t)group.counts.online * 70 / group.count);
+        int bad = (int)((uint64_t)(group.counts.degraded + group.counts.offline) * 70 / group.count);
+        tft.fillRect(160, y + 1, good, 5, COLOR_GREEN);
+        tft.fillRect(230 - bad, y + 1, bad, 5, COLOR_RED);
+      }
     }
+    y += AGENT_GROUP_ROW_H;
+  }
+}
 
-    y += 20;
+void drawAgentHeatmap(bool full) {
+  // One pixel per agent, painted a row at a time straight from the bitset
+  uint32_t first = 0, last = AGENT_MAX - 1;
+  bool dirty = agentStatus.takeDirty(first, last);
+  if (full) {
+    first = 0;
+    last = AGENT_MAX - 1;
+  } else if (!dirty) {
+    return;
   }
 
-  y += 10;
-  tft.setTextColor(COLOR_HOT_PINK, COLOR_BLACK);
-  tft.setCursor(10, y);
-  tft.printf("Active: %s agents", formatNumber(agentCount).c_str());
-  y += 15;
-  tft.setCursor(10, y);
-  tft.printf("Online: %d / %d", activeAgents, 8);
+  static const uint16_t palette[4] = { COLOR_DARK_GRAY, COLOR_GREEN, COLOR_AMBER, COLOR_RED };
+  const uint32_t* words = agentStatus.words();
+  uint32_t size = agentStatus.size();
+  uint16_t line[HEATMAP_W];
+
+  bool swap = tft.getSwapBytes();
+  tft.setSwapBytes(true);
+  for (uint32_t row = first / HEATMAP_W; row <= last / HEATMAP_W && row < HEATMAP_ROWS; row++) {
+    uint32_t base = row * HEATMAP_W;
+    for (uint32_t w = 0; w < HEATMAP_W / 16; w++) {
+      uint32_t word = base / 16 + w < AGENT_WORDS ? words[base / 16 + w] : 0;
+      for (uint32_t k = 0; k < 16; k++) {
+        uint32_t index = base + w * 16 + k;
+        line[w * 16 + k] = index < size ? palette[(word >> (k * 2)) & 3] : COLOR_BLACK;
+      }
+    }
+    tft.pushImage(HEATMAP_X, HEATMAP_Y + row, HEATMAP_W, 1, line);
+  }
+  tft.setSwapBytes(swap);
 }
 
 void drawFinanceScreen() {
-  int y = 60;
+  PROFILE_ZONE(PROF_DRAW_FINANCE);
 
   tft.setTextColor(COLOR_AMBER, COLOR_BLACK);
   tft.setTextSize(2);
-  tft.setCursor(40, y);
+  tft.setCursor(40, 60);
   tft.println("ROADCOIN");
-  y += 35;
-
-  // Price
-  tft.setTextColor(COLOR_HOT_PINK, COLOR_BLACK);
-  tft.setTextSize(3);
-  tft.setCursor(30, y);
-  tft.printf("$%.4f", roadCoinPrice);
-  y += 30;
-
-  // 24h change
-  uint16_t changeColor = roadCoinChange24h >= 0 ? COLOR_GREEN : COLOR_RED;
-  tft.setTextColor(changeColor, COLOR_BLACK);
-  tft.setTextSize(2);
-  tft.setCursor(30, y);
-  tft.printf("%s%.2f%%", roadCoinChange24h >= 0 ? "+" : "", roadCoinChange24h);
-  y += 25;
-
-  // Price chart
-  tft.setTextColor(COLOR_WHITE, COLOR_BLACK);
-  tft.setTextSize(1);
-  tft.setCursor(10, y);
-  tft.println("Price (24h):");
-  y += 15;
 
-  uint8_t priceData[24];
-  for (int i = 0; i < 24; i++) {
-    priceData[i] = 50 + random(-20, 20);
-  }
-  drawMiniChart(10, y, 220, 40, priceData, 24, changeColor);
-  y += 45;
+  drawFinancePrice();
+  drawCandleTabs();
+  drawCandleChart(true);
+  drawFinanceStats();
 
-  // Stats
-  tft.setTextColor(COLOR_LIGHT_GRAY, COLOR_BLACK);
-  tft.setCursor(10, y);
-  tft.printf("Market Cap: $%dM", random(100, 500));
-  y += 15;
-  tft.setCursor(10, y);
-  tft.printf("Volume: $%dK", random(50, 200));
-  y += 20;
+  int y = FINANCE_STATS_Y + 35;
+  char num[FMT_BUF_SIZE];
 
   // Holdings
   tft.setTextColor(COLOR_BLUE, COLOR_BLACK);
@@ -900,16 +2568,154 @@ void drawFinanceScreen() {
 
   tft.setTextColor(COLOR_VIOLET, COLOR_BLACK);
   tft.setCursor(15, y);
-  tft.printf("ETH: 2.5 ($%.1fK)", 2.5 * 3.2);
+  fmtFloat(num, sizeof(num), 2.5f * 3.2f, 1);
+  tft.printf("ETH: 2.5 ($%sK)", num);
   y += 15;
   tft.setCursor(15, y);
-  tft.printf("SOL: 100 ($%.1fK)", 100 * 0.18);
+  fmtFloat(num, sizeof(num), 100 * 0.18f, 1);
+  tft.printf("SOL: 100 ($%sK)", num);
   y += 15;
   tft.setCursor(15, y);
-  tft.printf("BTC: 0.1 ($%.1fK)", 0.1 * 95);
+  fmtFloat(num, sizeof(num), 0.1f * 95, 1);
+  tft.printf("BTC: 0.1 ($%sK)", num);
+}
+
+void drawFinancePrice() {
+  char num[FMT_BUF_SIZE];
+  tft.setTextColor(COLOR_HOT_PINK, COLOR_BLACK);
+  tft.setTextSize(3);
+  tft.setCursor(30, FINANCE_PRICE_Y);
+  fmtPrice(num, sizeof(num), candles.lastPrice(), 4);
+  tft.printf("$%s ", num);
+
+  uint16_t changeColor = roadCoinChangeBp >= 0 ? COLOR_GREEN : COLOR_RED;
+  tft.setTextColor(changeColor, COLOR_BLACK);
+  tft.setTextSize(2);
+  tft.setCursor(30, FINANCE_CHANGE_Y);
+  fmtFixed(num, sizeof(num), roadCoinChangeBp, 2);
+  tft.printf("%s%s%%  ", roadCoinChangeBp >= 0 ? "+" : "", num);
+}
+
+void drawFinanceStats() {
+  char low[FMT_BUF_SIZE], high[FMT_BUF_SIZE];
+  Price lo, hi;
+  candles.range24h(lo, hi);
+  fmtPrice(low, sizeof(low), lo, 4);
+  fmtPrice(high, sizeof(high), hi, 4);
+
+  tft.setTextColor(COLOR_LIGHT_GRAY, COLOR_BLACK);
+  tft.setTextSize(1);
+  tft.setCursor(10, FINANCE_STATS_Y);
+  tft.printf("24h Low/High: $%s / $%s  ", low, high);
+  tft.setCursor(10, FINANCE_STATS_Y + 15);
+  fmtSI(low, sizeof(low), candles.volume24h());
+  tft.printf("24h Volume: %s RC  ", low);
+}
+
+void drawCandleTabs() {
+  static const char* const labels[CANDLE_FRAMES + 1] = { "1m", "5m", "1h", "all" };
+  tft.setTextSize(1);
+  tft.setTextColor(COLOR_WHITE, COLOR_BLACK);
+  tft.setCursor(10, CANDLE_TABS_Y);
+  tft.print("Price:");
+
+  // Tap anywhere on the chart to cycle the timeframe
+  for (uint8_t f = 0; f <= CANDLE_FRAMES; f++) {
+    int x = 123 + f * 27;
+    bool selected = priceLineView ? f == CANDLE_FRAMES : f == candleFrame;
+    tft.fillRect(x, CANDLE_TABS_Y - 2, 24, 11, selected ? COLOR_AMBER : COLOR_DARK_GRAY);
+    tft.setTextColor(selected ? COLOR_BLACK : COLOR_LIGHT_GRAY);
+    tft.setCursor(x + (f == CANDLE_FRAMES ? 3 : 6), CANDLE_TABS_Y);
+    tft.print(labels[f]);
+  }
+}
+
+int candleY(Price price) {
+  return CANDLE_CHART_Y + (int)((int64_t)(chartHigh - price) * (CANDLE_CHART_H - 1) / (chartHigh - chartLow));
+}
+
+void drawCandleChart(bool full) {
+  if (priceLineView) {
+    drawPriceLine(full);
+    return;
+  }
+
+  const CandleSeries& series = candles.series(candleFrame);
+  uint16_t shown = series.count() < CANDLE_VISIBLE ? series.count() : CANDLE_VISIBLE;
+  uint16_t first = series.count() - shown;
+  if (shown == 0) return;
+
+  // A new candle shifts every column and a price outside the scale
+  // rescales them; anything else only touches the newest column
+  const Candle& newest = series.last();
+  if ((candlesOpened & (1 << candleFrame)) || newest.high > chartHigh || newest.low < chartLow) {
+    full = true;
+  }
+  candlesOpened = 0;
+
+  if (!full) {
+    drawCandle(CANDLE_VISIBLE - 1, newest);
+    return;
+  }
+
+  Price lo = series.at(first).low, hi = series.at(first).high;
+  for (uint16_t i = first + 1; i < series.count(); i++) {
+    if (series.at(i).low < lo) lo = series.at(i).low;
+    if (series.at(i).high > hi) hi = series.at(i).high;
+  }
+  Price pad = (hi - lo) / 8 + 1;
+  chartLow = lo - pad;
+  chartHigh = hi + pad;
+
+  tft.fillRect(CANDLE_CHART_X, CANDLE_CHART_Y, CANDLE_CHART_W, CANDLE_CHART_H, COLOR_BLACK);
+  for (uint16_t i = 0; i < shown; i++) {
+    drawCandle(CANDLE_VISIBLE - shown + i, series.at(first + i));
+  }
+}
+
+// Whole history in constant time: LTTB over the series' min/max buckets.
+// Repaints when a new second starts, not on every tick
+void drawPriceLine(bool full) {
+  static uint32_t drawnSamples = 0;
+  uint32_t samples = priceHistory.samples();
+  if (!full && samples == drawnSamples) return;
+  drawnSamples = samples;
+
+  tft.fillRect(CANDLE_CHART_X, CANDLE_CHART_Y, CANDLE_CHART_W, CANDLE_CHART_H, COLOR_BLACK);
+  Price lo, hi;
+  if (!priceHistory.range(lo, hi)) return;
+  Price pad = (hi - lo) / 8 + 1;
+  chartLow = lo - pad;
+  chartHigh = hi + pad;
+
+  static ChartPoint points[CANDLE_CHART_W];
+  uint16_t n = priceHistory.lttb(points, CANDLE_CHART_W);
+  uint32_t lastX = samples > 1 ? samples - 1 : 1;
+  int prevX = 0, prevY = 0;
+  for (uint16_t i = 0; i < n; i++) {
+    int x = CANDLE_CHART_X + (int)((uint64_t)points[i].x * (CANDLE_CHART_W - 1) / lastX);
+    int y = candleY(points[i].y);
+    if (i) tft.drawLine(prevX, prevY, x, y, COLOR_AMBER);
+    prevX = x;
+    prevY = y;
+  }
+}
+
+void drawCandle(int column, const Candle& c) {
+  int x = CANDLE_CHART_X + column * CANDLE_W;
+  uint16_t color = c.close >= c.open ? COLOR_GREEN : COLOR_RED;
+  int wickTop = candleY(c.high);
+  int bodyTop = candleY(c.close >= c.open ? c.close : c.open);
+  int bodyBottom = candleY(c.close >= c.open ? c.open : c.close);
+
+  tft.fillRect(x, CANDLE_CHART_Y, CANDLE_W, CANDLE_CHART_H, COLOR_BLACK);
+  tft.drawFastVLine(x + 2, wickTop, candleY(c.low) - wickTop + 1, color);
+  tft.fillRect(x + 1, bodyTop, 3, bodyBottom - bodyTop + 1, color);
 }
 
 void drawStudioScreen() {
+  PROFILE_ZONE(PROF_DRAW_STUDIO);
+
   int y = 60;
 
   tft.setTextColor(COLOR_HOT_PINK, COLOR_BLACK);
@@ -945,9 +2751,7 @@ void drawStudioScreen() {
     tft.printf("%s - %s", studios[i*3], studios[i*3+1]);
 
     // Active indicator
-    tft.setCursor(210, y);
-    tft.setTextColor(COLOR_GREEN, COLOR_BLACK);
-    tft.print("●");
+    drawIcon(tft, ICON_DOT_ONLINE, 212, y, COLOR_BLACK);
 
     y += 20;
   }
@@ -959,6 +2763,8 @@ void drawStudioScreen() {
 }
 
 void drawSettingsScreen() {
+  PROFILE_ZONE(PROF_DRAW_SETTINGS);
+
   int y = 60;
 
   tft.setTextColor(COLOR_VIOLET, COLOR_BLACK);
@@ -979,10 +2785,15 @@ void drawSettingsScreen() {
   tft.printf("WiFi: %s", wifiConnected ? "Connected" : "Disconnected");
   y += 12;
 
+  char num[FMT_BUF_SIZE];
+
   if (wifiConnected) {
+    IPAddress ip = WiFi.localIP();
+    uint8_t octets[4] = { ip[0], ip[1], ip[2], ip[3] };
+    fmtIPv4(num, sizeof(num), octets);
     tft.setTextColor(COLOR_BLUE, COLOR_BLACK);
     tft.setCursor(15, y);
-    tft.printf("IP: %s", WiFi.localIP().toString().c_str());
+    tft.printf("IP: %s", num);
     y += 12;
 
     tft.setCursor(15, y);
@@ -993,6 +2804,21 @@ void drawSettingsScreen() {
   tft.setTextColor(wsConnected ? COLOR_GREEN : COLOR_RED, COLOR_BLACK);
   tft.setCursor(15, y);
   tft.printf("WebSocket: %s", wsConnected ? "Connected" : "Disconnected");
+  y += 12;
+
+  // Live session quality of the active endpoint
+  if (wsSession.connected()) {
+    const WsEndpointStats& ws = wsSession.stats(wsSession.active());
+    tft.setTextColor(COLOR_BLUE, COLOR_BLACK);
+    tft.setCursor(15, y);
+    if (ws.srttUs == WS_RTT_UNKNOWN) {
+      tft.printf("%s", wsSession.endpoint(wsSession.active()).host);
+    } else {
+      fmtFixed(num, sizeof(num), ws.srttUs / 100, 1);
+      tft.printf("%s %s ms, %u%% loss", wsSession.endpoint(wsSession.active()).host, num,
+        wsSession.lossPercent(wsSession.active()));
+    }
+  }
   y += 20;
 
   // System info
@@ -1009,18 +2835,52 @@ void drawSettingsScreen() {
   tft.println("240x320 ILI9341");
   y += 12;
   tft.setCursor(15, y);
-  tft.printf("Uptime: %dd %dh %dm",
-    millis()/(1000*60*60*24),
-    (millis()/(1000*60*60))%24,
-    (millis()/(1000*60))%60);
+  fmtDuration(num, sizeof(num), millis() / 1000);
+  tft.printf("Uptime: %s", num);
   y += 12;
   tft.setCursor(15, y);
-  tft.printf("Free RAM: %s", formatBytes(ESP.getFreeHeap()).c_str());
+  fmtBytes(num, sizeof(num), ESP.getFreeHeap());
+  tft.printf("Free RAM: %s", num);
   y += 12;
   tft.setCursor(15, y);
   tft.printf("CPU: %d MHz", ESP.getCpuFreqMHz());
   y += 25;
 
+#if CEO_HUB_PROFILE
+  // Profiler summary replaces the version footer in profiling builds
+  tft.setTextColor(COLOR_AMBER, COLOR_BLACK);
+  tft.setCursor(10, y);
+  const CycleHistogram& loopHist = profileHistogram(PROF_LOOP);
+  tft.printf("Loop p50/p99: %lu/%lu us",
+    (unsigned long)profileCyclesToMicros(loopHist.percentile(500)),
+    (unsigned long)profileCyclesToMicros(loopHist.percentile(990)));
+  y += 12;
+
+  // Slowest zone by p99
+  uint8_t worst = PROF_LOOP;
+  uint32_t worstP99 = 0;
+  for (uint8_t i = PROF_LOOP + 1; i < PROF_ZONE_COUNT; i++) {
+    uint32_t p99 = profileHistogram((ProfileZone)i).percentile(990);
+    if (p99 > worstP99) {
+      worstP99 = p99;
+      worst = i;
+    }
+  }
+  tft.setCursor(10, y);
+  tft.printf("%s p99: %lu us", profileZoneName(worst),
+    (unsigned long)profileCyclesToMicros(worstP99));
+  y += 12;
+
+  const ProfileStall* stall = profileLastStall();
+  tft.setTextColor(stall ? COLOR_HOT_PINK : COLOR_GREEN, COLOR_BLACK);
+  tft.setCursor(10, y);
+  if (stall) {
+    tft.printf("Stalls: %lu (last: %s)", (unsigned long)profileStallCount(),
+      profileZoneName(stall->zone));
+  } else {
+    tft.print("Stalls: 0");
+  }
+#else
   // Version
   tft.setTextColor(COLOR_AMBER, COLOR_BLACK);
   tft.setCursor(10, y);
@@ -1036,6 +2896,7 @@ void drawSettingsScreen() {
   y += 12;
   tft.setCursor(10, y);
   tft.println(" everything.\"");
+#endif
 }
 
 // ══════════════════════════════════════════════════════════════════════════
@@ -1058,49 +2919,505 @@ void drawProgressBar(int x, int y, int w, int h, float percentage, uint16_t colo
 }
 
 void drawMiniChart(int x, int y, int w, int h, uint8_t* data, int dataSize, uint16_t color) {
+  PROFILE_ZONE(PROF_DRAW_MINI_CHART);
+
   // Draw border
   tft.drawRect(x, y, w, h, COLOR_DARK_GRAY);
 
-  // Find min/max for scaling
-  uint8_t minVal = 255, maxVal = 0;
-  for (int i = 0; i < dataSize; i++) {
-    if (data[i] < minVal) minVal = data[i];
-    if (data[i] > maxVal) maxVal = data[i];
+  // More samples than columns: 1px columns from each one's min to max,
+  // the range between them dimmed, so peaks survive
+  if (dataSize > w - 4) {
+    int16_t low[CHART_MAX_BARS], high[CHART_MAX_BARS];
+    uint16_t columns = chartScaleEnvelope(data, dataSize, w, h, low, high);
+    uint16_t dim = (color >> 1) & 0x7BEF;
+    for (uint16_t i = 0; i < columns; i++) {
+      int barX = x + 2 + i;
+      tft.drawFastVLine(barX, y + h - 2 - low[i], low[i], color);
+      tft.drawFastVLine(barX, y + h - 2 - high[i], high[i] - low[i], dim);
+    }
+    return;
   }
 
-  if (maxVal == minVal) maxVal = minVal + 1; // Avoid division by zero
-
   // Draw bars
-  int barWidth = w / dataSize;
-  if (barWidth < 1) barWidth = 1;
+  int16_t heights[CHART_MAX_BARS];
+  int16_t barWidth;
+  uint16_t bars = chartScale(data, dataSize, w, h, heights, barWidth);
 
-  for (int i = 0; i < dataSize && i * barWidth < w; i++) {
-    int barHeight = ((data[i] - minVal) * (h - 4)) / (maxVal - minVal);
+  for (uint16_t i = 0; i < bars; i++) {
     int barX = x + 2 + i * barWidth;
-    int barY = y + h - 2 - barHeight;
+    int barY = y + h - 2 - heights[i];
+
+    tft.fillRect(barX, barY, barWidth - 1, heights[i], color);
+  }
+}
+
+// ══════════════════════════════════════════════════════════════════════════
+// METRICS ENDPOINT
+// ══════════════════════════════════════════════════════════════════════════
 
-    tft.fillRect(barX, barY, barWidth - 1, barHeight, color);
+// The whole /metrics body; runs on the loop task when a scrape is waiting
+void collectHubMetrics(PromWriter& w) {
+  char labels[WS_HOST_LEN + 24];
+
+  w.family("blackroad_hub_uptime_seconds", "Time since boot.", PROM_GAUGE);
+  w.sampleMicros("blackroad_hub_uptime_seconds", nullptr, esp_timer_get_time());
+  w.gauge("blackroad_hub_heap_free_bytes", "Free heap.", ESP.getFreeHeap());
+  w.gauge("blackroad_hub_heap_min_free_bytes", "Lowest free heap since boot.", ESP.getMinFreeHeap());
+  w.gauge("blackroad_hub_heap_largest_block_bytes", "Largest allocatable heap block.", ESP.getMaxAllocHeap());
+  w.gauge("blackroad_hub_dashboard_stale", "1 while the dashboard shows restored values.", dashboardStale);
+
+  // Network
+  w.gauge("blackroad_hub_wifi_connected", "1 while associated.", wifiConnected);
+  if (wifiConnected) w.gauge("blackroad_hub_wifi_rssi_dbm", "Signal strength of the access point.", WiFi.RSSI());
+  w.counter("blackroad_hub_wifi_connects_total", "WiFi associations.", hubCounters.wifiConnects);
+  w.counter("blackroad_hub_wifi_failures_total", "WiFi attempts that timed out.", hubCounters.wifiFailures);
+  w.gauge("blackroad_hub_ws_connected", "1 while the WebSocket session is up.", wsConnected);
+  w.counter("blackroad_hub_ws_failovers_total", "Switches to another endpoint.", wsSession.switches());
+  w.family("blackroad_hub_ws_connects_total", "WebSocket connects per endpoint.", PROM_COUNTER);
+  for (uint8_t i = 0; i < wsSession.size(); i++) {
+    snprintf(labels, sizeof(labels), "endpoint=\"%s:%u\"", wsSession.endpoint(i).host, wsSession.endpoint(i).port);
+    w.sample("blackroad_hub_ws_connects_total", labels, wsSession.stats(i).connects);
+  }
+  w.family("blackroad_hub_ws_rtt_seconds", "Smoothed ping RTT per endpoint.", PROM_GAUGE);
+  for (uint8_t i = 0; i < wsSession.size(); i++) {
+    const WsEndpointStats& h = wsSession.stats(i);
+    if (h.srttUs == WS_RTT_UNKNOWN) continue;
+    snprintf(labels, sizeof(labels), "endpoint=\"%s:%u\"", wsSession.endpoint(i).host, wsSession.endpoint(i).port);
+    w.sampleMicros("blackroad_hub_ws_rtt_seconds", labels, h.srttUs);
+  }
+  w.family("blackroad_hub_ws_messages_total", "Messages received from the backend.", PROM_COUNTER);
+  w.sample("blackroad_hub_ws_messages_total", "type=\"text\"", hubCounters.wsText);
+  w.sample("blackroad_hub_ws_messages_total", "type=\"binary\"", hubCounters.wsBinary);
+  w.counter("blackroad_hub_ws_received_bytes_total", "Message bytes received.", hubCounters.wsBytes);
+  w.counter("blackroad_hub_json_errors_total", "Text messages that failed to parse.", hubCounters.jsonErrors);
+
+  // Timing
+  w.family("blackroad_hub_frame_seconds", "Time to draw the current screen.", PROM_HISTOGRAM);
+  w.histogram("blackroad_hub_frame_seconds", nullptr, frameHistogram);
+  w.family("blackroad_hub_parse_seconds", "Time to deserialize one JSON message.", PROM_HISTOGRAM);
+  w.histogram("blackroad_hub_parse_seconds", nullptr, parseHistogram);
+  static const char* const spanLabels[SPAN_COUNT] = {
+    "span=\"touch_to_gesture\"", "span=\"gesture_to_switch\"", "span=\"switch_to_photon\"", "span=\"touch_to_photon\""
+  };
+  w.family("blackroad_hub_touch_latency_seconds", "Touch-to-photon latency per stage.", PROM_HISTOGRAM);
+  for (uint8_t i = 0; i < SPAN_COUNT; i++) {
+    w.histogram("blackroad_hub_touch_latency_seconds", spanLabels[i], latencyHistogram((LatencySpan)i));
+  }
+  w.family("blackroad_hub_apply_seconds", "Time to apply the last binary frame.", PROM_GAUGE);
+  w.sampleMicros("blackroad_hub_apply_seconds", "frame=\"agents\"", agentApplyUs);
+  w.sampleMicros("blackroad_hub_apply_seconds", "frame=\"ticks\"", tickApplyUs);
+
+  // Loop, logging and notifications
+  const IdleStats& idle = idleStats();
+  w.family("blackroad_hub_idle_seconds_total", "Time the loop spent waiting.", PROM_COUNTER);
+  w.sampleMicros("blackroad_hub_idle_seconds_total", nullptr, idle.idleUs);
+  w.family("blackroad_hub_idle_wakes_total", "Loop wake-ups by cause.", PROM_COUNTER);
+  for (uint8_t i = 0; i < IDLE_WAKE_COUNT; i++) {
+    snprintf(labels, sizeof(labels), "cause=\"%s\"", idleWakeName(i));
+    w.sample("blackroad_hub_idle_wakes_total", labels, idle.wakes[i]);
   }
+  LogStats log = logStats();
+  w.counter("blackroad_hub_log_records_total", "Log records written.", log.written);
+  w.counter("blackroad_hub_log_dropped_total", "Log records dropped on a full ring.", log.dropped);
+  const NotifyStats& notify = notifications.stats();
+  w.family("blackroad_hub_notifications_total", "Notifications posted, by outcome.", PROM_COUNTER);
+  w.sample("blackroad_hub_notifications_total", "outcome=\"shown\"", notify.posted);
+  w.sample("blackroad_hub_notifications_total", "outcome=\"merged\"", notify.merged);
+  w.sample("blackroad_hub_notifications_total", "outcome=\"limited\"", notify.limited);
+  w.sample("blackroad_hub_notifications_total", "outcome=\"dropped\"", notify.dropped);
+
+  // Caches
+  InferStats infer = inference.stats();
+  w.counter("blackroad_hub_inference_requests_total", "Inference cache lookups.", infer.requests);
+  w.counter("blackroad_hub_inference_hits_total", "Lookups answered from the cache, stale included.",
+    infer.hits + infer.staleHits);
+  w.counter("blackroad_hub_inference_calls_total", "Upstream inference calls.", infer.calls);
+
+  // The endpoint itself; the render in progress is not counted yet
+  PromServerStats scrape = promServerStats();
+  w.counter("blackroad_hub_scrapes_total", "Scrapes served.", scrape.scrapes);
+  w.counter("blackroad_hub_scrape_failures_total", "Scrapes that failed or timed out.", scrape.failures);
+  w.family("blackroad_hub_scrape_render_seconds", "Loop time spent rendering the last scrape.", PROM_GAUGE);
+  w.sampleMicros("blackroad_hub_scrape_render_seconds", nullptr, scrape.lastRenderUs);
 }
 
 // ══════════════════════════════════════════════════════════════════════════
-// UTILITIES
+// SERIAL CONSOLE
 // ══════════════════════════════════════════════════════════════════════════
 
-String formatNumber(uint32_t num) {
-  if (num >= 1000000) {
-    return String(num / 1000000.0, 1) + "M";
-  } else if (num >= 1000) {
-    return String(num / 1000.0, 1) + "K";
+// Room for "ask <question>|<context>" at the inference cache's limits
+#define SERIAL_LINE_MAX (16 + INFER_TEXT_MAX + INFER_CONTEXT_MAX)
+
+void handleSerialCommands() {
+  static char line[SERIAL_LINE_MAX];
+  static uint16_t len = 0;
+  static bool overlong = false;  // rest of the line is dropped, then it is refused
+
+  while (Serial.available()) {
+    char c = Serial.read();
+    if (c == '\r' || c == '\n') {
+      if (overlong) {
+        Serial.printf("Line too long, ignored (at most %u bytes)\n", (unsigned)(SERIAL_LINE_MAX - 1));
+      } else if (len > 0) {
+        line[len] = '\0';
+        runSerialCommand(line);
+      }
+      len = 0;
+      overlong = false;
+    } else if (len < SERIAL_LINE_MAX - 1) {
+      line[len++] = c;
+    } else {
+      overlong = true;
+    }
   }
-  return String(num);
 }
 
-String formatBytes(uint32_t bytes) {
-  if (bytes >= 1024 * 1024) {
-    return String(bytes / (1024.0 * 1024.0), 1) + "MB";
-  } else if (bytes >= 1024) {
-    return String(bytes / 1024.0, 1) + "KB";
+template <uint16_t BUCKETS>
+void printQuantiles(const char* metric, MetricWindowsT<BUCKETS>& windows, SketchWindow w) {
+  typename MetricWindowsT<BUCKETS>::Sketch sketch;
+  uint32_t start = micros();
+  windows.query(w, sketch, millis() / 1000);
+  uint32_t queryUs = micros() - start;
+  Serial.printf("  %-3s %-8s p50 %8lu  p95 %8lu  p99 %8lu  %6lu samples%s  query %lu us\n",
+    sketchWindowName(w), metric, (unsigned long)sketch.quantile(500), (unsigned long)sketch.quantile(950),
+    (unsigned long)sketch.quantile(990), (unsigned long)sketch.count, sketch.collapsed ? " (low end folded)" : "",
+    (unsigned long)queryUs);
+}
+
+void runSerialCommand(const char* cmd) {
+  if (strcmp(cmd, "lat") == 0) {
+    latencyPrintReport(Serial);
+  } else if (strcmp(cmd, "lat bin") == 0) {
+    latencyExport(Serial);
+  } else if (strcmp(cmd, "lat reset") == 0) {
+    latencyReset();
+    Serial.println("Latency histograms cleared");
+  } else if (strcmp(cmd, "lat overlay") == 0) {
+    latencyOverlayEnabled = !latencyOverlayEnabled;
+    drawStatusBar();
+  } else if (strcmp(cmd, "prof") == 0) {
+#if CEO_HUB_PROFILE
+    profilePrintReport(Serial);
+#else
+    Serial.println("Profiler disabled (build env:esp32dev-profile)");
+#endif
+  } else if (strcmp(cmd, "prof reset") == 0) {
+#if CEO_HUB_PROFILE
+    profileReset();
+    Serial.println("Profiler cleared");
+#endif
+  } else if (strcmp(cmd, "heap") == 0) {
+    char a[FMT_BUF_SIZE], b[FMT_BUF_SIZE], c[FMT_BUF_SIZE];
+    fmtBytes(a, sizeof(a), ESP.getFreeHeap());
+    fmtBytes(b, sizeof(b), ESP.getMaxAllocHeap());
+    fmtBytes(c, sizeof(c), ESP.getMinFreeHeap());
+    Serial.printf("Heap free %s, largest block %s, low water %s\n", a, b, c);
+#if CEO_HUB_ALLOC_GUARD
+    const AllocGuardStats& g = allocGuardStats();
+    Serial.printf("Alloc guard: %lu frames, %lu allocating (%lu allocs)",
+      (unsigned long)g.frames, (unsigned long)g.violations, (unsigned long)g.allocations);
+    if (g.lastScope) Serial.printf(", last in %s x%lu", g.lastScope, (unsigned long)g.lastCount);
+    Serial.println();
+#endif
+    JsonArenaStats arena = jsonArena.stats();
+    Serial.printf("JSON arena: %u/%u bytes peak (last msg %u), %lu msgs, %lu failed allocs\n",
+      (unsigned)arena.highWater, (unsigned)arena.capacity, (unsigned)arena.lastPeak,
+      (unsigned long)arena.messages, (unsigned long)arena.failures);
+  } else if (strncmp(cmd, "find ", 5) == 0 || strncmp(cmd, "grep ", 5) == 0) {
+    // Same path as a keystroke, run to completion and timed end to end
+    uint32_t start = micros();
+    searchIndex.query(cmd + 5, cmd[0] == 'f' ? SEARCH_PREFIX : SEARCH_SUBSTRING);
+    while (!searchIndex.step(SEARCH_KEY_BUDGET_US)) {}
+    uint32_t elapsed = micros() - start;
+
+    for (uint16_t i = 0; i < searchIndex.hitCount(); i++) {
+      const SearchHit& hit = searchIndex.hit(i);
+      Serial.printf("  #%-6lu %s\n", (unsigned long)hit.id, hit.name);
+    }
+    Serial.printf("%u matches in %lu us\n", searchIndex.hitCount(), (unsigned long)elapsed);
+    if (searchOpen) runSearch();
+  } else if (strcmp(cmd, "index") == 0) {
+    SearchIndexStats s = searchIndex.stats();
+    char size[FMT_BUF_SIZE], raw[FMT_BUF_SIZE];
+    fmtBytes(size, sizeof(size), s.indexBytes);
+    fmtBytes(raw, sizeof(raw), s.rawBytes);
+    Serial.printf("Search index v%lu (gen %lu): %lu names in %lu blocks, %s (raw %s)\n",
+      (unsigned long)s.version, (unsigned long)s.generation, (unsigned long)s.entries,
+      (unsigned long)s.blocks, size, raw);
+    Serial.printf("Overlay: %u deltas, %u hidden ids, log %lu/%u bytes, %lu compactions, %lu failures\n",
+      s.deltas, s.shadowed, (unsigned long)s.logBytes, (unsigned)SEARCH_LOG_BYTES,
+      (unsigned long)s.compactions, (unsigned long)s.failures);
+  } else if (strncmp(cmd, "related ", 8) == 0) {
+    uint32_t id = strtoul(cmd + 8, nullptr, 10);
+    VectorHit hits[VECTOR_MAX_RESULTS], exact[VECTOR_MAX_RESULTS];
+    uint32_t start = micros();
+    uint8_t n = vectorIndex.related(id, hits, VECTOR_MAX_RESULTS);
+    uint32_t elapsed = micros() - start;
+
+    // Brute force over the whole cache, for recall
+    const int8_t* vector = vectorIndex.vector(id);
+    start = micros();
+    uint8_t m = vector ? vectorIndex.queryExact(vector, id, exact, VECTOR_MAX_RESULTS) : 0;
+    uint32_t exactUs = micros() - start;
+    uint8_t found = 0;
+    for (uint8_t i = 0; i < n; i++) {
+      Serial.printf("  #%-6lu %3d%%  %s\n", (unsigned long)hits[i].id, hits[i].score / 10, hits[i].name);
+      for (uint8_t j = 0; j < m; j++) found += exact[j].id == hits[i].id;
+    }
+    Serial.printf("%u related in %lu us (%u codes compared); brute force %lu us, %u/%u found\n",
+      n, (unsigned long)elapsed, vectorIndex.stats().lastScanned, (unsigned long)exactUs, found, m);
+  } else if (strcmp(cmd, "vectors") == 0) {
+    VectorIndexStats s = vectorIndex.stats();
+    Serial.printf("Vector index v%lu (gen %lu): %u/%u projects, %u deleted slots, %u lists (clustered in %lu us)\n",
+      (unsigned long)s.version, (unsigned long)s.generation, s.entries, (unsigned)VECTOR_CAPACITY,
+      s.deleted, s.lists, (unsigned long)s.clusterUs);
+    Serial.printf("%u changes since clustering, %lu sector rewrites, last query %lu us\n",
+      s.changed, (unsigned long)s.rewrites, (unsigned long)s.lastQueryUs);
+  } else if (strcmp(cmd, "candles") == 0) {
+    static const char* const frameNames[CANDLE_FRAMES] = { "1m", "5m", "1h" };
+    char o[FMT_BUF_SIZE], h[FMT_BUF_SIZE], l[FMT_BUF_SIZE], c[FMT_BUF_SIZE];
+    Serial.printf("Ticks: %lu (%lu late, dropped), %s clock, last frame %lu us\n",
+      (unsigned long)candles.tickCount(), (unsigned long)candles.lateCount(),
+      tickStream ? "server" : "uptime", (unsigned long)tickApplyUs);
+    for (uint8_t f = 0; f < CANDLE_FRAMES; f++) {
+      const CandleSeries& series = candles.series((CandleFrame)f);
+      if (series.count() == 0) continue;
+      const Candle& last = series.last();
+      fmtPrice(o, sizeof(o), last.open, 4);
+      fmtPrice(h, sizeof(h), last.high, 4);
+      fmtPrice(l, sizeof(l), last.low, 4);
+      fmtPrice(c, sizeof(c), last.close, 4);
+      Serial.printf("  %s  %2u candles  O %s H %s L %s C %s  vol %lu, %u ticks\n",
+        frameNames[f], series.count(), o, h, l, c, (unsigned long)last.volume, last.ticks);
+    }
+  } else if (strcmp(cmd, "agents") == 0) {
+    uint32_t start = micros();
+    agentStatus.aggregate();
+    uint32_t aggregateUs = micros() - start;
+    const AgentCounts& t = agentStatus.totals();
+    Serial.printf("Agents: %lu tracked (seq %lu%s), %lu online, %lu degraded, %lu offline, %lu unknown\n",
+      (unsigned long)agentStatus.size(), (unsigned long)agentStatus.sequence(),
+      agentStatus.synced() ? "" : ", not synced", (unsigned long)t.online,
+      (unsigned long)t.degraded, (unsigned long)t.offline, (unsigned long)t.unknown);
+    for (uint8_t g = 0; g < agentStatus.groupCount(); g++) {
+      const AgentGroup& group = agentStatus.group(g);
+      Serial.printf("  %-11s %6lu online / %lu\n", group.name,
+        (unsigned long)group.counts.online, (unsigned long)group.count);
+    }
+    Serial.printf("Last diff + aggregate %lu us, aggregate alone %lu us\n",
+      (unsigned long)agentApplyUs, (unsigned long)aggregateUs);
+  } else if (strcmp(cmd, "ws") == 0) {
+    static const char* const states[] = { "offline", "connecting", "connected", "waiting" };
+    Serial.printf("Session %s, %lu switches (last: %s), last outage %lu ms\n",
+      states[wsSession.state()], (unsigned long)wsSession.switches(),
+      wsSwitchReasonName(wsSession.lastSwitchReason()), (unsigned long)(wsSession.lastOutageUs() / 1000));
+    for (uint8_t i = 0; i < wsSession.size(); i++) {
+      const WsEndpointStats& h = wsSession.stats(i);
+      char srtt[FMT_BUF_SIZE] = "-", minRtt[FMT_BUF_SIZE] = "-", probe[FMT_BUF_SIZE] = "-";
+      if (h.srttUs != WS_RTT_UNKNOWN) fmtFixed(srtt, sizeof(srtt), h.srttUs / 100, 1);
+      if (h.minRttUs != WS_RTT_UNKNOWN) fmtFixed(minRtt, sizeof(minRtt), h.minRttUs / 100, 1);
+      if (h.probeUs != WS_RTT_UNKNOWN) fmtFixed(probe, sizeof(probe), h.probeUs / 100, 1);
+      Serial.printf("%c %s\n", i == wsSession.active() ? '*' : ' ', wsSession.endpoint(i).url);
+      Serial.printf("    rtt %s ms (min %s, var %lu us), loss %u%% (%lu/%lu pings), tcp %s ms\n",
+        srtt, minRtt, (unsigned long)h.rttVarUs, wsSession.lossPercent(i),
+        (unsigned long)h.lost, (unsigned long)h.pingsSent, probe);
+      Serial.printf("    %lu connects, %lu failures, %lu/%lu probes failed%s\n",
+        (unsigned long)h.connects, (unsigned long)h.failures, (unsigned long)h.probeFailures,
+        (unsigned long)h.probes, h.backoffMs ? ", backing off" : "");
+    }
+  } else if (strcmp(cmd, "cmd") == 0) {
+    static const char* const routes[CMD_ROUTES] = { "ws", "http" };
+    static const char* const states[] = { "free", "pending", "acked", "failed" };
+    const CommandStats& st = commands.stats();
+    Serial.printf("Commands: %lu submitted, %lu acked, %lu failed, %lu timeouts, %lu retries, "
+                  "%lu unsent, %lu stray acks\n",
+      (unsigned long)st.submitted, (unsigned long)st.acked, (unsigned long)st.failed,
+      (unsigned long)st.timeouts, (unsigned long)st.retries, (unsigned long)st.unsent,
+      (unsigned long)st.stray);
+    for (uint8_t r = 0; r < CMD_ROUTES; r++) {
+      const LogHistogram& h = st.latencyUs[r];
+      Serial.printf("  %-4s %6lu sent %6lu answered  round trip p50 %lu us, p99 %lu us, max %lu us\n",
+        routes[r], (unsigned long)st.sent[r], (unsigned long)h.count, (unsigned long)h.percentile(500),
+        (unsigned long)h.percentile(990), (unsigned long)(h.count ? h.maxValue : 0));
+    }
+    for (uint8_t i = 0; i < CMD_SLOTS; i++) {
+      const Command& c = commands.slot(i);
+      if (c.state == CMD_FREE) continue;
+      Serial.printf("  #%lu %s %lu: %s, %u attempts, last via %s %s\n", (unsigned long)c.id,
+        commandKindName(c.kind), (unsigned long)c.target, states[c.state], c.attempts,
+        routes[c.route], c.error);
+    }
+  } else if (strcmp(cmd, "cmd reset") == 0) {
+    commands.resetStats();
+    Serial.println("Command stats cleared");
+  } else if (strncmp(cmd, "deploy ", 7) == 0) {
+    uint32_t id = submitCommand(CMD_DEPLOY, strtoul(cmd + 7, nullptr, 10));
+    if (id) Serial.printf("Command %lu submitted\n", (unsigned long)id);
+  } else if (strncmp(cmd, "restart ", 8) == 0) {
+    // restart <group name>
+    uint8_t g = 0;
+    while (g < agentStatus.groupCount() && strcmp(agentStatus.group(g).name, cmd + 8) != 0) g++;
+    if (g == agentStatus.groupCount()) {
+      Serial.println("Unknown agent group (see agents)");
+    } else {
+      uint32_t id = submitCommand(CMD_RESTART_GROUP, g);
+      if (id) Serial.printf("Command %lu submitted\n", (unsigned long)id);
+    }
+  } else if (strcmp(cmd, "quantiles") == 0) {
+    for (uint8_t w = 0; w < SKETCH_WINDOWS; w++) {
+      printQuantiles("cpu", cpuWindows, (SketchWindow)w);
+      printQuantiles("memory", memWindows, (SketchWindow)w);
+      printQuantiles("network", networkWindows, (SketchWindow)w);
+    }
+    Serial.printf("Sketches: %u bytes\n", (unsigned)(sizeof(cpuWindows) + sizeof(memWindows) + sizeof(networkWindows)));
+  } else if (strncmp(cmd, "classify ", 9) == 0) {
+    uint32_t start = micros();
+    TextVerdict v = classifyText(cmd + 9);
+    uint32_t tookUs = micros() - start;
+    Serial.printf("%s, %u%% confident, %u features, %lu us\n", textClassName(v.label), (unsigned)v.confidence,
+      (unsigned)v.features, (unsigned long)tookUs);
+    Serial.printf("Events: %lu triaged, %lu sent to Hugging Face\n", (unsigned long)eventsTriaged,
+      (unsigned long)eventsAsked);
+  } else if (strncmp(cmd, "summarize ", 10) == 0) {
+    if (strlen(cmd + 10) >= INFER_TEXT_MAX) {
+      Serial.printf("Text too long (at most %u bytes)\n", (unsigned)(INFER_TEXT_MAX - 1));
+    } else {
+      printInferLookup(askInference(INFER_SUMMARY, cmd + 10, nullptr, INFER_FOR_SERIAL));
+    }
+  } else if (strncmp(cmd, "ask ", 4) == 0) {
+    // ask <question>|<context>
+    static char question[SERIAL_LINE_MAX];
+    strcpy(question, cmd + 4);
+    char* context = strchr(question, '|');
+    if (context) *context++ = '\0';
+    if (strlen(question) >= INFER_TEXT_MAX || (context && strlen(context) >= INFER_CONTEXT_MAX)) {
+      Serial.printf("Question or context too long (at most %u and %u bytes)\n", (unsigned)(INFER_TEXT_MAX - 1),
+        (unsigned)(INFER_CONTEXT_MAX - 1));
+    } else {
+      printInferLookup(askInference(INFER_ANSWER, question, context ? context : "", INFER_FOR_SERIAL));
+    }
+  } else if (strncmp(cmd, "chat ", 5) == 0) {
+    if (strlen(cmd + 5) >= INFER_TEXT_MAX) {
+      Serial.printf("Text too long (at most %u bytes)\n", (unsigned)(INFER_TEXT_MAX - 1));
+    } else {
+      printInferLookup(askInference(INFER_CHAT, cmd + 5, nullptr, INFER_FOR_SERIAL));
+    }
+  } else if (strcmp(cmd, "infer") == 0 || strcmp(cmd, "infer reset") == 0) {
+    InferStats s = inference.stats();
+    uint32_t served = s.hits + s.staleHits;
+    Serial.printf("Inference cache: %u/%u results, %u calls in flight, %lu evictions\n",
+      s.entries, (unsigned)INFER_ENTRIES, s.inFlight, (unsigned long)s.evictions);
+    Serial.printf("%lu requests: %lu hits, %lu stale, %lu coalesced, %lu misses, %lu busy (hit rate %lu%%)\n",
+      (unsigned long)s.requests, (unsigned long)s.hits, (unsigned long)s.staleHits, (unsigned long)s.coalesced,
+      (unsigned long)s.misses, (unsigned long)s.busy, (unsigned long)(s.requests ? served * 100 / s.requests : 0));
+    Serial.printf("Upstream: %lu calls, %lu answered (mean %lu ms), %lu failed; %lu ms of waiting saved\n",
+      (unsigned long)s.calls, (unsigned long)s.answers,
+      (unsigned long)(s.answers ? s.upstreamUs / s.answers / 1000 : 0), (unsigned long)s.failures,
+      (unsigned long)(s.savedUs / 1000));
+    if (cmd[5]) inference.resetStats();
+  } else if (strcmp(cmd, "anomaly") == 0) {
+    for (uint8_t m = 0; m < ANOMALY_METRICS; m++) {
+      const AnomalyConfig& c = ANOMALY_CONFIGS[m];
+      AnomalyStats st = anomalyDetectors[m].stats();
+      char mean[FMT_BUF_SIZE], sigma[FMT_BUF_SIZE];
+      c.format(mean, sizeof(mean), st.mean);
+      c.format(sigma, sizeof(sigma), st.sigma);
+      Serial.printf("  %-10s mean %10s  sigma %10s  %7lu samples  %3lu fired", c.name, mean, sigma,
+        (unsigned long)st.samples, (unsigned long)st.fired);
+      for (uint8_t r = 0; r < ANOMALY_RULES; r++) {
+        if (st.active & (3 << (r * 2))) Serial.printf("  [%s]", anomalyRuleName((AnomalyRule)r));
+      }
+      Serial.println();
+    }
+  } else if (strcmp(cmd, "cloud") == 0) {
+    Serial.printf("Cloud: %u of %u services compiled in\n", (unsigned)Cloud::enabledCount, (unsigned)Cloud::count);
+    for (size_t i = 0; i < Cloud::count; i++) {
+      const CloudFootprint& f = cloud.footprint(i);
+      if (!f.enabled) {
+        Serial.printf("  %-12s compiled out\n", f.name);
+        continue;
+      }
+      Serial.printf("  %-12s %-7s begin %5lu us  heap %6ld bytes\n", f.name, f.started ? "started" : "idle",
+        (unsigned long)f.beginUs, (long)f.heapBytes);
+    }
+  } else if (strcmp(cmd, "timers") == 0) {
+    for (TimerId id = 0; id < timers.size(); id++) {
+      TimerStats t = timers.stats(id);
+      char due[12] = "-";
+      if (t.armed) snprintf(due, sizeof(due), "%lu", (unsigned long)t.dueIn);
+      Serial.printf("  %-10s every %6lu ms  due %6s  fired %6lu  skipped %4lu  max late %lu ms\n",
+        t.name, (unsigned long)t.period, due, (unsigned long)t.fired,
+        (unsigned long)t.skipped, (unsigned long)t.maxLate);
+    }
+    const IdleStats& idle = idleStats();
+    uint64_t span = esp_timer_get_time() - idle.sinceUs;
+    Serial.printf("Idle %lu%% over %lu s: %lu waits, %lu light sleeps, wakes",
+      span ? (unsigned long)(idle.idleUs * 100 / span) : 0UL,
+      (unsigned long)(span / 1000000), (unsigned long)idle.waits, (unsigned long)idle.lightSleeps);
+    for (uint8_t w = 0; w < IDLE_WAKE_COUNT; w++) {
+      Serial.printf(" %s %lu", idleWakeName(w), (unsigned long)idle.wakes[w]);
+    }
+    Serial.println();
+  } else if (strcmp(cmd, "timers reset") == 0) {
+    idleReset();
+    Serial.println("Idle stats cleared");
+  } else if (strcmp(cmd, "scrape") == 0) {
+    PromServerStats st = promServerStats();
+    if (!HUB_METRICS_PORT) Serial.println("Metrics endpoint off (HUB_METRICS_PORT 0)");
+    Serial.printf("Metrics: %lu scrapes, %lu not found, %lu failed, %lu cut at %u bytes\n",
+      (unsigned long)st.scrapes, (unsigned long)st.notFound, (unsigned long)st.failures,
+      (unsigned long)st.overflows, (unsigned)PROM_BODY_MAX);
+    Serial.printf("Last body %lu bytes, rendered in %lu us\n", (unsigned long)st.lastBytes,
+      (unsigned long)st.lastRenderUs);
+  } else if (strcmp(cmd, "boot") == 0 || strcmp(cmd, "boot save") == 0) {
+    if (cmd[4]) saveBootSnapshot();
+    const uint32_t marks[] = { bootTimes.firstFrame, bootTimes.setupDone, bootTimes.wifiUp,
+                               bootTimes.wsUp, bootTimes.freshData };
+    const char* names[] = { "first frame", "setup done", "WiFi up", "WS up", "fresh data" };
+    Serial.printf("Boot: %s, dashboard %s\n", bootRestored ? "restored from snapshot" : "no snapshot",
+      dashboardStale ? "stale" : "fresh");
+    for (uint8_t i = 0; i < 5; i++) {
+      if (marks[i]) Serial.printf("  %-12s %6lu ms\n", names[i], (unsigned long)(marks[i] / 1000));
+      else Serial.printf("  %-12s      -\n", names[i]);
+    }
+    uint8_t blob[BOOT_SNAPSHOT_MAX];
+    Serial.printf("Snapshot %u bytes: screen %s, %lu projects, %lu agents\n",
+      (unsigned)bootSnapshotEncode(bootSaved, blob, sizeof(blob)),
+      screenNames[bootSaved.screen < SCREEN_COUNT ? bootSaved.screen : 0],
+      (unsigned long)bootSaved.projects, (unsigned long)bootSaved.agents);
+  } else if (strcmp(cmd, "log") == 0) {
+    LogStats st = logStats();
+    Serial.printf("Log: %lu records, %lu dropped, ring peak %lu/%u bytes, %s output, table %04x\n",
+      (unsigned long)st.written, (unsigned long)st.dropped, (unsigned long)st.highWater,
+      (unsigned)LOG_RING_BYTES, logOutput() == LOG_OUTPUT_BINARY ? "binary" : "text", logTableHash());
+    for (uint8_t m = 0; m < LOG_MODULE_COUNT; m++) {
+      Serial.printf("  %-5s %s\n", logModuleName(m), logLevelName(logLevels[m]));
+    }
+  } else if (strcmp(cmd, "log text") == 0 || strcmp(cmd, "log bin") == 0) {
+    logSetOutput(cmd[4] == 'b' ? LOG_OUTPUT_BINARY : LOG_OUTPUT_TEXT);
+  } else if (strncmp(cmd, "log ", 4) == 0) {
+    // log <module|all> <level>
+    char module[12];
+    const char* level = strchr(cmd + 4, ' ');
+    size_t len = level ? (size_t)(level - cmd - 4) : 0;
+    if (len && len < sizeof(module)) {
+      memcpy(module, cmd + 4, len);
+      module[len] = '\0';
+    }
+    if (len && len < sizeof(module) && logSetLevel(module, level + 1)) {
+      Serial.printf("Log %s: %s\n", module, level + 1);
+    } else {
+      Serial.println("Usage: log <sys|net|ws|ui|touch|data|all> <error|warn|info|debug>");
+    }
+  } else if (strcmp(cmd, "index sync") == 0) {
+    requestIndexSync(true);
+    Serial.println("Full index snapshot requested");
+  } else {
+    Serial.println("Commands: lat, lat bin, lat reset, lat overlay, prof, prof reset, heap, "
+                   "find <text>, grep <text>, index, index sync, agents, candles, ws, cmd, cmd reset, "
+                   "deploy <project id>, restart <group>, cloud, quantiles, anomaly, classify <text>, timers, timers reset, "
+                   "related <project id>, vectors, summarize <text>, ask <question>|<context>, chat <text>, "
+                   "infer, infer reset, boot, boot save, scrape, "
+                   "log, log text, log bin, log <module> <level>");
   }
-  return String(bytes) + "B";
 }
@@ -0,0 +1,37 @@
+/**
+ * ══════════════════════════════════════════════════════════════════════════
+ *                    🖤🛣️ METRICS MESSAGE 🛣️🖤
+ * ══════════════════════════════════════════════════════════════════════════
+ */
+
+#include "metrics.h"
+#include <math.h>
+
+static void readCount(JsonVariantConst value, uint8_t flag, uint32_t& out, uint8_t& fields) {
+  if (!value.is<uint32_t>()) return;
+  out = value.as<uint32_t>();
+  fields |= flag;
+}
+
+void metricsRead(JsonVariantConst doc, MetricsUpdate& out) {
+  out.fields = 0;
+  readCount(doc["projects"], METRIC_PROJECTS, out.projects, out.fields);
+  readCount(doc["agents"], METRIC_AGENTS, out.agents, out.fields);
+  readCount(doc["cpu"], METRIC_CPU, out.cpu, out.fields);
+  readCount(doc["memory"], METRIC_MEMORY, out.memory, out.fields);
+  readCount(doc["network"], METRIC_NETWORK, out.network, out.fields);
+
+  JsonVariantConst rc = doc["roadcoin"];
+  if (rc.is<const char*>()) {
+    if (priceParse(rc.as<const char*>(), out.price)) out.fields |= METRIC_PRICE;
+  } else if (rc.is<float>()) {
+    out.price = priceFromDouble(rc.as<double>());
+    out.fields |= METRIC_PRICE;
+  }
+
+  JsonVariantConst change = doc["change24h"];
+  if (change.is<float>()) {
+    out.change24hBp = lround(change.as<float>() * 100);
+    out.fields |= METRIC_CHANGE;
+  }
+}
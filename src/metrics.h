@@ -0,0 +1,45 @@
+/**
+ * ══════════════════════════════════════════════════════════════════════════
+ *                    🖤🛣️ METRICS MESSAGE 🛣️🖤
+ * ══════════════════════════════════════════════════════════════════════════
+ *
+ * Reads the polled metrics message
+ *
+ *   {"projects":30247,"agents":15892,"roadcoin":0.42,"change24h":5.23,
+ *    "cpu":45,"memory":67,"network":2048}
+ *
+ * into plain values. Every field is optional: `fields` says which ones
+ * were present and well-typed. `roadcoin` is a number or a decimal
+ * string such as "0.4213". Whether a field is applied (the agent bitset
+ * or a tick stream may own it) is up to the caller.
+ */
+
+#ifndef METRICS_H
+#define METRICS_H
+
+#include <stdint.h>
+#include <ArduinoJson.h>
+#include "candles.h"
+
+#define METRIC_PROJECTS  0x01
+#define METRIC_AGENTS    0x02
+#define METRIC_PRICE     0x04
+#define METRIC_CHANGE    0x08
+#define METRIC_CPU       0x10
+#define METRIC_MEMORY    0x20
+#define METRIC_NETWORK   0x40
+
+struct MetricsUpdate {
+  uint8_t fields;         // METRIC_* present
+  uint32_t projects;
+  uint32_t agents;
+  Price price;
+  int32_t change24hBp;    // basis points
+  uint32_t cpu;
+  uint32_t memory;
+  uint32_t network;
+};
+
+void metricsRead(JsonVariantConst doc, MetricsUpdate& out);
+
+#endif // METRICS_H
@@ -0,0 +1,144 @@
+/**
+ * ══════════════════════════════════════════════════════════════════════════
+ *                    🖤🛣️ NOTIFICATION QUEUE 🛣️🖤
+ * ══════════════════════════════════════════════════════════════════════════
+ */
+
+#include "notifications.h"
+#include <string.h>
+
+// Higher priority first, then newer (by signed age, so wrap is fine)
+static bool outranks(const Notification& a, const Notification& b) {
+  if (a.priority != b.priority) return a.priority > b.priority;
+  return (int32_t)(a.timestamp - b.timestamp) > 0;
+}
+
+void NotificationQueue::clear() {
+  for (Notification& n : slots) n.active = false;
+  tokens = NOTIFY_BURST;
+  changes++;
+}
+
+// Token bucket; the refill clock starts when the bucket is first dipped
+// into, so a full one does not bank time
+bool NotificationQueue::takeToken(uint32_t nowMs) {
+  if (tokens < NOTIFY_BURST) {
+    uint32_t earned = (nowMs - refillMs) / NOTIFY_RATE_MS;
+    if (earned >= (uint32_t)(NOTIFY_BURST - tokens)) {
+      tokens = NOTIFY_BURST;
+    } else {
+      tokens += earned;
+      refillMs += earned * NOTIFY_RATE_MS;
+    }
+  }
+  if (!tokens) return false;
+  if (tokens == NOTIFY_BURST) refillMs = nowMs;
+  tokens--;
+  return true;
+}
+
+bool NotificationQueue::add(const char* msg, uint16_t color, uint32_t nowMs, uint8_t priority) {
+  // Already showing: keep the slot, restart its time
+  for (Notification& n : slots) {
+    if (n.active && strncmp(n.message, msg, NOTIFY_MSG_LEN - 1) == 0) {
+      n.timestamp = nowMs;
+      if (n.repeats < UINT16_MAX) n.repeats++;
+      if (priority >= n.priority) {
+        n.priority = priority;
+        n.color = color;
+      }
+      counters.merged++;
+      changes++;
+      return true;
+    }
+  }
+
+  // Free slot first, otherwise the oldest of the lowest priority (by age,
+  // so millis() wrap is fine)
+  uint8_t slot = NOTIFY_SLOTS;
+  uint8_t lowest = 0xFF;
+  uint32_t oldestAge = 0;
+  for (uint8_t i = 0; i < NOTIFY_SLOTS; i++) {
+    if (!slots[i].active) {
+      slot = i;
+      break;
+    }
+    uint32_t age = nowMs - slots[i].timestamp;
+    if (slots[i].priority < lowest || (slots[i].priority == lowest && age >= oldestAge)) {
+      lowest = slots[i].priority;
+      oldestAge = age;
+      slot = i;
+    }
+  }
+  if (slots[slot].active && lowest > priority) {
+    counters.dropped++;
+    return false;
+  }
+  if (priority < NOTIFY_CRITICAL && !takeToken(nowMs)) {
+    counters.limited++;
+    return false;
+  }
+
+  Notification& n = slots[slot];
+  strncpy(n.message, msg, NOTIFY_MSG_LEN - 1);
+  n.message[NOTIFY_MSG_LEN - 1] = '\0';
+  n.color = color;
+  n.timestamp = nowMs;
+  n.priority = priority;
+  n.repeats = 1;
+  n.active = true;
+  counters.posted++;
+  changes++;
+  return true;
+}
+
+bool NotificationQueue::raise(const char* msg, uint16_t color, uint32_t nowMs, uint8_t priority) {
+  for (Notification& n : slots) {
+    if (!n.active || strncmp(n.message, msg, NOTIFY_MSG_LEN - 1) != 0) continue;
+    if (nowMs - n.timestamp >= NOTIFY_MS || priority <= n.priority) return false;
+    n.priority = priority;
+    n.color = color;
+    changes++;
+    return true;
+  }
+  return false;
+}
+
+uint32_t NotificationQueue::expire(uint32_t nowMs) {
+  uint32_t next = 0;
+  for (Notification& n : slots) {
+    if (!n.active) continue;
+    uint32_t age = nowMs - n.timestamp;
+    if (age >= NOTIFY_MS) {
+      n.active = false;
+      changes++;
+    } else if (next == 0 || NOTIFY_MS - age < next) {
+      next = NOTIFY_MS - age;
+    }
+  }
+  return next;
+}
+
+uint8_t NotificationQueue::active() const {
+  uint8_t count = 0;
+  for (const Notification& n : slots) count += n.active;
+  return count;
+}
+
+uint8_t NotificationQueue::ranked(uint8_t* out, uint8_t max) const {
+  uint8_t order[NOTIFY_SLOTS];
+  uint8_t count = 0;
+  for (uint8_t i = 0; i < NOTIFY_SLOTS; i++) {
+    if (!slots[i].active) continue;
+    // Insertion sort over at most NOTIFY_SLOTS entries
+    uint8_t pos = count++;
+    while (pos > 0 && outranks(slots[i], slots[order[pos - 1]])) {
+      order[pos] = order[pos - 1];
+      pos--;
+    }
+    order[pos] = i;
+  }
+  if (count > max) count = max;
+  for (uint8_t i = 0; i < count; i++) out[i] = order[i];
+  return count;
+}
@@ -0,0 +1,92 @@
+/**
+ * ══════════════════════════════════════════════════════════════════════════
+ *                    🖤🛣️ NOTIFICATION QUEUE 🛣️🖤
+ * ══════════════════════════════════════════════════════════════════════════
+ *
+ * The toasts under the status bar. A fixed set of slots: a new message
+ * takes a free slot, or replaces the oldest of the lowest priority when
+ * all are in use; it is dropped when every slot outranks it. Posting a
+ * message that is already showing only restarts its time (and raises
+ * its priority) and counts the repeat, so a flapping link shows one
+ * "Server disconnected x4" instead of filling the queue.
+ * New messages below critical are also rate limited: NOTIFY_BURST back
+ * to back, then one per NOTIFY_RATE_MS. Repeats and critical alerts are
+ * never limited.
+ * Each message expires NOTIFY_MS after it was posted. expire() returns
+ * how long until the next one is due, so the caller can arm a one-shot
+ * timer instead of polling. revision() changes whenever what ranked()
+ * returns may have, so the drawer can skip a repaint.
+ *
+ * Pure logic with times passed in; drawing stays with the caller.
+ */
+
+#ifndef NOTIFICATIONS_H
+#define NOTIFICATIONS_H
+
+#include <stdint.h>
+
+#define NOTIFY_SLOTS   5
+#define NOTIFY_MSG_LEN 100
+#define NOTIFY_MS      5000
+#define NOTIFY_BURST   3
+#define NOTIFY_RATE_MS 1000
+
+enum NotifyPriority : uint8_t {
+  NOTIFY_INFO = 0,
+  NOTIFY_WARN,
+  NOTIFY_CRITICAL
+};
+
+struct Notification {
+  char message[NOTIFY_MSG_LEN];
+  uint16_t color;
+  uint32_t timestamp;  // ms
+  uint8_t priority;
+  uint16_t repeats;    // posts merged into this one, 1 for a single post
+  bool active;
+};
+
+struct NotifyStats {
+  uint32_t posted;     // new messages shown
+  uint32_t merged;     // repeats of a message already showing
+  uint32_t limited;    // new messages over the rate limit
+  uint32_t dropped;    // outranked by every slot
+};
+
+class NotificationQueue {
+ public:
+  void clear();
+
+  // Copies msg (truncated to NOTIFY_MSG_LEN - 1 bytes); false when
+  // dropped or rate limited
+  bool add(const char* msg, uint16_t color, uint32_t nowMs, uint8_t priority = NOTIFY_INFO);
+
+  // Lifts the slot still showing msg to priority and color, in place: not
+  // a repeat, so its count, age and the rate limit are untouched. false
+  // when msg has expired or already ranks that high
+  bool raise(const char* msg, uint16_t color, uint32_t nowMs, uint8_t priority);
+
+  // Deactivates expired slots; ms until the next expiry, 0 when none is left
+  uint32_t expire(uint32_t nowMs);
+
+  const Notification& slot(uint8_t i) const { return slots[i]; }
+  uint8_t active() const;
+
+  // Active slot indices, highest priority first and newest first within
+  // a priority; returns how many were written (at most max)
+  uint8_t ranked(uint8_t* out, uint8_t max) const;
+
+  uint32_t revision() const { return changes; }
+  const NotifyStats& stats() const { return counters; }
+
+ private:
+  Notification slots[NOTIFY_SLOTS] = {};
+  uint32_t changes = 0;
+  NotifyStats counters = {};
+  uint8_t tokens = NOTIFY_BURST;
+  uint32_t refillMs = 0;   // when the next token started to accrue
+
+  bool takeToken(uint32_t nowMs);
+};
+
+#endif // NOTIFICATIONS_H
@@ -0,0 +1,181 @@
+/**
+ * ══════════════════════════════════════════════════════════════════════════
+ *                    🖤🛣️ HOT-PATH CYCLE PROFILER 🛣️🖤
+ * ══════════════════════════════════════════════════════════════════════════
+ */
+
+#include "profiler.h"
+
+#if CEO_HUB_PROFILE
+
+static const char* zoneNames[PROF_ZONE_COUNT] = {
+  "loop",
+  "parseMetricsData",
+  "drawHomeScreen",
+  "drawProjectsScreen",
+  "drawAIScreen",
+  "drawFinanceScreen",
+  "drawStudioScreen",
+  "drawSettingsScreen",
+  "drawMiniChart",
+  "drawIcon",
+  "handleTouch",
+  "connectWiFi"
+};
+
+struct ProfileFrame {
+  uint8_t zone;
+  uint32_t childCycles;
+};
+
+static CycleHistogram histograms[PROF_ZONE_COUNT];
+static ProfileFrame stack[PROFILE_MAX_DEPTH];
+static uint8_t depth = 0;
+
+// Per loop() iteration: zone with the most self time so far
+static uint8_t iterWorstZone = PROF_LOOP;
+static uint32_t iterWorstCycles = 0;
+
+static ProfileStall stalls[PROFILE_STALL_LOG];
+static uint8_t stallHead = 0;
+static uint32_t stallTotal = 0;
+static uint32_t stallsByZone[PROF_ZONE_COUNT];
+static uint32_t stallCycles = 0;
+
+static void ensureInit() {
+  if (stallCycles == 0) profileReset();
+}
+
+static void recordStall(uint32_t loopCycles) {
+  ProfileStall& s = stalls[stallHead];
+  s.timestamp = millis();
+  s.loopCycles = loopCycles;
+  s.zoneCycles = iterWorstCycles;
+  s.zone = iterWorstZone;
+
+  stallHead = (stallHead + 1) % PROFILE_STALL_LOG;
+  stallTotal++;
+  stallsByZone[iterWorstZone]++;
+}
+
+// ══════════════════════════════════════════════════════════════════════════
+// SCOPE
+// ══════════════════════════════════════════════════════════════════════════
+
+ProfileScope::ProfileScope(ProfileZone z) : zone(z) {
+  if (depth < PROFILE_MAX_DEPTH) {
+    stack[depth].zone = z;
+    stack[depth].childCycles = 0;
+  }
+  depth++;
+  start = ESP.getCycleCount();
+}
+
+ProfileScope::~ProfileScope() {
+  uint32_t elapsed = ESP.getCycleCount() - start;
+  ensureInit();
+
+  depth--;
+  uint32_t self = elapsed;
+  if (depth < PROFILE_MAX_DEPTH) {
+    uint32_t children = stack[depth].childCycles;
+    self = elapsed > children ? elapsed - children : 0;
+  }
+  if (depth > 0 && depth - 1 < PROFILE_MAX_DEPTH) {
+    stack[depth - 1].childCycles += elapsed;
+  }
+
+  histograms[zone].record(elapsed);
+
+  if (self > iterWorstCycles) {
+    iterWorstCycles = self;
+    iterWorstZone = zone;
+  }
+
+  if (zone == PROF_LOOP) {
+    if (elapsed > stallCycles) {
+      recordStall(elapsed);
+    }
+    iterWorstZone = PROF_LOOP;
+    iterWorstCycles = 0;
+  }
+}
+
+// ══════════════════════════════════════════════════════════════════════════
+// RESULTS
+// ══════════════════════════════════════════════════════════════════════════
+
+const char* profileZoneName(uint8_t zone) {
+  return zone < PROF_ZONE_COUNT ? zoneNames[zone] : "?";
+}
+
+const CycleHistogram& profileHistogram(ProfileZone zone) {
+  ensureInit();
+  return histograms[zone];
+}
+
+uint32_t profileStallCount() {
+  return stallTotal;
+}
+
+uint32_t profileStallCount(ProfileZone zone) {
+  return stallsByZone[zone];
+}
+
+const ProfileStall* profileLastStall() {
+  if (stallTotal == 0) return nullptr;
+  return &stalls[(stallHead + PROFILE_STALL_LOG - 1) % PROFILE_STALL_LOG];
+}
+
+uint32_t profileCyclesToMicros(uint32_t cycles) {
+  return cycles / ESP.getCpuFreqMHz();
+}
+
+void profileReset() {
+  for (int i = 0; i < PROF_ZONE_COUNT; i++) {
+    histograms[i].reset();
+    stallsByZone[i] = 0;
+  }
+  memset(stalls, 0, sizeof(stalls));
+  stallHead = 0;
+  stallTotal = 0;
+  iterWorstZone = PROF_LOOP;
+  iterWorstCycles = 0;
+  stallCycles = (uint32_t)PROFILE_STALL_US * ESP.getCpuFreqMHz();
+}
+
+void profilePrintReport(Print& out) {
+  ensureInit();
+
+  out.printf("Profile @ %lu MHz (us):       n      p50      p99      max     mean\n",
+    (unsigned long)ESP.getCpuFreqMHz());
+  for (int i = 0; i < PROF_ZONE_COUNT; i++) {
+    const CycleHistogram& h = histograms[i];
+    if (h.count == 0) continue;
+    out.printf("  %-20s %8lu %8lu %8lu %8lu %8lu\n", zoneNames[i],
+      (unsigned long)h.count,
+      (unsigned long)profileCyclesToMicros(h.percentile(500)),
+      (unsigned long)profileCyclesToMicros(h.percentile(990)),
+      (unsigned long)profileCyclesToMicros(h.maxValue),
+      (unsigned long)profileCyclesToMicros(h.mean()));
+  }
+
+  out.printf("Stalls > %lu us: %lu\n", (unsigned long)PROFILE_STALL_US, (unsigned long)stallTotal);
+  for (int i = 0; i < PROF_ZONE_COUNT; i++) {
+    if (stallsByZone[i]) {
+      out.printf("  %-20s %lu\n", zoneNames[i], (unsigned long)stallsByZone[i]);
+    }
+  }
+
+  uint8_t shown = stallTotal < PROFILE_STALL_LOG ? stallTotal : PROFILE_STALL_LOG;
+  for (uint8_t n = 0; n < shown; n++) {
+    const ProfileStall& s = stalls[(stallHead + PROFILE_STALL_LOG - 1 - n) % PROFILE_STALL_LOG];
+    out.printf("  @%lums loop %luus, %s %luus\n",
+      (unsigned long)s.timestamp,
+      (unsigned long)profileCyclesToMicros(s.loopCycles),
+      zoneNames[s.zone],
+      (unsigned long)profileCyclesToMicros(s.zoneCycles));
+  }
+}
+
+#endif // CEO_HUB_PROFILE
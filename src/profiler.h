@@ -0,0 +1,92 @@
+/**
+ * ══════════════════════════════════════════════════════════════════════════
+ *                    🖤🛣️ HOT-PATH CYCLE PROFILER 🛣️🖤
+ * ══════════════════════════════════════════════════════════════════════════
+ *
+ * Scoped profiler on the Xtensa cycle counter (ESP.getCycleCount()).
+ * Put PROFILE_ZONE(PROF_xxx) at the top of a function; the elapsed cycles
+ * of every call go into that zone's log-scale histogram.
+ *
+ * PROF_LOOP is the root zone. When one loop() iteration takes longer than
+ * PROFILE_STALL_US the zone with the most self time in that iteration is
+ * blamed and logged as a stall.
+ *
+ * Build with -DCEO_HUB_PROFILE=1 (env:esp32dev-profile) to enable. Without
+ * it PROFILE_ZONE expands to nothing and none of this is compiled.
+ */
+
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#ifndef CEO_HUB_PROFILE
+#define CEO_HUB_PROFILE 0
+#endif
+
+enum ProfileZone {
+  PROF_LOOP = 0,
+  PROF_PARSE_METRICS,
+  PROF_DRAW_HOME,
+  PROF_DRAW_PROJECTS,
+  PROF_DRAW_AI,
+  PROF_DRAW_FINANCE,
+  PROF_DRAW_STUDIO,
+  PROF_DRAW_SETTINGS,
+  PROF_DRAW_MINI_CHART,
+  PROF_DRAW_ICON,
+  PROF_HANDLE_TOUCH,
+  PROF_CONNECT_WIFI,
+  PROF_ZONE_COUNT
+};
+
+#if CEO_HUB_PROFILE
+
+#include <Arduino.h>
+#include "histogram.h"
+
+#ifndef PROFILE_STALL_US
+#define PROFILE_STALL_US 50000  // 50ms loop iteration = visible hitch
+#endif
+
+#define PROFILE_MAX_DEPTH 8
+#define PROFILE_STALL_LOG 8
+
+typedef LogHistogramT<HISTOGRAM_BUCKETS_FULL> CycleHistogram;
+
+struct ProfileStall {
+  uint32_t timestamp;     // millis() at end of the slow iteration
+  uint32_t loopCycles;    // whole iteration
+  uint32_t zoneCycles;    // self time of the blamed zone
+  uint8_t zone;
+};
+
+class ProfileScope {
+ public:
+  explicit ProfileScope(ProfileZone zone);
+  ~ProfileScope();
+
+ private:
+  uint32_t start;
+  uint8_t zone;
+};
+
+#define PROFILE_CONCAT_(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_(a, b)
+#define PROFILE_ZONE(zone) ProfileScope PROFILE_CONCAT(profileScope_, __LINE__)(zone)
+
+const char* profileZoneName(uint8_t zone);
+const CycleHistogram& profileHistogram(ProfileZone zone);
+uint32_t profileStallCount();
+uint32_t profileStallCount(ProfileZone zone);
+const ProfileStall* profileLastStall();
+uint32_t profileCyclesToMicros(uint32_t cycles);
+
+void profileReset();
+void profilePrintReport(Print& out);
+
+#else
+
+#define PROFILE_ZONE(zone) do {} while (0)
+
+#endif // CEO_HUB_PROFILE
+
+#endif // PROFILER_H
@@ -0,0 +1,401 @@
+/**
+ * ══════════════════════════════════════════════════════════════════════════
+ *                    🖤🛣️ VIRTUALIZED PROJECT LIST 🛣️🖤
+ * ══════════════════════════════════════════════════════════════════════════
+ */
+
+#include "project_list.h"
+#include "colors.h"
+
+#define COLOR_ROW_ODD    0x1082  // zebra stripe, between black and dark gray
+
+// ILI9341 vertical scrolling
+#define ILI9341_VSCRDEF  0x33
+#define ILI9341_VSCRSADD 0x37
+#define PANEL_LINES      320
+
+#define FLING_TAU_S      0.35f   // velocity halves roughly every 240ms
+#define FLING_MIN_SPEED  15.0f   // px/s, below this the list settles
+#define FLING_MAX_SPEED  6000.0f
+#define DRAG_SLOP        6       // px of jitter ignored on resistive touch
+#define FLING_STALE_MS   80      // finger held still this long = no fling
+
+static inline int32_t wrap(int32_t v, int32_t m) {
+  int32_t r = v % m;
+  return r < 0 ? r + m : r;
+}
+
+static uint8_t parseStatus(const char* status) {
+  if (!status) return PROJECT_UNKNOWN;
+  if (strcmp(status, "active") == 0) return PROJECT_ACTIVE;
+  if (strcmp(status, "done") == 0) return PROJECT_DONE;
+  if (strcmp(status, "paused") == 0) return PROJECT_PAUSED;
+  return PROJECT_UNKNOWN;
+}
+
+// ══════════════════════════════════════════════════════════════════════════
+// PAGE CACHE
+// ══════════════════════════════════════════════════════════════════════════
+
+void ProjectPageCache::begin(RequestFn request) {
+  requestPage = request;
+  clear();
+}
+
+void ProjectPageCache::clear() {
+  for (int i = 0; i < PROJECT_PAGE_SLOTS; i++) {
+    slots[i].page = -1;
+    slots[i].state = SLOT_EMPTY;
+    slots[i].count = 0;
+  }
+}
+
+ProjectPageCache::Slot* ProjectPageCache::find(int32_t page) {
+  for (int i = 0; i < PROJECT_PAGE_SLOTS; i++) {
+    if (slots[i].state != SLOT_EMPTY && slots[i].page == page) return &slots[i];
+  }
+  return nullptr;
+}
+
+// Free slot, or the one farthest from the viewport outside [keepFirst, keepLast]
+ProjectPageCache::Slot* ProjectPageCache::claim(int32_t page, int32_t keepFirst, int32_t keepLast) {
+  Slot* victim = nullptr;
+  int32_t worst = -1;
+
+  for (int i = 0; i < PROJECT_PAGE_SLOTS; i++) {
+    Slot& s = slots[i];
+    if (s.state == SLOT_EMPTY) {
+      victim = &s;
+      break;
+    }
+    if (s.page >= keepFirst && s.page <= keepLast) continue;
+    int32_t distance = abs(s.page - centerPage);
+    if (distance > worst) {
+      worst = distance;
+      victim = &s;
+    }
+  }
+
+  if (!victim) return nullptr;
+  if (victim->state != SLOT_EMPTY) cacheStats.evictions++;
+
+  victim->page = page;
+  victim->state = SLOT_EMPTY;
+  victim->count = 0;
+  return victim;
+}
+
+uint8_t ProjectPageCache::inflight(uint32_t now) const {
+  uint8_t n = 0;
+  for (int i = 0; i < PROJECT_PAGE_SLOTS; i++) {
+    if (slots[i].state == SLOT_PENDING && now - slots[i].requestedAt < PROJECT_REQUEST_TIMEOUT) n++;
+  }
+  return n;
+}
+
+void ProjectPageCache::request(int32_t page, int32_t keepFirst, int32_t keepLast, uint32_t now) {
+  Slot* s = find(page);
+  if (s && s->state == SLOT_READY) return;
+  if (s && s->state == SLOT_PENDING && now - s->requestedAt < PROJECT_REQUEST_TIMEOUT) return;
+  if (!requestPage || inflight(now) >= PROJECT_MAX_INFLIGHT) return;
+
+  if (!s) s = claim(page, keepFirst, keepLast);
+  if (!s) return;
+
+  if (requestPage((uint32_t)page * PROJECT_PAGE_SIZE, PROJECT_PAGE_SIZE)) {
+    s->state = SLOT_PENDING;
+    s->requestedAt = now;
+    cacheStats.requests++;
+  } else {
+    s->page = -1;
+  }
+}
+
+const ProjectRow* ProjectPageCache::row(uint32_t index) {
+  Slot* s = find(index / PROJECT_PAGE_SIZE);
+  uint32_t offset = index % PROJECT_PAGE_SIZE;
+  if (s && s->state == SLOT_READY && offset < s->count) {
+    cacheStats.hits++;
+    return &s->rows[offset];
+  }
+  cacheStats.misses++;
+  return nullptr;
+}
+
+void ProjectPageCache::want(uint32_t first, uint32_t last, int8_t direction, uint32_t now) {
+  if (totalRows == 0) return;
+  int32_t lastPage = (totalRows - 1) / PROJECT_PAGE_SIZE;
+  int32_t firstVisible = first / PROJECT_PAGE_SIZE;
+  int32_t lastVisible = last / PROJECT_PAGE_SIZE;
+  if (lastVisible > lastPage) lastVisible = lastPage;
+  centerPage = (firstVisible + lastVisible) / 2;
+
+  // Two pages ahead in the scroll direction, one behind
+  int32_t ahead = direction > 0 ? 2 : 1;
+  int32_t behind = direction < 0 ? 2 : 1;
+  int32_t keepFirst = max((int32_t)0, firstVisible - behind);
+  int32_t keepLast = min(lastPage, lastVisible + ahead);
+
+  // Visible pages first, then prefetch nearest-first
+  for (int32_t p = firstVisible; p <= lastVisible; p++) {
+    request(p, keepFirst, keepLast, now);
+  }
+  for (int32_t d = 1; d <= 2; d++) {
+    int32_t forward = direction < 0 ? firstVisible - d : lastVisible + d;
+    int32_t backward = direction < 0 ? lastVisible + d : firstVisible - d;
+    if (forward >= keepFirst && forward <= keepLast) request(forward, keepFirst, keepLast, now);
+    if (backward >= keepFirst && backward <= keepLast) request(backward, keepFirst, keepLast, now);
+  }
+}
+
+int32_t ProjectPageCache::ingest(uint32_t cursor, uint32_t total, JsonArrayConst items) {
+  if (total > 0) {
+    totalRows = total;
+    totalKnown = true;
+  }
+  if (cursor % PROJECT_PAGE_SIZE != 0) return -1;
+
+  int32_t page = cursor / PROJECT_PAGE_SIZE;
+  Slot* s = find(page);
+  if (!s) s = claim(page, page, page);
+  if (!s) return -1;
+
+  uint8_t count = 0;
+  for (JsonVariantConst item : items) {
+    if (count >= PROJECT_PAGE_SIZE) break;
+    ProjectRow& r = s->rows[count++];
+    r.id = item["id"] | (uint32_t)(cursor + count - 1);
+    r.status = parseStatus(item["status"].as<const char*>());
+    strncpy(r.name, item["name"] | "", PROJECT_NAME_LEN - 1);
+    r.name[PROJECT_NAME_LEN - 1] = '\0';
+  }
+
+  s->count = count;
+  s->state = SLOT_READY;
+  cacheStats.pages++;
+  return page;
+}
+
+// ══════════════════════════════════════════════════════════════════════════
+// LIST VIEW
+// ══════════════════════════════════════════════════════════════════════════
+
+void ProjectListView::begin(TFT_eSPI* display, ProjectPageCache* pages, int16_t top, int16_t height) {
+  tft = display;
+  cache = pages;
+  areaTop = top;
+  areaHeight = height;
+}
+
+int32_t ProjectListView::maxScroll() const {
+  int32_t content = (int32_t)cache->total() * PROJECT_ROW_HEIGHT;
+  return content > areaHeight ? content - areaHeight : 0;
+}
+
+void ProjectListView::clamp() {
+  if (position < 0) {
+    position = 0;
+    velocity = 0;
+  }
+  if (position > maxScroll()) {
+    position = maxScroll();
+    velocity = 0;
+  }
+}
+
+void ProjectListView::setHardwareScroll(int16_t top, int16_t height, int16_t offset) {
+  tft->writecommand(ILI9341_VSCRDEF);
+  tft->writedata(top >> 8);
+  tft->writedata(top & 0xFF);
+  tft->writedata(height >> 8);
+  tft->writedata(height & 0xFF);
+  int16_t bottom = PANEL_LINES - top - height;
+  tft->writedata(bottom >> 8);
+  tft->writedata(bottom & 0xFF);
+
+  uint16_t start = top + offset;
+  tft->writecommand(ILI9341_VSCRSADD);
+  tft->writedata(start >> 8);
+  tft->writedata(start & 0xFF);
+}
+
+void ProjectListView::activate() {
+  active = true;
+  velocity = 0;
+  dragging = false;
+  clamp();
+
+  hwOffset = 0;
+  setHardwareScroll(areaTop, areaHeight, 0);
+  rendered = (int32_t)position;
+  drawStrip(0, areaHeight);
+  lastStep = lastFrame = millis();
+}
+
+void ProjectListView::deactivate() {
+  if (!active) return;
+  active = false;
+  velocity = 0;
+  dragging = false;
+  hwOffset = 0;
+  setHardwareScroll(0, PANEL_LINES, 0);
+}
+
+void ProjectListView::touchDown(int16_t y, uint32_t now) {
+  dragging = true;
+  velocity = 0;  // catching a fling stops it
+  dragStartY = y;
+  dragStartPos = position;
+  lastTouchY = y;
+  lastTouchTime = now;
+}
+
+void ProjectListView::touchMove(int16_t y, uint32_t now) {
+  if (!dragging) return;
+  if (abs(y - dragStartY) < DRAG_SLOP && velocity == 0) return;
+
+  uint32_t dt = now - lastTouchTime;
+  if (dt > 0) {
+    // Finger up = content up = position grows
+    float instant = (float)(lastTouchY - y) * 1000.0f / dt;
+    velocity = 0.8f * instant + 0.2f * velocity;
+  }
+
+  position = dragStartPos + (dragStartY - y);
+  clamp();
+  lastTouchY = y;
+  lastTouchTime = now;
+}
+
+void ProjectListView::touchUp(uint32_t now) {
+  if (!dragging) return;
+  dragging = false;
+
+  if (now - lastTouchTime > FLING_STALE_MS) velocity = 0;
+  if (velocity > FLING_MAX_SPEED) velocity = FLING_MAX_SPEED;
+  if (velocity < -FLING_MAX_SPEED) velocity = -FLING_MAX_SPEED;
+  lastStep = now;
+}
+
+void ProjectListView::update(uint32_t now) {
+  if (!active) return;
+
+  // Exponential friction while flinging
+  if (!dragging && velocity != 0) {
+    float dt = (now - lastStep) / 1000.0f;
+    position += velocity * dt;
+    velocity -= velocity * min(1.0f, dt / FLING_TAU_S);
+    if (fabsf(velocity) < FLING_MIN_SPEED) velocity = 0;
+    clamp();
+  }
+  lastStep = now;
+
+  int32_t target = (int32_t)position;
+  if (target != rendered) direction = target > rendered ? 1 : -1;
+
+  uint32_t first = target / PROJECT_ROW_HEIGHT;
+  uint32_t last = (target + areaHeight - 1) / PROJECT_ROW_HEIGHT;
+  cache->want(first, last, direction, now);
+
+  if (target != rendered && now - lastFrame >= PROJECT_FRAME_MS) {
+    scrollTo(target);
+    lastFrame = now;
+  }
+}
+
+void ProjectListView::pageArrived(int32_t page) {
+  if (!active || page < 0) return;
+
+  // Repaint only the part of the viewport covered by this page
+  int32_t pageTop = page * PROJECT_PAGE_SIZE * PROJECT_ROW_HEIGHT - rendered;
+  int32_t pageBottom = pageTop + PROJECT_PAGE_SIZE * PROJECT_ROW_HEIGHT;
+  int32_t from = max(pageTop, (int32_t)0);
+  int32_t to = min(pageBottom, (int32_t)areaHeight);
+  if (from < to) drawStrip(from, to);
+}
+
+// Hardware scroll by the delta, then paint the exposed strip
+void ProjectListView::scrollTo(int32_t target) {
+  int32_t delta = target - rendered;
+  if (delta == 0) return;
+
+  if (abs(delta) >= areaHeight) {
+    rendered = target;
+    drawStrip(0, areaHeight);
+    return;
+  }
+
+  hwOffset = wrap(hwOffset + delta, areaHeight);
+  tft->writecommand(ILI9341_VSCRSADD);
+  uint16_t start = areaTop + hwOffset;
+  tft->writedata(start >> 8);
+  tft->writedata(start & 0xFF);
+
+  rendered = target;
+  if (delta > 0) {
+    drawStrip(areaHeight - delta, areaHeight);
+  } else {
+    drawStrip(0, -delta);
+  }
+}
+
+// Paints viewport lines [from, to) - coordinates relative to the list top
+void ProjectListView::drawStrip(int32_t from, int32_t to) {
+  uint32_t total = cache->total();
+  int32_t firstRow = (rendered + from) / PROJECT_ROW_HEIGHT;
+  int32_t lastRow = (rendered + to - 1) / PROJECT_ROW_HEIGHT;
+
+  for (int32_t r = firstRow; r <= lastRow; r++) {
+    int32_t rowY = r * PROJECT_ROW_HEIGHT - rendered;
+    int32_t a = max(rowY, from);
+    int32_t b = min(rowY + PROJECT_ROW_HEIGHT, to);
+    if (a >= b) continue;
+
+    // Logical lines map to panel memory rotated by the hardware offset;
+    // a row straddling the wrap point is painted in two segments
+    int32_t memA = wrap(a + hwOffset, areaHeight);
+    int32_t len = b - a;
+    int32_t first = min(len, areaHeight - memA);
+    uint32_t index = (uint32_t)r < total ? r : UINT32_MAX;
+    drawRowSegment(index, memA, a - rowY, first);
+    if (len > first) {
+      drawRowSegment(index, 0, a - rowY + first, len - first);
+    }
+  }
+}
+
+void ProjectListView::drawRowSegment(uint32_t index, int16_t memStart, int16_t rowLine, int16_t count) {
+  tft->setViewport(0, areaTop + memStart, tft->width(), count, false);
+  renderRow(index, areaTop + memStart - rowLine);
+  tft->resetViewport();
+}
+
+void ProjectListView::renderRow(uint32_t index, int16_t y) {
+  if (index == UINT32_MAX) {
+    tft->fillRect(0, y, tft->width(), PROJECT_ROW_HEIGHT, COLOR_BLACK);
+    return;
+  }
+
+  uint16_t bg = (index & 1) ? COLOR_ROW_ODD : COLOR_BLACK;
+  tft->fillRect(0, y, tft->width(), PROJECT_ROW_HEIGHT, bg);
+  tft->setTextSize(1);
+  tft->setCursor(6, y + 5);
+
+  const ProjectRow* row = cache->row(index);
+  if (!row) {
+    tft->setTextColor(COLOR_LIGHT_GRAY, bg);
+    tft->printf("#%05lu  ...", (unsigned long)index + 1);
+    return;
+  }
+
+  tft->setTextColor(COLOR_LIGHT_GRAY, bg);
+  tft->printf("#%05lu ", (unsigned long)row->id);
+  tft->setTextColor(COLOR_WHITE, bg);
+  tft->print(row->name);
+
+  uint16_t dot = COLOR_LIGHT_GRAY;
+  if (row->status == PROJECT_ACTIVE) dot = COLOR_GREEN;
+  else if (row->status == PROJECT_DONE) dot = COLOR_VIOLET;
+  else if (row->status == PROJECT_PAUSED) dot = COLOR_AMBER;
+  tft->fillCircle(tft->width() - 10, y + PROJECT_ROW_HEIGHT / 2, 3, dot);
+}
@@ -0,0 +1,161 @@
+/**
+ * ══════════════════════════════════════════════════════════════════════════
+ *                    🖤🛣️ VIRTUALIZED PROJECT LIST 🛣️🖤
+ * ══════════════════════════════════════════════════════════════════════════
+ *
+ * The backend knows 30,000+ projects; the hub keeps only a handful of
+ * pages around the viewport.
+ *
+ * ProjectPageCache  fixed page slots filled over the WebSocket:
+ *                     → {"type":"getProjects","cursor":<row>,"limit":32}
+ *                     ← {"type":"projects","cursor":<row>,"total":30247,
+ *                        "items":[{"id":1,"name":"RoadView","status":"active"}]}
+ *                   The cursor is the row offset of the first item. Pages in
+ *                   the scroll direction are prefetched, the page farthest
+ *                   from the viewport is evicted when a slot is needed.
+ *
+ * ProjectListView   kinetic scrolling driven by touch velocity. Scrolls with
+ *                   the ILI9341 hardware vertical-scroll registers, so each
+ *                   frame only paints the newly exposed strip of rows.
+ */
+
+#ifndef PROJECT_LIST_H
+#define PROJECT_LIST_H
+
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+#include <ArduinoJson.h>
+
+#define PROJECT_PAGE_SIZE 32
+#define PROJECT_PAGE_SLOTS 6
+#define PROJECT_NAME_LEN 28
+#define PROJECT_MAX_INFLIGHT 2
+#define PROJECT_REQUEST_TIMEOUT 3000  // ms before a page request is retried
+
+#define PROJECT_ROW_HEIGHT 17
+#define PROJECT_FRAME_MS 16           // ~60 fps cap for scroll repaints
+
+enum ProjectStatus : uint8_t {
+  PROJECT_ACTIVE = 0,
+  PROJECT_DONE,
+  PROJECT_PAUSED,
+  PROJECT_UNKNOWN
+};
+
+struct ProjectRow {
+  uint32_t id;
+  uint8_t status;
+  char name[PROJECT_NAME_LEN];
+};
+
+struct ProjectCacheStats {
+  uint32_t requests;
+  uint32_t pages;      // pages received
+  uint32_t evictions;
+  uint32_t hits;       // row lookups served from cache
+  uint32_t misses;     // row lookups that had to show a placeholder
+};
+
+// ══════════════════════════════════════════════════════════════════════════
+// PAGE CACHE
+// ══════════════════════════════════════════════════════════════════════════
+
+class ProjectPageCache {
+ public:
+  typedef bool (*RequestFn)(uint32_t cursor, uint16_t limit);
+
+  void begin(RequestFn request);
+  void clear();
+
+  // nullptr while the page is not resident
+  const ProjectRow* row(uint32_t index);
+
+  // Keeps rows first..last resident and prefetches toward `direction`
+  void want(uint32_t first, uint32_t last, int8_t direction, uint32_t now);
+
+  // Stores a page response; returns its page index or -1
+  int32_t ingest(uint32_t cursor, uint32_t total, JsonArrayConst items);
+
+  uint32_t total() const { return totalRows; }
+  void setTotal(uint32_t total) { if (!totalKnown) totalRows = total; }
+  const ProjectCacheStats& stats() const { return cacheStats; }
+
+ private:
+  enum SlotState : uint8_t { SLOT_EMPTY, SLOT_PENDING, SLOT_READY };
+
+  struct Slot {
+    int32_t page;
+    uint8_t state;
+    uint8_t count;
+    uint32_t requestedAt;
+    ProjectRow rows[PROJECT_PAGE_SIZE];
+  };
+
+  Slot slots[PROJECT_PAGE_SLOTS];
+  RequestFn requestPage = nullptr;
+  uint32_t totalRows = 0;
+  bool totalKnown = false;
+  int32_t centerPage = 0;
+  ProjectCacheStats cacheStats = {};
+
+  Slot* find(int32_t page);
+  Slot* claim(int32_t page, int32_t keepFirst, int32_t keepLast);
+  void request(int32_t page, int32_t keepFirst, int32_t keepLast, uint32_t now);
+  uint8_t inflight(uint32_t now) const;
+};
+
+// ══════════════════════════════════════════════════════════════════════════
+// LIST VIEW
+// ══════════════════════════════════════════════════════════════════════════
+
+class ProjectListView {
+ public:
+  void begin(TFT_eSPI* display, ProjectPageCache* pages, int16_t top, int16_t height);
+
+  void activate();    // claims the hardware scroll area and paints everything
+  void deactivate();  // hands the full screen back to normal drawing
+  bool contains(int16_t y) const { return y >= areaTop && y < areaTop + areaHeight; }
+
+  void touchDown(int16_t y, uint32_t now);
+  void touchMove(int16_t y, uint32_t now);
+  void touchUp(uint32_t now);
+
+  // Physics step + repaint of exposed rows; call every loop()
+  void update(uint32_t now);
+  void pageArrived(int32_t page);
+  // Still animating or dragged: loop() must not sleep yet
+  bool moving() const { return active && (dragging || velocity != 0 || (int32_t)position != rendered); }
+
+ private:
+  TFT_eSPI* tft = nullptr;
+  ProjectPageCache* cache = nullptr;
+  int16_t areaTop = 0;
+  int16_t areaHeight = 0;
+  bool active = false;
+
+  // Scroll state in pixels
+  float position = 0;
+  float velocity = 0;        // px/s, positive = content moving up
+  int32_t rendered = 0;      // position currently on the glass
+  int16_t hwOffset = 0;      // hardware scroll offset within the area
+  int8_t direction = 0;
+  uint32_t lastStep = 0;
+  uint32_t lastFrame = 0;
+
+  // Drag state
+  bool dragging = false;
+  int16_t dragStartY = 0;
+  float dragStartPos = 0;
+  int16_t lastTouchY = 0;
+  uint32_t lastTouchTime = 0;
+
+  int32_t maxScroll() const;
+  void clamp();
+  void setHardwareScroll(int16_t top, int16_t height, int16_t offset);
+  void scrollTo(int32_t target);
+  void drawStrip(int32_t from, int32_t to);
+  void drawRowSegment(uint32_t index, int16_t memStart, int16_t rowLine, int16_t count);
+  void renderRow(uint32_t index, int16_t y);
+};
+
+#endif // PROJECT_LIST_H
@@ -0,0 +1,235 @@
+/**
+ * ══════════════════════════════════════════════════════════════════════════
+ *                    🖤🛣️ PROMETHEUS EXPORT 🛣️🖤
+ * ══════════════════════════════════════════════════════════════════════════
+ */
+
+#include "prom_export.h"
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+
+void PromWriter::begin(char* buffer, size_t bytes) {
+  out = buffer;
+  size = bytes;
+  used = 0;
+  overflow = false;
+  if (size) out[0] = '\0';
+}
+
+// A line that does not fit is dropped whole, with everything after it,
+// so a cut body is still valid exposition text
+void PromWriter::append(const char* format, ...) {
+  if (overflow) return;
+  va_list args;
+  va_start(args, format);
+  int n = vsnprintf(out + used, size - used, format, args);
+  va_end(args);
+  if (n >= 0 && used + n < size) {
+    used += n;
+    return;
+  }
+  overflow = true;
+  while (used && out[used - 1] != '\n') used--;
+  out[used] = '\0';
+}
+
+void PromWriter::family(const char* name, const char* help, PromType type) {
+  static const char* const typeNames[] = { "counter", "gauge", "histogram" };
+  append("# HELP %s %s\n# TYPE %s %s\n", name, help, name, typeNames[type]);
+}
+
+void PromWriter::suffixed(const char* name, const char* suffix, const char* labels) {
+  if (labels) append("%s%s{%s}", name, suffix, labels);
+  else append("%s%s", name, suffix);
+}
+
+void PromWriter::seconds(uint64_t us) {
+  append(" %lu.%06lu\n", (unsigned long)(us / 1000000), (unsigned long)(us % 1000000));
+}
+
+void PromWriter::sample(const char* name, const char* labels, uint32_t value) {
+  suffixed(name, "", labels);
+  append(" %lu\n", (unsigned long)value);
+}
+
+void PromWriter::sampleSigned(const char* name, const char* labels, int32_t value) {
+  suffixed(name, "", labels);
+  append(" %ld\n", (long)value);
+}
+
+void PromWriter::sampleMicros(const char* name, const char* labels, uint64_t us) {
+  suffixed(name, "", labels);
+  seconds(us);
+}
+
+void PromWriter::counter(const char* name, const char* help, uint32_t value) {
+  family(name, help, PROM_COUNTER);
+  sample(name, nullptr, value);
+}
+
+void PromWriter::gauge(const char* name, const char* help, int32_t value) {
+  family(name, help, PROM_GAUGE);
+  sampleSigned(name, nullptr, value);
+}
+
+// edgeUs 0 is +Inf
+void PromWriter::bucket(const char* name, const char* labels, uint32_t edgeUs, uint32_t count) {
+  char le[16];
+  if (edgeUs) snprintf(le, sizeof(le), "%lu.%06lu", (unsigned long)(edgeUs / 1000000), (unsigned long)(edgeUs % 1000000));
+  else strcpy(le, "+Inf");
+  if (labels) append("%s_bucket{%s,le=\"%s\"} %lu\n", name, labels, le, (unsigned long)count);
+  else append("%s_bucket{le=\"%s\"} %lu\n", name, le, (unsigned long)count);
+}
+
+// ══════════════════════════════════════════════════════════════════════════
+// HTTP SERVER
+// ══════════════════════════════════════════════════════════════════════════
+
+#ifdef ARDUINO
+#include <Arduino.h>
+#include <lwip/sockets.h>
+#include "idle.h"
+
+#define PROM_TASK_STACK    3072
+#define PROM_TASK_PRIORITY 1
+#define PROM_TASK_CORE     0
+#define PROM_BACKLOG       2
+#define PROM_IO_TIMEOUT_MS 2000   // per recv/send, so a stuck client cannot hold the worker
+#define PROM_HEAD_MAX      4096   // request bytes read before giving up
+#define PROM_RENDER_MS     1000   // loop stalls longer than this fail the scrape
+
+static char body[PROM_BODY_MAX];
+static size_t bodyLength = 0;
+static volatile bool pending = false;
+static TaskHandle_t serverTask = nullptr;
+static int listenFd = -1;
+static PromServerStats counters = {};
+
+static bool sendAll(int fd, const char* data, size_t length) {
+  while (length) {
+    int n = send(fd, data, length, 0);
+    if (n <= 0) return false;
+    data += n;
+    length -= n;
+  }
+  return true;
+}
+
+static bool reply(int fd, const char* status, const char* text, size_t length) {
+  char head[160];
+  int n = snprintf(head, sizeof(head),
+    "HTTP/1.1 %s\r\nContent-Type: text/plain; version=0.0.4; charset=utf-8\r\n"
+    "Content-Length: %u\r\nConnection: close\r\n\r\n", status, (unsigned)length);
+  return sendAll(fd, head, n) && sendAll(fd, text, length);
+}
+
+// Keeps the request line and reads on to the blank line that ends the
+// head, so closing the socket does not reset the reply
+static bool readRequest(int fd, char* line, size_t size) {
+  char chunk[128];
+  size_t n = 0, total = 0;
+  bool lineDone = false;
+  uint32_t tail = 0;
+  while (total < PROM_HEAD_MAX) {
+    int got = recv(fd, chunk, sizeof(chunk), 0);
+    if (got <= 0) return false;
+    total += got;
+    for (int i = 0; i < got; i++) {
+      char c = chunk[i];
+      if (!lineDone) {
+        if (c == '\r' || c == '\n') lineDone = true;
+        else if (n + 1 < size) line[n++] = c;
+      }
+      tail = tail << 8 | (uint8_t)c;
+      if (tail == 0x0D0A0D0A) {
+        line[n] = '\0';
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+static bool isMetricsPath(const char* line) {
+  if (strncmp(line, "GET /metrics", 12) != 0) return false;
+  return line[12] == ' ' || line[12] == '?' || line[12] == '\0';
+}
+
+// One connection at a time; the loop renders, this task does the I/O
+static void promWorker(void*) {
+  static char line[64];
+  for (;;) {
+    int fd = accept(listenFd, nullptr, nullptr);
+    if (fd < 0) {
+      vTaskDelay(pdMS_TO_TICKS(100));
+      continue;
+    }
+    timeval tv = { PROM_IO_TIMEOUT_MS / 1000, 0 };
+    setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+    setsockopt(fd, SOL_SOCKET, SO_SNDTIMEO, &tv, sizeof(tv));
+
+    if (!readRequest(fd, line, sizeof(line))) {
+      counters.failures++;
+    } else if (!isMetricsPath(line)) {
+      counters.notFound++;
+      reply(fd, "404 Not Found", "Not found\n", 10);
+    } else {
+      ulTaskNotifyTake(pdTRUE, 0);  // a render that came too late for the last scrape
+      pending = true;
+      idleNotify();
+      if (ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(PROM_RENDER_MS)) && reply(fd, "200 OK", body, bodyLength)) {
+        counters.scrapes++;
+      } else {
+        pending = false;
+        counters.failures++;
+      }
+    }
+    close(fd);
+  }
+}
+
+bool promServerBegin(uint16_t port) {
+  if (listenFd >= 0) return true;
+  int fd = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+  if (fd < 0) return false;
+  int on = 1;
+  setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on));
+  sockaddr_in addr = {};
+  addr.sin_family = AF_INET;
+  addr.sin_port = htons(port);
+  addr.sin_addr.s_addr = htonl(INADDR_ANY);
+  if (bind(fd, (sockaddr*)&addr, sizeof(addr)) < 0 || listen(fd, PROM_BACKLOG) < 0) {
+    close(fd);
+    return false;
+  }
+  listenFd = fd;
+  xTaskCreatePinnedToCore(promWorker, "metricsHttp", PROM_TASK_STACK, nullptr,
+    PROM_TASK_PRIORITY, &serverTask, PROM_TASK_CORE);
+  return true;
+}
+
+bool promServerPending() {
+  return pending;
+}
+
+void promServerRender(PromCollect collect) {
+  if (!pending) return;
+  uint32_t start = micros();
+  PromWriter w;
+  w.begin(body, sizeof(body));
+  collect(w);
+  bodyLength = w.length();
+  if (w.overflowed()) counters.overflows++;
+  counters.lastBytes = bodyLength;
+  counters.lastRenderUs = micros() - start;
+  pending = false;
+  xTaskNotifyGive(serverTask);
+}
+
+PromServerStats promServerStats() {
+  return counters;
+}
+
+#endif
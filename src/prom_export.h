@@ -0,0 +1,117 @@
+/**
+ * ══════════════════════════════════════════════════════════════════════════
+ *                    🖤🛣️ PROMETHEUS EXPORT 🛣️🖤
+ * ══════════════════════════════════════════════════════════════════════════
+ *
+ * The hub's own counters in Prometheus text exposition format (0.0.4),
+ * served over plain HTTP at /metrics so hubs can be scraped like the
+ * servers.
+ *
+ * PromWriter formats into a fixed buffer: no heap, no floats. Durations
+ * are kept in µs and printed as seconds. A LogHistogram becomes a
+ * Prometheus histogram with edges at powers of 4 µs (64 µs .. 4.2 s).
+ * Its buckets split at powers of two, so the cumulative counts need no
+ * interpolation.
+ *
+ * The HTTP side is a worker task that accepts, reads the request and
+ * sends the reply with blocking sockets, off the loop task. The loop
+ * only renders: the worker flags a scrape and wakes it (idleNotify), the
+ * loop calls promServerRender() from its next pass, and the worker sends
+ * what was rendered. The counters are thus read on the task that
+ * updates them, and a scrape costs the loop one render.
+ */
+
+#ifndef PROM_EXPORT_H
+#define PROM_EXPORT_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "histogram.h"
+
+#define PROM_BODY_MAX   12288
+#define PROM_EDGE_FIRST 6       // le = 2^6 µs
+#define PROM_EDGE_LAST  22      // le = 2^22 µs, then +Inf
+#define PROM_EDGE_STEP  2
+
+enum PromType : uint8_t {
+  PROM_COUNTER = 0,
+  PROM_GAUGE,
+  PROM_HISTOGRAM
+};
+
+class PromWriter {
+ public:
+  void begin(char* buffer, size_t size);
+
+  // # HELP and # TYPE lines; samples of the family follow
+  void family(const char* name, const char* help, PromType type);
+
+  // One sample; `labels` is the inside of the braces (`span="total"`)
+  // or null
+  void sample(const char* name, const char* labels, uint32_t value);
+  void sampleSigned(const char* name, const char* labels, int32_t value);
+  void sampleMicros(const char* name, const char* labels, uint64_t us);  // as seconds
+
+  // Family and one unlabelled sample
+  void counter(const char* name, const char* help, uint32_t value);
+  void gauge(const char* name, const char* help, int32_t value);
+
+  // _bucket, _sum and _count of a µs histogram
+  template <uint8_t BUCKETS>
+  void histogram(const char* name, const char* labels, const LogHistogramT<BUCKETS>& h) {
+    uint32_t below = 0;
+    uint8_t next = 0;
+    for (uint8_t edge = PROM_EDGE_FIRST; edge <= PROM_EDGE_LAST; edge += PROM_EDGE_STEP) {
+      // Every value under 2^edge is in a bucket before this one
+      uint8_t end = LogHistogramT<BUCKETS>::bucketFor(1UL << edge);
+      while (next < end) below += h.buckets[next++];
+      bucket(name, labels, 1UL << edge, below);
+    }
+    bucket(name, labels, 0, h.count);
+    suffixed(name, "_sum", labels);
+    seconds(h.sum);
+    suffixed(name, "_count", labels);
+    append(" %lu\n", (unsigned long)h.count);
+  }
+
+  size_t length() const { return used; }
+  bool overflowed() const { return overflow; }
+
+ private:
+  char* out = nullptr;
+  size_t size = 0;
+  size_t used = 0;
+  bool overflow = false;
+
+  void append(const char* format, ...);
+  void suffixed(const char* name, const char* suffix, const char* labels);
+  void bucket(const char* name, const char* labels, uint32_t edgeUs, uint32_t count);
+  void seconds(uint64_t us);
+};
+
+// ══════════════════════════════════════════════════════════════════════════
+// HTTP SERVER
+// ══════════════════════════════════════════════════════════════════════════
+
+#ifdef ARDUINO
+struct PromServerStats {
+  uint32_t scrapes;        // 200 replies
+  uint32_t notFound;       // other paths
+  uint32_t failures;       // bad requests, render timeouts, short sends
+  uint32_t overflows;      // bodies cut at PROM_BODY_MAX
+  uint32_t lastBytes;
+  uint32_t lastRenderUs;
+};
+
+typedef void (*PromCollect)(PromWriter& w);
+
+// Listens on `port`; starts the worker task the first time
+bool promServerBegin(uint16_t port);
+// A scrape waits for the loop to render
+bool promServerPending();
+// Loop task: renders the body with `collect` and hands it to the worker
+void promServerRender(PromCollect collect);
+PromServerStats promServerStats();
+#endif
+
+#endif // PROM_EXPORT_H
@@ -0,0 +1,23 @@
+/**
+ * ══════════════════════════════════════════════════════════════════════════
+ *                    🖤🛣️ QUANTILE SKETCH 🛣️🖤
+ * ══════════════════════════════════════════════════════════════════════════
+ */
+
+#include "quantile_sketch.h"
+
+static const char* const windowNames[SKETCH_WINDOWS] = { "1m", "1h", "24h" };
+
+const char* sketchWindowName(SketchWindow w) {
+  return w < SKETCH_WINDOWS ? windowNames[w] : "?";
+}
+
+bool sketchWindowParse(const char* name, SketchWindow& out) {
+  for (uint8_t w = 0; w < SKETCH_WINDOWS; w++) {
+    if (name && strcmp(name, windowNames[w]) == 0) {
+      out = (SketchWindow)w;
+      return true;
+    }
+  }
+  return false;
+}
@@ -0,0 +1,268 @@
+/**
+ * ══════════════════════════════════════════════════════════════════════════
+ *                    🖤🛣️ QUANTILE SKETCH 🛣️🖤
+ * ══════════════════════════════════════════════════════════════════════════
+ *
+ * Fixed-memory streaming quantiles with bounded relative error, after
+ * DDSketch. Values are mapped to log-linear buckets: 0..31 get one
+ * bucket each and every power of two above that is split into 16, so a
+ * bucket's midpoint is within 1/32 (3.1%) of any value in it. The index
+ * comes from a count-leading-zeros, no log() and no floats.
+ *
+ * A sketch holds BUCKETS consecutive indices starting at `base`. When
+ * the data spans more than that, the lowest buckets are folded into one
+ * (`collapsed`), so the upper quantiles keep their accuracy. Two
+ * sketches merge by adding counts, the result is the sketch of both
+ * streams, so windows can be assembled from slots and a server can send
+ * sketches of its own.
+ *
+ * MetricWindowsT keeps one metric over rolling 1 min, 1 h and 24 h
+ * windows, each a ring of slot sketches that rotate with the clock.
+ * Recording a sample touches one bucket per window; queries merge the
+ * ring. Times are passed in (seconds).
+ */
+
+#ifndef QUANTILE_SKETCH_H
+#define QUANTILE_SKETCH_H
+
+#include <stdint.h>
+#include <string.h>
+
+#define SKETCH_SUB_BITS 4
+#define SKETCH_SUB_COUNT (1 << SKETCH_SUB_BITS)
+#define SKETCH_INDEX_COUNT (SKETCH_SUB_COUNT * (33 - SKETCH_SUB_BITS))  // covers all of uint32_t
+
+// Indices 0..63 are values 0..127 at full accuracy: enough for percentages
+#define SKETCH_BUCKETS_PERCENT 64
+// Eight octaves (a factor of 256) before the lowest buckets fold, for rates
+#define SKETCH_BUCKETS_WIDE 128
+
+// ══════════════════════════════════════════════════════════════════════════
+// SKETCH
+// ══════════════════════════════════════════════════════════════════════════
+
+template <uint16_t BUCKETS, typename Count = uint32_t>
+struct QuantileSketchT {
+  Count counts[BUCKETS];
+  uint16_t base;       // index of counts[0]
+  uint16_t top;        // highest index holding samples
+  uint32_t count;
+  uint32_t minValue;
+  uint32_t maxValue;
+  bool collapsed;      // low buckets were folded into counts[0]
+
+  void reset() {
+    memset(counts, 0, sizeof(counts));
+    base = 0;
+    top = 0;
+    count = 0;
+    minValue = UINT32_MAX;
+    maxValue = 0;
+    collapsed = false;
+  }
+
+  static uint16_t indexFor(uint32_t value) {
+    if (value < 2 * SKETCH_SUB_COUNT) return (uint16_t)value;
+    uint8_t msb = 31 - __builtin_clz(value);
+    uint32_t sub = (value >> (msb - SKETCH_SUB_BITS)) & (SKETCH_SUB_COUNT - 1);
+    return (uint16_t)(SKETCH_SUB_COUNT * (msb - SKETCH_SUB_BITS + 1) + sub);
+  }
+
+  // Smallest value that maps to index idx
+  static uint32_t indexLow(uint16_t idx) {
+    if (idx < 2 * SKETCH_SUB_COUNT) return idx;
+    uint8_t msb = idx / SKETCH_SUB_COUNT + SKETCH_SUB_BITS - 1;
+    uint32_t sub = idx % SKETCH_SUB_COUNT;
+    return (1UL << msb) + (sub << (msb - SKETCH_SUB_BITS));
+  }
+
+  // Bucket midpoint, clamped to what was actually seen
+  uint32_t valueAt(uint16_t idx) const {
+    uint32_t lo = indexLow(idx);
+    uint32_t hi = idx + 1 < SKETCH_INDEX_COUNT ? indexLow(idx + 1) - 1 : UINT32_MAX;
+    uint32_t mid = lo + (hi - lo) / 2;
+    if (mid < minValue) mid = minValue;
+    if (mid > maxValue) mid = maxValue;
+    return mid;
+  }
+
+  void record(uint32_t value) {
+    addIndex(indexFor(value), 1);
+    noteRange(value, value);
+  }
+
+  void noteRange(uint32_t lo, uint32_t hi) {
+    if (lo < minValue) minValue = lo;
+    if (hi > maxValue) maxValue = hi;
+  }
+
+  // n samples at index idx; counts saturate rather than wrap
+  void addIndex(uint16_t idx, uint32_t n) {
+    if (n == 0) return;
+    if (count == 0) {
+      base = idx >= BUCKETS - 1 ? idx - (BUCKETS - 1) : 0;
+      top = idx;
+    } else if (idx >= base + BUCKETS) {
+      slide(idx - (BUCKETS - 1));
+    } else if (idx < base) {
+      if (top - idx < BUCKETS) {
+        slide(top >= BUCKETS - 1 ? top - (BUCKETS - 1) : 0);
+      } else {
+        idx = base;
+        collapsed = true;
+      }
+    }
+    if (idx > top) top = idx;
+    count += saturatingAdd(counts[idx - base], n);
+  }
+
+  // Highest bucket first, so the range is settled by the first add
+  template <uint16_t B, typename C>
+  void merge(const QuantileSketchT<B, C>& other) {
+    if (other.count == 0) return;
+    for (int i = other.top - other.base; i >= 0; i--) addIndex(other.base + i, other.counts[i]);
+    noteRange(other.minValue, other.maxValue);
+    collapsed |= other.collapsed;
+  }
+
+  // Approximate quantile (q in 0..1000 permille); 0 when empty
+  uint32_t quantile(uint16_t permille) const {
+    if (count == 0) return 0;
+    uint32_t target = ((uint64_t)count * permille + 999) / 1000;
+    if (target == 0) target = 1;
+
+    uint32_t seen = 0;
+    for (uint16_t i = 0; i <= top - base; i++) {
+      seen += counts[i];
+      if (seen >= target) return valueAt(base + i);
+    }
+    return maxValue;
+  }
+
+ private:
+  static uint32_t saturatingAdd(Count& c, uint32_t n) {
+    uint32_t room = (Count)~(Count)0 - c;
+    if (n > room) n = room;
+    c += n;
+    return n;
+  }
+
+  // Moves the held range to start at newBase. Up folds whatever falls
+  // below into the new lowest bucket; down only happens with room to spare
+  void slide(uint16_t newBase) {
+    if (newBase > base) {
+      uint16_t shift = newBase - base < BUCKETS ? newBase - base : BUCKETS;
+      uint32_t folded = 0;
+      for (uint16_t i = 0; i < shift; i++) folded += counts[i];
+      memmove(counts, counts + shift, (BUCKETS - shift) * sizeof(Count));
+      memset(counts + (BUCKETS - shift), 0, shift * sizeof(Count));
+      if (folded) {
+        count -= folded - saturatingAdd(counts[0], folded);
+        collapsed = true;
+      }
+    } else {
+      uint16_t shift = base - newBase;
+      memmove(counts + shift, counts, (BUCKETS - shift) * sizeof(Count));
+      memset(counts, 0, shift * sizeof(Count));
+    }
+    base = newBase;
+    if (top < base) top = base;
+  }
+};
+
+// ══════════════════════════════════════════════════════════════════════════
+// ROLLING WINDOWS
+// ══════════════════════════════════════════════════════════════════════════
+
+enum SketchWindow : uint8_t {
+  SKETCH_1M = 0,
+  SKETCH_1H,
+  SKETCH_24H,
+  SKETCH_WINDOWS
+};
+
+// "1m", "1h", "24h"
+const char* sketchWindowName(SketchWindow w);
+bool sketchWindowParse(const char* name, SketchWindow& out);
+
+// A window is SLOTS slots of spanS seconds; the oldest is dropped as the
+// clock enters a new one, so the window covers (SLOTS - 1) full slots
+// plus the current one
+template <uint16_t BUCKETS, typename Count, uint8_t SLOTS>
+struct SketchRingT {
+  QuantileSketchT<BUCKETS, Count> slots[SLOTS];
+  uint32_t spanS;
+  uint32_t epoch;  // slot number of the current slot (time / spanS)
+
+  void begin(uint32_t span, uint32_t nowS) {
+    spanS = span;
+    epoch = nowS / span;
+    for (auto& s : slots) s.reset();
+  }
+
+  QuantileSketchT<BUCKETS, Count>& current(uint32_t nowS) {
+    uint32_t e = nowS / spanS;
+    if (e != epoch) {
+      uint32_t gap = e > epoch ? e - epoch : SLOTS;  // clock went back: start over
+      for (uint32_t i = 1; i <= gap && i <= SLOTS; i++) slots[(epoch + i) % SLOTS].reset();
+      epoch = e;
+    }
+    return slots[epoch % SLOTS];
+  }
+
+  template <uint16_t B, typename C>
+  void mergeInto(QuantileSketchT<B, C>& out, uint32_t nowS) {
+    current(nowS);
+    for (const auto& s : slots) out.merge(s);
+  }
+};
+
+// Slot counts are sized for the push rate: a 10 s slot holds 255 equal
+// samples, a 10 min or 2 h slot 65535, far above the 1 Hz the gateway sends
+template <uint16_t BUCKETS>
+class MetricWindowsT {
+ public:
+  typedef QuantileSketchT<BUCKETS> Sketch;
+
+  void begin(uint32_t nowS) {
+    minute.begin(10, nowS);
+    hour.begin(600, nowS);
+    day.begin(7200, nowS);
+  }
+
+  void record(uint32_t value, uint32_t nowS) {
+    uint16_t idx = Sketch::indexFor(value);
+    add(minute.current(nowS), idx, value);
+    add(hour.current(nowS), idx, value);
+    add(day.current(nowS), idx, value);
+  }
+
+  // Sketch of samples the hub did not see itself (e.g. from before it
+  // connected); ages out of the window with the current slot
+  template <uint16_t B, typename C>
+  void mergeRemote(SketchWindow w, const QuantileSketchT<B, C>& remote, uint32_t nowS) {
+    if (w == SKETCH_1M) minute.current(nowS).merge(remote);
+    else if (w == SKETCH_1H) hour.current(nowS).merge(remote);
+    else day.current(nowS).merge(remote);
+  }
+
+  void query(SketchWindow w, Sketch& out, uint32_t nowS) {
+    out.reset();
+    if (w == SKETCH_1M) minute.mergeInto(out, nowS);
+    else if (w == SKETCH_1H) hour.mergeInto(out, nowS);
+    else day.mergeInto(out, nowS);
+  }
+
+ private:
+  SketchRingT<BUCKETS, uint8_t, 6> minute;   // 10 s slots
+  SketchRingT<BUCKETS, uint16_t, 6> hour;    // 10 min slots
+  SketchRingT<BUCKETS, uint16_t, 12> day;    // 2 h slots
+
+  template <typename S>
+  static void add(S& slot, uint16_t idx, uint32_t value) {
+    slot.addIndex(idx, 1);
+    slot.noteRange(value, value);
+  }
+};
+
+#endif // QUANTILE_SKETCH_H
@@ -0,0 +1,733 @@
+/**
+ * ══════════════════════════════════════════════════════════════════════════
+ *                    🖤🛣️ PROJECT SEARCH INDEX 🛣️🖤
+ * ══════════════════════════════════════════════════════════════════════════
+ *
+ * Bank layout (each bank is half the storage, sector aligned):
+ *
+ *   +0                header sector (Header, magic written last)
+ *   +4K               blocks: [count] then per name
+ *                     [shared u8][suffix len u8][suffix][id varint]
+ *   end-8K-64K        directory: DirEntry per block
+ *   end-8K            delta log: [type][len][id u32 LE][name]...
+ */
+
+#include "search_index.h"
+#include <string.h>
+
+#ifdef ARDUINO
+#include <Arduino.h>
+#include <esp_partition.h>
+#include <esp_spi_flash.h>
+#else
+#include <chrono>
+#endif
+
+#define SEARCH_MAGIC  0x58535242  // "BRSX"
+#define SEARCH_FORMAT 2           // 2: partition shared with the vector index
+
+#define LOG_PUT     'P'
+#define LOG_REMOVE  'D'
+#define LOG_VERSION 'V'
+#define LOG_RECORD  6             // type, len, id
+
+#define DIR_BYTES   (SEARCH_MAX_BLOCKS * 16)
+
+static uint32_t nowUs() {
+#ifdef ARDUINO
+  return micros();
+#else
+  using namespace std::chrono;
+  return (uint32_t)duration_cast<microseconds>(steady_clock::now().time_since_epoch()).count();
+#endif
+}
+
+static inline uint8_t fold(uint8_t c) {
+  return (c >= 'A' && c <= 'Z') ? (uint8_t)(c + ('a' - 'A')) : c;
+}
+
+static int compareFolded(const char* a, uint8_t alen, const char* b, uint8_t blen) {
+  uint8_t n = alen < blen ? alen : blen;
+  for (uint8_t i = 0; i < n; i++) {
+    int d = (int)fold(a[i]) - (int)fold(b[i]);
+    if (d) return d;
+  }
+  return (int)alen - (int)blen;
+}
+
+// Character classes present in a string: a-z, 0-9 folded onto 5 bits,
+// everything else on one bit. Spaces are ignored.
+static uint32_t charMask(const char* s, uint8_t length) {
+  uint32_t mask = 0;
+  for (uint8_t i = 0; i < length; i++) {
+    uint8_t c = fold(s[i]);
+    if (c >= 'a' && c <= 'z') mask |= 1UL << (c - 'a');
+    else if (c >= '0' && c <= '9') mask |= 1UL << (26 + (c - '0') % 5);
+    else if (c != ' ') mask |= 1UL << 31;
+  }
+  return mask;
+}
+
+static void foldKey(uint8_t* key, const char* s, uint8_t length) {
+  for (uint8_t i = 0; i < SEARCH_KEY_BYTES; i++) {
+    key[i] = i < length ? fold(s[i]) : 0;
+  }
+}
+
+static uint8_t clampLength(const char* s) {
+  size_t n = strlen(s);
+  return n < SEARCH_NAME_MAX ? (uint8_t)n : SEARCH_NAME_MAX - 1;
+}
+
+static void copyName(char* dst, const char* src, uint8_t length) {
+  memcpy(dst, src, length);
+  dst[length] = '\0';
+}
+
+// ══════════════════════════════════════════════════════════════════════════
+// FLASH PARTITION
+// ══════════════════════════════════════════════════════════════════════════
+
+#ifdef ARDUINO
+bool PartitionSearchStorage::begin() {
+  const esp_partition_t* p = esp_partition_find_first(
+    ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_DATA_SPIFFS, nullptr);
+  if (!p) return false;
+
+  // The mapping stays valid across writes; IDF flushes the cache lines
+  // of any range it erases or programs.
+  const void* view = nullptr;
+  spi_flash_mmap_handle_t handle;
+  if (esp_partition_mmap(p, 0, p->size, SPI_FLASH_MMAP_DATA, &view, &handle) != ESP_OK) {
+    return false;
+  }
+
+  partition = p;
+  mapped = (const uint8_t*)view;
+  mapHandle = handle;
+  return true;
+}
+
+uint32_t PartitionSearchStorage::size() const {
+  return partition ? ((const esp_partition_t*)partition)->size : 0;
+}
+
+bool PartitionSearchStorage::erase(uint32_t offset, uint32_t length) {
+  return esp_partition_erase_range((const esp_partition_t*)partition, offset, length) == ESP_OK;
+}
+
+bool PartitionSearchStorage::write(uint32_t offset, const void* src, uint32_t length) {
+  return esp_partition_write((const esp_partition_t*)partition, offset, src, length) == ESP_OK;
+}
+#endif
+
+// ══════════════════════════════════════════════════════════════════════════
+// MOUNT
+// ══════════════════════════════════════════════════════════════════════════
+
+uint32_t SearchIndex::dirOffset(uint32_t bank) const {
+  return bankOffset(bank) + bankSize - SEARCH_LOG_BYTES - DIR_BYTES;
+}
+
+uint32_t SearchIndex::logOffset(uint32_t bank) const {
+  return bankOffset(bank) + bankSize - SEARCH_LOG_BYTES;
+}
+
+bool SearchIndex::begin(SearchStorage* storage) {
+  static_assert(sizeof(DirEntry) == 16, "directory entries are 16 bytes");
+
+  bankSize = (storage->size() / 2) & ~(uint32_t)(SEARCH_SECTOR_SIZE - 1);
+  if (!storage->data() || bankSize < 2 * SEARCH_SECTOR_SIZE + DIR_BYTES + SEARCH_LOG_BYTES) {
+    return false;
+  }
+  store = storage;
+
+  // Newest bank with a complete header wins
+  int32_t best = -1;
+  uint32_t bestGeneration = 0;
+  for (uint32_t bank = 0; bank < 2; bank++) {
+    Header h;
+    memcpy(&h, store->data() + bankOffset(bank), sizeof(h));
+    bool valid = h.magic == SEARCH_MAGIC && h.format == SEARCH_FORMAT &&
+                 h.blockEntries == SEARCH_BLOCK_ENTRIES && h.blocks <= SEARCH_MAX_BLOCKS;
+    if (valid && (best < 0 || h.generation > bestGeneration)) {
+      best = bank;
+      bestGeneration = h.generation;
+    }
+  }
+
+  if (best >= 0) return mount(best);
+
+  // Blank flash: commit an empty index so deltas have a log to go to
+  return buildBegin(0) && buildCommit();
+}
+
+bool SearchIndex::mount(uint32_t bank) {
+  memcpy(&header, store->data() + bankOffset(bank), sizeof(header));
+  activeBank = bank;
+  mounted = true;
+  directory = (const DirEntry*)(store->data() + dirOffset(bank));
+
+  sparseCount = 0;
+  for (uint32_t b = 0; b < header.blocks; b += SEARCH_SPARSE_STRIDE) {
+    memcpy(sparse[sparseCount++], directory[b].key, SEARCH_KEY_BYTES);
+  }
+
+  currentVersion = header.version;
+  clearOverlay();
+  replayLog();
+
+  // Any query in flight pointed into the other bank
+  phase = PHASE_DONE;
+  return true;
+}
+
+// ══════════════════════════════════════════════════════════════════════════
+// DELTA LOG & OVERLAY
+// ══════════════════════════════════════════════════════════════════════════
+
+void SearchIndex::replayLog() {
+  const uint8_t* data = store->data();
+  uint32_t pos = logOffset(activeBank);
+  uint32_t end = pos + SEARCH_LOG_BYTES;
+
+  while (pos + LOG_RECORD <= end && data[pos] != 0xFF) {
+    uint8_t type = data[pos];
+    uint8_t length = data[pos + 1];
+    if (pos + LOG_RECORD + length > end || length >= SEARCH_NAME_MAX) break;
+
+    uint32_t id;
+    memcpy(&id, data + pos + 2, 4);
+    char name[SEARCH_NAME_MAX];
+    copyName(name, (const char*)data + pos + LOG_RECORD, length);
+
+    if (type == LOG_PUT) applyPut(id, name);
+    else if (type == LOG_REMOVE) applyRemove(id);
+    else if (type == LOG_VERSION) currentVersion = id;
+    pos += LOG_RECORD + length;
+  }
+
+  logPos = pos;
+  checkOverlay();
+}
+
+bool SearchIndex::appendLog(uint8_t type, uint32_t id, const char* name) {
+  uint8_t length = name ? clampLength(name) : 0;
+  if (logPos + LOG_RECORD + length > logOffset(activeBank) + SEARCH_LOG_BYTES) return false;
+
+  uint8_t record[LOG_RECORD + SEARCH_NAME_MAX];
+  record[0] = type;
+  record[1] = length;
+  memcpy(record + 2, &id, 4);
+  if (length) memcpy(record + LOG_RECORD, name, length);
+
+  if (!store->write(logPos, record, LOG_RECORD + length)) return false;
+  logPos += LOG_RECORD + length;
+  return true;
+}
+
+void SearchIndex::clearOverlay() {
+  deltaCount = 0;
+  shadowCount = 0;
+}
+
+void SearchIndex::checkOverlay() {
+  bool logFull = logPos + LOG_RECORD + SEARCH_NAME_MAX > logOffset(activeBank) + SEARCH_LOG_BYTES;
+  if (deltaCount >= SEARCH_DELTA_MAX || shadowCount >= SEARCH_SHADOW_MAX || logFull) {
+    compactPending = true;
+  }
+}
+
+bool SearchIndex::isShadowed(uint32_t id) const {
+  uint16_t lo = 0, hi = shadowCount;
+  while (lo < hi) {
+    uint16_t mid = (lo + hi) / 2;
+    if (shadow[mid] < id) lo = mid + 1;
+    else hi = mid;
+  }
+  return lo < shadowCount && shadow[lo] == id;
+}
+
+bool SearchIndex::shadowId(uint32_t id) {
+  uint16_t pos = 0;
+  while (pos < shadowCount && shadow[pos] < id) pos++;
+  if (pos < shadowCount && shadow[pos] == id) return true;
+  if (shadowCount >= SEARCH_SHADOW_MAX) return false;
+
+  memmove(shadow + pos + 1, shadow + pos, (shadowCount - pos) * sizeof(shadow[0]));
+  shadow[pos] = id;
+  shadowCount++;
+  return true;
+}
+
+int16_t SearchIndex::findDelta(uint32_t id) const {
+  for (uint8_t i = 0; i < deltaCount; i++) {
+    if (deltas[i].id == id) return i;
+  }
+  return -1;
+}
+
+bool SearchIndex::applyPut(uint32_t id, const char* name) {
+  int16_t existing = findDelta(id);
+  if (existing < 0 && deltaCount >= SEARCH_DELTA_MAX) return false;
+  if (!shadowId(id)) return false;
+
+  if (existing >= 0) {
+    memmove(deltas + existing, deltas + existing + 1, (deltaCount - existing - 1) * sizeof(DeltaEntry));
+    deltaCount--;
+  }
+
+  uint8_t length = clampLength(name);
+  uint8_t pos = 0;
+  while (pos < deltaCount &&
+         compareFolded(deltas[pos].name, strlen(deltas[pos].name), name, length) <= 0) {
+    pos++;
+  }
+  memmove(deltas + pos + 1, deltas + pos, (deltaCount - pos) * sizeof(DeltaEntry));
+  deltas[pos].id = id;
+  copyName(deltas[pos].name, name, length);
+  deltaCount++;
+  return true;
+}
+
+bool SearchIndex::applyRemove(uint32_t id) {
+  if (!shadowId(id)) return false;
+
+  int16_t existing = findDelta(id);
+  if (existing >= 0) {
+    memmove(deltas + existing, deltas + existing + 1, (deltaCount - existing - 1) * sizeof(DeltaEntry));
+    deltaCount--;
+  }
+  return true;
+}
+
+bool SearchIndex::put(uint32_t id, const char* name) {
+  if (!mounted || building) return false;
+
+  uint8_t length = clampLength(name);
+  if (logPos + LOG_RECORD + length > logOffset(activeBank) + SEARCH_LOG_BYTES) return false;
+  if (!applyPut(id, name)) return false;
+
+  bool logged = appendLog(LOG_PUT, id, name);
+  checkOverlay();
+  return logged;
+}
+
+bool SearchIndex::remove(uint32_t id) {
+  if (!mounted || building) return false;
+
+  if (logPos + LOG_RECORD > logOffset(activeBank) + SEARCH_LOG_BYTES) return false;
+  if (!applyRemove(id)) return false;
+
+  bool logged = appendLog(LOG_REMOVE, id, nullptr);
+  checkOverlay();
+  return logged;
+}
+
+bool SearchIndex::setVersion(uint32_t version) {
+  if (!mounted || building) return false;
+  if (!appendLog(LOG_VERSION, version, nullptr)) return false;
+  currentVersion = version;
+  checkOverlay();
+  return true;
+}
+
+// ══════════════════════════════════════════════════════════════════════════
+// BUILDER
+// ══════════════════════════════════════════════════════════════════════════
+
+bool SearchIndex::ensureErased(uint32_t& erased, uint32_t end) {
+  while (erased < end) {
+    if (!store->erase(erased, SEARCH_SECTOR_SIZE)) return false;
+    erased += SEARCH_SECTOR_SIZE;
+  }
+  return true;
+}
+
+bool SearchIndex::buildBegin(uint32_t version) {
+  Builder& b = builder;
+  b.bank = mounted ? 1 - activeBank : 0;
+
+  // Erasing the header first invalidates the bank until commit
+  if (!store->erase(bankOffset(b.bank), SEARCH_SECTOR_SIZE)) return false;
+  if (!store->erase(logOffset(b.bank), SEARCH_LOG_BYTES)) return false;
+
+  b.blockPos = bankOffset(b.bank) + SEARCH_SECTOR_SIZE;
+  b.blockErased = b.blockPos;
+  b.dirErased = dirOffset(b.bank);
+  b.entries = 0;
+  b.blocks = 0;
+  b.rawBytes = 0;
+  b.version = version;
+  b.length = 0;
+  b.count = 0;
+  b.prevLength = 0;
+  building = true;
+  return true;
+}
+
+bool SearchIndex::buildFlush() {
+  Builder& b = builder;
+  if (b.count == 0) return true;
+  if (b.blocks >= SEARCH_MAX_BLOCKS) return false;
+
+  uint32_t end = b.blockPos + b.length;
+  if (end > dirOffset(b.bank)) return false;
+
+  b.buffer[0] = b.count;
+  if (!ensureErased(b.blockErased, end)) return false;
+  if (!store->write(b.blockPos, b.buffer, b.length)) return false;
+
+  DirEntry entry;
+  entry.offset = b.blockPos;
+  entry.mask = b.mask;
+  memcpy(entry.key, b.key, SEARCH_KEY_BYTES);
+  uint32_t at = dirOffset(b.bank) + b.blocks * sizeof(DirEntry);
+  if (!ensureErased(b.dirErased, at + sizeof(DirEntry))) return false;
+  if (!store->write(at, &entry, sizeof(entry))) return false;
+
+  b.blocks++;
+  b.blockPos = end;
+  b.count = 0;
+  b.length = 0;
+  return true;
+}
+
+bool SearchIndex::buildAdd(uint32_t id, const char* name) {
+  Builder& b = builder;
+  uint8_t length = clampLength(name);
+
+  // Lookups rely on the order; reject rather than build a broken table
+  if (b.entries > 0 && compareFolded(name, length, b.prev, b.prevLength) < 0) return false;
+
+  if (b.count == SEARCH_BLOCK_ENTRIES || b.length + 2 + length + 5 > SEARCH_BLOCK_BYTES) {
+    if (!buildFlush()) return false;
+  }
+
+  uint8_t shared = 0;
+  if (b.count == 0) {
+    b.length = 1;  // entry count, filled in on flush
+    b.mask = 0;
+    foldKey(b.key, name, length);
+  } else {
+    while (shared < length && shared < b.prevLength && name[shared] == b.prev[shared]) shared++;
+  }
+
+  uint8_t* out = b.buffer + b.length;
+  *out++ = shared;
+  *out++ = length - shared;
+  memcpy(out, name + shared, length - shared);
+  out += length - shared;
+  uint32_t v = id;
+  do {
+    uint8_t byte = v & 0x7F;
+    v >>= 7;
+    *out++ = v ? (byte | 0x80) : byte;
+  } while (v);
+  b.length = out - b.buffer;
+
+  b.mask |= charMask(name, length);
+  copyName(b.prev, name, length);
+  b.prevLength = length;
+  b.count++;
+  b.entries++;
+  b.rawBytes += length + 4;
+  return true;
+}
+
+bool SearchIndex::buildCommit() {
+  Builder& b = builder;
+  if (!buildFlush()) return false;
+
+  Header h;
+  h.magic = SEARCH_MAGIC;
+  h.format = SEARCH_FORMAT;
+  h.blockEntries = SEARCH_BLOCK_ENTRIES;
+  h.version = b.version;
+  h.generation = mounted ? header.generation + 1 : 1;
+  h.entries = b.entries;
+  h.blocks = b.blocks;
+  h.blocksEnd = b.blockPos;
+  h.rawBytes = b.rawBytes;
+
+  // Body first, magic last: a torn header is simply not a valid bank
+  uint32_t at = bankOffset(b.bank);
+  if (!store->write(at + 4, (const uint8_t*)&h + 4, sizeof(h) - 4)) return false;
+  if (!store->write(at, &h.magic, 4)) return false;
+
+  building = false;
+  return mount(b.bank);
+}
+
+// ══════════════════════════════════════════════════════════════════════════
+// SNAPSHOT & COMPACTION
+// ══════════════════════════════════════════════════════════════════════════
+
+bool SearchIndex::snapshotBegin(uint32_t version) {
+  if (!store) return false;
+  // A fresh snapshot supersedes whatever the idle bank was being used for
+  building = false;
+  compacting = false;
+  return buildBegin(version);
+}
+
+bool SearchIndex::snapshotAdd(uint32_t id, const char* name) {
+  return snapshotActive() && buildAdd(id, name);
+}
+
+bool SearchIndex::snapshotEnd() {
+  if (!snapshotActive()) return false;
+  compactPending = false;
+  return buildCommit();
+}
+
+void SearchIndex::snapshotAbort() {
+  if (!snapshotActive()) return;
+  building = false;
+  failures++;
+}
+
+bool SearchIndex::nextBase() {
+  while (cursorNext(mergeCursor)) {
+    if (!isShadowed(mergeCursor.id)) return true;
+  }
+  return false;
+}
+
+void SearchIndex::service(uint32_t budgetUs) {
+  uint32_t start = nowUs();
+
+  if (!compacting) {
+    if (!compactPending || building) return;
+    compactPending = false;
+    if (!buildBegin(currentVersion)) {
+      failures++;
+      return;
+    }
+    compacting = true;
+    cursorOpen(mergeCursor, 0);
+    mergeHasBase = nextBase();
+    mergeDelta = 0;
+  }
+
+  // Two sorted streams (base minus shadowed ids, overlay) into one table
+  while (nowUs() - start < budgetUs) {
+    bool haveDelta = mergeDelta < deltaCount;
+    if (!mergeHasBase && !haveDelta) {
+      compacting = false;
+      if (buildCommit()) {
+        compactions++;
+      } else {
+        building = false;
+        failures++;
+      }
+      return;
+    }
+
+    bool ok;
+    if (haveDelta && (!mergeHasBase ||
+        compareFolded(deltas[mergeDelta].name, strlen(deltas[mergeDelta].name),
+                      mergeCursor.name, mergeCursor.length) <= 0)) {
+      ok = buildAdd(deltas[mergeDelta].id, deltas[mergeDelta].name);
+      mergeDelta++;
+    } else {
+      ok = buildAdd(mergeCursor.id, mergeCursor.name);
+      mergeHasBase = nextBase();
+    }
+
+    if (!ok) {
+      building = false;
+      compacting = false;
+      failures++;
+      return;
+    }
+  }
+}
+
+// ══════════════════════════════════════════════════════════════════════════
+// QUERIES
+// ══════════════════════════════════════════════════════════════════════════
+
+void SearchIndex::cursorOpen(Cursor& c, uint32_t block) const {
+  c.block = block;
+  c.length = 0;
+  if (block < header.blocks) {
+    c.p = store->data() + directory[block].offset;
+    c.left = *c.p++;
+  } else {
+    c.p = nullptr;
+    c.left = 0;
+  }
+}
+
+bool SearchIndex::cursorNext(Cursor& c) const {
+  while (c.left == 0) {
+    if (c.block + 1 >= header.blocks) return false;
+    cursorOpen(c, c.block + 1);
+  }
+
+  uint8_t shared = *c.p++;
+  uint8_t suffix = *c.p++;
+  if (shared > c.length || shared + suffix >= SEARCH_NAME_MAX) {
+    c.left = 0;
+    c.block = header.blocks;  // corrupt block: stop here
+    return false;
+  }
+
+  memcpy(c.name + shared, c.p, suffix);
+  c.p += suffix;
+  c.length = shared + suffix;
+  c.name[c.length] = '\0';
+
+  uint32_t id = 0;
+  uint8_t shift = 0;
+  uint8_t byte;
+  do {
+    byte = *c.p++;
+    id |= (uint32_t)(byte & 0x7F) << shift;
+    shift += 7;
+  } while ((byte & 0x80) && shift < 35);
+  c.id = id;
+  c.left--;
+  return true;
+}
+
+// First block whose key is >= the first n bytes of `key`
+uint32_t SearchIndex::lowerBound(const uint8_t* key, uint8_t n) const {
+  uint16_t lo = 0, hi = sparseCount;
+  while (lo < hi) {
+    uint16_t mid = (lo + hi) / 2;
+    if (memcmp(sparse[mid], key, n) < 0) lo = mid + 1;
+    else hi = mid;
+  }
+
+  uint32_t first = lo == 0 ? 0 : (uint32_t)(lo - 1) * SEARCH_SPARSE_STRIDE + 1;
+  uint32_t last = lo < sparseCount ? (uint32_t)lo * SEARCH_SPARSE_STRIDE : header.blocks;
+  while (first < last) {
+    uint32_t mid = (first + last) / 2;
+    if (memcmp(directory[mid].key, key, n) < 0) first = mid + 1;
+    else last = mid;
+  }
+  return first;
+}
+
+bool SearchIndex::openScan(uint32_t block) {
+  if (queryMode == SEARCH_SUBSTRING) {
+    while (block < header.blocks && (directory[block].mask & queryMask) != queryMask) block++;
+  }
+  if (block >= header.blocks) return false;
+  cursorOpen(scan, block);
+  return true;
+}
+
+bool SearchIndex::matches(const char* name, uint8_t length) const {
+  if (queryLength > length) return false;
+  if (queryMode == SEARCH_PREFIX) {
+    return compareFolded(name, queryLength, queryText, queryLength) == 0;
+  }
+  for (uint8_t i = 0; i + queryLength <= length; i++) {
+    if (compareFolded(name + i, queryLength, queryText, queryLength) == 0) return true;
+  }
+  return false;
+}
+
+bool SearchIndex::addHit(uint32_t id, const char* name) {
+  if (hits >= SEARCH_MAX_HITS) return false;
+  results[hits].id = id;
+  copyName(results[hits].name, name, clampLength(name));
+  hits++;
+  return true;
+}
+
+void SearchIndex::query(const char* text, SearchMode mode) {
+  queryLength = clampLength(text);
+  copyName(queryText, text, queryLength);
+  queryMode = mode;
+  queryMask = charMask(queryText, queryLength);
+  hits = 0;
+  queryUs = 0;
+  phase = mounted ? PHASE_OVERLAY : PHASE_DONE;
+}
+
+bool SearchIndex::step(uint32_t budgetUs) {
+  if (phase == PHASE_DONE) return true;
+  uint32_t start = nowUs();
+
+  if (phase == PHASE_OVERLAY) {
+    // Recent changes first; the overlay is small enough to scan whole
+    for (uint8_t i = 0; i < deltaCount; i++) {
+      const DeltaEntry& d = deltas[i];
+      if (matches(d.name, strlen(d.name)) && !addHit(d.id, d.name)) break;
+    }
+
+    phase = PHASE_BASE;
+    uint32_t first = 0;
+    if (queryMode == SEARCH_PREFIX && queryLength > 0) {
+      uint8_t key[SEARCH_KEY_BYTES];
+      foldKey(key, queryText, queryLength);
+      uint8_t n = queryLength < SEARCH_KEY_BYTES ? queryLength : SEARCH_KEY_BYTES;
+      first = lowerBound(key, n);
+      if (first > 0) first--;  // matches may start inside the previous block
+    }
+    if (!openScan(first)) phase = PHASE_DONE;
+  }
+
+  while (phase == PHASE_BASE) {
+    if (hits >= SEARCH_MAX_HITS) {
+      phase = PHASE_DONE;
+      break;
+    }
+
+    if (scan.left == 0) {
+      if (!openScan(scan.block + 1)) {
+        phase = PHASE_DONE;
+        break;
+      }
+      if (nowUs() - start >= budgetUs) {
+        queryUs += nowUs() - start;
+        return false;
+      }
+    }
+
+    if (!cursorNext(scan)) {
+      phase = PHASE_DONE;
+      break;
+    }
+    if (isShadowed(scan.id)) continue;
+
+    if (queryMode == SEARCH_PREFIX) {
+      int order = compareFolded(scan.name, scan.length < queryLength ? scan.length : queryLength,
+                                queryText, queryLength);
+      if (order > 0) {
+        phase = PHASE_DONE;  // sorted: nothing further can match
+      } else if (order == 0) {
+        addHit(scan.id, scan.name);
+      }
+    } else if (matches(scan.name, scan.length)) {
+      addHit(scan.id, scan.name);
+    }
+  }
+
+  queryUs += nowUs() - start;
+  return true;
+}
+
+SearchIndexStats SearchIndex::stats() const {
+  SearchIndexStats s = {};
+  s.version = currentVersion;
+  s.generation = header.generation;
+  s.entries = header.entries;
+  s.blocks = header.blocks;
+  if (mounted) {
+    s.indexBytes = header.blocksEnd - (bankOffset(activeBank) + SEARCH_SECTOR_SIZE) +
+                   header.blocks * sizeof(DirEntry);
+    s.logBytes = logPos - logOffset(activeBank);
+  }
+  s.rawBytes = header.rawBytes;
+  s.deltas = deltaCount;
+  s.shadowed = shadowCount;
+  s.compactions = compactions;
+  s.failures = failures;
+  s.lastQueryUs = phase == PHASE_DONE ? queryUs : 0;
+  return s;
+}
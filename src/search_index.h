@@ -0,0 +1,286 @@
+/**
+ * ══════════════════════════════════════════════════════════════════════════
+ *                    🖤🛣️ PROJECT SEARCH INDEX 🛣️🖤
+ * ══════════════════════════════════════════════════════════════════════════
+ *
+ * Flash-resident index of every project name, synced from the backend so
+ * search works without a round trip.
+ *
+ * Layout: a front-coded sorted string table. Names are sorted
+ * case-insensitively and packed into blocks of 32; inside a block each
+ * name stores only the bytes that differ from its predecessor. A flash
+ * directory holds, per block, its offset, the first 8 (folded) key bytes
+ * and a character-class mask. RAM keeps only every 16th directory key, so
+ * a prefix lookup is one RAM binary search, one short flash binary search
+ * and a single block decode.
+ *
+ * Substring queries scan blocks, skipping any block whose character mask
+ * cannot contain the query. Queries are resumable: step() works for a
+ * time budget, so a keystroke shows the first screenful at once and the
+ * rest of the scan continues from loop().
+ *
+ * Storage is split into two banks. Snapshots and compactions are written
+ * to the idle bank and committed by writing its header last, so a reset
+ * mid-write keeps the old index. Incremental deltas (put/remove by id)
+ * go into a small RAM overlay backed by an append-only log in the active
+ * bank; when either fills up the overlay is merged into the other bank in
+ * the background.
+ */
+
+#ifndef SEARCH_INDEX_H
+#define SEARCH_INDEX_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define SEARCH_SECTOR_SIZE    4096
+#define SEARCH_NAME_MAX       48      // bytes incl. NUL; longer names are cut
+#define SEARCH_BLOCK_ENTRIES  32
+#define SEARCH_BLOCK_BYTES    2048
+#define SEARCH_KEY_BYTES      8
+#define SEARCH_SPARSE_STRIDE  16      // directory entries per RAM key
+#define SEARCH_MAX_BLOCKS     4096    // 131k names
+#define SEARCH_DELTA_MAX      64      // overlay entries before compaction
+#define SEARCH_SHADOW_MAX     128     // base ids hidden by deltas
+#define SEARCH_LOG_BYTES      8192
+#define SEARCH_MAX_HITS       32
+
+enum SearchMode : uint8_t {
+  SEARCH_PREFIX = 0,
+  SEARCH_SUBSTRING
+};
+
+struct SearchHit {
+  uint32_t id;
+  char name[SEARCH_NAME_MAX];
+};
+
+struct SearchIndexStats {
+  uint32_t version;
+  uint32_t generation;
+  uint32_t entries;       // names in the flash table
+  uint32_t blocks;
+  uint32_t indexBytes;    // blocks + directory
+  uint32_t rawBytes;      // names + 4-byte ids, uncompressed
+  uint16_t deltas;        // overlay entries
+  uint16_t shadowed;
+  uint32_t logBytes;
+  uint32_t compactions;
+  uint32_t failures;      // aborted snapshots/compactions
+  uint32_t lastQueryUs;   // time spent by the last finished query
+};
+
+// Byte-addressable flash with a memory-mapped read view
+class SearchStorage {
+ public:
+  virtual ~SearchStorage() {}
+  virtual uint32_t size() const = 0;
+  virtual const uint8_t* data() const = 0;
+  virtual bool erase(uint32_t offset, uint32_t length) = 0;  // sector aligned
+  virtual bool write(uint32_t offset, const void* src, uint32_t length) = 0;
+};
+
+// A sector-aligned window onto another storage, so indexes can share
+// one partition
+class StorageSlice : public SearchStorage {
+ public:
+  void begin(SearchStorage* parent, uint32_t offset, uint32_t length) {
+    base = parent;
+    start = offset;
+    bytes = parent->data() && offset + length <= parent->size() ? length : 0;
+  }
+
+  uint32_t size() const override { return bytes; }
+  const uint8_t* data() const override { return bytes ? base->data() + start : nullptr; }
+  bool erase(uint32_t offset, uint32_t length) override {
+    return offset + length <= bytes && base->erase(start + offset, length);
+  }
+  bool write(uint32_t offset, const void* src, uint32_t length) override {
+    return offset + length <= bytes && base->write(start + offset, src, length);
+  }
+
+ private:
+  SearchStorage* base = nullptr;
+  uint32_t start = 0;
+  uint32_t bytes = 0;
+};
+
+#ifdef ARDUINO
+// Raw use of the first SPIFFS-subtype data partition (not mounted as a
+// filesystem). Present in all stock ESP32 partition tables.
+class PartitionSearchStorage : public SearchStorage {
+ public:
+  bool begin();
+
+  uint32_t size() const override;
+  const uint8_t* data() const override { return mapped; }
+  bool erase(uint32_t offset, uint32_t length) override;
+  bool write(uint32_t offset, const void* src, uint32_t length) override;
+
+ private:
+  const void* partition = nullptr;  // esp_partition_t
+  const uint8_t* mapped = nullptr;
+  uint32_t mapHandle = 0;
+};
+#endif
+
+class SearchIndex {
+ public:
+  // Mounts the newest valid bank and replays its delta log
+  bool begin(SearchStorage* storage);
+  bool ready() const { return store != nullptr; }
+  uint32_t version() const { return currentVersion; }
+
+  // ── Queries ──────────────────────────────────────────────────────────
+  void query(const char* text, SearchMode mode);
+  bool step(uint32_t budgetUs);  // true once the query is finished
+  bool complete() const { return phase == PHASE_DONE; }
+  uint16_t hitCount() const { return hits; }
+  const SearchHit& hit(uint16_t i) const { return results[i]; }
+
+  // ── Full snapshot (names must arrive in folded-name order) ───────────
+  bool snapshotBegin(uint32_t version);
+  bool snapshotAdd(uint32_t id, const char* name);
+  bool snapshotEnd();
+  void snapshotAbort();
+  bool snapshotActive() const { return building && !compacting; }
+
+  // ── Incremental deltas ───────────────────────────────────────────────
+  // false when the overlay is full or busy; re-sending later is safe
+  bool put(uint32_t id, const char* name);
+  bool remove(uint32_t id);
+  bool setVersion(uint32_t version);
+
+  // Background compaction of the overlay into the idle bank
+  void compact() { compactPending = true; }
+  bool needsService() const { return compactPending || compacting; }
+  void service(uint32_t budgetUs);
+
+  SearchIndexStats stats() const;
+
+ private:
+  enum Phase : uint8_t { PHASE_OVERLAY, PHASE_BASE, PHASE_DONE };
+
+  struct Header {
+    uint32_t magic;
+    uint16_t format;
+    uint16_t blockEntries;
+    uint32_t version;
+    uint32_t generation;
+    uint32_t entries;
+    uint32_t blocks;
+    uint32_t blocksEnd;
+    uint32_t rawBytes;
+  };
+
+  struct DirEntry {
+    uint32_t offset;
+    uint32_t mask;
+    uint8_t key[SEARCH_KEY_BYTES];
+  };
+
+  // Sequential decoder over the blocks of one bank
+  struct Cursor {
+    const uint8_t* p;
+    uint32_t block;
+    uint8_t left;
+    uint8_t length;
+    uint32_t id;
+    char name[SEARCH_NAME_MAX];
+  };
+
+  struct Builder {
+    uint32_t bank;
+    uint32_t blockPos;
+    uint32_t blockErased;
+    uint32_t dirErased;
+    uint32_t entries;
+    uint32_t blocks;
+    uint32_t rawBytes;
+    uint32_t version;
+    uint16_t length;
+    uint8_t count;
+    uint32_t mask;
+    uint8_t key[SEARCH_KEY_BYTES];
+    uint8_t prevLength;
+    char prev[SEARCH_NAME_MAX];
+    uint8_t buffer[SEARCH_BLOCK_BYTES];
+  };
+
+  struct DeltaEntry {
+    uint32_t id;
+    char name[SEARCH_NAME_MAX];
+  };
+
+  SearchStorage* store = nullptr;
+  uint32_t bankSize = 0;
+  uint32_t activeBank = 0;
+  bool mounted = false;
+  Header header = {};
+  const DirEntry* directory = nullptr;
+  uint8_t sparse[SEARCH_MAX_BLOCKS / SEARCH_SPARSE_STRIDE][SEARCH_KEY_BYTES];
+  uint16_t sparseCount = 0;
+  uint32_t currentVersion = 0;
+  uint32_t logPos = 0;
+  uint32_t compactions = 0;
+  uint32_t failures = 0;
+
+  // Overlay, sorted by folded name; shadow ids sorted ascending
+  DeltaEntry deltas[SEARCH_DELTA_MAX];
+  uint8_t deltaCount = 0;
+  uint32_t shadow[SEARCH_SHADOW_MAX];
+  uint16_t shadowCount = 0;
+
+  // Build / compaction state
+  Builder builder;
+  bool building = false;
+  bool compacting = false;
+  bool compactPending = false;
+  Cursor mergeCursor;
+  uint8_t mergeDelta = 0;
+  bool mergeHasBase = false;
+
+  // Query state
+  char queryText[SEARCH_NAME_MAX];
+  uint8_t queryLength = 0;
+  SearchMode queryMode = SEARCH_PREFIX;
+  uint32_t queryMask = 0;
+  Phase phase = PHASE_DONE;
+  Cursor scan;
+  uint32_t queryUs = 0;
+  SearchHit results[SEARCH_MAX_HITS];
+  uint16_t hits = 0;
+
+  bool mount(uint32_t bank);
+  void replayLog();
+  bool appendLog(uint8_t type, uint32_t id, const char* name);
+  bool applyPut(uint32_t id, const char* name);
+  bool applyRemove(uint32_t id);
+  void checkOverlay();
+
+  uint32_t bankOffset(uint32_t bank) const { return bank * bankSize; }
+  uint32_t dirOffset(uint32_t bank) const;
+  uint32_t logOffset(uint32_t bank) const;
+
+  void cursorOpen(Cursor& c, uint32_t block) const;
+  bool cursorNext(Cursor& c) const;
+  bool openScan(uint32_t block);
+  bool nextBase();
+
+  bool buildBegin(uint32_t version);
+  bool buildAdd(uint32_t id, const char* name);
+  bool buildFlush();
+  bool buildCommit();
+  bool ensureErased(uint32_t& erased, uint32_t end);
+
+  bool isShadowed(uint32_t id) const;
+  bool shadowId(uint32_t id);
+  int16_t findDelta(uint32_t id) const;
+  void clearOverlay();
+
+  uint32_t lowerBound(const uint8_t* key, uint8_t n) const;
+  bool matches(const char* name, uint8_t length) const;
+  bool addHit(uint32_t id, const char* name);
+};
+
+#endif // SEARCH_INDEX_H
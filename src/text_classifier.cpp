@@ -0,0 +1,126 @@
+/**
+ * ══════════════════════════════════════════════════════════════════════════
+ *                    🖤🛣️ TEXT CLASSIFIER 🛣️🖤
+ * ══════════════════════════════════════════════════════════════════════════
+ */
+
+#include "text_classifier.h"
+#include <math.h>
+#include <string.h>
+
+#define FNV_OFFSET 2166136261UL
+#define FNV_PRIME  16777619UL
+
+static inline uint32_t fnv(uint32_t h, uint8_t c) {
+  return (h ^ c) * FNV_PRIME;
+}
+
+static uint32_t fnvBytes(uint32_t h, const char* s, uint8_t len) {
+  for (uint8_t i = 0; i < len; i++) h = fnv(h, (uint8_t)s[i]);
+  return h;
+}
+
+// Adds the embedding row of one hashed feature
+static inline void addRow(int32_t* sum, const int8_t* embed, uint32_t hash) {
+  const int8_t* row = embed + (hash & (CLASSIFIER_BUCKETS - 1)) * CLASSIFIER_EMBED;
+  for (uint8_t i = 0; i < CLASSIFIER_EMBED; i++) sum[i] += row[i];
+}
+
+TextVerdict classifyText(const char* text, const ClassifierModel& model) {
+  // Lowercase words, digit runs as "0"
+  char buf[CLASSIFIER_TEXT_MAX];
+  uint8_t start[CLASSIFIER_WORDS_MAX], len[CLASSIFIER_WORDS_MAX];
+  uint8_t words = 0, used = 0;
+  bool inWord = false, inDigits = false;
+  for (size_t i = 0; text[i] && i < CLASSIFIER_TEXT_MAX && used < CLASSIFIER_TEXT_MAX; i++) {
+    char c = text[i];
+    bool digit = c >= '0' && c <= '9';
+    if (c >= 'A' && c <= 'Z') c += 'a' - 'A';
+    if (!digit && !(c >= 'a' && c <= 'z')) {
+      inWord = inDigits = false;
+      continue;
+    }
+    if (digit && inDigits) continue;
+    inDigits = digit;
+    if (!inWord) {
+      if (words == CLASSIFIER_WORDS_MAX) break;
+      start[words] = used;
+      len[words++] = 0;
+      inWord = true;
+    }
+    buf[used++] = digit ? '0' : c;
+    len[words - 1]++;
+  }
+
+  TextVerdict verdict = { TEXT_INFO, 0, 0 };
+  int32_t sum[CLASSIFIER_EMBED] = {};
+  uint16_t n = 0;
+  for (uint8_t w = 0; w < words; w++) {
+    const char* word = buf + start[w];
+    addRow(sum, model.embed, fnvBytes(fnv(FNV_OFFSET, 'w'), word, len[w]));
+    n++;
+    if (w + 1 < words) {
+      uint32_t h = fnv(fnvBytes(fnv(FNV_OFFSET, 'b'), word, len[w]), ' ');
+      addRow(sum, model.embed, fnvBytes(h, buf + start[w + 1], len[w + 1]));
+      n++;
+    }
+    // Trigrams of "^word$"
+    for (uint8_t i = 0; i < len[w]; i++) {
+      uint32_t h = fnv(FNV_OFFSET, 't');
+      h = fnv(h, i == 0 ? '^' : word[i - 1]);
+      h = fnv(h, word[i]);
+      h = fnv(h, i + 1 == len[w] ? '$' : word[i + 1]);
+      addRow(sum, model.embed, h);
+      n++;
+    }
+  }
+  verdict.features = n;
+  if (n == 0) return verdict;
+
+  // Hidden layer on the summed rows; the bias is scaled up by n so the
+  // mean is a single division at requantization
+  uint8_t act[CLASSIFIER_HIDDEN];
+  for (uint8_t j = 0; j < CLASSIFIER_HIDDEN; j++) {
+    const int8_t* w = model.hiddenW + j * CLASSIFIER_EMBED;
+    int32_t acc = model.hiddenB[j] * (int32_t)n;
+    for (uint8_t i = 0; i < CLASSIFIER_EMBED; i++) acc += w[i] * sum[i];
+    if (acc <= 0) {
+      act[j] = 0;
+      continue;
+    }
+    int64_t scaled = (int64_t)acc * model.hiddenMult / n;
+    int64_t a = (scaled + (1LL << (model.hiddenShift - 1))) >> model.hiddenShift;
+    act[j] = a > 127 ? 127 : (uint8_t)a;
+  }
+
+  float logits[TEXT_CLASSES];
+  float top = -1e30f;
+  for (uint8_t k = 0; k < TEXT_CLASSES; k++) {
+    const int8_t* w = model.outW + k * CLASSIFIER_HIDDEN;
+    int32_t acc = model.outB[k];
+    for (uint8_t j = 0; j < CLASSIFIER_HIDDEN; j++) acc += w[j] * act[j];
+    logits[k] = acc * model.logitScale;
+    if (logits[k] > top) {
+      top = logits[k];
+      verdict.label = (TextClass)k;
+    }
+  }
+
+  float total = 0;
+  for (uint8_t k = 0; k < TEXT_CLASSES; k++) total += expf(logits[k] - top);
+  verdict.confidence = (uint8_t)(100.0f / total + 0.5f);
+  return verdict;
+}
+
+const char* textClassName(TextClass c) {
+  switch (c) {
+    case TEXT_INFO:     return "info";
+    case TEXT_WARN:     return "warn";
+    case TEXT_CRITICAL: return "critical";
+    default:            return "?";
+  }
+}
+
+TextClass sentimentClass(const char* label) {
+  return label && strcmp(label, "NEGATIVE") == 0 ? TEXT_WARN : TEXT_INFO;
+}
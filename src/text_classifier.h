@@ -0,0 +1,74 @@
+/**
+ * ══════════════════════════════════════════════════════════════════════════
+ *                    🖤🛣️ TEXT CLASSIFIER 🛣️🖤
+ * ══════════════════════════════════════════════════════════════════════════
+ *
+ * Triage of event text on the hub: is "billing charged customers twice"
+ * info, a warning or critical? A distilled int8 model in flash answers
+ * in well under a millisecond, so the Hugging Face sentiment endpoint is
+ * only asked when the model is unsure.
+ *
+ * Text is lowercased, digit runs become "0" and everything else splits
+ * words. Features are the words, adjacent word pairs and the character
+ * trigrams of each word (with ^ and $ at its ends), each hashed (FNV-1a)
+ * into CLASSIFIER_BUCKETS rows of an int8 embedding table. The rows are
+ * summed and averaged, then go through one int8 ReLU layer and an int8
+ * output layer. Accumulation is int32 and the hidden layer is
+ * requantized with a fixed-point multiplier, so the only float math is
+ * the three-way softmax that turns logits into a confidence.
+ *
+ * The model (src/classifier_model.cpp) is generated by
+ * tools/train_classifier.py from assets/classifier/events.tsv. The
+ * trainer mirrors this kernel bit for bit to report quantized accuracy.
+ */
+
+#ifndef TEXT_CLASSIFIER_H
+#define TEXT_CLASSIFIER_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Shape of the model; the trainer checks these (tools/train_classifier.py)
+#define CLASSIFIER_BUCKETS 1024
+#define CLASSIFIER_EMBED   16
+#define CLASSIFIER_HIDDEN  16
+#define CLASSIFIER_TEXT_MAX 128   // longer text is judged on its start
+#define CLASSIFIER_WORDS_MAX 24
+
+// Same order and values as NotifyPriority
+enum TextClass : uint8_t {
+  TEXT_INFO = 0,
+  TEXT_WARN,
+  TEXT_CRITICAL,
+  TEXT_CLASSES
+};
+
+struct ClassifierModel {
+  const int8_t* embed;     // [CLASSIFIER_BUCKETS][CLASSIFIER_EMBED]
+  const int8_t* hiddenW;   // [CLASSIFIER_HIDDEN][CLASSIFIER_EMBED]
+  const int32_t* hiddenB;  // in embed scale × hiddenW scale
+  const int8_t* outW;      // [TEXT_CLASSES][CLASSIFIER_HIDDEN]
+  const int32_t* outB;     // in activation scale × outW scale
+  int32_t hiddenMult;      // requantizes the hidden layer: × mult >> shift
+  uint8_t hiddenShift;
+  float logitScale;        // output accumulator to logits
+};
+
+extern const ClassifierModel CLASSIFIER_MODEL;
+
+struct TextVerdict {
+  TextClass label;
+  uint8_t confidence;   // softmax of the winner, percent
+  uint16_t features;    // 0: nothing to go on, label is TEXT_INFO
+};
+
+TextVerdict classifyText(const char* text, const ClassifierModel& model = CLASSIFIER_MODEL);
+
+// "info", "warn", "critical"
+const char* textClassName(TextClass c);
+
+// SST-2 sentiment knows good and bad, not urgent: a NEGATIVE label from
+// the Hugging Face fallback is a warning and anything else info
+TextClass sentimentClass(const char* label);
+
+#endif // TEXT_CLASSIFIER_H
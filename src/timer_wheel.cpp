@@ -0,0 +1,199 @@
+/**
+ * ══════════════════════════════════════════════════════════════════════════
+ *                    🖤🛣️ TIMER WHEEL 🛣️🖤
+ * ══════════════════════════════════════════════════════════════════════════
+ */
+
+#include "timer_wheel.h"
+
+#define LEVEL_SHIFT(l) ((l) * TIMER_SLOT_BITS)
+#define WHEEL_SPAN     (1u << LEVEL_SHIFT(TIMER_LEVELS))  // 2^24 ms
+
+// Distance (1..64) from slot `from` to the next occupied slot after it
+static inline uint32_t nextOccupied(uint64_t mask, uint32_t from) {
+  uint32_t start = (from + 1) & (TIMER_SLOTS - 1);
+  uint64_t rotated = start ? (mask >> start) | (mask << (TIMER_SLOTS - start)) : mask;
+  return __builtin_ctzll(rotated) + 1;
+}
+
+void TimerWheel::begin(uint32_t now) {
+  count = 0;
+  for (uint16_t i = 0; i <= FIRING; i++) heads[i] = TIMER_NONE;
+  for (uint8_t l = 0; l < TIMER_LEVELS; l++) occupied[l] = 0;
+  wheelNow = now;
+}
+
+TimerId TimerWheel::add(const char* name, TimerCallback callback, uint32_t period) {
+  if (count >= TIMER_MAX) return TIMER_NONE;
+  Timer& t = timers[count];
+  t = {};
+  t.name = name;
+  t.callback = callback;
+  t.period = period;
+  t.list = NOT_LINKED;
+  return count++;
+}
+
+void TimerWheel::start(TimerId id, uint32_t delay, uint32_t now) {
+  if (id >= count) return;
+  if (armed(id)) unlink(id);
+  timers[id].expires = now + delay;
+  place(id);
+}
+
+void TimerWheel::stop(TimerId id) {
+  if (armed(id)) unlink(id);
+}
+
+// ══════════════════════════════════════════════════════════════════════════
+// SLOT LISTS
+// ══════════════════════════════════════════════════════════════════════════
+
+void TimerWheel::link(TimerId id, uint16_t list) {
+  Timer& t = timers[id];
+  t.list = list;
+  t.prev = TIMER_NONE;
+  t.next = heads[list];
+  if (t.next != TIMER_NONE) timers[t.next].prev = id;
+  heads[list] = id;
+  if (list < FIRING) occupied[list >> TIMER_SLOT_BITS] |= 1ull << (list & (TIMER_SLOTS - 1));
+}
+
+void TimerWheel::unlink(TimerId id) {
+  Timer& t = timers[id];
+  if (t.prev != TIMER_NONE) timers[t.prev].next = t.next;
+  else heads[t.list] = t.next;
+  if (t.next != TIMER_NONE) timers[t.next].prev = t.prev;
+
+  if (t.list < FIRING && heads[t.list] == TIMER_NONE) {
+    occupied[t.list >> TIMER_SLOT_BITS] &= ~(1ull << (t.list & (TIMER_SLOTS - 1)));
+  }
+  t.list = NOT_LINKED;
+}
+
+void TimerWheel::place(TimerId id) {
+  // Overdue timers go in the next slot; too-distant ones park at the top
+  // level and are placed again when it cascades
+  uint32_t at = timers[id].expires;
+  int32_t delta = (int32_t)(at - wheelNow);
+  if (delta <= 0) at = wheelNow + 1;
+  else if ((uint32_t)delta >= WHEEL_SPAN) at = wheelNow + WHEEL_SPAN - 1;
+
+  uint32_t distance = at - wheelNow;
+  uint8_t level = 0;
+  while (level < TIMER_LEVELS - 1 && distance >= (1u << LEVEL_SHIFT(level + 1))) level++;
+
+  uint32_t slot = (at >> LEVEL_SHIFT(level)) & (TIMER_SLOTS - 1);
+  link(id, level * TIMER_SLOTS + slot);
+}
+
+void TimerWheel::cascade(uint8_t level) {
+  uint16_t list = level * TIMER_SLOTS + ((wheelNow >> LEVEL_SHIFT(level)) & (TIMER_SLOTS - 1));
+  while (heads[list] != TIMER_NONE) {
+    TimerId id = heads[list];
+    unlink(id);
+    // Due exactly on this boundary: straight into the slot about to fire
+    if (timers[id].expires == wheelNow) link(id, wheelNow & (TIMER_SLOTS - 1));
+    else place(id);
+  }
+}
+
+// Ticks from wheelNow to the next expiry or cascade, TIMER_NEVER if empty
+uint32_t TimerWheel::nextEvent() const {
+  uint32_t best = TIMER_NEVER;
+  if (occupied[0]) {
+    best = nextOccupied(occupied[0], wheelNow & (TIMER_SLOTS - 1));
+  }
+  for (uint8_t l = 1; l < TIMER_LEVELS; l++) {
+    if (!occupied[l]) continue;
+    uint32_t block = wheelNow >> LEVEL_SHIFT(l);
+    uint32_t k = nextOccupied(occupied[l], block & (TIMER_SLOTS - 1));
+    uint32_t distance = ((block + k) << LEVEL_SHIFT(l)) - wheelNow;
+    if (distance < best) best = distance;
+  }
+  return best;
+}
+
+// ══════════════════════════════════════════════════════════════════════════
+// ADVANCING
+// ══════════════════════════════════════════════════════════════════════════
+
+uint8_t TimerWheel::fire(uint16_t list, uint32_t now) {
+  // Move the slot aside first: callbacks may start or stop any timer
+  while (heads[list] != TIMER_NONE) {
+    TimerId id = heads[list];
+    unlink(id);
+    link(id, FIRING);
+  }
+
+  uint8_t ran = 0;
+  while (heads[FIRING] != TIMER_NONE) {
+    TimerId id = heads[FIRING];
+    Timer& t = timers[id];
+    unlink(id);
+
+    uint32_t late = now - t.expires;
+    if ((int32_t)late > 0 && late > t.maxLate) t.maxLate = late;
+    t.fired++;
+
+    if (t.period) {
+      // Re-arm on the original grid; skip runs the loop was too late for
+      uint32_t next = t.expires + t.period;
+      if ((int32_t)(next - now) <= 0) {
+        uint32_t missed = (now - next) / t.period + 1;
+        t.skipped += missed;
+        next += missed * t.period;
+      }
+      t.expires = next;
+      place(id);
+    }
+
+    t.callback();
+    ran++;
+  }
+  return ran;
+}
+
+uint8_t TimerWheel::advance(uint32_t now) {
+  uint8_t ran = 0;
+
+  while ((int32_t)(now - wheelNow) > 0) {
+    // Jump straight to the next tick with work: an occupied level-0 slot
+    // or the start of an occupied higher-level slot
+    uint32_t step = nextEvent();
+    if (step == TIMER_NEVER || (int32_t)(now - (wheelNow + step)) < 0) {
+      wheelNow = now;
+      break;
+    }
+    wheelNow += step;
+
+    for (uint8_t l = TIMER_LEVELS - 1; l > 0; l--) {
+      if ((wheelNow & ((1u << LEVEL_SHIFT(l)) - 1)) == 0) cascade(l);
+    }
+    ran += fire(wheelNow & (TIMER_SLOTS - 1), now);
+  }
+  return ran;
+}
+
+uint32_t TimerWheel::nextDeadline(uint32_t now) const {
+  uint32_t best = nextEvent();
+  if (best == TIMER_NEVER) return TIMER_NEVER;
+
+  int32_t due = (int32_t)(wheelNow + best - now);
+  return due > 0 ? (uint32_t)due : 0;
+}
+
+TimerStats TimerWheel::stats(TimerId id) const {
+  TimerStats s = {};
+  if (id >= count) return s;
+  const Timer& t = timers[id];
+  s.name = t.name;
+  s.period = t.period;
+  s.armed = armed(id);
+  int32_t due = (int32_t)(t.expires - wheelNow);
+  s.dueIn = s.armed && due > 0 ? (uint32_t)due : 0;
+  s.fired = t.fired;
+  s.skipped = t.skipped;
+  s.maxLate = t.maxLate;
+  return s;
+}
@@ -0,0 +1,99 @@
+/**
+ * ══════════════════════════════════════════════════════════════════════════
+ *                    🖤🛣️ TIMER WHEEL 🛣️🖤
+ * ══════════════════════════════════════════════════════════════════════════
+ *
+ * Hierarchical timer wheel that owns every periodic and one-shot task, so
+ * loop() no longer polls millis() deltas and can sleep until the next
+ * deadline.
+ *
+ * Four levels of 64 slots at 1 ms resolution cover ~4.6 hours; anything
+ * further out parks in the top level and cascades again. Level 0 slots
+ * hold exact expiries, higher levels are moved down when the wheel
+ * reaches them. A 64-bit occupancy mask per level lets advance() jump
+ * over empty stretches and nextDeadline() find the next wake-up with a
+ * couple of bit scans.
+ *
+ * Timers come from a fixed pool and are created stopped; the caller keeps
+ * the TimerId. Periodic timers re-arm from their scheduled expiry, not
+ * from when they ran, so they do not drift; when the loop falls more than
+ * a period behind the missed runs are skipped (and counted) rather than
+ * fired back to back.
+ */
+
+#ifndef TIMER_WHEEL_H
+#define TIMER_WHEEL_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define TIMER_MAX        16
+#define TIMER_LEVELS     4
+#define TIMER_SLOT_BITS  6
+#define TIMER_SLOTS      (1 << TIMER_SLOT_BITS)
+#define TIMER_NONE       0xFF
+#define TIMER_NEVER      UINT32_MAX
+
+typedef uint8_t TimerId;
+typedef void (*TimerCallback)();
+
+struct TimerStats {
+  const char* name;
+  uint32_t period;    // 0 = one-shot
+  bool armed;
+  uint32_t dueIn;     // ms from the last advance(), when armed
+  uint32_t fired;
+  uint32_t skipped;   // periodic runs dropped because the loop was late
+  uint32_t maxLate;   // ms between expiry and the advance() that fired it
+};
+
+class TimerWheel {
+ public:
+  void begin(uint32_t now);
+
+  // Stopped until start(); period 0 makes a one-shot
+  TimerId add(const char* name, TimerCallback callback, uint32_t period);
+  void start(TimerId id, uint32_t delay, uint32_t now);
+  void stop(TimerId id);
+  bool armed(TimerId id) const { return id < count && timers[id].list != NOT_LINKED; }
+
+  // Fires everything due by `now`; returns how many callbacks ran
+  uint8_t advance(uint32_t now);
+  // ms from `now` until the next expiry (or cascade), TIMER_NEVER if idle
+  uint32_t nextDeadline(uint32_t now) const;
+
+  uint8_t size() const { return count; }
+  TimerStats stats(TimerId id) const;
+
+ private:
+  static const uint16_t NOT_LINKED = 0xFFFF;
+  static const uint16_t FIRING = TIMER_LEVELS * TIMER_SLOTS;
+
+  struct Timer {
+    const char* name;
+    TimerCallback callback;
+    uint32_t period;
+    uint32_t expires;
+    uint16_t list;
+    TimerId prev;
+    TimerId next;
+    uint32_t fired;
+    uint32_t skipped;
+    uint32_t maxLate;
+  };
+
+  Timer timers[TIMER_MAX];
+  uint8_t count = 0;
+  TimerId heads[TIMER_LEVELS * TIMER_SLOTS + 1];  // + the firing list
+  uint64_t occupied[TIMER_LEVELS] = {};
+  uint32_t wheelNow = 0;  // every expiry <= wheelNow has fired
+
+  void link(TimerId id, uint16_t list);
+  void unlink(TimerId id);
+  void place(TimerId id);
+  void cascade(uint8_t level);
+  uint32_t nextEvent() const;
+  uint8_t fire(uint16_t list, uint32_t now);
+};
+
+#endif // TIMER_WHEEL_H
@@ -0,0 +1,631 @@
+/**
+ * ══════════════════════════════════════════════════════════════════════════
+ *                    🖤🛣️ PROJECT VECTOR INDEX 🛣️🖤
+ * ══════════════════════════════════════════════════════════════════════════
+ *
+ * Storage layout (VECTOR_STORAGE_BYTES):
+ *
+ *   +0                header sector: Header, then from +64 the version
+ *                     log (u32 per delta, 0xFFFFFFFF = unused)
+ *   +4K × (1 + s)     sector s: VECTOR_PER_SECTOR Records of 184 bytes,
+ *                     Trailer in the last 8 bytes
+ */
+
+#include "vector_index.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef ARDUINO
+#include <Arduino.h>
+#else
+#include <chrono>
+#endif
+
+#define VECTOR_MAGIC   0x56535242  // "BRSV"
+#define VECTOR_FORMAT  1
+#define TRAILER_MAGIC  0x54535242  // "BRST"
+
+#define LOG_START      64
+#define TRAILER_OFFSET (VECTOR_SECTOR_SIZE - 8)
+
+#define SLOT_FREE      0xFF   // erased, writable
+#define SLOT_DEAD      0xFE   // id zeroed, needs a sector rewrite
+#define CLUSTER_ROUNDS 6
+#define CLUSTER_MIN    (VECTOR_LISTS * 4)  // fewer records: one list
+
+static uint32_t nowUs() {
+#ifdef ARDUINO
+  return micros();
+#else
+  using namespace std::chrono;
+  return (uint32_t)duration_cast<microseconds>(steady_clock::now().time_since_epoch()).count();
+#endif
+}
+
+static uint32_t sectorOffset(uint16_t sector) {
+  return (uint32_t)(sector + 1) * VECTOR_SECTOR_SIZE;
+}
+
+// ══════════════════════════════════════════════════════════════════════════
+// KERNELS
+// ══════════════════════════════════════════════════════════════════════════
+
+static inline uint16_t hamming(const uint32_t* a, const uint32_t* b) {
+  uint16_t d = 0;
+  for (uint8_t w = 0; w < VECTOR_CODE_WORDS; w++) d += __builtin_popcount(a[w] ^ b[w]);
+  return d;
+}
+
+// Four independent accumulators, so the multiplies pipeline
+static int32_t dot(const int8_t* a, const int8_t* b) {
+  int32_t s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+  for (uint16_t i = 0; i < VECTOR_DIM; i += 4) {
+    s0 += a[i] * b[i];
+    s1 += a[i + 1] * b[i + 1];
+    s2 += a[i + 2] * b[i + 2];
+    s3 += a[i + 3] * b[i + 3];
+  }
+  return s0 + s1 + s2 + s3;
+}
+
+static uint16_t norm(const int8_t* v) {
+  return (uint16_t)(sqrtf((float)dot(v, v)) + 0.5f);
+}
+
+// Bit i set when component i is positive
+static void signCode(const int8_t* v, uint32_t* code) {
+  for (uint8_t w = 0; w < VECTOR_CODE_WORDS; w++) {
+    uint32_t bits = 0;
+    for (uint8_t b = 0; b < 32; b++) bits |= (uint32_t)(v[w * 32 + b] > 0) << b;
+    code[w] = bits;
+  }
+}
+
+static int16_t cosine(int32_t d, uint16_t na, uint16_t nb) {
+  if (!na || !nb) return 0;
+  return (int16_t)((int64_t)d * 1000 / ((int32_t)na * nb));
+}
+
+// Keeps out[0..count) best first; the name is only copied for a hit
+// that makes the cut
+static void offerHit(VectorHit* out, uint8_t& count, uint8_t max, uint32_t id, const char* name, int16_t score) {
+  if (count == max && score <= out[max - 1].score) return;
+  uint8_t i = count < max ? count++ : max - 1;
+  while (i > 0 && out[i - 1].score < score) {
+    out[i] = out[i - 1];
+    i--;
+  }
+  out[i].id = id;
+  out[i].score = score;
+  memcpy(out[i].name, name, VECTOR_NAME_MAX);
+  out[i].name[VECTOR_NAME_MAX - 1] = '\0';
+}
+
+// ══════════════════════════════════════════════════════════════════════════
+// MOUNT
+// ══════════════════════════════════════════════════════════════════════════
+
+const VectorIndex::Record* VectorIndex::record(uint16_t slot) const {
+  uint16_t sector = slot / VECTOR_PER_SECTOR;
+  return (const Record*)(store->data() + sectorOffset(sector) + (slot % VECTOR_PER_SECTOR) * sizeof(Record));
+}
+
+bool VectorIndex::sectorValid(uint16_t sector) const {
+  Trailer t;
+  memcpy(&t, store->data() + sectorOffset(sector) + TRAILER_OFFSET, sizeof(t));
+  return t.magic == TRAILER_MAGIC && t.generation == header.generation;
+}
+
+bool VectorIndex::begin(SearchStorage* storage) {
+  static_assert(sizeof(Record) == 184, "records are 184 bytes");
+  static_assert(VECTOR_PER_SECTOR * sizeof(Record) <= TRAILER_OFFSET, "records and trailer fit a sector");
+
+  if (!storage->data() || storage->size() < VECTOR_STORAGE_BYTES) return false;
+  store = storage;
+
+  memcpy(&header, store->data(), sizeof(header));
+  bool valid = header.magic == VECTOR_MAGIC && header.format == VECTOR_FORMAT && header.dim == VECTOR_DIM &&
+               header.perSector == VECTOR_PER_SECTOR && header.sectors == VECTOR_SECTORS;
+  if (!valid) {
+    // Above any generation a stale sector may still carry
+    uint32_t newest = 0;
+    for (uint16_t s = 0; s < VECTOR_SECTORS; s++) {
+      Trailer t;
+      memcpy(&t, store->data() + sectorOffset(s) + TRAILER_OFFSET, sizeof(t));
+      if (t.magic == TRAILER_MAGIC && t.generation > newest) newest = t.generation;
+    }
+    return commitEmpty(newest + 1);
+  }
+
+  // The last logged version wins
+  currentVersion = header.version;
+  for (logPos = LOG_START; logPos + 4 <= VECTOR_SECTOR_SIZE; logPos += 4) {
+    uint32_t v;
+    memcpy(&v, store->data() + logPos, 4);
+    if (v == 0xFFFFFFFF) break;
+    currentVersion = v;
+  }
+
+  liveCount = deadCount = 0;
+  for (uint16_t s = 0; s < VECTOR_SECTORS; s++) {
+    sectorLive[s] = sectorValid(s);
+    for (uint16_t i = 0; i < VECTOR_PER_SECTOR; i++) {
+      uint16_t slot = s * VECTOR_PER_SECTOR + i;
+      uint32_t id = sectorLive[s] ? record(slot)->id : 0xFFFFFFFF;
+      if (id == 0xFFFFFFFF) {
+        slotList[slot] = SLOT_FREE;
+      } else if (id == 0) {
+        slotList[slot] = SLOT_DEAD;
+        deadCount++;
+      } else {
+        slotList[slot] = 0;
+        liveCount++;
+      }
+    }
+  }
+  cluster();
+  return true;
+}
+
+// Header of an index with nothing in it; every sector is stale
+bool VectorIndex::commitEmpty(uint32_t generation) {
+  building = false;
+  header = { VECTOR_MAGIC, VECTOR_FORMAT, VECTOR_DIM, generation, 0, VECTOR_PER_SECTOR, VECTOR_SECTORS };
+  currentVersion = 0;
+  logPos = LOG_START;
+  memset(slotList, SLOT_FREE, sizeof(slotList));
+  memset(sectorLive, 0, sizeof(sectorLive));
+  liveCount = deadCount = changed = 0;
+  listCount = 1;
+  return store->erase(0, VECTOR_SECTOR_SIZE) && store->write(0, &header, sizeof(header));
+}
+
+// ══════════════════════════════════════════════════════════════════════════
+// CLUSTERING
+// ══════════════════════════════════════════════════════════════════════════
+
+uint8_t VectorIndex::nearestList(const uint32_t* code) const {
+  uint8_t best = 0;
+  uint16_t bestDistance = 0xFFFF;
+  for (uint8_t c = 0; c < listCount; c++) {
+    uint16_t d = hamming(code, centroids[c]);
+    if (d < bestDistance) {
+      bestDistance = d;
+      best = c;
+    }
+  }
+  return best;
+}
+
+// k-modes: assign each code to the nearest centroid, then set every
+// centroid bit to the majority of its members. Seeds are spread over
+// the slots, so the result depends only on the contents
+void VectorIndex::cluster() {
+  uint32_t start = nowUs();
+  changed = 0;
+  listCount = 1;
+  for (uint16_t s = 0; s < VECTOR_CAPACITY; s++) {
+    if (slotList[s] < VECTOR_LISTS) slotList[s] = 0;
+  }
+
+  // Too few to split, or no room for the votes: one list, every query
+  // exhaustive but right
+  uint16_t* votes = liveCount < CLUSTER_MIN ? nullptr : (uint16_t*)calloc(VECTOR_LISTS * VECTOR_DIM, sizeof(uint16_t));
+  if (!votes) {
+    clusterUs = nowUs() - start;
+    return;
+  }
+
+  uint16_t seen = 0, seeded = 0;
+  for (uint16_t s = 0; s < VECTOR_CAPACITY && seeded < VECTOR_LISTS; s++) {
+    if (slotList[s] >= VECTOR_LISTS) continue;
+    if ((uint32_t)seen++ * VECTOR_LISTS >= (uint32_t)seeded * liveCount) {
+      memcpy(centroids[seeded++], record(s)->code, sizeof(centroids[0]));
+    }
+  }
+  listCount = seeded;
+
+  uint16_t members[VECTOR_LISTS];
+  for (uint8_t round = 0; round < CLUSTER_ROUNDS; round++) {
+    memset(votes, 0, VECTOR_LISTS * VECTOR_DIM * sizeof(uint16_t));
+    memset(members, 0, sizeof(members));
+    uint16_t moved = 0;
+    for (uint16_t s = 0; s < VECTOR_CAPACITY; s++) {
+      if (slotList[s] >= VECTOR_LISTS) continue;
+      const uint32_t* code = record(s)->code;
+      uint8_t c = nearestList(code);
+      moved += c != slotList[s];
+      slotList[s] = c;
+      members[c]++;
+      uint16_t* v = votes + c * VECTOR_DIM;
+      for (uint16_t b = 0; b < VECTOR_DIM; b++) v[b] += (code[b / 32] >> (b % 32)) & 1;
+    }
+    if (round > 0 && moved == 0) break;
+
+    // An empty list keeps its centroid
+    for (uint8_t c = 0; c < listCount; c++) {
+      if (!members[c]) continue;
+      const uint16_t* v = votes + c * VECTOR_DIM;
+      for (uint8_t w = 0; w < VECTOR_CODE_WORDS; w++) {
+        uint32_t bits = 0;
+        for (uint8_t b = 0; b < 32; b++) bits |= (uint32_t)(2 * v[w * 32 + b] > members[c]) << b;
+        centroids[c][w] = bits;
+      }
+    }
+  }
+  free(votes);
+
+  // Final assignment against the final centroids
+  for (uint16_t s = 0; s < VECTOR_CAPACITY; s++) {
+    if (slotList[s] < VECTOR_LISTS) slotList[s] = nearestList(record(s)->code);
+  }
+  clusterUs = nowUs() - start;
+}
+
+void VectorIndex::service() {
+  if (needsService()) cluster();
+}
+
+// ══════════════════════════════════════════════════════════════════════════
+// QUERIES
+// ══════════════════════════════════════════════════════════════════════════
+
+int32_t VectorIndex::find(uint32_t id) const {
+  if (!store || id == 0 || id == 0xFFFFFFFF) return -1;
+  for (uint16_t s = 0; s < VECTOR_CAPACITY; s++) {
+    if (slotList[s] < VECTOR_LISTS && record(s)->id == id) return s;
+  }
+  return -1;
+}
+
+const int8_t* VectorIndex::vector(uint32_t id) const {
+  int32_t slot = find(id);
+  return slot < 0 ? nullptr : record(slot)->v;
+}
+
+uint8_t VectorIndex::rerank(const int8_t* vector, uint16_t n, const uint16_t* slots, uint16_t count,
+                            uint32_t exclude, VectorHit* out, uint8_t max) const {
+  uint8_t hits = 0;
+  for (uint16_t i = 0; i < count; i++) {
+    const Record* r = record(slots[i]);
+    if (r->id == exclude) continue;
+    offerHit(out, hits, max, r->id, r->name, cosine(dot(vector, r->v), n, r->norm));
+  }
+  return hits;
+}
+
+uint8_t VectorIndex::query(const int8_t* vector, uint32_t exclude, VectorHit* out, uint8_t max) {
+  if (!store || building || max == 0) return 0;
+  uint32_t start = nowUs();
+  if (max > VECTOR_MAX_RESULTS) max = VECTOR_MAX_RESULTS;
+
+  uint32_t code[VECTOR_CODE_WORDS];
+  signCode(vector, code);
+
+  // Coarse: the nearest lists by centroid distance
+  bool probe[VECTOR_LISTS] = {};
+  if (listCount <= VECTOR_PROBES) {
+    for (uint8_t c = 0; c < listCount; c++) probe[c] = true;
+  } else {
+    uint16_t distance[VECTOR_LISTS];
+    for (uint8_t c = 0; c < listCount; c++) distance[c] = hamming(code, centroids[c]);
+    for (uint8_t p = 0; p < VECTOR_PROBES; p++) {
+      uint8_t best = 0xFF;
+      for (uint8_t c = 0; c < listCount; c++) {
+        if (!probe[c] && (best == 0xFF || distance[c] < distance[best])) best = c;
+      }
+      probe[best] = true;
+    }
+  }
+
+  // Hamming: keep the VECTOR_SHORTLIST nearest codes, worst at the end
+  uint16_t shortSlots[VECTOR_SHORTLIST], shortDistance[VECTOR_SHORTLIST];
+  uint16_t shortCount = 0;
+  lastScanned = 0;
+  for (uint16_t s = 0; s < VECTOR_CAPACITY; s++) {
+    uint8_t list = slotList[s];
+    if (list >= VECTOR_LISTS || !probe[list]) continue;
+    uint16_t d = hamming(code, record(s)->code);
+    lastScanned++;
+    if (shortCount == VECTOR_SHORTLIST && d >= shortDistance[VECTOR_SHORTLIST - 1]) continue;
+    uint16_t i = shortCount < VECTOR_SHORTLIST ? shortCount++ : VECTOR_SHORTLIST - 1;
+    while (i > 0 && shortDistance[i - 1] > d) {
+      shortSlots[i] = shortSlots[i - 1];
+      shortDistance[i] = shortDistance[i - 1];
+      i--;
+    }
+    shortSlots[i] = (uint16_t)s;
+    shortDistance[i] = d;
+  }
+
+  uint8_t hits = rerank(vector, norm(vector), shortSlots, shortCount, exclude, out, max);
+  lastQueryUs = nowUs() - start;
+  return hits;
+}
+
+uint8_t VectorIndex::related(uint32_t id, VectorHit* out, uint8_t max) {
+  int32_t slot = find(id);
+  if (slot < 0) return 0;
+  int8_t v[VECTOR_DIM];
+  memcpy(v, record(slot)->v, VECTOR_DIM);
+  return query(v, id, out, max);
+}
+
+uint8_t VectorIndex::queryExact(const int8_t* vector, uint32_t exclude, VectorHit* out, uint8_t max) const {
+  if (!store || building || max == 0) return 0;
+  if (max > VECTOR_MAX_RESULTS) max = VECTOR_MAX_RESULTS;
+  uint16_t n = norm(vector);
+  uint8_t hits = 0;
+  for (uint16_t s = 0; s < VECTOR_CAPACITY; s++) {
+    if (slotList[s] >= VECTOR_LISTS) continue;
+    const Record* r = record(s);
+    if (r->id != exclude) offerHit(out, hits, max, r->id, r->name, cosine(dot(vector, r->v), n, r->norm));
+  }
+  return hits;
+}
+
+// ══════════════════════════════════════════════════════════════════════════
+// WRITES
+// ══════════════════════════════════════════════════════════════════════════
+
+void VectorIndex::fill(Record& r, uint32_t id, const char* name, const int8_t* vector) const {
+  memset(&r, 0, sizeof(r));
+  r.id = id;
+  r.norm = norm(vector);
+  signCode(vector, r.code);
+  memcpy(r.v, vector, VECTOR_DIM);
+  strncpy(r.name, name, VECTOR_NAME_MAX - 1);
+}
+
+bool VectorIndex::writeTrailer(uint16_t sector) {
+  Trailer t = { TRAILER_MAGIC, header.generation };
+  if (!store->write(sectorOffset(sector) + TRAILER_OFFSET, &t, sizeof(t))) return false;
+  sectorLive[sector] = true;
+  return true;
+}
+
+// Drops the deleted records of one sector by erasing and writing it back
+bool VectorIndex::rewriteSector(uint16_t sector) {
+  uint32_t offset = sectorOffset(sector);
+  memcpy(buffer, store->data() + offset, VECTOR_PER_SECTOR * sizeof(Record));
+  for (uint16_t i = 0; i < VECTOR_PER_SECTOR; i++) {
+    uint16_t slot = sector * VECTOR_PER_SECTOR + i;
+    if (slotList[slot] != SLOT_DEAD) continue;
+    memset(buffer + i * sizeof(Record), 0xFF, sizeof(Record));
+    slotList[slot] = SLOT_FREE;
+    deadCount--;
+  }
+  rewrites++;
+  sectorLive[sector] = false;
+  return store->erase(offset, VECTOR_SECTOR_SIZE) &&
+         store->write(offset, buffer, VECTOR_PER_SECTOR * sizeof(Record)) &&
+         writeTrailer(sector);
+}
+
+// An erased slot in a live sector, else a stale sector made live, else
+// the sector with the most deleted records rewritten; -1 when full
+int32_t VectorIndex::freeSlot() {
+  int32_t stale = -1, dirtiest = -1;
+  uint8_t mostDead = 0;
+  for (uint16_t s = 0; s < VECTOR_SECTORS; s++) {
+    if (!sectorLive[s]) {
+      if (stale < 0) stale = s;
+      continue;
+    }
+    uint8_t dead = 0;
+    for (uint16_t i = 0; i < VECTOR_PER_SECTOR; i++) {
+      uint8_t state = slotList[s * VECTOR_PER_SECTOR + i];
+      if (state == SLOT_FREE) return s * VECTOR_PER_SECTOR + i;
+      dead += state == SLOT_DEAD;
+    }
+    if (dead > mostDead) {
+      mostDead = dead;
+      dirtiest = s;
+    }
+  }
+
+  if (stale >= 0) {
+    rewrites++;
+    if (!store->erase(sectorOffset(stale), VECTOR_SECTOR_SIZE) || !writeTrailer(stale)) return -1;
+    return stale * VECTOR_PER_SECTOR;
+  }
+  if (dirtiest >= 0 && rewriteSector(dirtiest)) {
+    for (uint16_t i = 0; i < VECTOR_PER_SECTOR; i++) {
+      if (slotList[dirtiest * VECTOR_PER_SECTOR + i] == SLOT_FREE) return dirtiest * VECTOR_PER_SECTOR + i;
+    }
+  }
+  return -1;
+}
+
+bool VectorIndex::writeRecord(uint16_t slot, const Record& r) {
+  uint32_t offset = sectorOffset(slot / VECTOR_PER_SECTOR) + (slot % VECTOR_PER_SECTOR) * sizeof(Record);
+  if (!store->write(offset, &r, sizeof(r))) return false;
+  slotList[slot] = listCount > 1 ? nearestList(r.code) : 0;
+  liveCount++;
+  return true;
+}
+
+// ══════════════════════════════════════════════════════════════════════════
+// SNAPSHOT
+// ══════════════════════════════════════════════════════════════════════════
+
+bool VectorIndex::snapshotBegin(uint32_t version) {
+  if (!store) return false;
+  uint32_t generation = header.generation + 1;
+
+  // Header gone first: from here a reset leaves an empty index
+  if (!store->erase(0, VECTOR_SECTOR_SIZE)) return false;
+  header.generation = generation;
+  header.version = version;
+  currentVersion = 0;
+  memset(slotList, SLOT_FREE, sizeof(slotList));
+  memset(sectorLive, 0, sizeof(sectorLive));
+  liveCount = deadCount = 0;
+  listCount = 1;
+  building = true;
+  buildSector = 0;
+  buildCount = 0;
+  memset(buffer, 0xFF, sizeof(buffer));
+  return true;
+}
+
+bool VectorIndex::flushBuild() {
+  uint32_t offset = sectorOffset(buildSector);
+  bool ok = store->erase(offset, VECTOR_SECTOR_SIZE) &&
+            store->write(offset, buffer, VECTOR_PER_SECTOR * sizeof(Record)) &&
+            writeTrailer(buildSector);
+  buildSector++;
+  buildCount = 0;
+  memset(buffer, 0xFF, sizeof(buffer));
+  return ok;
+}
+
+// Entries past VECTOR_CAPACITY are refused; the rest stays usable
+bool VectorIndex::snapshotAdd(uint32_t id, const char* name, const int8_t* vector) {
+  if (!building || buildSector == VECTOR_SECTORS || id == 0 || id == 0xFFFFFFFF) return false;
+  Record r;
+  fill(r, id, name, vector);
+  memcpy(buffer + buildCount * sizeof(Record), &r, sizeof(r));
+  slotList[buildSector * VECTOR_PER_SECTOR + buildCount] = 0;
+  liveCount++;
+  if (++buildCount == VECTOR_PER_SECTOR) {
+    if (!flushBuild()) {
+      snapshotAbort();
+      return false;
+    }
+  }
+  return true;
+}
+
+bool VectorIndex::snapshotEnd() {
+  if (!building) return false;
+  if (buildCount && !flushBuild()) {
+    snapshotAbort();
+    return false;
+  }
+  building = false;
+  // Committed by the header
+  if (!store->write(0, &header, sizeof(header))) {
+    commitEmpty(header.generation + 1);
+    return false;
+  }
+  logPos = LOG_START;
+  currentVersion = header.version;
+  cluster();
+  return true;
+}
+
+// Sectors already written carry the new generation; one more makes
+// them stale
+void VectorIndex::snapshotAbort() {
+  if (!building) return;
+  commitEmpty(header.generation + 1);
+}
+
+// ══════════════════════════════════════════════════════════════════════════
+// DELTAS
+// ══════════════════════════════════════════════════════════════════════════
+
+// Old record out first: a reset in between loses the project until the
+// delta is replayed, which it is, since its version is logged last
+bool VectorIndex::put(uint32_t id, const char* name, const int8_t* vector) {
+  if (!store || building || id == 0 || id == 0xFFFFFFFF) return false;
+  Record r;
+  fill(r, id, name, vector);
+
+  int32_t existing = find(id);
+  if (existing >= 0) {
+    const Record* old = record(existing);
+    if (memcmp(old->v, r.v, VECTOR_DIM) == 0 && strncmp(old->name, r.name, VECTOR_NAME_MAX) == 0) return true;
+    if (!remove(id)) return false;
+  }
+
+  int32_t slot = freeSlot();
+  if (slot < 0 || !writeRecord(slot, r)) return false;
+  changed++;
+  return true;
+}
+
+bool VectorIndex::remove(uint32_t id) {
+  if (!store || building) return false;
+  int32_t slot = find(id);
+  if (slot < 0) return true;
+
+  // Programming only clears bits, so the id can be zeroed without an erase
+  uint32_t zero = 0;
+  uint32_t offset = sectorOffset(slot / VECTOR_PER_SECTOR) + (slot % VECTOR_PER_SECTOR) * sizeof(Record);
+  if (!store->write(offset, &zero, sizeof(zero))) return false;
+  slotList[slot] = SLOT_DEAD;
+  liveCount--;
+  deadCount++;
+  changed++;
+  return true;
+}
+
+bool VectorIndex::logVersion(uint32_t version) {
+  if (logPos + 4 > VECTOR_SECTOR_SIZE) {
+    // Log full: fold it into the header
+    header.version = version;
+    if (!store->erase(0, VECTOR_SECTOR_SIZE) || !store->write(0, &header, sizeof(header))) return false;
+    logPos = LOG_START;
+    return true;
+  }
+  if (!store->write(logPos, &version, sizeof(version))) return false;
+  logPos += 4;
+  return true;
+}
+
+bool VectorIndex::setVersion(uint32_t version) {
+  if (!store || building) return false;
+  if (version == currentVersion) return true;
+  if (!logVersion(version)) return false;
+  currentVersion = version;
+  return true;
+}
+
+VectorIndexStats VectorIndex::stats() const {
+  VectorIndexStats s;
+  s.version = currentVersion;
+  s.generation = header.generation;
+  s.entries = liveCount;
+  s.deleted = deadCount;
+  s.lists = listCount;
+  s.changed = changed;
+  s.rewrites = rewrites;
+  s.clusterUs = clusterUs;
+  s.lastQueryUs = lastQueryUs;
+  s.lastScanned = lastScanned;
+  return s;
+}
+
+// ══════════════════════════════════════════════════════════════════════════
+// BASE64
+// ══════════════════════════════════════════════════════════════════════════
+
+static int8_t base64Value(char c) {
+  if (c >= 'A' && c <= 'Z') return c - 'A';
+  if (c >= 'a' && c <= 'z') return c - 'a' + 26;
+  if (c >= '0' && c <= '9') return c - '0' + 52;
+  if (c == '+') return 62;
+  if (c == '/') return 63;
+  return -1;
+}
+
+bool vectorDecode(const char* base64, int8_t* out) {
+  uint16_t n = 0;
+  uint32_t bits = 0;
+  uint8_t have = 0;
+  for (const char* p = base64; *p && *p != '='; p++) {
+    int8_t v = base64Value(*p);
+    if (v < 0) return false;
+    bits = (bits << 6) | v;
+    have += 6;
+    if (have >= 8) {
+      have -= 8;
+      if (n == VECTOR_DIM) return false;
+      out[n++] = (int8_t)(uint8_t)(bits >> have);
+    }
+  }
+  return n == VECTOR_DIM;
+}
@@ -0,0 +1,186 @@
+/**
+ * ══════════════════════════════════════════════════════════════════════════
+ *                    🖤🛣️ PROJECT VECTOR INDEX 🛣️🖤
+ * ══════════════════════════════════════════════════════════════════════════
+ *
+ * Flash-resident cache of project embeddings, so "related projects" is
+ * answered on the hub. The backend embeds each project through
+ * ENCLAVE_EMBEDDINGS_URL, reduces it to VECTOR_DIM dimensions, scales
+ * it to int8 and syncs it here by snapshot and delta, like the search
+ * index. The hub caches up to VECTOR_CAPACITY projects (the backend
+ * picks which).
+ *
+ * Each record holds the int8 vector, its sign bits as a packed binary
+ * code, its norm and a short name. A query runs in three steps:
+ *
+ *   1. Coarse: the query code is compared with VECTOR_LISTS centroid
+ *      codes, and only the VECTOR_PROBES nearest lists are searched.
+ *   2. Hamming: the codes of those lists' records are compared 32 bits
+ *      at a time (XOR + popcount), and the nearest VECTOR_SHORTLIST kept.
+ *   3. Rerank: the shortlist is scored by the exact int8 cosine.
+ *
+ * The lists come from k-modes over the binary codes: at mount, after a
+ * snapshot, and again once a quarter of the cache has changed. Only the
+ * list number of each slot and the centroids live in RAM.
+ *
+ * Layout: sector 0 holds the header and an append-only log of delta
+ * versions. Every other sector holds VECTOR_PER_SECTOR records and a
+ * trailer carrying the snapshot generation, written last; a sector
+ * whose trailer is missing or from an older snapshot is empty. New
+ * records go into erased slots with no erase. A removal zeroes the id
+ * in place. Only reusing deleted slots rewrites a sector. A snapshot
+ * erases the header first, so a reset mid-snapshot leaves an empty
+ * cache at version 0 and the next sync starts over. A reset during a
+ * sector rewrite loses that sector's records until the next snapshot:
+ * it is a cache.
+ */
+
+#ifndef VECTOR_INDEX_H
+#define VECTOR_INDEX_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "search_index.h"
+
+#define VECTOR_DIM          128
+#define VECTOR_CODE_WORDS   (VECTOR_DIM / 32)
+#define VECTOR_NAME_MAX     32      // bytes incl. NUL; longer names are cut
+#define VECTOR_SECTOR_SIZE  4096
+#define VECTOR_PER_SECTOR   22
+#define VECTOR_SECTORS      94
+#define VECTOR_CAPACITY     (VECTOR_SECTORS * VECTOR_PER_SECTOR)  // 2068
+#define VECTOR_STORAGE_BYTES ((VECTOR_SECTORS + 1) * VECTOR_SECTOR_SIZE)
+#define VECTOR_LISTS        32
+#define VECTOR_PROBES       6
+#define VECTOR_SHORTLIST    48
+#define VECTOR_MAX_RESULTS  8
+#define VECTOR_B64_LEN      ((VECTOR_DIM + 2) / 3 * 4)  // base64 of one vector
+
+struct VectorHit {
+  uint32_t id;
+  int16_t score;   // cosine, permille
+  char name[VECTOR_NAME_MAX];
+};
+
+struct VectorIndexStats {
+  uint32_t version;
+  uint32_t generation;
+  uint16_t entries;
+  uint16_t deleted;       // slots waiting for a sector rewrite
+  uint16_t lists;         // 1 until clustered
+  uint16_t changed;       // puts and removes since the last clustering
+  uint32_t rewrites;      // sector erases outside snapshots
+  uint32_t clusterUs;     // last clustering
+  uint32_t lastQueryUs;
+  uint16_t lastScanned;   // records whose code the last query compared
+};
+
+class VectorIndex {
+ public:
+  // Mounts the committed snapshot, replays the version log, clusters
+  bool begin(SearchStorage* storage);
+  bool ready() const { return store != nullptr; }
+  uint32_t version() const { return currentVersion; }
+
+  // ── Queries ──────────────────────────────────────────────────────────
+  // Nearest neighbours of `vector` by cosine, best first; `exclude` is
+  // left out (the project asking). Returns the number of hits
+  uint8_t query(const int8_t* vector, uint32_t exclude, VectorHit* out, uint8_t max);
+  // Projects nearest to project `id`; 0 hits when it is not cached
+  uint8_t related(uint32_t id, VectorHit* out, uint8_t max);
+  bool contains(uint32_t id) const { return find(id) >= 0; }
+  const int8_t* vector(uint32_t id) const;
+
+  // Every live record, exact cosine: the reference the coarse search is
+  // measured against
+  uint8_t queryExact(const int8_t* vector, uint32_t exclude, VectorHit* out, uint8_t max) const;
+
+  // ── Full snapshot ────────────────────────────────────────────────────
+  bool snapshotBegin(uint32_t version);
+  bool snapshotAdd(uint32_t id, const char* name, const int8_t* vector);
+  bool snapshotEnd();
+  void snapshotAbort();
+  bool snapshotActive() const { return building; }
+
+  // ── Incremental deltas ───────────────────────────────────────────────
+  // false when the cache is full or flash failed
+  bool put(uint32_t id, const char* name, const int8_t* vector);
+  bool remove(uint32_t id);
+  bool setVersion(uint32_t version);
+
+  // Reclusters once enough has changed; cheap to call every loop
+  bool needsService() const { return changed >= VECTOR_CAPACITY / 4 && !building; }
+  void service();
+
+  VectorIndexStats stats() const;
+
+ private:
+  struct Header {
+    uint32_t magic;
+    uint16_t format;
+    uint16_t dim;
+    uint32_t generation;
+    uint32_t version;       // of the snapshot; deltas are in the log
+    uint16_t perSector;
+    uint16_t sectors;
+  };
+
+  struct Record {
+    uint32_t id;            // erased 0xFFFFFFFF: free; 0: deleted
+    uint16_t norm;
+    uint16_t reserved;
+    uint32_t code[VECTOR_CODE_WORDS];
+    int8_t v[VECTOR_DIM];
+    char name[VECTOR_NAME_MAX];
+  };
+
+  struct Trailer {
+    uint32_t magic;
+    uint32_t generation;
+  };
+
+  SearchStorage* store = nullptr;
+  Header header = {};
+  uint32_t currentVersion = 0;
+  uint32_t logPos = 0;
+  bool building = false;
+  uint16_t buildSector = 0;
+  uint8_t buildCount = 0;
+
+  // Per slot: its list, or SLOT_FREE / SLOT_DEAD. A sector is usable
+  // once it carries this generation's trailer; until then it is stale
+  uint8_t slotList[VECTOR_CAPACITY];
+  bool sectorLive[VECTOR_SECTORS];
+  uint32_t centroids[VECTOR_LISTS][VECTOR_CODE_WORDS];
+  uint16_t listCount = 1;
+  uint16_t liveCount = 0;
+  uint16_t deadCount = 0;
+  uint16_t changed = 0;
+  uint32_t rewrites = 0;
+  uint32_t clusterUs = 0;
+  uint32_t lastQueryUs = 0;
+  uint16_t lastScanned = 0;
+
+  uint8_t buffer[VECTOR_SECTOR_SIZE];
+
+  const Record* record(uint16_t slot) const;
+  bool sectorValid(uint16_t sector) const;
+  int32_t find(uint32_t id) const;
+  int32_t freeSlot();
+  bool writeRecord(uint16_t slot, const Record& r);
+  bool rewriteSector(uint16_t sector);
+  bool writeTrailer(uint16_t sector);
+  bool flushBuild();
+  bool commitEmpty(uint32_t generation);
+  bool logVersion(uint32_t version);
+  void fill(Record& r, uint32_t id, const char* name, const int8_t* vector) const;
+  uint8_t nearestList(const uint32_t* code) const;
+  void cluster();
+  uint8_t rerank(const int8_t* vector, uint16_t norm, const uint16_t* slots, uint16_t count,
+                 uint32_t exclude, VectorHit* out, uint8_t max) const;
+};
+
+// Decodes VECTOR_DIM int8 values from base64; false on bad input
+bool vectorDecode(const char* base64, int8_t* out);
+
+#endif // VECTOR_INDEX_H
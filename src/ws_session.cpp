@@ -0,0 +1,331 @@
+/**
+ * ══════════════════════════════════════════════════════════════════════════
+ *                    🖤🛣️ WEBSOCKET SESSION & FAILOVER 🛣️🖤
+ * ══════════════════════════════════════════════════════════════════════════
+ */
+
+#include "ws_session.h"
+#include "logger.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MS_TO_US(ms) ((uint32_t)(ms) * 1000u)
+
+static inline bool reached(uint32_t now, uint32_t at) {
+  return (int32_t)(now - at) >= 0;
+}
+
+bool wsParseUrl(const char* url, WsEndpoint& out) {
+  memset(&out, 0, sizeof(out));
+  out.url = url;
+
+  const char* p;
+  if (strncmp(url, "wss://", 6) == 0) {
+    out.secure = true;
+    out.port = 443;
+    p = url + 6;
+  } else if (strncmp(url, "ws://", 5) == 0) {
+    out.port = 80;
+    p = url + 5;
+  } else {
+    return false;
+  }
+
+  size_t hostLen = strcspn(p, ":/");
+  if (hostLen == 0 || hostLen >= WS_HOST_LEN) return false;
+  memcpy(out.host, p, hostLen);
+  p += hostLen;
+
+  if (*p == ':') {
+    char* end;
+    long port = strtol(p + 1, &end, 10);
+    if (end == p + 1 || port <= 0 || port > 65535) return false;
+    out.port = (uint16_t)port;
+    p = end;
+  }
+
+  const char* path = *p ? p : "/";
+  if (*path != '/' || strlen(path) >= WS_PATH_LEN) return false;
+  strcpy(out.path, path);
+  return true;
+}
+
+const char* wsSwitchReasonName(WsSwitchReason reason) {
+  static const char* const names[] = { "-", "connect failed", "heartbeat lost", "closed", "better endpoint" };
+  return reason <= WS_SWITCH_BETTER ? names[reason] : "?";
+}
+
+uint8_t WsSession::begin(WsTransport* transport, const char* const* urls, uint8_t urlCount) {
+  link = transport;
+  count = 0;
+  for (uint8_t i = 0; i < urlCount && count < WS_MAX_ENDPOINTS; i++) {
+    if (!urls[i] || !wsParseUrl(urls[i], endpoints[count])) continue;
+    WsEndpointStats& h = health[count];
+    memset(&h, 0, sizeof(h));
+    h.srttUs = h.minRttUs = h.probeUs = WS_RTT_UNKNOWN;
+    count++;
+  }
+  current = WS_OFFLINE;
+  activeIndex = -1;
+  return count;
+}
+
+// ══════════════════════════════════════════════════════════════════════════
+// SELECTION
+// ══════════════════════════════════════════════════════════════════════════
+
+bool WsSession::fasterByMargin(uint8_t a, uint8_t b) const {
+  uint32_t pa = health[a].probeUs;
+  uint32_t pb = health[b].probeUs;
+  if (pa == WS_RTT_UNKNOWN || pb == WS_RTT_UNKNOWN || pa >= pb) return false;
+  return pb - pa >= WS_SWITCH_MIN_GAIN_US &&
+         (uint64_t)pa * 100 < (uint64_t)pb * (100 - WS_SWITCH_MARGIN_PCT);
+}
+
+// Preference order, unless a later endpoint is clearly faster
+int8_t WsSession::pick(uint32_t nowUs, int8_t exclude) const {
+  int8_t best = -1;
+  for (uint8_t i = 0; i < count; i++) {
+    if ((int8_t)i == exclude) continue;
+    if (health[i].backoffMs && !reached(nowUs, health[i].retryAt)) continue;
+    if (best < 0 || fasterByMargin(i, best)) best = i;
+  }
+  return best;
+}
+
+void WsSession::connect(int8_t index, uint32_t nowUs) {
+  if (current == WS_CONNECTING || current == WS_CONNECTED) {
+    closing = true;  // our own close must not read as a failure
+    link->close();
+    closing = false;
+  }
+  activeIndex = index;
+  current = WS_CONNECTING;
+  stateSince = nowUs;
+  link->open(endpoints[index]);
+}
+
+void WsSession::fail(uint32_t nowUs, WsSwitchReason reason) {
+  WsEndpointStats& h = health[activeIndex];
+  h.failures++;
+  h.backoffMs = h.backoffMs ? h.backoffMs * 2 : WS_RETRY_MIN_MS;
+  if (h.backoffMs > WS_RETRY_MAX_MS) h.backoffMs = WS_RETRY_MAX_MS;
+  h.retryAt = nowUs + MS_TO_US(h.backoffMs);
+
+  lastReason = reason;
+  if (!down) {
+    down = true;
+    downSinceUs = nowUs;
+  }
+
+  int8_t next = pick(nowUs, activeIndex);
+  if (next >= 0) {
+    switchCount++;
+    LOG(WS_SWITCH, endpoints[next].url, wsSwitchReasonName(reason));
+    connect(next, nowUs);
+    return;
+  }
+
+  LOG(WS_ALL_BACKING_OFF);
+  closing = true;
+  link->close();
+  closing = false;
+  current = WS_WAITING;
+}
+
+// ══════════════════════════════════════════════════════════════════════════
+// SERVICE
+// ══════════════════════════════════════════════════════════════════════════
+
+void WsSession::service(bool networkUp, uint32_t nowUs) {
+  if (!link || count == 0) return;
+
+  if (!networkUp) {
+    // Not the backend's fault: no backoff, no outage accounting
+    if (current == WS_CONNECTING || current == WS_CONNECTED) {
+      closing = true;
+      link->close();
+      closing = false;
+    }
+    current = WS_OFFLINE;
+    down = false;
+    return;
+  }
+
+  switch (current) {
+    case WS_OFFLINE:
+    case WS_WAITING: {
+      int8_t next = pick(nowUs, -1);
+      if (next >= 0) connect(next, nowUs);
+      else current = WS_WAITING;
+      break;
+    }
+
+    case WS_CONNECTING:
+      if (reached(nowUs, stateSince + MS_TO_US(WS_CONNECT_TIMEOUT_MS))) fail(nowUs, WS_SWITCH_CONNECT_FAILED);
+      break;
+
+    case WS_CONNECTED: {
+      expirePings(nowUs);
+      if (reached(nowUs, lastPongUs + MS_TO_US(WS_PING_MS * WS_MISSED_PINGS))) {
+        fail(nowUs, WS_SWITCH_HEARTBEAT);
+        break;
+      }
+      if (reached(nowUs, lastPingUs + MS_TO_US(WS_PING_MS))) sendPing(nowUs);
+
+      if (!reached(nowUs, stateSince + MS_TO_US(WS_SWITCH_DWELL_MS))) break;
+      // Stable long enough: forget past failures, consider a planned move
+      health[activeIndex].backoffMs = 0;
+      int8_t want = pick(nowUs, -1);
+      if (want >= 0 && want != activeIndex && health[want].probeUs != WS_RTT_UNKNOWN) {
+        lastReason = WS_SWITCH_BETTER;
+        switchCount++;
+        LOG(WS_SWITCH, endpoints[want].url, wsSwitchReasonName(WS_SWITCH_BETTER));
+        connect(want, nowUs);
+      }
+      break;
+    }
+  }
+}
+
+void WsSession::onConnected(uint32_t nowUs) {
+  if (activeIndex < 0 || current == WS_OFFLINE) return;
+  current = WS_CONNECTED;
+  stateSince = nowUs;
+  lastPongUs = nowUs;                       // grace period for the first pong
+  lastPingUs = nowUs - MS_TO_US(WS_PING_MS);  // first ping on the next tick
+  memset(inflight, 0, sizeof(inflight));
+  health[activeIndex].connects++;
+
+  if (down) {
+    outageUs = nowUs - downSinceUs;
+    down = false;
+    LOG(WS_RECOVERED, (unsigned long)(outageUs / 1000));
+  }
+}
+
+void WsSession::onDisconnected(uint32_t nowUs) {
+  if (closing) return;
+  if (current == WS_CONNECTING) fail(nowUs, WS_SWITCH_CONNECT_FAILED);
+  else if (current == WS_CONNECTED) fail(nowUs, WS_SWITCH_CLOSED);
+}
+
+// ══════════════════════════════════════════════════════════════════════════
+// PING / PONG
+// ══════════════════════════════════════════════════════════════════════════
+
+void WsSession::recordLoss(uint8_t index, bool lost) {
+  WsEndpointStats& h = health[index];
+  h.lossWindow = (h.lossWindow << 1) | (lost ? 1 : 0);
+  if (h.lossSamples < WS_LOSS_WINDOW) h.lossSamples++;
+  if (lost) h.lost++;
+}
+
+uint8_t WsSession::lossPercent(uint8_t i) const {
+  const WsEndpointStats& h = health[i];
+  if (!h.lossSamples) return 0;
+  uint32_t mask = h.lossSamples >= 32 ? 0xFFFFFFFFu : (1u << h.lossSamples) - 1;
+  return (uint8_t)(__builtin_popcount(h.lossWindow & mask) * 100 / h.lossSamples);
+}
+
+void WsSession::expirePings(uint32_t nowUs) {
+  for (Ping& p : inflight) {
+    if (p.pending && reached(nowUs, p.sentUs + MS_TO_US(WS_PONG_TIMEOUT_MS))) {
+      p.pending = false;
+      recordLoss(activeIndex, true);
+    }
+  }
+}
+
+void WsSession::sendPing(uint32_t nowUs) {
+  WsEndpointStats& h = health[activeIndex];
+  uint32_t seq = nextSeq++;
+  Ping& slot = inflight[seq % WS_INFLIGHT];
+  if (slot.pending) recordLoss(activeIndex, true);
+  slot = { seq, nowUs, true };
+
+  char msg[96];
+  if (h.srttUs == WS_RTT_UNKNOWN) {
+    snprintf(msg, sizeof(msg), "{\"type\":\"ping\",\"seq\":%lu}", (unsigned long)seq);
+  } else {
+    snprintf(msg, sizeof(msg), "{\"type\":\"ping\",\"seq\":%lu,\"rtt\":%lu.%lu,\"loss\":%u}",
+      (unsigned long)seq, (unsigned long)(h.srttUs / 1000), (unsigned long)(h.srttUs / 100 % 10),
+      lossPercent(activeIndex));
+  }
+  link->send(msg);
+  h.pingsSent++;
+  lastPingUs = nowUs;
+}
+
+void WsSession::onPong(uint32_t seq, uint32_t nowUs) {
+  if (current != WS_CONNECTED) return;
+  lastPongUs = nowUs;  // any pong, even a late one, proves the link is alive
+
+  Ping& slot = inflight[seq % WS_INFLIGHT];
+  if (!slot.pending || slot.seq != seq) return;
+  slot.pending = false;
+  recordLoss(activeIndex, false);
+
+  WsEndpointStats& h = health[activeIndex];
+  uint32_t rtt = nowUs - slot.sentUs;
+  h.pongs++;
+  h.lastRttUs = rtt;
+  if (rtt < h.minRttUs) h.minRttUs = rtt;
+  if (h.srttUs == WS_RTT_UNKNOWN) {
+    h.srttUs = rtt;
+    h.rttVarUs = rtt / 2;
+  } else {
+    uint32_t err = rtt > h.srttUs ? rtt - h.srttUs : h.srttUs - rtt;
+    h.rttVarUs = (3 * h.rttVarUs + err) / 4;
+    h.srttUs = (7 * (uint64_t)h.srttUs + rtt) / 8;
+  }
+}
+
+// ══════════════════════════════════════════════════════════════════════════
+// TCP PROBES
+// ══════════════════════════════════════════════════════════════════════════
+
+#ifdef ARDUINO
+#include <Arduino.h>
+#include <WiFi.h>
+
+#define PROBE_TASK_STACK    4096
+#define PROBE_TASK_PRIORITY 1
+#define PROBE_TASK_CORE     0
+
+// Connect time only: the name is resolved first and not counted
+static uint32_t probeOnce(const WsEndpoint& e) {
+  IPAddress ip;
+  if (!WiFi.hostByName(e.host, ip)) return WS_RTT_UNKNOWN;
+
+  WiFiClient client;
+  uint32_t start = micros();
+  bool ok = client.connect(ip, e.port, WS_PROBE_TIMEOUT_MS);
+  uint32_t elapsed = micros() - start;
+  client.stop();
+  return ok ? elapsed : WS_RTT_UNKNOWN;
+}
+
+void WsSession::startProbing() {
+  xTaskCreatePinnedToCore([](void* arg) {
+    WsSession* session = (WsSession*)arg;
+    for (;;) {
+      for (uint8_t i = 0; i < session->count && WiFi.status() == WL_CONNECTED; i++) {
+        WsEndpointStats& h = session->health[i];
+        uint32_t us = probeOnce(session->endpoints[i]);
+        h.probes++;
+        if (us == WS_RTT_UNKNOWN) {
+          h.probeFailures++;
+          h.probeUs = WS_RTT_UNKNOWN;  // unreachable: never a switch target
+        } else {
+          h.probeUs = h.probeUs == WS_RTT_UNKNOWN ? us : (3 * h.probeUs + us) / 4;
+        }
+      }
+      vTaskDelay(pdMS_TO_TICKS(WS_PROBE_MS));
+    }
+  }, "wsProbe", PROBE_TASK_STACK, this, PROBE_TASK_PRIORITY, nullptr, PROBE_TASK_CORE);
+}
+
+#endif
@@ -0,0 +1,185 @@
+/**
+ * ══════════════════════════════════════════════════════════════════════════
+ *                    🖤🛣️ WEBSOCKET SESSION & FAILOVER 🛣️🖤
+ * ══════════════════════════════════════════════════════════════════════════
+ *
+ * Keeps one WebSocket open to the best of an ordered list of backend
+ * endpoints (ws:// or wss://).
+ *
+ * Liveness: every WS_PING_MS the session sends an application ping
+ *   → {"type":"ping","seq":12,"rtt":23.4,"loss":0}
+ *   ← {"type":"pong","seq":12}
+ * and keeps a smoothed RTT (RFC 6298 style srtt/rttvar) plus packet
+ * loss over the last WS_LOSS_WINDOW pings. The ping carries the client's
+ * current view, so the backend sees it too. A ping unanswered after
+ * WS_PONG_TIMEOUT_MS counts as lost. WS_MISSED_PINGS in a row without any
+ * pong means the heartbeat stopped: the endpoint is backed off and the
+ * next one is tried. Outage before failover starts is bounded by
+ * WS_PING_MS * WS_MISSED_PINGS + WS_TICK_MS; each further endpoint tried
+ * adds at most WS_CONNECT_TIMEOUT_MS.
+ *
+ * Selection: list order is the preference. A background task measures
+ * TCP connect time to every endpoint (WS_PROBE_MS), the active one
+ * included, so all are compared on the same footing. An endpoint only
+ * beats an earlier one in the list when it is clearly faster
+ * (WS_SWITCH_MARGIN_PCT and WS_SWITCH_MIN_GAIN_US). After a minimum dwell
+ * the session makes a planned move to the endpoint that ranks best. That
+ * can be a faster one, or a preferred one back from a failure.
+ *
+ * The policy is pure (times passed in, transport behind an interface);
+ * only the probe task is ESP32-specific.
+ */
+
+#ifndef WS_SESSION_H
+#define WS_SESSION_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define WS_MAX_ENDPOINTS      4
+#define WS_HOST_LEN           48
+#define WS_PATH_LEN           32
+
+#define WS_TICK_MS            250     // service() period
+#define WS_PING_MS            2000
+#define WS_PONG_TIMEOUT_MS    2000    // unanswered this long = lost
+#define WS_MISSED_PINGS       3       // heartbeat considered stopped
+#define WS_CONNECT_TIMEOUT_MS 5000    // handshake, TLS included
+#define WS_RETRY_MIN_MS       5000    // backoff after a failure, doubling
+#define WS_RETRY_MAX_MS       60000
+#define WS_LOSS_WINDOW        32      // pings
+#define WS_INFLIGHT           4       // outstanding pings tracked
+
+#define WS_PROBE_MS           30000
+#define WS_PROBE_TIMEOUT_MS   1000
+#define WS_SWITCH_DWELL_MS    60000   // minimum time on an endpoint before a planned switch
+#define WS_SWITCH_MARGIN_PCT  30
+#define WS_SWITCH_MIN_GAIN_US 15000
+#define WS_RTT_UNKNOWN        UINT32_MAX
+
+struct WsEndpoint {
+  const char* url;
+  char host[WS_HOST_LEN];
+  char path[WS_PATH_LEN];
+  uint16_t port;
+  bool secure;
+};
+
+// "ws://host[:port][/path]" or "wss://…"; default ports 80 / 443
+bool wsParseUrl(const char* url, WsEndpoint& out);
+
+enum WsState : uint8_t {
+  WS_OFFLINE = 0,   // no network, nothing to do
+  WS_CONNECTING,
+  WS_CONNECTED,
+  WS_WAITING        // every endpoint is backing off
+};
+
+enum WsSwitchReason : uint8_t {
+  WS_SWITCH_NONE = 0,
+  WS_SWITCH_CONNECT_FAILED,
+  WS_SWITCH_HEARTBEAT,
+  WS_SWITCH_CLOSED,     // server or network closed the socket
+  WS_SWITCH_BETTER      // planned move to a faster or more preferred endpoint
+};
+
+const char* wsSwitchReasonName(WsSwitchReason reason);
+
+struct WsEndpointStats {
+  // Application pings while active
+  uint32_t srttUs;        // WS_RTT_UNKNOWN until the first pong
+  uint32_t rttVarUs;
+  uint32_t lastRttUs;
+  uint32_t minRttUs;
+  uint32_t pingsSent;
+  uint32_t pongs;
+  uint32_t lost;
+  uint32_t lossWindow;    // bit set = lost, newest in bit 0
+  uint8_t lossSamples;    // valid bits in lossWindow
+  // TCP connect probes, active or not
+  volatile uint32_t probeUs;  // smoothed, WS_RTT_UNKNOWN if never reached
+  volatile uint32_t probes;
+  volatile uint32_t probeFailures;
+  // Session history
+  uint32_t connects;
+  uint32_t failures;
+  uint32_t retryAt;       // µs; backing off until then
+  uint32_t backoffMs;
+};
+
+// What the session drives; implemented over WebSocketsClient on the device
+class WsTransport {
+ public:
+  virtual ~WsTransport() {}
+  virtual void open(const WsEndpoint& endpoint) = 0;
+  virtual void close() = 0;
+  virtual bool send(const char* text) = 0;
+};
+
+class WsSession {
+ public:
+  // urls: most preferred first; unparseable ones are skipped
+  uint8_t begin(WsTransport* transport, const char* const* urls, uint8_t count);
+
+  // Call every WS_TICK_MS with the network state; times are micros()
+  void service(bool networkUp, uint32_t nowUs);
+
+  // Transport events
+  void onConnected(uint32_t nowUs);
+  void onDisconnected(uint32_t nowUs);
+  void onPong(uint32_t seq, uint32_t nowUs);
+
+  WsState state() const { return current; }
+  bool connected() const { return current == WS_CONNECTED; }
+  int8_t active() const { return activeIndex; }
+  uint8_t size() const { return count; }
+  const WsEndpoint& endpoint(uint8_t i) const { return endpoints[i]; }
+  const WsEndpointStats& stats(uint8_t i) const { return health[i]; }
+  uint8_t lossPercent(uint8_t i) const;
+
+  uint32_t switches() const { return switchCount; }
+  WsSwitchReason lastSwitchReason() const { return lastReason; }
+  uint32_t lastOutageUs() const { return outageUs; }  // disconnect -> next connected
+
+#ifdef ARDUINO
+  // Starts the TCP probe task; it only runs while the network is up
+  void startProbing();
+#endif
+
+ private:
+  struct Ping {
+    uint32_t seq;
+    uint32_t sentUs;
+    bool pending;
+  };
+
+  WsTransport* link = nullptr;
+  WsEndpoint endpoints[WS_MAX_ENDPOINTS];
+  WsEndpointStats health[WS_MAX_ENDPOINTS];
+  uint8_t count = 0;
+
+  WsState current = WS_OFFLINE;
+  int8_t activeIndex = -1;
+  uint32_t stateSince = 0;
+  uint32_t lastPingUs = 0;
+  uint32_t lastPongUs = 0;
+  uint32_t nextSeq = 1;
+  Ping inflight[WS_INFLIGHT] = {};
+  bool closing = false;
+
+  uint32_t switchCount = 0;
+  WsSwitchReason lastReason = WS_SWITCH_NONE;
+  uint32_t downSinceUs = 0;
+  bool down = false;
+  uint32_t outageUs = 0;
+
+  int8_t pick(uint32_t nowUs, int8_t exclude) const;
+  bool fasterByMargin(uint8_t a, uint8_t b) const;
+  void connect(int8_t index, uint32_t nowUs);
+  void fail(uint32_t nowUs, WsSwitchReason reason);
+  void sendPing(uint32_t nowUs);
+  void expirePings(uint32_t nowUs);
+  void recordLoss(uint8_t index, bool lost);
+};
+
+#endif // WS_SESSION_H
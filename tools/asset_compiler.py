@@ -0,0 +1,209 @@
+#!/usr/bin/env python3
+"""
+BlackRoad CEO Hub - icon asset compiler
+
+Turns the PNG/SVG icons in assets/icons into palette-indexed, run-length
+encoded RGB565 bitmaps in flash (src/icon_data.h / src/icon_data.cpp),
+decoded at draw time by src/icons.cpp.
+
+Each icon gets its own palette of RGB565 colors; index 0 is transparent.
+Icons with up to 15 colors use RLE4 (one byte per run: run-1 in the high
+nibble, palette index in the low nibble), bigger palettes use RLE8 (a
+run-1 byte then an index byte). Runs continue across rows. Icons with
+more colors than --max-colors are quantized first.
+
+Runs automatically before each PlatformIO build (extra_scripts) and only
+regenerates when an icon is newer than the output. SVG input needs
+cairosvg; PNG only needs Pillow.
+
+Usage:
+    python3 tools/asset_compiler.py [--max-colors 15] [--force]
+"""
+
+import argparse
+import io
+import os
+import sys
+
+try:
+    ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+    PLATFORMIO = False
+except NameError:
+    # PlatformIO runs extra_scripts through SCons, which has no __file__
+    Import("env")  # noqa: F821
+    ROOT = env.subst("$PROJECT_DIR")  # noqa: F821
+    PLATFORMIO = True
+
+ICON_DIR = os.path.join(ROOT, "assets", "icons")
+OUT_H = os.path.join(ROOT, "src", "icon_data.h")
+OUT_CPP = os.path.join(ROOT, "src", "icon_data.cpp")
+
+ICON_RLE4 = 0
+ICON_RLE8 = 1
+MAX_PIXELS = 24 * 24  # ICON_MAX_PIXELS in src/icons.h
+ALPHA_THRESHOLD = 128
+
+
+def rgb565(r, g, b):
+    return ((r * 31 + 127) // 255) << 11 | ((g * 63 + 127) // 255) << 5 | ((b * 31 + 127) // 255)
+
+
+def load(path):
+    from PIL import Image
+
+    if path.endswith(".svg"):
+        try:
+            import cairosvg
+        except ImportError:
+            sys.exit(f"asset_compiler: {os.path.basename(path)} needs cairosvg (pip install cairosvg)")
+        image = Image.open(io.BytesIO(cairosvg.svg2png(url=path)))
+    else:
+        image = Image.open(path)
+    return image.convert("RGBA")
+
+
+def flat(image):
+    # getdata() is deprecated from Pillow 12 on
+    return list(image.get_flattened_data() if hasattr(image, "get_flattened_data") else image.getdata())
+
+
+def indexed(image, max_colors):
+    """Returns (palette, pixels): palette[0] is the transparent slot."""
+    from PIL import Image
+
+    rgba = flat(image)
+    opaque = [p[3] >= ALPHA_THRESHOLD for p in rgba]
+    colors = {p[:3] for p, o in zip(rgba, opaque) if o}
+
+    # Transparent pixels take an opaque color so they cannot cost a palette slot
+    rgb = image.convert("RGB")
+    if colors:
+        filler = next(iter(colors))
+        rgb.putdata([p if o else filler for p, o in zip(flat(rgb), opaque)])
+    if len(colors) > max_colors:
+        rgb = rgb.quantize(colors=max_colors, method=Image.Quantize.MEDIANCUT).convert("RGB")
+
+    palette = [0]
+    lookup = {}
+    pixels = []
+    for color, o in zip(flat(rgb), opaque):
+        if not o:
+            pixels.append(0)
+            continue
+        c = rgb565(*color)
+        if c not in lookup:
+            lookup[c] = len(palette)
+            palette.append(c)
+        pixels.append(lookup[c])
+    return palette, pixels
+
+
+def runs(pixels, longest):
+    i = 0
+    while i < len(pixels):
+        n = 1
+        while i + n < len(pixels) and pixels[i + n] == pixels[i] and n < longest:
+            n += 1
+        yield n, pixels[i]
+        i += n
+
+
+def encode(palette, pixels):
+    if len(palette) <= 16:
+        return ICON_RLE4, bytes((n - 1) << 4 | index for n, index in runs(pixels, 16))
+    data = bytearray()
+    for n, index in runs(pixels, 256):
+        data += bytes((n - 1, index))
+    return ICON_RLE8, bytes(data)
+
+
+def c_name(filename):
+    return "ICON_" + os.path.splitext(filename)[0].upper().replace("-", "_")
+
+
+def byte_rows(data, per_row=16):
+    for i in range(0, len(data), per_row):
+        yield "  " + ", ".join(f"0x{b:02X}" for b in data[i:i + per_row]) + ","
+
+
+def compile_icons(max_colors):
+    files = sorted(f for f in os.listdir(ICON_DIR) if f.endswith((".png", ".svg")))
+    header = [
+        "// Generated by tools/asset_compiler.py from assets/icons - do not edit",
+        "",
+        "#ifndef ICON_DATA_H",
+        "#define ICON_DATA_H",
+        "",
+        '#include "icons.h"',
+        "",
+    ]
+    source = [
+        "// Generated by tools/asset_compiler.py from assets/icons - do not edit",
+        "",
+        '#include "icon_data.h"',
+        "",
+    ]
+
+    total_raw = total_flash = 0
+    for filename in files:
+        image = load(os.path.join(ICON_DIR, filename))
+        w, h = image.size
+        if w * h > MAX_PIXELS or w > 255 or h > 255:
+            sys.exit(f"asset_compiler: {filename} is {w}x{h}, larger than ICON_MAX_PIXELS")
+
+        palette, pixels = indexed(image, max_colors)
+        encoding, data = encode(palette, pixels)
+        name = c_name(filename)
+        flash = len(palette) * 2 + len(data)
+        total_raw += w * h * 2
+        total_flash += flash
+
+        header.append(f"extern const Icon {name};  // {w}x{h}, {len(palette) - 1} colors, {flash} B")
+        source.append(f"static const uint16_t {name}_PALETTE[] PROGMEM = {{")
+        source.append("  " + ", ".join(f"0x{c:04X}" for c in palette))
+        source.append("};")
+        source.append(f"static const uint8_t {name}_DATA[] PROGMEM = {{")
+        source.extend(byte_rows(data))
+        source.append("};")
+        source.append(f"const Icon {name} = {{ {w}, {h}, "
+                      f"{'ICON_RLE4' if encoding == ICON_RLE4 else 'ICON_RLE8'}, "
+                      f"{len(palette)}, {name}_PALETTE, {name}_DATA, {len(data)} }};")
+        source.append("")
+        print(f"  {filename:<20} {w:>2}x{h:<2} {len(palette) - 1:>3} colors "
+              f"{'RLE4' if encoding == ICON_RLE4 else 'RLE8'} {w * h * 2:>5} -> {flash:>4} B")
+
+    header += ["", "#endif // ICON_DATA_H", ""]
+    with open(OUT_H, "w") as f:
+        f.write("\n".join(header))
+    with open(OUT_CPP, "w") as f:
+        f.write("\n".join(source))
+    print(f"asset_compiler: {len(files)} icons, {total_raw} B raw RGB565 -> {total_flash} B flash")
+
+
+def stale():
+    if not (os.path.exists(OUT_H) and os.path.exists(OUT_CPP)):
+        return True
+    built = min(os.path.getmtime(OUT_H), os.path.getmtime(OUT_CPP))
+    sources = [os.path.join(ICON_DIR, f) for f in os.listdir(ICON_DIR)]
+    sources.append(os.path.join(ROOT, "tools", "asset_compiler.py"))
+    return any(os.path.getmtime(p) > built for p in sources)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--max-colors", type=int, default=15, help="quantize icons with more opaque colors")
+    parser.add_argument("--force", action="store_true", help="regenerate even if up to date")
+    args = parser.parse_args()
+    if not 1 <= args.max_colors <= 255:
+        parser.error("--max-colors must be 1..255")
+    if args.force or stale():
+        compile_icons(args.max_colors)
+    else:
+        print("asset_compiler: icons up to date")
+
+
+if PLATFORMIO:
+    if stale():
+        compile_icons(15)
+elif __name__ == "__main__":
+    main()
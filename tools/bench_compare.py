@@ -0,0 +1,66 @@
+#!/usr/bin/env python3
+"""
+BlackRoad CEO Hub - host benchmark comparison
+
+Compares two result files written by a bench/ binary with --json (for
+example `make -C bench json` on two commits). A benchmark counts as
+changed only when its median moved by more than --threshold percent AND
+by more than --mads times the combined MAD of both runs, so run-to-run
+noise does not show up as a regression.
+
+Usage:
+    python3 tools/bench_compare.py bench/hotpath-<old>.json bench/hotpath-<new>.json
+Exit status is 1 when any benchmark got slower.
+"""
+
+import argparse
+import json
+import sys
+
+
+def load(path):
+    with open(path, encoding="utf-8") as f:
+        data = json.load(f)
+    return data, {r["name"]: r for r in data["results"]}
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    parser.add_argument("base", help="results before the change")
+    parser.add_argument("head", help="results after the change")
+    parser.add_argument("--threshold", type=float, default=5.0, help="minimum change in percent")
+    parser.add_argument("--mads", type=float, default=3.0, help="minimum change in combined MADs")
+    args = parser.parse_args()
+
+    base_info, base = load(args.base)
+    head_info, head = load(args.head)
+    for key in ("compiler", "flags"):
+        if base_info.get(key) != head_info.get(key):
+            print("warning: %s differs (%s vs %s)" % (key, base_info.get(key), head_info.get(key)),
+                  file=sys.stderr)
+
+    print("%-32s %12s %12s %8s" % ("benchmark", base_info.get("label") or "base",
+                                   head_info.get("label") or "head", "change"))
+    slower = 0
+    for name, new in head.items():
+        old = base.get(name)
+        if old is None:
+            print("%-32s %12s %9.1f ns %8s" % (name, "-", new["median_ns"], "new"))
+            continue
+        delta = new["median_ns"] - old["median_ns"]
+        pct = 100.0 * delta / old["median_ns"] if old["median_ns"] else 0.0
+        noise = args.mads * (old["mad_ns"] + new["mad_ns"])
+        verdict = ""
+        if abs(pct) > args.threshold and abs(delta) > noise:
+            verdict = "slower" if delta > 0 else "faster"
+            slower += delta > 0
+        print("%-32s %9.1f ns %9.1f ns %+7.1f%% %s" % (name, old["median_ns"], new["median_ns"], pct, verdict))
+    for name in base:
+        if name not in head:
+            print("%-32s %9.1f ns %12s %8s" % (name, base[name]["median_ns"], "-", "gone"))
+
+    sys.exit(1 if slower else 0)
+
+
+if __name__ == "__main__":
+    main()
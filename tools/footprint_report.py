@@ -0,0 +1,81 @@
+#!/usr/bin/env python3
+"""
+BlackRoad CEO Hub - per-service firmware footprint
+
+Builds the firmware once as configured and once more per cloud service
+with that service's ENABLE_* flag flipped (-DENABLE_<SERVICE>=0 or 1),
+then reports what each service costs in flash and static RAM. Services
+are compiled out through if constexpr (src/cloud_services.h), so the
+difference is the whole service: code, strings, buffers and the
+libraries only it pulls in. Heap and boot time taken at run time are in
+the `cloud` serial command.
+
+Sizes come from the toolchain's `size` on firmware.elf: flash is
+text + data, static RAM is data + bss.
+
+Usage:
+    python3 tools/footprint_report.py [--env esp32dev] [--size PATH]
+"""
+
+import argparse
+import glob
+import os
+import re
+import subprocess
+import sys
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+FLAG = re.compile(r"#define\s+ENABLE_(\w+)\s+(\d)")
+
+
+def service_defaults():
+    source = open(os.path.join(ROOT, "src", "cloud_config.h"), encoding="utf-8").read()
+    return [(name, value != "0") for name, value in FLAG.findall(source)]
+
+
+def find_size_tool():
+    home = os.environ.get("PLATFORMIO_CORE_DIR", os.path.expanduser("~/.platformio"))
+    found = glob.glob(os.path.join(home, "packages", "toolchain-xtensa*", "bin", "xtensa-esp32-elf-size"))
+    return found[0] if found else "xtensa-esp32-elf-size"
+
+
+def build(env, variant, flags):
+    # Separate build directory per variant, so flipping back is incremental
+    build_dir = os.path.join(ROOT, ".pio", "footprint", variant)
+    run_env = dict(os.environ, PLATFORMIO_BUILD_DIR=build_dir, PLATFORMIO_BUILD_FLAGS=flags)
+    result = subprocess.run(["pio", "run", "-e", env], cwd=ROOT, env=run_env,
+                            stdout=subprocess.DEVNULL, stderr=subprocess.PIPE, text=True)
+    if result.returncode != 0:
+        sys.stderr.write(result.stderr)
+        sys.exit("build failed: %s %s" % (variant, flags))
+    return os.path.join(build_dir, env, "firmware.elf")
+
+
+def sizes(size_tool, elf):
+    out = subprocess.run([size_tool, elf], check=True, stdout=subprocess.PIPE, text=True).stdout
+    text, data, bss = (int(v) for v in out.splitlines()[1].split()[:3])
+    return text + data, data + bss
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    parser.add_argument("--env", default="esp32dev", help="PlatformIO environment to build")
+    parser.add_argument("--size", default=None, help="path to xtensa-esp32-elf-size")
+    args = parser.parse_args()
+    size_tool = args.size or find_size_tool()
+
+    services = service_defaults()
+    base_flash, base_ram = sizes(size_tool, build(args.env, "base", ""))
+    print("%-14s %-8s %12s %12s" % ("service", "default", "flash", "static RAM"))
+    for name, enabled in services:
+        flags = "-DENABLE_%s=%d" % (name, 0 if enabled else 1)
+        flash, ram = sizes(size_tool, build(args.env, name.lower(), flags))
+        # Cost of having the service in, whichever way its default points
+        flash_cost = base_flash - flash if enabled else flash - base_flash
+        ram_cost = base_ram - ram if enabled else ram - base_ram
+        print("%-14s %-8s %+10d B %+10d B" % (name.lower(), "on" if enabled else "off", flash_cost, ram_cost))
+    print("%-14s %-8s %10d B %10d B" % ("image", "", base_flash, base_ram))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,146 @@
+#!/usr/bin/env python3
+"""
+BlackRoad CEO Hub - touch-to-photon latency report
+
+Decodes the binary frames written by the `lat bin` serial command and
+prints p50/p90/p99 per span. Frames can be mixed with normal serial text;
+the decoder scans for the sync byte and checks the CRC.
+
+Usage:
+    pio device monitor --raw > capture.bin    (then type `lat bin`)
+    python3 tools/latency_report.py capture.bin [--json]
+"""
+
+import argparse
+import json
+import sys
+
+FRAME_SYNC = 0xA5
+FRAME_TYPE = ord("L")
+SUB_BITS = 2
+SUB_COUNT = 1 << SUB_BITS
+BUCKETS = 96
+
+SPAN_NAMES = ["touch->gesture", "gesture->switch", "switch->photon", "touch->photon"]
+
+
+def crc8(data):
+    crc = 0
+    for b in data:
+        crc ^= b
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x07) & 0xFF if crc & 0x80 else (crc << 1) & 0xFF
+    return crc
+
+
+def bucket_low(idx):
+    if idx < SUB_COUNT:
+        return idx
+    msb = (idx - SUB_COUNT) // SUB_COUNT + SUB_BITS
+    sub = (idx - SUB_COUNT) % SUB_COUNT
+    return (1 << msb) + (sub << (msb - SUB_BITS))
+
+
+class Reader:
+    def __init__(self, data):
+        self.data = data
+        self.pos = 0
+
+    def byte(self):
+        b = self.data[self.pos]
+        self.pos += 1
+        return b
+
+    def varint(self):
+        value, shift = 0, 0
+        while True:
+            b = self.byte()
+            value |= (b & 0x7F) << shift
+            shift += 7
+            if not b & 0x80:
+                return value
+
+
+def percentile(span, permille):
+    count = span["count"]
+    if count == 0:
+        return 0
+    target = max(1, (count * permille + 999) // 1000)
+    seen = 0
+    for idx in sorted(span["buckets"]):
+        seen += span["buckets"][idx]
+        if seen >= target:
+            lo = bucket_low(idx)
+            hi = bucket_low(idx + 1) - 1 if idx + 1 < BUCKETS else span["max"]
+            return min(max(lo + (hi - lo) // 2, span["min"]), span["max"])
+    return span["max"]
+
+
+def parse_payload(payload):
+    r = Reader(payload)
+    version = r.byte()
+    if version != 1:
+        raise ValueError("unsupported frame version %d" % version)
+    spans = []
+    for _ in range(r.byte()):
+        span = {"id": r.byte(), "count": r.varint(), "min": r.varint(),
+                "max": r.varint(), "sum": r.varint(), "buckets": {}}
+        for _ in range(r.byte()):
+            idx = r.byte()
+            span["buckets"][idx] = r.varint()
+        spans.append(span)
+    return spans
+
+
+def find_frames(data):
+    pos = 0
+    while True:
+        pos = data.find(bytes([FRAME_SYNC, FRAME_TYPE]), pos)
+        if pos < 0 or pos + 4 > len(data):
+            return
+        length = data[pos + 2] | (data[pos + 3] << 8)
+        end = pos + 4 + length
+        if end < len(data) and crc8(data[pos + 4:end]) == data[end]:
+            yield parse_payload(data[pos + 4:end])
+            pos = end + 1
+        else:
+            pos += 1
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    parser.add_argument("capture", help="raw serial capture ('-' for stdin)")
+    parser.add_argument("--json", action="store_true", help="machine-readable output")
+    args = parser.parse_args()
+
+    data = sys.stdin.buffer.read() if args.capture == "-" else open(args.capture, "rb").read()
+    frames = list(find_frames(data))
+    if not frames:
+        sys.exit("no latency frames found")
+
+    # Last frame wins: histograms are cumulative on the device
+    rows = []
+    for span in frames[-1]:
+        rows.append({
+            "span": SPAN_NAMES[span["id"]] if span["id"] < len(SPAN_NAMES) else str(span["id"]),
+            "count": span["count"],
+            "p50_us": percentile(span, 500),
+            "p90_us": percentile(span, 900),
+            "p99_us": percentile(span, 990),
+            "max_us": span["max"],
+            "mean_us": span["sum"] // span["count"] if span["count"] else 0,
+        })
+
+    if args.json:
+        json.dump(rows, sys.stdout, indent=2)
+        print()
+        return
+
+    print("%-18s %8s %8s %8s %8s %8s" % ("span (us)", "n", "p50", "p90", "p99", "max"))
+    for row in rows:
+        print("%-18s %8d %8d %8d %8d %8d" % (row["span"], row["count"], row["p50_us"],
+                                            row["p90_us"], row["p99_us"], row["max_us"]))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,205 @@
+#!/usr/bin/env python3
+"""
+BlackRoad CEO Hub - binary log decoder
+
+Turns the frames written in `log bin` mode back into text. Message formats
+come from src/log_messages.h, so decode with the same source revision the
+firmware was built from; every frame carries a hash of the format table and
+a mismatch is reported. Frames can be mixed with normal serial text; the
+decoder scans for the sync byte and checks the CRC.
+
+Usage:
+    pio device monitor --raw > capture.bin    (then type `log bin`)
+    python3 tools/log_decode.py capture.bin [--level info] [--module ws]
+"""
+
+import argparse
+import os
+import re
+import struct
+import sys
+
+FRAME_SYNC = 0xA5
+FRAME_TYPE = ord("G")
+STR_MAX = 40
+
+LEVELS = ["error", "warn", "info", "debug"]
+
+# ESP32: long and size_t are 32-bit
+INT_BYTES = {"": 4, "h": 4, "hh": 4, "l": 4, "z": 4, "t": 4, "ll": 8, "j": 8}
+
+SPEC = re.compile(r"%([-+ #0]*\d*(?:\.\d+)?)(hh|h|ll|l|z|t|j)?([diuxXocsfFeEgGaAp%])")
+MESSAGE = re.compile(r'X\((\w+),\s*(\w+),\s*(\w+),\s*"((?:[^"\\]|\\.)*)"\)')
+MODULE = re.compile(r'X\((\w+),\s*"(\w+)"\)')
+
+
+def unescape(text):
+    return re.sub(r"\\(.)", lambda m: {"n": "\n", "t": "\t"}.get(m.group(1), m.group(1)), text)
+
+
+def load_table(path):
+    source = open(path, encoding="utf-8").read()
+    modules_src, messages_src = source.split("#define LOG_MESSAGES", 1)
+    modules = {token: label for token, label in MODULE.findall(modules_src)}
+    messages = []
+    for name, module, level, fmt in MESSAGE.findall(messages_src):
+        messages.append({"name": name, "module": modules.get(module, module.lower()),
+                         "level": LEVELS.index(level.lower()), "format": unescape(fmt)})
+    return messages
+
+
+def crc8(data):
+    crc = 0
+    for b in data:
+        crc ^= b
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x07) & 0xFF if crc & 0x80 else (crc << 1) & 0xFF
+    return crc
+
+
+def table_hash(messages):
+    # CRC-16/CCITT-FALSE over each format and its terminating NUL
+    crc = 0xFFFF
+    for msg in messages:
+        for b in msg["format"].encode("utf-8") + b"\0":
+            crc ^= b << 8
+            for _ in range(8):
+                crc = ((crc << 1) ^ 0x1021) & 0xFFFF if crc & 0x8000 else (crc << 1) & 0xFFFF
+    return crc
+
+
+def format_record(fmt, args):
+    pos = 0
+    out = []
+    last = 0
+    for m in SPEC.finditer(fmt):
+        out.append(fmt[last:m.start()])
+        last = m.end()
+        flags, length, conv = m.group(1), m.group(2) or "", m.group(3)
+        if conv == "%":
+            out.append("%")
+            continue
+        try:
+            if conv in "di":
+                size = INT_BYTES[length]
+                value = struct.unpack_from("<q" if size == 8 else "<i", args, pos)[0]
+                pos += size
+                out.append(("%" + flags + "d") % value)
+            elif conv in "uxXoc":
+                size = 4 if conv == "c" else INT_BYTES[length]
+                value = struct.unpack_from("<Q" if size == 8 else "<I", args, pos)[0]
+                pos += size
+                out.append(("%" + flags + ("d" if conv == "u" else conv)) % value)
+            elif conv in "fFeEgGaA":
+                value = struct.unpack_from("<f", args, pos)[0]
+                pos += 4
+                out.append(("%" + flags + ("f" if conv in "aA" else conv)) % value)
+            elif conv == "s":
+                size = args[pos]
+                if size > STR_MAX:
+                    raise IndexError
+                text = args[pos + 1:pos + 1 + size]
+                if len(text) < size:
+                    raise IndexError
+                pos += 1 + size
+                out.append(("%" + flags + "s") % text.decode("utf-8", "replace"))
+            elif conv == "p":
+                out.append("0x%08x" % struct.unpack_from("<I", args, pos)[0])
+                pos += 4
+        except (IndexError, struct.error):
+            out.append("?")  # record was cut short on the device
+    out.append(fmt[last:])
+    return "".join(out)
+
+
+class Reader:
+    def __init__(self, data):
+        self.data = data
+        self.pos = 0
+
+    def byte(self):
+        b = self.data[self.pos]
+        self.pos += 1
+        return b
+
+    def varint(self):
+        value, shift = 0, 0
+        while True:
+            b = self.byte()
+            value |= (b & 0x7F) << shift
+            shift += 7
+            if not b & 0x80:
+                return value
+
+
+def parse_payload(payload):
+    r = Reader(payload)
+    version = r.byte()
+    if version != 1:
+        raise ValueError("unsupported frame version %d" % version)
+    frame = {"hash": r.byte() | (r.byte() << 8), "dropped": r.varint(), "records": []}
+    while r.pos < len(payload):
+        length = r.byte()
+        body = payload[r.pos:r.pos + length]
+        r.pos += length
+        msg_id, millis = struct.unpack_from("<HI", body)
+        frame["records"].append((msg_id, millis, body[6:]))
+    return frame
+
+
+def find_frames(data):
+    pos = 0
+    while True:
+        pos = data.find(bytes([FRAME_SYNC, FRAME_TYPE]), pos)
+        if pos < 0 or pos + 4 > len(data):
+            return
+        length = data[pos + 2] | (data[pos + 3] << 8)
+        end = pos + 4 + length
+        if end < len(data) and crc8(data[pos + 4:end]) == data[end]:
+            yield parse_payload(data[pos + 4:end])
+            pos = end + 1
+        else:
+            pos += 1
+
+
+def main():
+    here = os.path.dirname(os.path.abspath(__file__))
+    parser = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    parser.add_argument("capture", help="raw serial capture ('-' for stdin)")
+    parser.add_argument("--table", default=os.path.join(here, "..", "src", "log_messages.h"),
+                        help="log_messages.h the firmware was built from")
+    parser.add_argument("--level", choices=LEVELS, default="debug", help="most verbose level shown")
+    parser.add_argument("--module", action="append", help="only these modules (repeatable)")
+    args = parser.parse_args()
+
+    messages = load_table(args.table)
+    expected_hash = table_hash(messages)
+    max_level = LEVELS.index(args.level)
+
+    data = sys.stdin.buffer.read() if args.capture == "-" else open(args.capture, "rb").read()
+    frames = 0
+    warned = False
+    for frame in find_frames(data):
+        frames += 1
+        if frame["hash"] != expected_hash and not warned:
+            print("warning: firmware table %04x, %s is %04x; messages may be wrong"
+                  % (frame["hash"], args.table, expected_hash), file=sys.stderr)
+            warned = True
+        if frame["dropped"]:
+            print("%-12s %-5s %-5s … %d records dropped" % ("", "", "log", frame["dropped"]))
+        for msg_id, millis, body in frame["records"]:
+            if msg_id >= len(messages):
+                text, module, level = "<message %d>" % msg_id, "?", 0
+            else:
+                msg = messages[msg_id]
+                text, module, level = format_record(msg["format"], body), msg["module"], msg["level"]
+            if level > max_level or (args.module and module not in args.module):
+                continue
+            print("[%6d.%03d] %-5s %-5s %s" % (millis // 1000, millis % 1000, LEVELS[level], module, text))
+
+    if not frames:
+        sys.exit("no log frames found")
+
+
+if __name__ == "__main__":
+    main()
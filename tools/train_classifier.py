@@ -0,0 +1,311 @@
+#!/usr/bin/env python3
+"""
+BlackRoad CEO Hub - event text classifier trainer
+
+Trains the hub's on-device priority classifier (src/text_classifier.h)
+on assets/classifier/events.tsv and writes the int8 model to
+src/classifier_model.cpp.
+
+The model is a bag of hashed features (words, word pairs, character
+trigrams) averaged through an embedding table, one ReLU layer and an
+output layer over info / warn / critical. It is trained in float with
+Adam, then quantized: int8 weights with one scale per tensor, int32
+biases, and a fixed-point multiplier for the hidden activations. The
+quantized model is scored with the same integer arithmetic the firmware
+uses, so the accuracy printed is the accuracy on the device.
+
+Every fifth example is held out for the reported accuracy; the model
+written is then trained on everything.
+
+Needs numpy. Not part of the build: rerun after editing the data and
+commit the generated file.
+
+Usage:
+    python3 tools/train_classifier.py [--epochs 600] [--seed 1]
+"""
+
+import argparse
+import math
+import os
+import re
+import sys
+
+import numpy as np
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+DATA = os.path.join(ROOT, "assets", "classifier", "events.tsv")
+OUT_CPP = os.path.join(ROOT, "src", "classifier_model.cpp")
+HEADER = os.path.join(ROOT, "src", "text_classifier.h")
+
+CLASSES = ["info", "warn", "critical"]  # TextClass order
+FNV_OFFSET = 2166136261
+FNV_PRIME = 16777619
+
+
+def shape():
+    source = open(HEADER, encoding="utf-8").read()
+    names = ("BUCKETS", "EMBED", "HIDDEN", "TEXT_MAX", "WORDS_MAX")
+    found = dict(re.findall(r"#define\s+CLASSIFIER_(\w+)\s+(\d+)", source))
+    return {name: int(found[name]) for name in names}
+
+
+# ══════════════════════════════════════════════════════════════════════════
+# FEATURES (as classifyText)
+# ══════════════════════════════════════════════════════════════════════════
+
+def fnv(h, data):
+    for c in data:
+        h = ((h ^ c) * FNV_PRIME) & 0xFFFFFFFF
+    return h
+
+
+def words(text, dims):
+    out, current, in_digits = [], None, False
+    used = 0
+    for ch in text.encode("utf-8")[:dims["TEXT_MAX"]]:
+        if used >= dims["TEXT_MAX"]:
+            break
+        digit = 48 <= ch <= 57
+        if 65 <= ch <= 90:
+            ch += 32
+        if not digit and not 97 <= ch <= 122:
+            current, in_digits = None, False
+            continue
+        if digit and in_digits:
+            continue
+        in_digits = digit
+        if current is None:
+            if len(out) == dims["WORDS_MAX"]:
+                break
+            current = bytearray()
+            out.append(current)
+        current.append(48 if digit else ch)
+        used += 1
+    return [bytes(w) for w in out]
+
+
+def features(text, dims):
+    ws = words(text, dims)
+    mask = dims["BUCKETS"] - 1
+    out = []
+    for i, w in enumerate(ws):
+        out.append(fnv(FNV_OFFSET, b"w" + w) & mask)
+        if i + 1 < len(ws):
+            out.append(fnv(FNV_OFFSET, b"b" + w + b" " + ws[i + 1]) & mask)
+        padded = b"^" + w + b"$"
+        for j in range(len(w)):
+            out.append(fnv(FNV_OFFSET, b"t" + padded[j:j + 3]) & mask)
+    return out
+
+
+# ══════════════════════════════════════════════════════════════════════════
+# TRAINING
+# ══════════════════════════════════════════════════════════════════════════
+
+def load(dims):
+    rows = []
+    for line in open(DATA, encoding="utf-8"):
+        if not line.strip() or line.startswith("#"):
+            continue
+        label, text = line.rstrip("\n").split("\t", 1)
+        rows.append((CLASSES.index(label), text, features(text, dims)))
+    return rows
+
+
+def bag_matrix(rows, buckets):
+    # Row i averages the embedding rows of example i's features
+    m = np.zeros((len(rows), buckets), dtype=np.float32)
+    for i, (_, _, feats) in enumerate(rows):
+        for f in feats:
+            m[i, f] += 1.0 / max(len(feats), 1)
+    return m
+
+
+def train(rows, dims, epochs, seed):
+    rng = np.random.default_rng(seed)
+    e, h, k = dims["EMBED"], dims["HIDDEN"], len(CLASSES)
+    params = {
+        "E": rng.normal(0, 0.3, (dims["BUCKETS"], e)),
+        "W1": rng.normal(0, 1 / math.sqrt(e), (h, e)),
+        "b1": np.zeros(h),
+        "W2": rng.normal(0, 1 / math.sqrt(h), (k, h)),
+        "b2": np.zeros(k),
+    }
+    bags = bag_matrix(rows, dims["BUCKETS"])
+    labels = np.array([r[0] for r in rows])
+    onehot = np.eye(k)[labels]
+    moments = {name: (np.zeros_like(p), np.zeros_like(p)) for name, p in params.items()}
+    rate, decay = 0.02, 1e-4
+
+    for step in range(1, epochs + 1):
+        x = bags @ params["E"]
+        pre = x @ params["W1"].T + params["b1"]
+        act = np.maximum(pre, 0)
+        logits = act @ params["W2"].T + params["b2"]
+        logits -= logits.max(axis=1, keepdims=True)
+        prob = np.exp(logits)
+        prob /= prob.sum(axis=1, keepdims=True)
+
+        d_logits = (prob - onehot) / len(rows)
+        d_act = d_logits @ params["W2"]
+        d_pre = d_act * (pre > 0)
+        d_x = d_pre @ params["W1"]
+        grads = {
+            "W2": d_logits.T @ act,
+            "b2": d_logits.sum(axis=0),
+            "W1": d_pre.T @ x,
+            "b1": d_pre.sum(axis=0),
+            "E": bags.T @ d_x,
+        }
+        for name, g in grads.items():
+            g = g + decay * params[name]
+            m, v = moments[name]
+            m[:] = 0.9 * m + 0.1 * g
+            v[:] = 0.999 * v + 0.001 * g * g
+            m_hat = m / (1 - 0.9 ** step)
+            v_hat = v / (1 - 0.999 ** step)
+            params[name] -= rate * m_hat / (np.sqrt(v_hat) + 1e-8)
+    return params
+
+
+# ══════════════════════════════════════════════════════════════════════════
+# QUANTIZATION AND THE INTEGER KERNEL
+# ══════════════════════════════════════════════════════════════════════════
+
+def quantize(params, rows):
+    def scale_of(a):
+        return max(float(np.abs(a).max()), 1e-8) / 127
+
+    s_e, s_1, s_2 = scale_of(params["E"]), scale_of(params["W1"]), scale_of(params["W2"])
+    q = {
+        "E": np.clip(np.round(params["E"] / s_e), -127, 127).astype(np.int64),
+        "W1": np.clip(np.round(params["W1"] / s_1), -127, 127).astype(np.int64),
+        "b1": np.round(params["b1"] / (s_e * s_1)).astype(np.int64),
+        "W2": np.clip(np.round(params["W2"] / s_2), -127, 127).astype(np.int64),
+    }
+
+    # Activation scale from the largest hidden value the data produces
+    top = 1e-8
+    for _, _, feats in rows:
+        if feats:
+            x = q["E"][feats].sum(axis=0) * s_e / len(feats)
+            top = max(top, float(np.maximum(q["W1"] @ x * s_1 + q["b1"] * s_e * s_1, 0).max()))
+    s_a = top / 127
+
+    # hidden = acc × (s_e s_1 / s_a), as mult / 2^shift with mult in [2^30, 2^31)
+    real = s_e * s_1 / s_a
+    shift = 0
+    while real * 2 ** (shift + 1) < 2 ** 31 and shift < 62:
+        shift += 1
+    q["mult"], q["shift"] = int(round(real * 2 ** shift)), shift
+    if q["mult"] >= 2 ** 31:
+        q["mult"] //= 2
+        q["shift"] -= 1
+    q["b2"] = np.round(params["b2"] / (s_a * s_2)).astype(np.int64)
+    q["logit_scale"] = s_a * s_2
+    return q
+
+
+def classify(q, feats):
+    """classifyText on integers: (label, confidence percent)"""
+    if not feats:
+        return 0, 0
+    n = len(feats)
+    total = q["E"][feats].sum(axis=0)
+    act = []
+    for j in range(q["W1"].shape[0]):
+        acc = int(q["b1"][j]) * n + int(q["W1"][j] @ total)
+        if acc <= 0:
+            act.append(0)
+            continue
+        a = (acc * q["mult"] // n + (1 << (q["shift"] - 1))) >> q["shift"]
+        act.append(min(a, 127))
+    act = np.array(act, dtype=np.int64)
+    logits = [float(np.float32(int(q["b2"][k]) + int(q["W2"][k] @ act)) * np.float32(q["logit_scale"]))
+              for k in range(len(CLASSES))]
+    label = int(np.argmax(logits))
+    denom = sum(math.exp(v - logits[label]) for v in logits)
+    return label, int(100.0 / denom + 0.5)
+
+
+def accuracy(q, rows):
+    return sum(classify(q, feats)[0] == label for label, _, feats in rows) / max(len(rows), 1)
+
+
+def float_accuracy(params, rows, dims):
+    bags = bag_matrix(rows, dims["BUCKETS"])
+    act = np.maximum(bags @ params["E"] @ params["W1"].T + params["b1"], 0)
+    logits = act @ params["W2"].T + params["b2"]
+    return float((logits.argmax(axis=1) == np.array([r[0] for r in rows])).mean())
+
+
+# ══════════════════════════════════════════════════════════════════════════
+# OUTPUT
+# ══════════════════════════════════════════════════════════════════════════
+
+def c_array(ctype, name, values, per_line):
+    lines = [f"static const {ctype} {name}[] PROGMEM = {{"]
+    for i in range(0, len(values), per_line):
+        lines.append("  " + ", ".join(str(int(v)) for v in values[i:i + per_line]) + ",")
+    lines.append("};")
+    return "\n".join(lines)
+
+
+def write(q, dims, summary):
+    e = dims["EMBED"]
+    parts = [
+        "// Generated by tools/train_classifier.py from assets/classifier/events.tsv - do not edit",
+        f"// {summary}",
+        "",
+        '#include "text_classifier.h"',
+        "",
+        "#ifndef PROGMEM",
+        "#define PROGMEM",
+        "#endif",
+        "",
+        c_array("int8_t", "EMBED", q["E"].reshape(-1), e),
+        "",
+        c_array("int8_t", "HIDDEN_W", q["W1"].reshape(-1), e),
+        c_array("int32_t", "HIDDEN_B", q["b1"], dims["HIDDEN"]),
+        "",
+        c_array("int8_t", "OUT_W", q["W2"].reshape(-1), dims["HIDDEN"]),
+        c_array("int32_t", "OUT_B", q["b2"], len(CLASSES)),
+        "",
+        "const ClassifierModel CLASSIFIER_MODEL = {",
+        f"  EMBED, HIDDEN_W, HIDDEN_B, OUT_W, OUT_B, {q['mult']}, {q['shift']}, {q['logit_scale']!r}f",
+        "};",
+        "",
+    ]
+    with open(OUT_CPP, "w", encoding="utf-8") as f:
+        f.write("\n".join(parts))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    parser.add_argument("--epochs", type=int, default=600)
+    parser.add_argument("--seed", type=int, default=1)
+    args = parser.parse_args()
+
+    dims = shape()
+    rows = load(dims)
+    if len(rows) < 10:
+        sys.exit("train_classifier: not enough examples in " + DATA)
+    held = rows[::5]
+    kept = [r for i, r in enumerate(rows) if i % 5]
+
+    params = train(kept, dims, args.epochs, args.seed)
+    q = quantize(params, kept)
+    print(f"held out {len(held)}: float {float_accuracy(params, held, dims):.1%}, int8 {accuracy(q, held):.1%}")
+
+    params = train(rows, dims, args.epochs, args.seed)
+    q = quantize(params, rows)
+    train_acc = accuracy(q, rows)
+    size = dims["BUCKETS"] * dims["EMBED"] + dims["HIDDEN"] * (dims["EMBED"] + 4) + len(CLASSES) * (dims["HIDDEN"] + 4)
+    summary = f"{len(rows)} examples, int8 accuracy {train_acc:.1%} on them, {size} bytes"
+    print(f"all {len(rows)}: float {float_accuracy(params, rows, dims):.1%}, int8 {train_acc:.1%}, {size} bytes")
+    write(q, dims, summary)
+    print("wrote " + os.path.relpath(OUT_CPP, ROOT))
+
+
+if __name__ == "__main__":
+    main()